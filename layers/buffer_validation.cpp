@@ -21,6 +21,7 @@
  */
 
 #include <cmath>
+#include <limits>
 #include <set>
 #include <sstream>
 #include <string>
@@ -400,6 +401,48 @@ void CoreChecks::SetImageInitialLayout(CMD_BUFFER_STATE *cb_node, const IMAGE_ST
     SetImageInitialLayout(cb_node, image_state, RangeFromLayers(layers), layout);
 }
 
+// Set the initial image layout for a batch of non-normalized subresource ranges, normalizing them in place
+void CoreChecks::SetImageInitialLayout(CMD_BUFFER_STATE *cb_node, const IMAGE_STATE &image_state,
+                                       std::vector<VkImageSubresourceRange> *ranges, VkImageLayout layout) {
+    auto *subresource_map = GetImageSubresourceLayoutMap(cb_node, image_state);
+    assert(subresource_map);
+    for (auto &range : *ranges) {
+        range = NormalizeSubresourceRange(image_state, range);
+    }
+    subresource_map->SetSubresourceRangesInitialLayout(*cb_node, *ranges, layout);
+}
+
+template <typename RegionType>
+void CoreChecks::SetCopyImageInitialLayouts(CMD_BUFFER_STATE *cb_node, const IMAGE_STATE &src_image_state,
+                                            VkImageLayout src_layout, const IMAGE_STATE &dst_image_state,
+                                            VkImageLayout dst_layout, uint32_t region_count, const RegionType *regions) {
+    if ((&src_image_state == &dst_image_state) && (src_layout != dst_layout)) {
+        // The first layout recorded for a subresource wins, so keep the per region src, dst order
+        for (uint32_t i = 0; i < region_count; ++i) {
+            SetImageInitialLayout(cb_node, src_image_state, regions[i].srcSubresource, src_layout);
+            SetImageInitialLayout(cb_node, dst_image_state, regions[i].dstSubresource, dst_layout);
+        }
+        return;
+    }
+    std::vector<VkImageSubresourceRange> src_ranges(region_count);
+    std::vector<VkImageSubresourceRange> dst_ranges(region_count);
+    for (uint32_t i = 0; i < region_count; ++i) {
+        src_ranges[i] = RangeFromLayers(regions[i].srcSubresource);
+        dst_ranges[i] = RangeFromLayers(regions[i].dstSubresource);
+    }
+    SetImageInitialLayout(cb_node, src_image_state, &src_ranges, src_layout);
+    SetImageInitialLayout(cb_node, dst_image_state, &dst_ranges, dst_layout);
+}
+
+// Collects the image subresource of each buffer/image copy region as a subresource range
+static void GetBufferImageCopyRanges(uint32_t region_count, const VkBufferImageCopy *regions,
+                                     std::vector<VkImageSubresourceRange> *ranges) {
+    ranges->resize(region_count);
+    for (uint32_t i = 0; i < region_count; ++i) {
+        (*ranges)[i] = RangeFromLayers(regions[i].imageSubresource);
+    }
+}
+
 // Set image layout for all slices of an image view
 void CoreChecks::SetImageViewLayout(CMD_BUFFER_STATE *cb_node, const IMAGE_VIEW_STATE &view_state, VkImageLayout layout,
                                     VkImageLayout layoutStencil) {
@@ -1979,48 +2022,174 @@ void CoreChecks::PreCallRecordCmdClearDepthStencilImage(VkCommandBuffer commandB
     }
 }
 
-// Returns true if [x, xoffset] and [y, yoffset] overlap
-static bool RangesIntersect(int32_t start, uint32_t start_offset, int32_t end, uint32_t end_offset) {
-    bool result = false;
-    uint32_t intersection_min = std::max(static_cast<uint32_t>(start), static_cast<uint32_t>(end));
-    uint32_t intersection_max = std::min(static_cast<uint32_t>(start) + start_offset, static_cast<uint32_t>(end) + end_offset);
+// An axis-aligned box of memory covered by one side of a copy region, as half-open [begin, end) ranges over array layers (or,
+// for buffers, unused), z, y and x (or, for buffers, byte offset). Boxes can only overlap if their keys match.
+struct RegionBox {
+    static const int kDimensions = 4;
+    static const int kX = kDimensions - 1;
+    uint64_t key;
+    uint64_t begin[kDimensions];
+    uint64_t end[kDimensions];
+    uint32_t index;  // Of the region the box was made from
+};
 
-    if (intersection_max > intersection_min) {
-        result = true;
+// Returns the dimension along which the boxes overlap each other least: the one where the sum of their lengths is smallest
+// relative to the span they cover, i.e. where the fewest boxes cover an average point. Ties go to the later dimension.
+static int LeastOverlappingDimension(const std::vector<RegionBox> &a, const std::vector<RegionBox> &b) {
+    int best = RegionBox::kX;
+    double best_density = std::numeric_limits<double>::max();
+    for (int d = RegionBox::kX; d >= 0; --d) {
+        double length = 0.0;
+        uint64_t lowest = std::numeric_limits<uint64_t>::max();
+        uint64_t highest = 0;
+        for (const auto *boxes : {&a, &b}) {
+            for (const RegionBox &box : *boxes) {
+                length += static_cast<double>(box.end[d] - box.begin[d]);
+                lowest = std::min(lowest, box.begin[d]);
+                highest = std::max(highest, box.end[d]);
+            }
+        }
+        const double density = (highest > lowest) ? length / static_cast<double>(highest - lowest) : 0.0;
+        if (density < best_density) {
+            best = d;
+            best_density = density;
+        }
+    }
+    return best;
+}
+
+// Calls overlap(a_index, b_index) for each box in a that overlaps a box in b, until overlap returns false. Both sets are sorted
+// and swept together in order of key and then of the sweep dimension, each box only being tested against the boxes of the other
+// set that are still open at its start. Beyond the O(n log n) sort, the cost is proportional to the number of pairs that share
+// a key and overlap along the sweep dimension, so the dimension along which the boxes overlap least is swept. This is
+// output-sensitive rather than O(n log n) overall: regions that are disjoint along the sweep dimension (rows of an image,
+// layers, disjoint buffer ranges) are never compared, but n boxes that all overlap along every dimension except one they are
+// not swept on are compared pairwise.
+template <typename Overlap>
+static void ForEachRegionBoxOverlap(std::vector<RegionBox> &a, std::vector<RegionBox> &b, Overlap &&overlap) {
+    const int sweep = LeastOverlappingDimension(a, b);
+    auto sweep_order = [sweep](const RegionBox &lhs, const RegionBox &rhs) {
+        return (lhs.key < rhs.key) || ((lhs.key == rhs.key) && (lhs.begin[sweep] < rhs.begin[sweep]));
+    };
+    std::sort(a.begin(), a.end(), sweep_order);
+    std::sort(b.begin(), b.end(), sweep_order);
+
+    std::vector<const RegionBox *> open_a;
+    std::vector<const RegionBox *> open_b;
+    size_t next_a = 0;
+    size_t next_b = 0;
+    while ((next_a < a.size()) || (next_b < b.size())) {
+        const bool from_a = (next_b == b.size()) || ((next_a < a.size()) && !sweep_order(b[next_b], a[next_a]));
+        const RegionBox &box = from_a ? a[next_a++] : b[next_b++];
+        auto &others = from_a ? open_b : open_a;
+        // Boxes of the other set closed before this one starts cannot overlap it, or anything after it
+        size_t kept = 0;
+        for (const RegionBox *other : others) {
+            if ((other->key != box.key) || (other->end[sweep] <= box.begin[sweep])) continue;
+            others[kept++] = other;
+            bool intersects = true;
+            for (int d = 0; d < RegionBox::kDimensions; ++d) {
+                intersects &= std::max(box.begin[d], other->begin[d]) < std::min(box.end[d], other->end[d]);
+            }
+            if (intersects && !(from_a ? overlap(box.index, other->index) : overlap(other->index, box.index))) return;
+        }
+        others.resize(kept);
+        (from_a ? open_a : open_b).push_back(&box);
+    }
+}
+
+// Sets a dimension of box from an offset and extent, in the 32-bit unsigned arithmetic used for image coordinates. Returns
+// false if the range is empty or wraps, in which case the box cannot overlap anything.
+static bool SetRegionBoxRange(RegionBox *box, int dimension, uint32_t offset, uint32_t extent) {
+    const uint32_t end = offset + extent;
+    box->begin[dimension] = offset;
+    box->end[dimension] = end;
+    return end > offset;
+}
+
+// Fills in the box of one side of an image copy region, returning false if it is empty
+static bool MakeImageCopyBox(const VkImageSubresourceLayers &subresource, const VkOffset3D &offset, const VkExtent3D &extent,
+                             VkImageType type, bool is_multiplane, uint32_t index, RegionBox *box) {
+    // Separate planes within a multiplane image cannot intersect
+    box->key = (static_cast<uint64_t>(subresource.mipLevel) << 32) | (is_multiplane ? subresource.aspectMask : 0);
+    box->index = index;
+    if (!SetRegionBoxRange(box, 0, subresource.baseArrayLayer, subresource.layerCount)) return false;
+    // Dimensions that the image type lacks overlap for every region
+    for (int d = 1; d < RegionBox::kDimensions; ++d) {
+        box->begin[d] = 0;
+        box->end[d] = 1;
+    }
+    switch (type) {
+        case VK_IMAGE_TYPE_3D:
+            if (!SetRegionBoxRange(box, 1, static_cast<uint32_t>(offset.z), extent.depth)) return false;
+            // fall through
+        case VK_IMAGE_TYPE_2D:
+            if (!SetRegionBoxRange(box, 2, static_cast<uint32_t>(offset.y), extent.height)) return false;
+            // fall through
+        case VK_IMAGE_TYPE_1D:
+            return SetRegionBoxRange(box, 3, static_cast<uint32_t>(offset.x), extent.width);
+        default:
+            // Unrecognized or new IMAGE_TYPE enums will be caught in parameter_validation
+            assert(false);
+            return true;
     }
-    return result;
 }
 
-// Returns true if source area of first copy region intersects dest area of second region
+// Returns the (i, j) pairs, in order, for which the source area of pRegions[i] intersects the dest area of pRegions[j]
 // It is assumed that these are copy regions within a single image (otherwise no possibility of collision)
-static bool RegionIntersects(const VkImageCopy *rgn0, const VkImageCopy *rgn1, VkImageType type, bool is_multiplane) {
-    bool result = false;
-
-    // Separate planes within a multiplane image cannot intersect
-    if (is_multiplane && (rgn0->srcSubresource.aspectMask != rgn1->dstSubresource.aspectMask)) {
-        return result;
-    }
-
-    if ((rgn0->srcSubresource.mipLevel == rgn1->dstSubresource.mipLevel) &&
-        (RangesIntersect(rgn0->srcSubresource.baseArrayLayer, rgn0->srcSubresource.layerCount, rgn1->dstSubresource.baseArrayLayer,
-                         rgn1->dstSubresource.layerCount))) {
-        result = true;
-        switch (type) {
-            case VK_IMAGE_TYPE_3D:
-                result &= RangesIntersect(rgn0->srcOffset.z, rgn0->extent.depth, rgn1->dstOffset.z, rgn1->extent.depth);
-                // fall through
-            case VK_IMAGE_TYPE_2D:
-                result &= RangesIntersect(rgn0->srcOffset.y, rgn0->extent.height, rgn1->dstOffset.y, rgn1->extent.height);
-                // fall through
-            case VK_IMAGE_TYPE_1D:
-                result &= RangesIntersect(rgn0->srcOffset.x, rgn0->extent.width, rgn1->dstOffset.x, rgn1->extent.width);
-                break;
-            default:
-                // Unrecognized or new IMAGE_TYPE enums will be caught in parameter_validation
-                assert(false);
+static std::vector<std::pair<uint32_t, uint32_t>> GetImageCopyOverlaps(uint32_t region_count, const VkImageCopy *regions,
+                                                                      VkImageType type, bool is_multiplane) {
+    std::vector<RegionBox> src_boxes;
+    std::vector<RegionBox> dst_boxes;
+    src_boxes.reserve(region_count);
+    dst_boxes.reserve(region_count);
+    for (uint32_t i = 0; i < region_count; ++i) {
+        RegionBox box;
+        if (MakeImageCopyBox(regions[i].srcSubresource, regions[i].srcOffset, regions[i].extent, type, is_multiplane, i, &box)) {
+            src_boxes.push_back(box);
+        }
+        if (MakeImageCopyBox(regions[i].dstSubresource, regions[i].dstOffset, regions[i].extent, type, is_multiplane, i, &box)) {
+            dst_boxes.push_back(box);
         }
     }
-    return result;
+
+    std::vector<std::pair<uint32_t, uint32_t>> overlaps;
+    ForEachRegionBoxOverlap(src_boxes, dst_boxes, [&overlaps](uint32_t src_index, uint32_t dst_index) {
+        overlaps.emplace_back(src_index, dst_index);
+        return true;
+    });
+    std::sort(overlaps.begin(), overlaps.end());
+    return overlaps;
+}
+
+// Returns true if the source range of any region intersects the dest range of any region, within a single buffer
+static bool BufferCopyRegionsOverlap(uint32_t region_count, const VkBufferCopy *regions) {
+    std::vector<RegionBox> src_boxes;
+    std::vector<RegionBox> dst_boxes;
+    src_boxes.reserve(region_count);
+    dst_boxes.reserve(region_count);
+    for (uint32_t i = 0; i < region_count; ++i) {
+        RegionBox box = {};
+        box.index = i;
+        for (int d = 0; d < RegionBox::kX; ++d) {
+            box.end[d] = 1;
+        }
+        const int x = RegionBox::kX;
+        // Ranges that are empty or wrap are reported as out of bounds, not as overlaps
+        box.begin[x] = regions[i].srcOffset;
+        box.end[x] = regions[i].srcOffset + regions[i].size;
+        if (box.end[x] > box.begin[x]) src_boxes.push_back(box);
+        box.begin[x] = regions[i].dstOffset;
+        box.end[x] = regions[i].dstOffset + regions[i].size;
+        if (box.end[x] > box.begin[x]) dst_boxes.push_back(box);
+    }
+
+    bool overlap_found = false;
+    ForEachRegionBoxOverlap(src_boxes, dst_boxes, [&overlap_found](uint32_t, uint32_t) {
+        overlap_found = true;
+        return false;
+    });
+    return overlap_found;
 }
 
 // Returns non-zero if offset and extent exceed image extents
@@ -2822,19 +2991,18 @@ bool CoreChecks::PreCallValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkIm
                             "depth [%1d].",
                             i, region.dstOffset.z, dst_copy_extent.depth, subresource_extent.depth);
         }
+    }
 
-        // The union of all source regions, and the union of all destination regions, specified by the elements of regions,
-        // must not overlap in memory
-        if (src_image_state->image == dst_image_state->image) {
-            for (uint32_t j = 0; j < regionCount; j++) {
-                if (RegionIntersects(&region, &pRegions[j], src_image_state->createInfo.imageType,
-                                     FormatIsMultiplane(src_image_state->createInfo.format))) {
-                    std::stringstream ss;
-                    ss << "vkCmdCopyImage(): pRegions[" << i << "] src overlaps with pRegions[" << j << "].";
-                    skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                                    HandleToUint64(command_buffer), "VUID-vkCmdCopyImage-pRegions-00124", "%s.", ss.str().c_str());
-                }
-            }
+    // The union of all source regions, and the union of all destination regions, specified by the elements of regions,
+    // must not overlap in memory
+    if (src_image_state->image == dst_image_state->image) {
+        const auto overlaps = GetImageCopyOverlaps(regionCount, pRegions, src_image_state->createInfo.imageType,
+                                                   FormatIsMultiplane(src_image_state->createInfo.format));
+        for (const auto &overlap : overlaps) {
+            std::stringstream ss;
+            ss << "vkCmdCopyImage(): pRegions[" << overlap.first << "] src overlaps with pRegions[" << overlap.second << "].";
+            skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
+                            HandleToUint64(command_buffer), "VUID-vkCmdCopyImage-pRegions-00124", "%s.", ss.str().c_str());
         }
     }
 
@@ -2910,10 +3078,8 @@ void CoreChecks::PreCallRecordCmdCopyImage(VkCommandBuffer commandBuffer, VkImag
     auto dst_image_state = GetImageState(dstImage);
 
     // Make sure that all image slices are updated to correct layout
-    for (uint32_t i = 0; i < regionCount; ++i) {
-        SetImageInitialLayout(cb_node, *src_image_state, pRegions[i].srcSubresource, srcImageLayout);
-        SetImageInitialLayout(cb_node, *dst_image_state, pRegions[i].dstSubresource, dstImageLayout);
-    }
+    SetCopyImageInitialLayouts(cb_node, *src_image_state, srcImageLayout, *dst_image_state, dstImageLayout, regionCount,
+                               pRegions);
 }
 
 // Returns true if sub_rect is entirely contained within rect
@@ -3514,10 +3680,8 @@ void CoreChecks::PreCallRecordCmdBlitImage(VkCommandBuffer commandBuffer, VkImag
     auto dst_image_state = GetImageState(dstImage);
 
     // Make sure that all image slices are updated to correct layout
-    for (uint32_t i = 0; i < regionCount; ++i) {
-        SetImageInitialLayout(cb_node, *src_image_state, pRegions[i].srcSubresource, srcImageLayout);
-        SetImageInitialLayout(cb_node, *dst_image_state, pRegions[i].dstSubresource, dstImageLayout);
-    }
+    SetCopyImageInitialLayouts(cb_node, *src_image_state, srcImageLayout, *dst_image_state, dstImageLayout, regionCount,
+                               pRegions);
 }
 
 // This validates that the initial layout specified in the command buffer for the IMAGE is the same as the global IMAGE layout
@@ -4918,17 +5082,8 @@ static inline bool ValidateCmdCopyBufferBounds(const debug_report_data *report_d
 
     VkDeviceSize src_buffer_size = src_buffer_state->createInfo.size;
     VkDeviceSize dst_buffer_size = dst_buffer_state->createInfo.size;
-    VkDeviceSize src_min = UINT64_MAX;
-    VkDeviceSize src_max = 0;
-    VkDeviceSize dst_min = UINT64_MAX;
-    VkDeviceSize dst_max = 0;
 
     for (uint32_t i = 0; i < regionCount; i++) {
-        src_min = std::min(src_min, pRegions[i].srcOffset);
-        src_max = std::max(src_max, (pRegions[i].srcOffset + pRegions[i].size));
-        dst_min = std::min(dst_min, pRegions[i].dstOffset);
-        dst_max = std::max(dst_max, (pRegions[i].dstOffset + pRegions[i].size));
-
         // The srcOffset member of each element of pRegions must be less than the size of srcBuffer
         if (pRegions[i].srcOffset >= src_buffer_size) {
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT,
@@ -4970,7 +5125,7 @@ static inline bool ValidateCmdCopyBufferBounds(const debug_report_data *report_d
 
     // The union of the source regions, and the union of the destination regions, must not overlap in memory
     if (src_buffer_state->buffer == dst_buffer_state->buffer) {
-        if (((src_min > dst_min) && (src_min < dst_max)) || ((src_max > dst_min) && (src_max < dst_max))) {
+        if (BufferCopyRegionsOverlap(regionCount, pRegions)) {
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT,
                             HandleToUint64(src_buffer_state->buffer), "VUID-vkCmdCopyBuffer-pRegions-00117",
                             "vkCmdCopyBuffer(): Detected overlap between source and dest regions in memory.");
@@ -5013,7 +5168,7 @@ bool CoreChecks::ValidateIdleBuffer(VkBuffer buffer) const {
                         kVUID_Core_DrawState_DoubleDestroy, "Cannot free %s that has not been allocated.",
                         report_data->FormatHandle(buffer).c_str());
     } else {
-        if (buffer_state->in_use.load()) {
+        if (buffer_state->InUse()) {
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT,
                             HandleToUint64(buffer), "VUID-vkDestroyBuffer-buffer-00922",
                             "Cannot free %s that is in use by a command buffer.", report_data->FormatHandle(buffer).c_str());
@@ -5489,9 +5644,9 @@ void CoreChecks::PreCallRecordCmdCopyImageToBuffer(VkCommandBuffer commandBuffer
     auto cb_node = GetCBState(commandBuffer);
     auto src_image_state = GetImageState(srcImage);
     // Make sure that all image slices record referenced layout
-    for (uint32_t i = 0; i < regionCount; ++i) {
-        SetImageInitialLayout(cb_node, *src_image_state, pRegions[i].imageSubresource, srcImageLayout);
-    }
+    std::vector<VkImageSubresourceRange> ranges;
+    GetBufferImageCopyRanges(regionCount, pRegions, &ranges);
+    SetImageInitialLayout(cb_node, *src_image_state, &ranges, srcImageLayout);
 }
 
 bool CoreChecks::PreCallValidateCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage,
@@ -5566,9 +5721,9 @@ void CoreChecks::PreCallRecordCmdCopyBufferToImage(VkCommandBuffer commandBuffer
     auto cb_node = GetCBState(commandBuffer);
     auto dst_image_state = GetImageState(dstImage);
     // Make sure that all image slices are record referenced layout
-    for (uint32_t i = 0; i < regionCount; ++i) {
-        SetImageInitialLayout(cb_node, *dst_image_state, pRegions[i].imageSubresource, dstImageLayout);
-    }
+    std::vector<VkImageSubresourceRange> ranges;
+    GetBufferImageCopyRanges(regionCount, pRegions, &ranges);
+    SetImageInitialLayout(cb_node, *dst_image_state, &ranges, dstImageLayout);
 }
 
 bool CoreChecks::PreCallValidateGetImageSubresourceLayout(VkDevice device, VkImage image, const VkImageSubresource *pSubresource,
@@ -24,6 +24,9 @@ class CommandCounter : public ValidationObject {
     virtual ~CommandCounter() {}
 
     virtual write_lock_guard_t write_lock() { return coreChecks->write_lock(); }
+    virtual cmd_lock_guard_t cmd_read_lock() { return coreChecks->cmd_read_lock(); }
+    virtual cmd_lock_guard_t cmd_write_lock() { return coreChecks->cmd_write_lock(); }
+    virtual cmd_lock_guard_t cmd_local_write_lock() { return coreChecks->cmd_local_write_lock(); }
 
 #include "command_counter_helper.h"
 
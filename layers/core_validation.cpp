@@ -62,6 +62,11 @@
 #include "shader_validation.h"
 #include "vk_layer_utils.h"
 
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 // Array of command names indexed by CMD_TYPE enum
 static const std::array<const char *, CMD_RANGE_SIZE> command_name_list = {{VUID_CMD_NAME_LIST}};
 
@@ -101,6 +106,77 @@ bool PipelineLayoutCompatDef::operator==(const PipelineLayoutCompatDef &other) c
     return true;
 }
 
+PipelineVertexInputDef::PipelineVertexInputDef(const VkPipelineVertexInputStateCreateInfo *vertex_input_state) {
+    if (!vertex_input_state) return;
+    bindings.assign(vertex_input_state->pVertexBindingDescriptions,
+                    vertex_input_state->pVertexBindingDescriptions + vertex_input_state->vertexBindingDescriptionCount);
+    binding_to_index.reserve(bindings.size());
+    for (uint32_t i = 0; i < bindings.size(); ++i) {
+        binding_to_index.emplace_back(bindings[i].binding, i);
+    }
+    // Binding numbers are unique in a valid pipeline; should an invalid one repeat a binding, lookups find its first description
+    std::stable_sort(
+        binding_to_index.begin(), binding_to_index.end(),
+        [](const std::pair<uint32_t, uint32_t> &a, const std::pair<uint32_t, uint32_t> &b) { return a.first < b.first; });
+
+    attributes.assign(vertex_input_state->pVertexAttributeDescriptions,
+                      vertex_input_state->pVertexAttributeDescriptions + vertex_input_state->vertexAttributeDescriptionCount);
+    attribute_alignments.reserve(attributes.size());
+    for (const auto &attribute : attributes) {
+        VkDeviceSize vtx_attrib_req_alignment = FormatElementSize(attribute.format);
+        if (FormatElementIsTexel(attribute.format)) {
+            vtx_attrib_req_alignment = SafeDivision(vtx_attrib_req_alignment, FormatChannelCount(attribute.format));
+        }
+        attribute_alignments.push_back(vtx_attrib_req_alignment);
+    }
+}
+
+const uint32_t *PipelineVertexInputDef::FindBindingIndex(uint32_t binding) const {
+    auto it = std::lower_bound(binding_to_index.cbegin(), binding_to_index.cend(), binding,
+                               [](const std::pair<uint32_t, uint32_t> &entry, uint32_t value) { return entry.first < value; });
+    return ((it != binding_to_index.cend()) && (it->first == binding)) ? &it->second : nullptr;
+}
+
+// The alignments and binding index are derived from the descriptions, so only those take part in hash and equality
+size_t PipelineVertexInputDef::hash() const {
+    hash_util::HashCombiner hc;
+    hc.Combine(bindings).Combine(attributes);
+    return hc.Value();
+}
+
+bool PipelineVertexInputDef::operator==(const PipelineVertexInputDef &other) const {
+    return (bindings == other.bindings) && (attributes == other.attributes);
+}
+
+PipelineColorBlendDef::PipelineColorBlendDef(const VkPipelineColorBlendStateCreateInfo *color_blend_state) {
+    if (!color_blend_state) return;
+    attachments.assign(color_blend_state->pAttachments, color_blend_state->pAttachments + color_blend_state->attachmentCount);
+    // If any attachment used by this pipeline has blendEnable, set top-level blendEnable. Computed here rather than at bind
+    // time so that binding never writes to the (shared) pipeline state.
+    for (const auto &attachment : attachments) {
+        if (VK_TRUE == attachment.blendEnable) {
+            if (((attachment.dstAlphaBlendFactor >= VK_BLEND_FACTOR_CONSTANT_COLOR) &&
+                 (attachment.dstAlphaBlendFactor <= VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_ALPHA)) ||
+                ((attachment.dstColorBlendFactor >= VK_BLEND_FACTOR_CONSTANT_COLOR) &&
+                 (attachment.dstColorBlendFactor <= VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_ALPHA)) ||
+                ((attachment.srcAlphaBlendFactor >= VK_BLEND_FACTOR_CONSTANT_COLOR) &&
+                 (attachment.srcAlphaBlendFactor <= VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_ALPHA)) ||
+                ((attachment.srcColorBlendFactor >= VK_BLEND_FACTOR_CONSTANT_COLOR) &&
+                 (attachment.srcColorBlendFactor <= VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_ALPHA))) {
+                blend_constants_enabled = true;
+            }
+        }
+    }
+}
+
+size_t PipelineColorBlendDef::hash() const {
+    hash_util::HashCombiner hc;
+    hc.Combine(attachments);
+    return hc.Value();
+}
+
+bool PipelineColorBlendDef::operator==(const PipelineColorBlendDef &other) const { return attachments == other.attachments; }
+
 using std::max;
 using std::string;
 using std::stringstream;
@@ -366,7 +442,7 @@ bool CoreChecks::ValidateDrawStateFlags(const CMD_BUFFER_STATE *pCB, const PIPEL
         result |= ValidateStatus(pCB, CBSTATUS_DEPTH_BIAS_SET, VK_DEBUG_REPORT_ERROR_BIT_EXT,
                                  "Dynamic depth bias state not set for this command buffer", msg_code);
     }
-    if (pPipe->blendConstantsEnabled) {
+    if (pPipe->color_blend->blend_constants_enabled) {
         result |= ValidateStatus(pCB, CBSTATUS_BLEND_CONSTANTS_SET, VK_DEBUG_REPORT_ERROR_BIT_EXT,
                                  "Dynamic blend constants state not set for this command buffer", msg_code);
     }
@@ -560,9 +636,10 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, co
     const auto &current_vtx_bfr_binding_info = pCB->current_vertex_buffer_binding_info.vertex_buffer_bindings;
 
     // Verify vertex binding
-    if (pPipeline->vertex_binding_descriptions_.size() > 0) {
-        for (size_t i = 0; i < pPipeline->vertex_binding_descriptions_.size(); i++) {
-            const auto vertex_binding = pPipeline->vertex_binding_descriptions_[i].binding;
+    const auto &vertex_input = *pPipeline->vertex_input;
+    if (vertex_input.bindings.size() > 0) {
+        for (size_t i = 0; i < vertex_input.bindings.size(); i++) {
+            const auto vertex_binding = vertex_input.bindings[i].binding;
             if ((current_vtx_bfr_binding_info.size() < (vertex_binding + 1)) ||
                 (current_vtx_bfr_binding_info[vertex_binding].buffer == VK_NULL_HANDLE)) {
                 skip |=
@@ -576,22 +653,21 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, co
         }
 
         // Verify vertex attribute address alignment
-        for (size_t i = 0; i < pPipeline->vertex_attribute_descriptions_.size(); i++) {
-            const auto &attribute_description = pPipeline->vertex_attribute_descriptions_[i];
+        for (size_t i = 0; i < vertex_input.attributes.size(); i++) {
+            const auto &attribute_description = vertex_input.attributes[i];
             const auto vertex_binding = attribute_description.binding;
             const auto attribute_offset = attribute_description.offset;
 
-            const auto &vertex_binding_map_it = pPipeline->vertex_binding_to_index_map_.find(vertex_binding);
-            if ((vertex_binding_map_it != pPipeline->vertex_binding_to_index_map_.cend()) &&
-                (vertex_binding < current_vtx_bfr_binding_info.size()) &&
+            const uint32_t *vertex_binding_index = vertex_input.FindBindingIndex(vertex_binding);
+            if (vertex_binding_index && (vertex_binding < current_vtx_bfr_binding_info.size()) &&
                 (current_vtx_bfr_binding_info[vertex_binding].buffer != VK_NULL_HANDLE)) {
-                const auto vertex_buffer_stride = pPipeline->vertex_binding_descriptions_[vertex_binding_map_it->second].stride;
+                const auto vertex_buffer_stride = vertex_input.bindings[*vertex_binding_index].stride;
                 const auto vertex_buffer_offset = current_vtx_bfr_binding_info[vertex_binding].offset;
 
                 // Use 1 as vertex/instance index to use buffer stride as well
                 const auto attrib_address = vertex_buffer_offset + vertex_buffer_stride + attribute_offset;
 
-                VkDeviceSize vtx_attrib_req_alignment = pPipeline->vertex_attribute_alignments_[i];
+                VkDeviceSize vtx_attrib_req_alignment = vertex_input.attribute_alignments[i];
 
                 if (SafeModulo(attrib_address, vtx_attrib_req_alignment) != 0) {
                     skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT,
@@ -611,8 +687,8 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, co
     if ((!pPipeline->graphicsPipelineCI.pRasterizationState ||
          (pPipeline->graphicsPipelineCI.pRasterizationState->rasterizerDiscardEnable == VK_FALSE)) &&
         pPipeline->graphicsPipelineCI.pViewportState) {
-        bool dynViewport = IsDynamic(pPipeline, VK_DYNAMIC_STATE_VIEWPORT);
-        bool dynScissor = IsDynamic(pPipeline, VK_DYNAMIC_STATE_SCISSOR);
+        bool dynViewport = !(pPipeline->static_state_mask & CBSTATUS_VIEWPORT_SET);
+        bool dynScissor = !(pPipeline->static_state_mask & CBSTATUS_SCISSOR_SET);
 
         if (dynViewport) {
             const auto requiredViewportsMask = (1 << pPipeline->graphicsPipelineCI.pViewportState->viewportCount) - 1;
@@ -936,7 +1012,7 @@ bool CoreChecks::ValidatePipelineLocked(std::vector<std::shared_ptr<PIPELINE_STA
             pBasePipeline = GetPipelineState(pPipeline->graphicsPipelineCI.basePipelineHandle);
         }
 
-        if (pBasePipeline && !(pBasePipeline->graphicsPipelineCI.flags & VK_PIPELINE_CREATE_ALLOW_DERIVATIVES_BIT)) {
+        if (pBasePipeline && !(pBasePipeline->getPipelineCreateFlags() & VK_PIPELINE_CREATE_ALLOW_DERIVATIVES_BIT)) {
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT,
                             HandleToUint64(device), kVUID_Core_DrawState_InvalidPipelineCreateState,
                             "Invalid Pipeline CreateInfo: base pipeline does not allow derivatives.");
@@ -974,9 +1050,9 @@ bool CoreChecks::ValidatePipelineUnlocked(const PIPELINE_STATE *pPipeline, uint3
                         subpass_desc->colorAttachmentCount, color_blend_state->attachmentCount);
         }
         if (!enabled_features.core.independentBlend) {
-            if (pPipeline->attachments.size() > 1) {
-                const VkPipelineColorBlendAttachmentState *const pAttachments = &pPipeline->attachments[0];
-                for (size_t i = 1; i < pPipeline->attachments.size(); i++) {
+            if (pPipeline->color_blend->attachments.size() > 1) {
+                const VkPipelineColorBlendAttachmentState *const pAttachments = &pPipeline->color_blend->attachments[0];
+                for (size_t i = 1; i < pPipeline->color_blend->attachments.size(); i++) {
                     // Quoting the spec: "If [the independent blend] feature is not enabled, the VkPipelineColorBlendAttachmentState
                     // settings for all color attachments must be identical." VkPipelineColorBlendAttachmentState contains
                     // only attachment state, so memcmp is best suited for the comparison
@@ -997,11 +1073,11 @@ bool CoreChecks::ValidatePipelineUnlocked(const PIPELINE_STATE *pPipeline, uint3
                         "VUID-VkPipelineColorBlendStateCreateInfo-logicOpEnable-00606",
                         "Invalid Pipeline CreateInfo: If logic operations feature not enabled, logicOpEnable must be VK_FALSE.");
         }
-        for (size_t i = 0; i < pPipeline->attachments.size(); i++) {
-            if ((pPipeline->attachments[i].srcColorBlendFactor == VK_BLEND_FACTOR_SRC1_COLOR) ||
-                (pPipeline->attachments[i].srcColorBlendFactor == VK_BLEND_FACTOR_ONE_MINUS_SRC1_COLOR) ||
-                (pPipeline->attachments[i].srcColorBlendFactor == VK_BLEND_FACTOR_SRC1_ALPHA) ||
-                (pPipeline->attachments[i].srcColorBlendFactor == VK_BLEND_FACTOR_ONE_MINUS_SRC1_ALPHA)) {
+        for (size_t i = 0; i < pPipeline->color_blend->attachments.size(); i++) {
+            if ((pPipeline->color_blend->attachments[i].srcColorBlendFactor == VK_BLEND_FACTOR_SRC1_COLOR) ||
+                (pPipeline->color_blend->attachments[i].srcColorBlendFactor == VK_BLEND_FACTOR_ONE_MINUS_SRC1_COLOR) ||
+                (pPipeline->color_blend->attachments[i].srcColorBlendFactor == VK_BLEND_FACTOR_SRC1_ALPHA) ||
+                (pPipeline->color_blend->attachments[i].srcColorBlendFactor == VK_BLEND_FACTOR_ONE_MINUS_SRC1_ALPHA)) {
                 if (!enabled_features.core.dualSrcBlend) {
                     skip |=
                         log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT,
@@ -1009,13 +1085,13 @@ bool CoreChecks::ValidatePipelineUnlocked(const PIPELINE_STATE *pPipeline, uint3
                                 "vkCreateGraphicsPipelines(): pPipelines[%d].pColorBlendState.pAttachments[" PRINTF_SIZE_T_SPECIFIER
                                 "].srcColorBlendFactor uses a dual-source blend factor (%d), but this device feature is not "
                                 "enabled.",
-                                pipelineIndex, i, pPipeline->attachments[i].srcColorBlendFactor);
+                                pipelineIndex, i, pPipeline->color_blend->attachments[i].srcColorBlendFactor);
                 }
             }
-            if ((pPipeline->attachments[i].dstColorBlendFactor == VK_BLEND_FACTOR_SRC1_COLOR) ||
-                (pPipeline->attachments[i].dstColorBlendFactor == VK_BLEND_FACTOR_ONE_MINUS_SRC1_COLOR) ||
-                (pPipeline->attachments[i].dstColorBlendFactor == VK_BLEND_FACTOR_SRC1_ALPHA) ||
-                (pPipeline->attachments[i].dstColorBlendFactor == VK_BLEND_FACTOR_ONE_MINUS_SRC1_ALPHA)) {
+            if ((pPipeline->color_blend->attachments[i].dstColorBlendFactor == VK_BLEND_FACTOR_SRC1_COLOR) ||
+                (pPipeline->color_blend->attachments[i].dstColorBlendFactor == VK_BLEND_FACTOR_ONE_MINUS_SRC1_COLOR) ||
+                (pPipeline->color_blend->attachments[i].dstColorBlendFactor == VK_BLEND_FACTOR_SRC1_ALPHA) ||
+                (pPipeline->color_blend->attachments[i].dstColorBlendFactor == VK_BLEND_FACTOR_ONE_MINUS_SRC1_ALPHA)) {
                 if (!enabled_features.core.dualSrcBlend) {
                     skip |=
                         log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT,
@@ -1023,13 +1099,13 @@ bool CoreChecks::ValidatePipelineUnlocked(const PIPELINE_STATE *pPipeline, uint3
                                 "vkCreateGraphicsPipelines(): pPipelines[%d].pColorBlendState.pAttachments[" PRINTF_SIZE_T_SPECIFIER
                                 "].dstColorBlendFactor uses a dual-source blend factor (%d), but this device feature is not "
                                 "enabled.",
-                                pipelineIndex, i, pPipeline->attachments[i].dstColorBlendFactor);
+                                pipelineIndex, i, pPipeline->color_blend->attachments[i].dstColorBlendFactor);
                 }
             }
-            if ((pPipeline->attachments[i].srcAlphaBlendFactor == VK_BLEND_FACTOR_SRC1_COLOR) ||
-                (pPipeline->attachments[i].srcAlphaBlendFactor == VK_BLEND_FACTOR_ONE_MINUS_SRC1_COLOR) ||
-                (pPipeline->attachments[i].srcAlphaBlendFactor == VK_BLEND_FACTOR_SRC1_ALPHA) ||
-                (pPipeline->attachments[i].srcAlphaBlendFactor == VK_BLEND_FACTOR_ONE_MINUS_SRC1_ALPHA)) {
+            if ((pPipeline->color_blend->attachments[i].srcAlphaBlendFactor == VK_BLEND_FACTOR_SRC1_COLOR) ||
+                (pPipeline->color_blend->attachments[i].srcAlphaBlendFactor == VK_BLEND_FACTOR_ONE_MINUS_SRC1_COLOR) ||
+                (pPipeline->color_blend->attachments[i].srcAlphaBlendFactor == VK_BLEND_FACTOR_SRC1_ALPHA) ||
+                (pPipeline->color_blend->attachments[i].srcAlphaBlendFactor == VK_BLEND_FACTOR_ONE_MINUS_SRC1_ALPHA)) {
                 if (!enabled_features.core.dualSrcBlend) {
                     skip |=
                         log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT,
@@ -1037,13 +1113,13 @@ bool CoreChecks::ValidatePipelineUnlocked(const PIPELINE_STATE *pPipeline, uint3
                                 "vkCreateGraphicsPipelines(): pPipelines[%d].pColorBlendState.pAttachments[" PRINTF_SIZE_T_SPECIFIER
                                 "].srcAlphaBlendFactor uses a dual-source blend factor (%d), but this device feature is not "
                                 "enabled.",
-                                pipelineIndex, i, pPipeline->attachments[i].srcAlphaBlendFactor);
+                                pipelineIndex, i, pPipeline->color_blend->attachments[i].srcAlphaBlendFactor);
                 }
             }
-            if ((pPipeline->attachments[i].dstAlphaBlendFactor == VK_BLEND_FACTOR_SRC1_COLOR) ||
-                (pPipeline->attachments[i].dstAlphaBlendFactor == VK_BLEND_FACTOR_ONE_MINUS_SRC1_COLOR) ||
-                (pPipeline->attachments[i].dstAlphaBlendFactor == VK_BLEND_FACTOR_SRC1_ALPHA) ||
-                (pPipeline->attachments[i].dstAlphaBlendFactor == VK_BLEND_FACTOR_ONE_MINUS_SRC1_ALPHA)) {
+            if ((pPipeline->color_blend->attachments[i].dstAlphaBlendFactor == VK_BLEND_FACTOR_SRC1_COLOR) ||
+                (pPipeline->color_blend->attachments[i].dstAlphaBlendFactor == VK_BLEND_FACTOR_ONE_MINUS_SRC1_COLOR) ||
+                (pPipeline->color_blend->attachments[i].dstAlphaBlendFactor == VK_BLEND_FACTOR_SRC1_ALPHA) ||
+                (pPipeline->color_blend->attachments[i].dstAlphaBlendFactor == VK_BLEND_FACTOR_ONE_MINUS_SRC1_ALPHA)) {
                 if (!enabled_features.core.dualSrcBlend) {
                     skip |=
                         log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT,
@@ -1051,7 +1127,7 @@ bool CoreChecks::ValidatePipelineUnlocked(const PIPELINE_STATE *pPipeline, uint3
                                 "vkCreateGraphicsPipelines(): pPipelines[%d].pColorBlendState.pAttachments[" PRINTF_SIZE_T_SPECIFIER
                                 "].dstAlphaBlendFactor uses a dual-source blend factor (%d), but this device feature is not "
                                 "enabled.",
-                                pipelineIndex, i, pPipeline->attachments[i].dstAlphaBlendFactor);
+                                pipelineIndex, i, pPipeline->color_blend->attachments[i].dstAlphaBlendFactor);
                 }
             }
         }
@@ -1480,7 +1556,7 @@ bool CoreChecks::ValidateIdleDescriptorSet(VkDescriptorSet set, const char *func
                         "Cannot call %s() on %s that has not been allocated.", func_str, report_data->FormatHandle(set).c_str());
     } else {
         // TODO : This covers various error cases so should pass error enum into this function and use passed in enum here
-        if (set_node->second->in_use.load()) {
+        if (set_node->second->InUse()) {
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT,
                             HandleToUint64(set), "VUID-vkFreeDescriptorSets-pDescriptorSets-00309",
                             "Cannot call %s() on %s that is in use by a command buffer.", func_str,
@@ -1538,9 +1614,10 @@ static char const *GetCauseStr(VulkanTypedHandle obj) {
     return "destroyed";
 }
 
-bool CoreChecks::ReportInvalidCommandBuffer(const CMD_BUFFER_STATE *cb_state, const char *call_source) const {
+bool CoreChecks::ReportBrokenBindings(const CMD_BUFFER_STATE *cb_state, const std::vector<VulkanTypedHandle> &broken_bindings,
+                                      const char *call_source) const {
     bool skip = false;
-    for (auto obj : cb_state->broken_bindings) {
+    for (auto obj : broken_bindings) {
         const char *cause_str = GetCauseStr(obj);
         string VUID;
         string_sprintf(&VUID, "%s-%s", kVUID_Core_DrawState_InvalidCommandBuffer, object_string[obj.type]);
@@ -1553,6 +1630,21 @@ bool CoreChecks::ReportInvalidCommandBuffer(const CMD_BUFFER_STATE *cb_state, co
     return skip;
 }
 
+// Reports the objects whose destruction or modification invalidated cb_state, including those not yet noticed by the state
+// tracker (see ValidationStateTracker::GetStaleBindings)
+bool CoreChecks::ReportInvalidCommandBuffer(const CMD_BUFFER_STATE *cb_state, const char *call_source) const {
+    std::vector<VulkanTypedHandle> broken_bindings = cb_state->broken_bindings;
+    GetStaleBindings(cb_state, &broken_bindings);
+    return ReportBrokenBindings(cb_state, broken_bindings, call_source);
+}
+
+// Reports only the bound objects destroyed or modified since the state tracker last checked cb_state's bindings
+bool CoreChecks::ReportStaleBindings(const CMD_BUFFER_STATE *cb_state, const char *call_source) const {
+    std::vector<VulkanTypedHandle> stale_bindings;
+    GetStaleBindings(cb_state, &stale_bindings);
+    return ReportBrokenBindings(cb_state, stale_bindings, call_source);
+}
+
 // 'commandBuffer must be in the recording state' valid usage error code for each command
 // Autogenerated as part of the vk_validation_error_message.h codegen
 static const std::array<const char *, CMD_RANGE_SIZE> must_be_recording_list = {{VUID_MUST_BE_RECORDING_LIST}};
@@ -1753,6 +1845,9 @@ void CoreChecks::PostCallRecordCreateDevice(VkPhysicalDevice gpu, const VkDevice
         [core_checks](CMD_BUFFER_STATE *cb_node, const IMAGE_VIEW_STATE &iv_state, VkImageLayout layout) -> void {
             core_checks->SetImageViewInitialLayout(cb_node, iv_state, layout);
         });
+
+    const std::string host_write_tracking = getLayerOption("khronos_validation.host_write_tracking");
+    core_checks->host_write_tracking = (host_write_tracking == "true");
 }
 
 void CoreChecks::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
@@ -1801,48 +1896,11 @@ bool CoreChecks::ValidateStageMaskGsTsEnables(VkPipelineStageFlags stageMask, co
 
 // Note: This function assumes that the global lock is held by the calling thread.
 // For the given queue, verify the queue state up to the given seq number.
-// Currently the only check is to make sure that if there are events to be waited on prior to
-//  a QueryReset, make sure that all such events have been signalled.
+// The submissions retired along with initial_seq are, for each queue, those through the seq in that submission's
+// dependency_seqs, so there's no need to follow semaphore waits from queue to queue to find them. Currently none of those
+// submissions have anything left to verify.
 bool CoreChecks::VerifyQueueStateToSeq(const QUEUE_STATE *initial_queue, uint64_t initial_seq) const {
     bool skip = false;
-
-    // sequence number we want to validate up to, per queue
-    std::unordered_map<const QUEUE_STATE *, uint64_t> target_seqs{{initial_queue, initial_seq}};
-    // sequence number we've completed validation for, per queue
-    std::unordered_map<const QUEUE_STATE *, uint64_t> done_seqs;
-    std::vector<const QUEUE_STATE *> worklist{initial_queue};
-
-    while (worklist.size()) {
-        auto queue = worklist.back();
-        worklist.pop_back();
-
-        auto target_seq = target_seqs[queue];
-        auto seq = std::max(done_seqs[queue], queue->seq);
-        auto sub_it = queue->submissions.begin() + int(seq - queue->seq);  // seq >= queue->seq
-
-        for (; seq < target_seq; ++sub_it, ++seq) {
-            for (auto &wait : sub_it->waitSemaphores) {
-                auto other_queue = GetQueueState(wait.queue);
-
-                if (other_queue == queue) continue;  // semaphores /always/ point backwards, so no point here.
-
-                auto other_target_seq = std::max(target_seqs[other_queue], wait.seq);
-                auto other_done_seq = std::max(done_seqs[other_queue], other_queue->seq);
-
-                // if this wait is for another queue, and covers new sequence
-                // numbers beyond what we've already validated, mark the new
-                // target seq and (possibly-re)add the queue to the worklist.
-                if (other_done_seq < other_target_seq) {
-                    target_seqs[other_queue] = other_target_seq;
-                    worklist.push_back(other_queue);
-                }
-            }
-        }
-
-        // finally mark the point we've now validated this queue to.
-        done_seqs[queue] = seq;
-    }
-
     return skip;
 }
 
@@ -1857,7 +1915,7 @@ bool CoreChecks::VerifyQueueStateToFence(VkFence fence) const {
 
 bool CoreChecks::ValidateCommandBufferSimultaneousUse(const CMD_BUFFER_STATE *pCB, int current_submit_count) const {
     bool skip = false;
-    if ((pCB->in_use.load() || current_submit_count > 1) &&
+    if ((pCB->InUse() || current_submit_count > 1) &&
         !(pCB->beginInfo.flags & VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT)) {
         skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT, 0,
                         "VUID-vkQueueSubmit-pCommandBuffers-00071", "%s is already in use and is not marked for simultaneous use.",
@@ -1902,6 +1960,8 @@ bool CoreChecks::ValidateCommandBufferState(const CMD_BUFFER_STATE *cb_state, co
             break;
 
         default: /* recorded */
+            // Bound objects destroyed or modified since recording are only noticed here
+            skip |= ReportStaleBindings(cb_state, call_source);
             break;
     }
     return skip;
@@ -1948,16 +2008,17 @@ bool CoreChecks::ValidateQueueFamilyIndices(const CMD_BUFFER_STATE *pCB, VkQueue
         }
 
         // Ensure that any bound images or buffers created with SHARING_MODE_CONCURRENT have access to the current queue family
-        for (const auto &object : pCB->object_bindings) {
+        for (const auto &binding : pCB->object_bindings) {
+            const auto &object = binding.object;
             if (object.type == kVulkanObjectTypeImage) {
-                auto image_state = object.node ? (IMAGE_STATE *)object.node : GetImageState(object.Cast<VkImage>());
+                auto image_state = static_cast<const IMAGE_STATE *>(GetBoundObjectState(pCB, binding));
                 if (image_state && image_state->createInfo.sharingMode == VK_SHARING_MODE_CONCURRENT) {
                     skip |= ValidImageBufferQueue(pCB, object, queue_state->queueFamilyIndex,
                                                   image_state->createInfo.queueFamilyIndexCount,
                                                   image_state->createInfo.pQueueFamilyIndices);
                 }
             } else if (object.type == kVulkanObjectTypeBuffer) {
-                auto buffer_state = object.node ? (BUFFER_STATE *)object.node : GetBufferState(object.Cast<VkBuffer>());
+                auto buffer_state = static_cast<const BUFFER_STATE *>(GetBoundObjectState(pCB, binding));
                 if (buffer_state && buffer_state->createInfo.sharingMode == VK_SHARING_MODE_CONCURRENT) {
                     skip |= ValidImageBufferQueue(pCB, object, queue_state->queueFamilyIndex,
                                                   buffer_state->createInfo.queueFamilyIndexCount,
@@ -2098,10 +2159,29 @@ bool CoreChecks::ValidateFenceForSubmit(const FENCE_STATE *pFence) const {
     return skip;
 }
 
+void CoreChecks::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence) {
+    for (const auto mem : host_write_tracked_memory) {
+        auto mem_info = GetDevMemState(mem);
+        if (mem_info) RecordHostWritesNotInUse(mem_info);
+    }
+}
+
 void CoreChecks::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
                                            VkResult result) {
     StateTracker::PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, result);
 
+    // Watch for host writes from here on, while the work just submitted may be using the memory
+    for (auto it = host_write_tracked_memory.begin(); it != host_write_tracked_memory.end();) {
+        const auto mem_info = GetDevMemState(*it);
+        if (mem_info && mem_info->host_writes) {
+            mem_info->host_writes->Protect();
+            ++it;
+        } else {
+            // Freed while still mapped
+            it = host_write_tracked_memory.erase(it);
+        }
+    }
+
     // The triply nested for duplicates that in the StateTracker, but avoids the need for two additional callbacks.
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
         const VkSubmitInfo *submit = &pSubmits[submit_idx];
@@ -2385,6 +2465,11 @@ bool CoreChecks::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount,
         }
     }
 
+    for (const auto mem : host_write_tracked_memory) {
+        const auto mem_info = GetDevMemState(mem);
+        if (mem_info) skip |= ValidateHostWritesNotInUse(mem_info, "vkQueueSubmit");
+    }
+
     return skip;
 }
 
@@ -2924,7 +3009,7 @@ bool CoreChecks::ValidateObjectNotInUse(const BASE_NODE *obj_node, const VulkanT
                                         const char *error_code) const {
     if (disabled.object_in_use) return false;
     bool skip = false;
-    if (obj_node->in_use.load()) {
+    if (obj_node->InUse()) {
         skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, get_debug_report_enum[obj_struct.type], obj_struct.handle,
                         error_code, "Cannot call %s on %s that is currently in use by a command buffer.", caller_name,
                         report_data->FormatHandle(obj_struct).c_str());
@@ -2986,6 +3071,77 @@ bool CoreChecks::ValidateMapMemRange(const DEVICE_MEMORY_STATE *mem_info, VkDevi
 // Guard value for pad data
 static char NoncoherentMemoryFillValue = 0xb;
 
+// True if every byte of data is NoncoherentMemoryFillValue. Compares a word at a time without branching, which compilers
+// vectorize.
+static bool IsNoncoherentMemoryFill(const char *data, size_t size) {
+    uint64_t fill_word;
+    memset(&fill_word, NoncoherentMemoryFillValue, sizeof(fill_word));
+    uint64_t difference = 0;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, data + i, sizeof(word));
+        difference |= word ^ fill_word;
+    }
+    for (; i < size; ++i) {
+        difference |= static_cast<uint8_t>(data[i] ^ NoncoherentMemoryFillValue);
+    }
+    return difference == 0;
+}
+
+// Allocates at least size bytes of zeroed, page aligned memory, between two inaccessible pages so that writes well past the
+// guard bands fault rather than corrupt the heap. The system zeroes pages as they are first touched, so mapping a large
+// allocation costs little until it is written. Falls back to calloc, with *allocation_size 0, where pages can't be reserved.
+static char *AllocateShadowMemory(size_t size, size_t *allocation_size) {
+#ifdef _WIN32
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+    const size_t page_size = system_info.dwPageSize;
+#else
+    const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+    const size_t region_size = (size + page_size - 1) & ~(page_size - 1);
+    const size_t total_size = region_size + 2 * page_size;
+    char *region = nullptr;
+#ifdef _WIN32
+    char *base = static_cast<char *>(VirtualAlloc(nullptr, total_size, MEM_RESERVE, PAGE_NOACCESS));
+    if (base) {
+        region = static_cast<char *>(VirtualAlloc(base + page_size, region_size, MEM_COMMIT, PAGE_READWRITE));
+        if (!region) VirtualFree(base, 0, MEM_RELEASE);
+    }
+#else
+    void *base = mmap(nullptr, total_size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base != MAP_FAILED) {
+        region = static_cast<char *>(base) + page_size;
+        if (mprotect(region, region_size, PROT_READ | PROT_WRITE) != 0) {
+            munmap(base, total_size);
+            region = nullptr;
+        }
+    }
+#endif
+    if (region) {
+        *allocation_size = total_size;
+        return region;
+    }
+    *allocation_size = 0;
+    return static_cast<char *>(calloc(1, size));
+}
+
+static void FreeShadowMemory(void *region, size_t allocation_size) {
+    if (!allocation_size) {
+        free(region);
+        return;
+    }
+#ifdef _WIN32
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+    VirtualFree(static_cast<char *>(region) - system_info.dwPageSize, 0, MEM_RELEASE);
+#else
+    const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    munmap(static_cast<char *>(region) - page_size, allocation_size);
+#endif
+}
+
 void CoreChecks::InitializeShadowMemory(VkDeviceMemory mem, VkDeviceSize offset, VkDeviceSize size, void **ppData) {
     auto mem_info = GetDevMemState(mem);
     if (mem_info) {
@@ -3004,18 +3160,33 @@ void CoreChecks::InitializeShadowMemory(VkDeviceMemory mem, VkDeviceSize offset,
             // From spec: (ppData - offset) must be aligned to at least limits::minMemoryMapAlignment.
             uint64_t start_offset = offset % map_alignment;
             // Data passed to driver will be wrapped by a guardband of data to detect over- or under-writes.
-            mem_info->shadow_copy_base =
-                malloc(static_cast<size_t>(2 * mem_info->shadow_pad_size + size + map_alignment + start_offset));
-
-            mem_info->shadow_copy =
-                reinterpret_cast<char *>((reinterpret_cast<uintptr_t>(mem_info->shadow_copy_base) + map_alignment) &
-                                         ~(map_alignment - 1)) +
-                start_offset;
+            const uint64_t shadow_size = 2 * mem_info->shadow_pad_size + size;
+            const uint64_t region_size = shadow_size + map_alignment + start_offset;
+            char *region = AllocateShadowMemory(static_cast<size_t>(region_size), &mem_info->shadow_copy_size);
+            mem_info->shadow_copy_base = region;
+
+            // Place the shadow copy as late in the region as alignment allows, so that an overflow past the guard band soon
+            // reaches the inaccessible page after it
+            const uintptr_t region_end = reinterpret_cast<uintptr_t>(region) + static_cast<uintptr_t>(region_size);
+            mem_info->shadow_copy = reinterpret_cast<char *>(
+                ((region_end - static_cast<uintptr_t>(shadow_size + start_offset)) & ~static_cast<uintptr_t>(map_alignment - 1)) +
+                static_cast<uintptr_t>(start_offset));
             assert(SafeModulo(reinterpret_cast<uintptr_t>(mem_info->shadow_copy) + mem_info->shadow_pad_size - start_offset,
                               map_alignment) == 0);
 
-            memset(mem_info->shadow_copy, NoncoherentMemoryFillValue, static_cast<size_t>(2 * mem_info->shadow_pad_size + size));
-            *ppData = static_cast<char *>(mem_info->shadow_copy) + mem_info->shadow_pad_size;
+            // Only the guard bands need filling; the data starts out zeroed
+            char *data = static_cast<char *>(mem_info->shadow_copy);
+            memset(data, NoncoherentMemoryFillValue, static_cast<size_t>(mem_info->shadow_pad_size));
+            memset(data + mem_info->shadow_pad_size + size, NoncoherentMemoryFillValue,
+                   static_cast<size_t>(mem_info->shadow_pad_size));
+            *ppData = data + mem_info->shadow_pad_size;
+
+            // Pages can only be protected when the shadow copy has pages of its own
+            if (host_write_tracking && mem_info->shadow_copy_size) {
+                mem_info->host_writes =
+                    HostWriteTracker::Create(region, mem_info->shadow_copy_size - 2 * HostWriteTracker::PageSize());
+                if (mem_info->host_writes) host_write_tracked_memory.insert(mem);
+            }
         }
     }
 }
@@ -3174,13 +3345,12 @@ bool CoreChecks::ValidatePerformanceQueryResults(const char *cmd_name, const QUE
                         cmd_name, report_data->FormatHandle(query_pool_state->pool).c_str(), invalid_flags_string.c_str());
     }
 
-    QueryObject query_obj{query_pool_state->pool, 0u};
-    for (uint32_t queryIndex = firstQuery; queryIndex < queryCount; queryIndex++) {
-        query_obj.query = queryIndex;
+    const uint32_t end_query = static_cast<uint32_t>(
+        std::min(static_cast<uint64_t>(firstQuery) + queryCount, static_cast<uint64_t>(query_pool_state->createInfo.queryCount)));
+    for (uint32_t queryIndex = firstQuery; queryIndex < end_query; queryIndex++) {
         uint32_t submitted = 0;
         for (uint32_t passIndex = 0; passIndex < query_pool_state->n_performance_passes; passIndex++) {
-            auto query_pass_iter = queryPassToStateMap.find(QueryObjectPass(query_obj, passIndex));
-            if (query_pass_iter != queryPassToStateMap.end() && query_pass_iter->second == QUERYSTATE_AVAILABLE) submitted++;
+            if (query_pool_state->GetPassState(queryIndex, passIndex) == QUERYSTATE_AVAILABLE) submitted++;
         }
         if (submitted < query_pool_state->n_performance_passes) {
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_QUERY_POOL_EXT, 0,
@@ -3234,14 +3404,15 @@ bool CoreChecks::ValidateGetQueryPoolResultsFlags(VkQueryPool queryPool, VkQuery
 
 bool CoreChecks::ValidateGetQueryPoolResultsQueries(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) const {
     bool skip = false;
-    QueryObject query_obj{queryPool, 0u};
+    const QUERY_POOL_STATE *query_pool_state = GetQueryPoolState(queryPool);
+    const uint32_t known_query_count = query_pool_state ? static_cast<uint32_t>(query_pool_state->query_states.size()) : 0;
     for (uint32_t i = 0; i < queryCount; ++i) {
-        query_obj.query = firstQuery + i;
-        if (queryToStateMap.count(query_obj) == 0) {
+        const uint32_t query = firstQuery + i;
+        if (query >= known_query_count) {
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_QUERY_POOL_EXT,
                             HandleToUint64(queryPool), kVUID_Core_DrawState_InvalidQuery,
                             "vkGetQueryPoolResults() on %s and query %" PRIu32 ": unknown query",
-                            report_data->FormatHandle(queryPool).c_str(), query_obj.query);
+                            report_data->FormatHandle(queryPool).c_str(), query);
         }
     }
     return skip;
@@ -3536,7 +3707,7 @@ bool CoreChecks::PreCallValidateDestroyDescriptorPool(VkDevice device, VkDescrip
 // This function is only valid at a point when cmdBuffer is being reset or freed
 bool CoreChecks::CheckCommandBufferInFlight(const CMD_BUFFER_STATE *cb_node, const char *action, const char *error_code) const {
     bool skip = false;
-    if (cb_node->in_use.load()) {
+    if (cb_node->InUse()) {
         skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
                         HandleToUint64(cb_node->commandBuffer), error_code, "Attempt to %s %s which is in use.", action,
                         report_data->FormatHandle(cb_node->commandBuffer).c_str());
@@ -3729,9 +3900,9 @@ bool CoreChecks::ValidatePipelineVertexDivisors(std::vector<std::shared_ptr<PIPE
 
             // Find the corresponding binding description and validate input rate setting
             bool failed_01871 = true;
-            for (size_t k = 0; k < pipe_state->vertex_binding_descriptions_.size(); k++) {
-                if ((vibdd->binding == pipe_state->vertex_binding_descriptions_[k].binding) &&
-                    (VK_VERTEX_INPUT_RATE_INSTANCE == pipe_state->vertex_binding_descriptions_[k].inputRate)) {
+            for (size_t k = 0; k < pipe_state->vertex_input->bindings.size(); k++) {
+                if ((vibdd->binding == pipe_state->vertex_input->bindings[k].binding) &&
+                    (VK_VERTEX_INPUT_RATE_INSTANCE == pipe_state->vertex_input->bindings[k].inputRate)) {
                     failed_01871 = false;
                     break;
                 }
@@ -4519,7 +4690,7 @@ bool CoreChecks::PreCallValidateResetDescriptorPool(VkDevice device, VkDescripto
     const DESCRIPTOR_POOL_STATE *pPool = GetDescriptorPoolState(descriptorPool);
     if (pPool != nullptr) {
         for (auto ds : pPool->sets) {
-            if (ds && ds->in_use.load()) {
+            if (ds && ds->InUse()) {
                 skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_POOL_EXT,
                                 HandleToUint64(descriptorPool), "VUID-vkResetDescriptorPool-descriptorPool-00313",
                                 "It is invalid to call vkResetDescriptorPool() with descriptor sets in use by a command buffer.");
@@ -4583,7 +4754,7 @@ bool CoreChecks::PreCallValidateBeginCommandBuffer(VkCommandBuffer commandBuffer
     const CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     if (!cb_state) return false;
     bool skip = false;
-    if (cb_state->in_use.load()) {
+    if (cb_state->InUse()) {
         skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
                         HandleToUint64(commandBuffer), "VUID-vkBeginCommandBuffer-commandBuffer-00049",
                         "Calling vkBeginCommandBuffer() on active %s before it has completed. You must check "
@@ -4676,6 +4847,10 @@ bool CoreChecks::PreCallValidateEndCommandBuffer(VkCommandBuffer commandBuffer)
     }
 
     skip |= ValidateCmd(cb_state, CMD_ENDCOMMANDBUFFER, "vkEndCommandBuffer()");
+    if (cb_state->state == CB_RECORDING) {
+        // Bound objects destroyed or modified while recording are not checked per command
+        skip |= ReportStaleBindings(cb_state, "vkEndCommandBuffer()");
+    }
     for (auto query : cb_state->activeQueries) {
         skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
                         HandleToUint64(commandBuffer), "VUID-vkEndCommandBuffer-commandBuffer-00061",
@@ -6883,6 +7058,11 @@ bool CoreChecks::PreCallValidateCmdResetQueryPool(VkCommandBuffer commandBuffer,
     skip |= ValidateCmd(cb_state, CMD_RESETQUERYPOOL, "VkCmdResetQueryPool()");
     skip |= ValidateCmdQueueFlags(cb_state, "VkCmdResetQueryPool()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
                                   "VUID-vkCmdResetQueryPool-commandBuffer-cmdpool");
+    const QUERY_POOL_STATE *query_pool_state = GetQueryPoolState(queryPool);
+    if (query_pool_state) {
+        skip |= ValidateQueryRange(device, queryPool, query_pool_state->createInfo.queryCount, firstQuery, queryCount,
+                                   "VUID-vkCmdResetQueryPool-firstQuery-00796", "VUID-vkCmdResetQueryPool-firstQuery-00797");
+    }
     return skip;
 }
 
@@ -9171,7 +9351,7 @@ bool CoreChecks::PreCallValidateCmdExecuteCommands(VkCommandBuffer commandBuffer
         skip |= ValidateCommandBufferState(sub_cb_state, "vkCmdExecuteCommands()", 0,
                                            "VUID-vkCmdExecuteCommands-pCommandBuffers-00089");
         if (!(sub_cb_state->beginInfo.flags & VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT)) {
-            if (sub_cb_state->in_use.load()) {
+            if (sub_cb_state->InUse()) {
                 skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
                                 HandleToUint64(cb_state->commandBuffer), "VUID-vkCmdExecuteCommands-pCommandBuffers-00091",
                                 "Cannot execute pending %s without VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT set.",
@@ -9297,15 +9477,21 @@ bool CoreChecks::PreCallValidateUnmapMemory(VkDevice device, VkDeviceMemory mem)
                         HandleToUint64(mem), "VUID-vkUnmapMemory-memory-00689", "Unmapping Memory without memory being mapped: %s.",
                         report_data->FormatHandle(mem).c_str());
     }
+    if (mem_info) skip |= ValidateHostWritesNotInUse(mem_info, "vkUnmapMemory");
     return skip;
 }
 
 void CoreChecks::PreCallRecordUnmapMemory(VkDevice device, VkDeviceMemory mem) {
     // Only core checks uses the shadow copy, clear that up here
     auto mem_info = GetDevMemState(mem);
+    if (mem_info && mem_info->host_writes) {
+        mem_info->host_writes.reset();
+        host_write_tracked_memory.erase(mem);
+    }
     if (mem_info && mem_info->shadow_copy_base) {
-        free(mem_info->shadow_copy_base);
+        FreeShadowMemory(mem_info->shadow_copy_base, mem_info->shadow_copy_size);
         mem_info->shadow_copy_base = nullptr;
+        mem_info->shadow_copy_size = 0;
         mem_info->shadow_copy = nullptr;
         mem_info->shadow_pad_size = 0;
     }
@@ -9345,48 +9531,135 @@ bool CoreChecks::ValidateMemoryIsMapped(const char *funcName, uint32_t memRangeC
     return skip;
 }
 
-bool CoreChecks::ValidateAndCopyNoncoherentMemoryToDriver(uint32_t mem_range_count, const VkMappedMemoryRange *mem_ranges) const {
+// The part of the mapped data that range covers, clamped to the mapping, as an offset from the start of the mapping and a size
+static void GetMappedRangeExtent(const DEVICE_MEMORY_STATE *mem_info, const VkMappedMemoryRange &range, VkDeviceSize *offset,
+                                 VkDeviceSize *size) {
+    const VkDeviceSize mapped_offset = mem_info->mapped_range.offset;
+    const VkDeviceSize mapped_size = (mem_info->mapped_range.size != VK_WHOLE_SIZE)
+                                         ? mem_info->mapped_range.size
+                                         : (mem_info->alloc_info.allocationSize - mapped_offset);
+    const VkDeviceSize begin = std::min(mapped_size, range.offset > mapped_offset ? range.offset - mapped_offset : 0);
+    VkDeviceSize end = mapped_size;
+    if (range.size != VK_WHOLE_SIZE) {
+        const VkDeviceSize range_end = range.offset + range.size;
+        end = std::min(mapped_size, range_end > mapped_offset ? range_end - mapped_offset : 0);
+    }
+    *offset = begin;
+    *size = end > begin ? end - begin : 0;
+}
+
+// The guard bands wrap the whole mapping rather than each range, so they are checked once per memory object even when several
+// ranges of it are flushed together
+bool CoreChecks::ValidateNoncoherentMemoryGuardBands(uint32_t mem_range_count, const VkMappedMemoryRange *mem_ranges) const {
     bool skip = false;
     for (uint32_t i = 0; i < mem_range_count; ++i) {
+        bool checked = false;
+        for (uint32_t j = 0; j < i && !checked; ++j) checked = (mem_ranges[j].memory == mem_ranges[i].memory);
         auto mem_info = GetDevMemState(mem_ranges[i].memory);
-        if (mem_info) {
+        if (mem_info && !checked) {
             if (mem_info->shadow_copy) {
                 VkDeviceSize size = (mem_info->mapped_range.size != VK_WHOLE_SIZE)
                                         ? mem_info->mapped_range.size
                                         : (mem_info->alloc_info.allocationSize - mem_info->mapped_range.offset);
                 char *data = static_cast<char *>(mem_info->shadow_copy);
-                for (uint64_t j = 0; j < mem_info->shadow_pad_size; ++j) {
-                    if (data[j] != NoncoherentMemoryFillValue) {
-                        skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT,
-                                        HandleToUint64(mem_ranges[i].memory), kVUID_Core_MemTrack_InvalidMap,
-                                        "Memory underflow was detected on %s.",
-                                        report_data->FormatHandle(mem_ranges[i].memory).c_str());
-                    }
+                const size_t pad_size = static_cast<size_t>(mem_info->shadow_pad_size);
+                if (!IsNoncoherentMemoryFill(data, pad_size)) {
+                    skip |=
+                        log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT,
+                                HandleToUint64(mem_ranges[i].memory), kVUID_Core_MemTrack_InvalidMap,
+                                "Memory underflow was detected on %s.", report_data->FormatHandle(mem_ranges[i].memory).c_str());
                 }
-                for (uint64_t j = (size + mem_info->shadow_pad_size); j < (2 * mem_info->shadow_pad_size + size); ++j) {
-                    if (data[j] != NoncoherentMemoryFillValue) {
-                        skip |=
-                            log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT,
-                                    HandleToUint64(mem_ranges[i].memory), kVUID_Core_MemTrack_InvalidMap,
-                                    "Memory overflow was detected on %s.", report_data->FormatHandle(mem_ranges[i].memory).c_str());
-                    }
+                if (!IsNoncoherentMemoryFill(data + pad_size + size, pad_size)) {
+                    skip |=
+                        log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT,
+                                HandleToUint64(mem_ranges[i].memory), kVUID_Core_MemTrack_InvalidMap,
+                                "Memory overflow was detected on %s.", report_data->FormatHandle(mem_ranges[i].memory).c_str());
                 }
-                memcpy(mem_info->p_driver_data, static_cast<void *>(data + mem_info->shadow_pad_size), (size_t)(size));
             }
         }
     }
     return skip;
 }
 
+// Only the flushed range goes to the driver, and with host write tracking only the pages written in it. This runs from
+// PreCallRecord, under the exclusive lock, as Sync() clears dirty bits and a concurrent flush of the same memory could
+// otherwise copy a page to the driver while another thread is copying it too.
+void CoreChecks::CopyNoncoherentMemoryToDriver(uint32_t mem_range_count, const VkMappedMemoryRange *mem_ranges) {
+    for (uint32_t i = 0; i < mem_range_count; ++i) {
+        auto mem_info = GetDevMemState(mem_ranges[i].memory);
+        if (mem_info && mem_info->shadow_copy) {
+            VkDeviceSize copy_offset, copy_size;
+            GetMappedRangeExtent(mem_info, mem_ranges[i], &copy_offset, &copy_size);
+            char *data = static_cast<char *>(mem_info->shadow_copy) + mem_info->shadow_pad_size;
+            if (mem_info->host_writes) {
+                mem_info->host_writes->Sync(data + copy_offset, static_cast<size_t>(copy_size),
+                                            static_cast<char *>(mem_info->p_driver_data) + copy_offset);
+            } else {
+                memcpy(static_cast<char *>(mem_info->p_driver_data) + copy_offset, data + copy_offset,
+                       static_cast<size_t>(copy_size));
+            }
+        }
+    }
+}
+
+// With host write tracking, the objects the host wrote to since the last queue submission that are still in use by submitted
+// work. Writes are seen a page at a time, so objects sharing a written page are included along with the one written.
+std::vector<VulkanTypedHandle> CoreChecks::GetHostWritesInUse(const DEVICE_MEMORY_STATE *mem_info) const {
+    std::vector<VulkanTypedHandle> written_in_use;
+    const HostWriteTracker *host_writes = mem_info->host_writes.get();
+    if (!host_writes || !mem_info->InUse() || !host_writes->HasWrites()) return written_in_use;
+
+    const char *data = static_cast<const char *>(mem_info->shadow_copy) + mem_info->shadow_pad_size;
+    const VkDeviceSize size = (mem_info->mapped_range.size != VK_WHOLE_SIZE)
+                                  ? mem_info->mapped_range.size
+                                  : (mem_info->alloc_info.allocationSize - mem_info->mapped_range.offset);
+    host_writes->ForEachWrittenRange(data, static_cast<size_t>(size), [&](size_t offset, size_t written_size) {
+        mem_info->bound_ranges.ForEachOverlapping(
+            mem_info->mapped_range.offset + offset, written_size, [&](const VulkanTypedHandle &handle) {
+                const BINDABLE *bindable = GetObjectMemBinding(handle);
+                if (bindable && bindable->InUse() &&
+                    std::find(written_in_use.begin(), written_in_use.end(), handle) == written_in_use.end()) {
+                    written_in_use.push_back(handle);
+                }
+            });
+    });
+    return written_in_use;
+}
+
+// Reports the host writes to objects still in use, once per submission: RecordHostWritesNotInUse marks them reported, and
+// the next submission's Protect() clears that again.
+bool CoreChecks::ValidateHostWritesNotInUse(const DEVICE_MEMORY_STATE *mem_info, const char *api_name) const {
+    bool skip = false;
+    if (!mem_info->host_writes || mem_info->host_writes->Reported()) return skip;
+    for (const auto &handle : GetHostWritesInUse(mem_info)) {
+        skip |= log_msg(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT,
+                        HandleToUint64(mem_info->mem), kVUID_Core_MemTrack_HostWriteInUse,
+                        "%s: Since the last vkQueueSubmit, the host wrote to %s through mapped %s while it is in use by a "
+                        "submitted command buffer.",
+                        api_name, report_data->FormatHandle(handle).c_str(), report_data->FormatHandle(mem_info->mem).c_str());
+    }
+    return skip;
+}
+
+void CoreChecks::RecordHostWritesNotInUse(DEVICE_MEMORY_STATE *mem_info) {
+    if (!mem_info->host_writes || mem_info->host_writes->Reported()) return;
+    if (!GetHostWritesInUse(mem_info).empty()) mem_info->host_writes->SetReported();
+}
+
 void CoreChecks::CopyNoncoherentMemoryFromDriver(uint32_t mem_range_count, const VkMappedMemoryRange *mem_ranges) {
     for (uint32_t i = 0; i < mem_range_count; ++i) {
         auto mem_info = GetDevMemState(mem_ranges[i].memory);
         if (mem_info && mem_info->shadow_copy) {
-            VkDeviceSize size = (mem_info->mapped_range.size != VK_WHOLE_SIZE)
-                                    ? mem_info->mapped_range.size
-                                    : (mem_info->alloc_info.allocationSize - mem_ranges[i].offset);
-            char *data = static_cast<char *>(mem_info->shadow_copy);
-            memcpy(data + mem_info->shadow_pad_size, mem_info->p_driver_data, (size_t)(size));
+            VkDeviceSize copy_offset, copy_size;
+            GetMappedRangeExtent(mem_info, mem_ranges[i], &copy_offset, &copy_size);
+            char *data = static_cast<char *>(mem_info->shadow_copy) + mem_info->shadow_pad_size;
+            if (mem_info->host_writes) {
+                mem_info->host_writes->CopyIn(data + copy_offset, static_cast<char *>(mem_info->p_driver_data) + copy_offset,
+                                              static_cast<size_t>(copy_size));
+            } else {
+                memcpy(data + copy_offset, static_cast<char *>(mem_info->p_driver_data) + copy_offset,
+                       static_cast<size_t>(copy_size));
+            }
         }
     }
 }
@@ -9423,11 +9696,24 @@ bool CoreChecks::PreCallValidateFlushMappedMemoryRanges(VkDevice device, uint32_
                                                         const VkMappedMemoryRange *pMemRanges) const {
     bool skip = false;
     skip |= ValidateMappedMemoryRangeDeviceLimits("vkFlushMappedMemoryRanges", memRangeCount, pMemRanges);
-    skip |= ValidateAndCopyNoncoherentMemoryToDriver(memRangeCount, pMemRanges);
+    for (uint32_t i = 0; i < memRangeCount; ++i) {
+        const auto mem_info = GetDevMemState(pMemRanges[i].memory);
+        if (mem_info) skip |= ValidateHostWritesNotInUse(mem_info, "vkFlushMappedMemoryRanges");
+    }
+    skip |= ValidateNoncoherentMemoryGuardBands(memRangeCount, pMemRanges);
     skip |= ValidateMemoryIsMapped("vkFlushMappedMemoryRanges", memRangeCount, pMemRanges);
     return skip;
 }
 
+void CoreChecks::PreCallRecordFlushMappedMemoryRanges(VkDevice device, uint32_t memRangeCount,
+                                                      const VkMappedMemoryRange *pMemRanges) {
+    for (uint32_t i = 0; i < memRangeCount; ++i) {
+        auto mem_info = GetDevMemState(pMemRanges[i].memory);
+        if (mem_info) RecordHostWritesNotInUse(mem_info);
+    }
+    CopyNoncoherentMemoryToDriver(memRangeCount, pMemRanges);
+}
+
 bool CoreChecks::PreCallValidateInvalidateMappedMemoryRanges(VkDevice device, uint32_t memRangeCount,
                                                              const VkMappedMemoryRange *pMemRanges) const {
     bool skip = false;
@@ -11025,10 +11311,11 @@ bool CoreChecks::ValidateQueryRange(VkDevice device, VkQueryPool queryPool, uint
                         firstQuery, totalCount, report_data->FormatHandle(queryPool).c_str());
     }
 
-    if ((firstQuery + queryCount) > totalCount) {
+    const uint64_t end_query = static_cast<uint64_t>(firstQuery) + queryCount;
+    if (end_query > totalCount) {
         skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT, HandleToUint64(device),
-                        vuid_badrange, "Query range [%" PRIu32 ", %" PRIu32 ") goes beyond query pool count (%" PRIu32 ") for %s",
-                        firstQuery, firstQuery + queryCount, totalCount, report_data->FormatHandle(queryPool).c_str());
+                        vuid_badrange, "Query range [%" PRIu32 ", %" PRIu64 ") goes beyond query pool count (%" PRIu32 ") for %s",
+                        firstQuery, end_query, totalCount, report_data->FormatHandle(queryPool).c_str());
     }
 
     return skip;
@@ -11196,6 +11483,24 @@ bool CoreChecks::ValidateCmdDrawStrideWithBuffer(VkCommandBuffer commandBuffer,
     return skip;
 }
 
+// Dictionaries of the canonical forms of the vertex input and color blend state shared between pipelines
+static PipelineVertexInputDict pipeline_vertex_input_dict;
+static PipelineColorBlendDict pipeline_color_blend_dict;
+
+static PipelineVertexInputId GetCanonicalId(const safe_VkPipelineVertexInputStateCreateInfo *vertex_input_state) {
+    return pipeline_vertex_input_dict.look_up(PipelineVertexInputDef(vertex_input_state ? vertex_input_state->ptr() : nullptr));
+}
+
+static PipelineColorBlendId GetCanonicalId(const safe_VkPipelineColorBlendStateCreateInfo *color_blend_state) {
+    return pipeline_color_blend_dict.look_up(PipelineColorBlendDef(color_blend_state ? color_blend_state->ptr() : nullptr));
+}
+
+// Non-graphics pipelines share the empty entries, so vertex_input and color_blend are never null
+void PIPELINE_STATE::SetEmptyGraphicsState() {
+    vertex_input = pipeline_vertex_input_dict.look_up(PipelineVertexInputDef());
+    color_blend = pipeline_color_blend_dict.look_up(PipelineColorBlendDef());
+}
+
 void PIPELINE_STATE::initGraphicsPipeline(const ValidationStateTracker *state_data, const VkGraphicsPipelineCreateInfo *pCreateInfo,
                                           std::shared_ptr<const RENDER_PASS_STATE> &&rpstate) {
     reset();
@@ -11215,7 +11520,9 @@ void PIPELINE_STATE::initGraphicsPipeline(const ValidationStateTracker *state_da
             uses_depthstencil_attachment = true;
         }
     }
-    graphicsPipelineCI.initialize(pCreateInfo, uses_color_attachment, uses_depthstencil_attachment);
+    new (&graphicsPipelineCI)
+        safe_VkGraphicsPipelineCreateInfo(pCreateInfo, uses_color_attachment, uses_depthstencil_attachment);
+    pipeline_type = VK_PIPELINE_BIND_POINT_GRAPHICS;
     if (graphicsPipelineCI.pInputAssemblyState) {
         topology_at_rasterizer = graphicsPipelineCI.pInputAssemblyState->topology;
     }
@@ -11228,43 +11535,17 @@ void PIPELINE_STATE::initGraphicsPipeline(const ValidationStateTracker *state_da
         state_data->RecordPipelineShaderStage(pPSSCI, this, &stage_state[i]);
     }
 
-    if (graphicsPipelineCI.pVertexInputState) {
-        const auto pVICI = graphicsPipelineCI.pVertexInputState;
-        if (pVICI->vertexBindingDescriptionCount) {
-            this->vertex_binding_descriptions_ = std::vector<VkVertexInputBindingDescription>(
-                pVICI->pVertexBindingDescriptions, pVICI->pVertexBindingDescriptions + pVICI->vertexBindingDescriptionCount);
-
-            this->vertex_binding_to_index_map_.reserve(pVICI->vertexBindingDescriptionCount);
-            for (uint32_t i = 0; i < pVICI->vertexBindingDescriptionCount; ++i) {
-                this->vertex_binding_to_index_map_[pVICI->pVertexBindingDescriptions[i].binding] = i;
-            }
-        }
-        if (pVICI->vertexAttributeDescriptionCount) {
-            this->vertex_attribute_descriptions_ = std::vector<VkVertexInputAttributeDescription>(
-                pVICI->pVertexAttributeDescriptions, pVICI->pVertexAttributeDescriptions + pVICI->vertexAttributeDescriptionCount);
-            for (uint32_t i = 0; i < pVICI->vertexAttributeDescriptionCount; ++i) {
-                const auto attribute_format = pVICI->pVertexAttributeDescriptions[i].format;
-                VkDeviceSize vtx_attrib_req_alignment = FormatElementSize(attribute_format);
-                if (FormatElementIsTexel(attribute_format)) {
-                    vtx_attrib_req_alignment = SafeDivision(vtx_attrib_req_alignment, FormatChannelCount(attribute_format));
-                }
-                this->vertex_attribute_alignments_.push_back(vtx_attrib_req_alignment);
-            }
-        }
-    }
-    if (graphicsPipelineCI.pColorBlendState) {
-        const auto pCBCI = graphicsPipelineCI.pColorBlendState;
-        if (pCBCI->attachmentCount) {
-            this->attachments =
-                std::vector<VkPipelineColorBlendAttachmentState>(pCBCI->pAttachments, pCBCI->pAttachments + pCBCI->attachmentCount);
-        }
-    }
+    vertex_input = GetCanonicalId(graphicsPipelineCI.pVertexInputState);
+    color_blend = GetCanonicalId(graphicsPipelineCI.pColorBlendState);
+    static_state_mask = MakeStaticStateMask(graphicsPipelineCI.ptr()->pDynamicState);
     rp_state = rpstate;
 }
 
 void PIPELINE_STATE::initComputePipeline(const ValidationStateTracker *state_data, const VkComputePipelineCreateInfo *pCreateInfo) {
     reset();
-    computePipelineCI.initialize(pCreateInfo);
+    new (&computePipelineCI) safe_VkComputePipelineCreateInfo(pCreateInfo);
+    pipeline_type = VK_PIPELINE_BIND_POINT_COMPUTE;
+    SetEmptyGraphicsState();
     switch (computePipelineCI.stage.stage) {
         case VK_SHADER_STAGE_COMPUTE_BIT:
             this->active_shaders |= VK_SHADER_STAGE_COMPUTE_BIT;
@@ -11280,7 +11561,9 @@ void PIPELINE_STATE::initComputePipeline(const ValidationStateTracker *state_dat
 void PIPELINE_STATE::initRayTracingPipelineNV(const ValidationStateTracker *state_data,
                                               const VkRayTracingPipelineCreateInfoNV *pCreateInfo) {
     reset();
-    raytracingPipelineCI.initialize(pCreateInfo);
+    new (&raytracingPipelineCI) safe_VkRayTracingPipelineCreateInfoNV(pCreateInfo);
+    pipeline_type = VK_PIPELINE_BIND_POINT_RAY_TRACING_NV;
+    SetEmptyGraphicsState();
 
     stage_state.resize(pCreateInfo->stageCount);
     for (uint32_t stage_index = 0; stage_index < pCreateInfo->stageCount; stage_index++) {
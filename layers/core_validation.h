@@ -39,6 +39,17 @@ class CoreChecks : public ValidationStateTracker {
     using ImageSubresPairLayoutMap = std::unordered_map<ImageSubresourcePair, IMAGE_LAYOUT_STATE>;
     ImageSubresPairLayoutMap imageLayoutMap;
 
+    // khronos_validation.host_write_tracking: shadow copies of non-coherent mappings track the pages the host writes
+    bool host_write_tracking = false;
+    std::unordered_set<VkDeviceMemory> host_write_tracked_memory;  // Mapped memory with a HostWriteTracker
+
+    // Recording a command writes only the state of the command buffer being recorded, which the application must externally
+    // synchronize, so it takes the object-wide lock shared rather than exclusive. It still reads device-level state (descriptor
+    // sets, events, pipelines, bound objects) that device-level calls modify or destroy under the exclusive lock. Commands that
+    // only set state of the command buffer itself read nothing else while recording and take no lock for it.
+    virtual cmd_lock_guard_t cmd_write_lock() { return {read_lock(), write_lock_guard_t()}; }
+    virtual cmd_lock_guard_t cmd_local_write_lock() { return cmd_lock_guard_t(); }
+
     void IncrementCommandCount(VkCommandBuffer commandBuffer);
 
     bool VerifyQueueStateToSeq(const QUEUE_STATE* initial_queue, uint64_t initial_seq) const;
@@ -88,7 +99,10 @@ class CoreChecks : public ValidationStateTracker {
                                       const char* error_code) const;
     bool ValidateRenderPassCompatibility(const char* type1_string, const RENDER_PASS_STATE* rp1_state, const char* type2_string,
                                          const RENDER_PASS_STATE* rp2_state, const char* caller, const char* error_code) const;
+    bool ReportBrokenBindings(const CMD_BUFFER_STATE* cb_state, const std::vector<VulkanTypedHandle>& broken_bindings,
+                              const char* call_source) const;
     bool ReportInvalidCommandBuffer(const CMD_BUFFER_STATE* cb_state, const char* call_source) const;
+    bool ReportStaleBindings(const CMD_BUFFER_STATE* cb_state, const char* call_source) const;
     bool ValidateQueueFamilyIndex(const PHYSICAL_DEVICE_STATE* pd_state, uint32_t requested_queue_family, const char* err_code,
                                   const char* cmd_name, const char* queue_family_var_name) const;
     bool ValidateDeviceQueueCreateInfos(const PHYSICAL_DEVICE_STATE* pd_state, uint32_t info_count,
@@ -123,8 +137,12 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidatePipelineBindPoint(const CMD_BUFFER_STATE* cb_state, VkPipelineBindPoint bind_point, const char* func_name,
                                    const std::map<VkPipelineBindPoint, std::string>& bind_errors) const;
     bool ValidateMemoryIsMapped(const char* funcName, uint32_t memRangeCount, const VkMappedMemoryRange* pMemRanges) const;
-    bool ValidateAndCopyNoncoherentMemoryToDriver(uint32_t mem_range_count, const VkMappedMemoryRange* mem_ranges) const;
+    bool ValidateNoncoherentMemoryGuardBands(uint32_t mem_range_count, const VkMappedMemoryRange* mem_ranges) const;
+    void CopyNoncoherentMemoryToDriver(uint32_t mem_range_count, const VkMappedMemoryRange* mem_ranges);
     void CopyNoncoherentMemoryFromDriver(uint32_t mem_range_count, const VkMappedMemoryRange* mem_ranges);
+    std::vector<VulkanTypedHandle> GetHostWritesInUse(const DEVICE_MEMORY_STATE* mem_info) const;
+    bool ValidateHostWritesNotInUse(const DEVICE_MEMORY_STATE* mem_info, const char* api_name) const;
+    void RecordHostWritesNotInUse(DEVICE_MEMORY_STATE* mem_info);
     bool ValidateMappedMemoryRangeDeviceLimits(const char* func_name, uint32_t mem_range_count,
                                                const VkMappedMemoryRange* mem_ranges) const;
     BarrierOperationsType ComputeBarrierOperationsType(const CMD_BUFFER_STATE* cb_state, uint32_t buffer_barrier_count,
@@ -305,7 +323,7 @@ class CoreChecks : public ValidationStateTracker {
     VkResult CoreLayerGetValidationCacheDataEXT(VkDevice device, VkValidationCacheEXT validationCache, size_t* pDataSize,
                                                 void* pData);
     // For given bindings validate state at time of draw is correct, returning false on error and writing error details into string*
-    bool ValidateDrawState(const cvdescriptorset::DescriptorSet* descriptor_set, const std::map<uint32_t, descriptor_req>& bindings,
+    bool ValidateDrawState(const cvdescriptorset::DescriptorSet* descriptor_set, const BindingReqMap& bindings,
                            const std::vector<uint32_t>& dynamic_offsets, const CMD_BUFFER_STATE* cb_node, const char* caller,
                            std::string* error) const;
     bool ValidateDescriptorSetBindingData(const CMD_BUFFER_STATE* cb_node, const cvdescriptorset::DescriptorSet* descriptor_set,
@@ -350,13 +368,15 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidatePipelineShaderStage(VkPipelineShaderStageCreateInfo const* pStage, const PIPELINE_STATE* pipeline,
                                      const PIPELINE_STATE::StageState& stage_state, const SHADER_MODULE_STATE* module,
                                      const spirv_inst_iter& entrypoint, bool check_point_size) const;
+    SHADER_MODULE_STATE::SpecializationResult SpecializeShaderModule(const SHADER_MODULE_STATE* module,
+                                                                     VkSpecializationInfo const* specialization_info) const;
     bool ValidatePointListShaderState(const PIPELINE_STATE* pipeline, SHADER_MODULE_STATE const* src, spirv_inst_iter entrypoint,
                                       VkShaderStageFlagBits stage) const;
-    bool ValidateShaderCapabilities(SHADER_MODULE_STATE const* src, VkShaderStageFlagBits stage) const;
+    bool ValidateShaderCapabilities(entrypoint_analysis const& analysis, VkShaderStageFlagBits stage) const;
     bool ValidateShaderStageWritableDescriptor(VkShaderStageFlagBits stage, bool has_writable_descriptor) const;
     bool ValidateShaderStageInputOutputLimits(SHADER_MODULE_STATE const* src, VkPipelineShaderStageCreateInfo const* pStage,
                                               const PIPELINE_STATE* pipeline, spirv_inst_iter entrypoint) const;
-    bool ValidateShaderStageGroupNonUniform(SHADER_MODULE_STATE const* src, VkShaderStageFlagBits stage) const;
+    bool ValidateShaderStageGroupNonUniform(entrypoint_analysis const& analysis, VkShaderStageFlagBits stage) const;
     bool ValidateCooperativeMatrix(SHADER_MODULE_STATE const* src, VkPipelineShaderStageCreateInfo const* pStage,
                                    const PIPELINE_STATE* pipeline) const;
     bool ValidateExecutionModes(SHADER_MODULE_STATE const* src, spirv_inst_iter entrypoint) const;
@@ -487,6 +507,12 @@ class CoreChecks : public ValidationStateTracker {
                                VkImageLayout layout);
     void SetImageInitialLayout(CMD_BUFFER_STATE* cb_node, const IMAGE_STATE& image_state, const VkImageSubresourceLayers& layers,
                                VkImageLayout layout);
+    void SetImageInitialLayout(CMD_BUFFER_STATE* cb_node, const IMAGE_STATE& image_state,
+                               std::vector<VkImageSubresourceRange>* ranges, VkImageLayout layout);
+    template <typename RegionType>
+    void SetCopyImageInitialLayouts(CMD_BUFFER_STATE* cb_node, const IMAGE_STATE& src_image_state, VkImageLayout src_layout,
+                                    const IMAGE_STATE& dst_image_state, VkImageLayout dst_layout, uint32_t region_count,
+                                    const RegionType* regions);
 
     bool VerifyFramebufferAndRenderPassLayouts(RenderPassCreateVersion rp_version, const CMD_BUFFER_STATE* pCB,
                                                const VkRenderPassBeginInfo* pRenderPassBegin,
@@ -695,6 +721,7 @@ class CoreChecks : public ValidationStateTracker {
     bool PreCallValidateCmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo) const;
     void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator);
     bool PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) const;
+    void PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence);
     void PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence,
                                    VkResult result);
     bool PreCallValidateAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
@@ -940,6 +967,7 @@ class CoreChecks : public ValidationStateTracker {
     void PreCallRecordUnmapMemory(VkDevice device, VkDeviceMemory mem);
     bool PreCallValidateFlushMappedMemoryRanges(VkDevice device, uint32_t memRangeCount,
                                                 const VkMappedMemoryRange* pMemRanges) const;
+    void PreCallRecordFlushMappedMemoryRanges(VkDevice device, uint32_t memRangeCount, const VkMappedMemoryRange* pMemRanges);
     bool PreCallValidateInvalidateMappedMemoryRanges(VkDevice device, uint32_t memRangeCount,
                                                      const VkMappedMemoryRange* pMemRanges) const;
     void PostCallRecordInvalidateMappedMemoryRanges(VkDevice device, uint32_t memRangeCount, const VkMappedMemoryRange* pMemRanges,
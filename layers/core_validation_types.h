@@ -37,7 +37,10 @@
 #include "convert_to_renderpass2.h"
 #include "layer_chassis_dispatch.h"
 #include "image_layout_map.h"
+#include "host_write_tracker.h"
+#include "range_vector.h"
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <functional>
@@ -69,6 +72,7 @@ using ImageSubresourceLayoutMap = image_layout_map::ImageSubresourceLayoutMap;
 
 struct CMD_BUFFER_STATE;
 class CoreChecks;
+class QUEUE_STATE;
 class ValidationStateTracker;
 
 enum CALL_STATE {
@@ -79,23 +83,55 @@ enum CALL_STATE {
 
 class BASE_NODE {
   public:
-    // Track when object is being used by an in-flight command buffer
+    // Count of the in-flight queue submissions that use this object directly, i.e. that submit this command buffer or wait on
+    // or signal this semaphore. Use through a submitted command buffer's bindings is tracked by submission_stamps instead, and
+    // InUse() (see state_tracker.h) covers both.
     std::atomic_int in_use;
-    // Track command buffers that this object is bound to
-    //  binding initialized when cmd referencing object is bound to command buffer
-    //  binding removed when command buffer is reset or destroyed
-    // When an object is destroyed, any bound cbs are set to INVALID.
-    // "int" value is an index into object_bindings where the corresponding
-    // backpointer to this node is stored.
-    small_unordered_map<CMD_BUFFER_STATE *, int, 8> cb_bindings;
+    // For each queue that has been submitted a command buffer bound to this object, the sequence number of the latest such
+    // submission. The object is in use until the queue retires it (QUEUE_STATE::seq catches up), so retiring needs no
+    // per-object update. Only stamped (at queue submit) and cleared (on command buffer reset) with the object lock held
+    // exclusively.
+    struct SubmissionStamp {
+        const QUEUE_STATE *queue;
+        uint64_t seq;
+    };
+    std::vector<SubmissionStamp> submission_stamps;
+    // Objects do not track the command buffers they are bound to. Instead each command buffer binding records the
+    // object's uid and generation (see CommandBufferBinding), and bindings are checked lazily at submit/execute time:
+    //  uid identifies this node, even if its handle and address are later reused by another object
+    //  generation changes whenever the object is destroyed or modified in a way that invalidates bound cbs
+    // Both are drawn from a process-wide counter, so stamps are never reused. generation is bumped under the exclusive object
+    // lock but compared by threads recording commands under the shared one, so it is atomic.
+    uint64_t uid;
+    std::atomic<uint64_t> generation;
     // Set to true when the API-level object is destroyed, but this object may
     // hang around until its shared_ptr refcount goes to zero.
     bool destroyed;
 
     BASE_NODE() {
         in_use.store(0);
+        uid = NextGeneration();
+        generation = uid;
         destroyed = false;
     };
+
+    static uint64_t NextGeneration() {
+        static std::atomic<uint64_t> counter(1);
+        return counter.fetch_add(1);
+    }
+
+    // Sequence numbers only grow on each queue, so the latest submission replaces any earlier stamp for its queue
+    void StampSubmission(const QUEUE_STATE *queue, uint64_t seq) {
+        for (auto &stamp : submission_stamps) {
+            if (stamp.queue == queue) {
+                stamp.seq = seq;
+                return;
+            }
+        }
+        submission_stamps.push_back({queue, seq});
+    }
+
+    bool InUse() const;
 };
 
 // Track command pools and their command buffers
@@ -163,7 +199,61 @@ enum descriptor_req {
 
 extern unsigned DescriptorRequirementsBitsFromFormat(VkFormat fmt);
 
-typedef std::map<uint32_t, descriptor_req> BindingReqMap;
+// Descriptor requirements by binding number, sorted by binding. Pipelines build these once and draws then only iterate and
+// merge them, so they are kept in one contiguous array rather than a tree. Supports the subset of the std::map interface the
+// descriptor validation uses; inserting in binding order, as filtering and std::inserter do, appends without searching.
+class BindingReqMap {
+  public:
+    using key_type = uint32_t;
+    using mapped_type = descriptor_req;
+    using value_type = std::pair<uint32_t, descriptor_req>;
+    using iterator = std::vector<value_type>::iterator;
+    using const_iterator = std::vector<value_type>::const_iterator;
+
+    iterator begin() { return reqs_.begin(); }
+    const_iterator begin() const { return reqs_.begin(); }
+    const_iterator cbegin() const { return reqs_.cbegin(); }
+    iterator end() { return reqs_.end(); }
+    const_iterator end() const { return reqs_.end(); }
+    const_iterator cend() const { return reqs_.cend(); }
+    size_t size() const { return reqs_.size(); }
+    bool empty() const { return reqs_.empty(); }
+
+    const_iterator find(uint32_t binding) const {
+        auto it = LowerBound(binding);
+        return ((it != reqs_.cend()) && (it->first == binding)) ? it : reqs_.cend();
+    }
+    // Like std::map, leaves an existing entry for the binding unchanged
+    std::pair<iterator, bool> emplace(const value_type &value) {
+        if (reqs_.empty() || (reqs_.back().first < value.first)) {
+            reqs_.push_back(value);
+            return std::make_pair(reqs_.end() - 1, true);
+        }
+        auto it = reqs_.begin() + (LowerBound(value.first) - reqs_.cbegin());
+        if (it->first == value.first) return std::make_pair(it, false);
+        return std::make_pair(reqs_.insert(it, value), true);
+    }
+    // For std::inserter, which passes the position after the previous insert
+    iterator insert(const_iterator hint, const value_type &value) {
+        const bool after_prev = (hint == reqs_.cbegin()) || ((hint - 1)->first < value.first);
+        const bool before_next = (hint == reqs_.cend()) || (value.first < hint->first);
+        if (after_prev && before_next) return reqs_.insert(reqs_.begin() + (hint - reqs_.cbegin()), value);
+        return emplace(value).first;
+    }
+    descriptor_req &operator[](uint32_t binding) { return emplace(value_type(binding, descriptor_req(0))).first->second; }
+
+    void shrink_to_fit() { reqs_.shrink_to_fit(); }
+    bool operator==(const BindingReqMap &other) const { return reqs_ == other.reqs_; }
+    bool operator!=(const BindingReqMap &other) const { return reqs_ != other.reqs_; }
+
+  private:
+    const_iterator LowerBound(uint32_t binding) const {
+        return std::lower_bound(reqs_.cbegin(), reqs_.cend(), binding,
+                                [](const value_type &entry, uint32_t value) { return entry.first < value; });
+    }
+
+    std::vector<value_type> reqs_;
+};
 
 struct DESCRIPTOR_POOL_STATE : BASE_NODE {
     VkDescriptorPool pool;
@@ -237,6 +327,9 @@ class BINDABLE : public BASE_NODE {
     //  There's more data for sparse bindings so need better long-term solution
     // TODO : Need to update solution to track all sparse binding data
     std::unordered_set<MEM_BINDING> sparse_bindings;
+    // Every range this object was inserted into the bound_ranges of its memory with. An image may be bound more than once,
+    // e.g. a disjoint multiplane image once per plane, and all of them must be removed when it is destroyed.
+    std::vector<MEM_BINDING> indexed_ranges;
 
     small_unordered_set<VkDeviceMemory, 1> bound_memory_set_;
 
@@ -247,6 +340,7 @@ class BINDABLE : public BASE_NODE {
           memory_requirements_checked(false),
           external_memory_handle(0),
           sparse_bindings{},
+          indexed_ranges{},
           bound_memory_set_{} {};
 
     // Update the cached set of memory bindings.
@@ -443,6 +537,52 @@ struct MemRange {
     VkDeviceSize size = 0;
 };
 
+// The objects bound to one VkDeviceMemory, by the range of the allocation each is bound to. The allocation is cut into segments at
+// every binding's bounds, each listing the objects bound over all of it, so finding what overlaps a range is O(log n + k) and
+// binding or unbinding an object only touches the segments it covers. Zero sized bindings are kept as one byte.
+class MemoryBindingIndex {
+  public:
+    using Range = sparse_container::range<VkDeviceSize>;
+
+    void Insert(const VulkanTypedHandle &handle, VkDeviceSize offset, VkDeviceSize size);
+    // offset and size must be those handle was inserted with
+    void Remove(const VulkanTypedHandle &handle, VkDeviceSize offset, VkDeviceSize size);
+
+    // Calls fn(handle) once for each object bound anywhere in [offset, offset + size)
+    template <typename Fn>
+    void ForEachOverlapping(VkDeviceSize offset, VkDeviceSize size, Fn &&fn) const {
+        const Range range = MakeRange(offset, size);
+        const Handles *previous = nullptr;
+        VkDeviceSize previous_end = 0;
+        for (auto pos = segments_.lower_bound(range); pos != segments_.end() && pos->first.begin < range.end; ++pos) {
+            // An object covers a run of adjacent segments; report it from the first of them within range
+            const bool adjacent = previous && (previous_end == pos->first.begin);
+            for (const auto &handle : pos->second) {
+                if (!adjacent || std::find(previous->cbegin(), previous->cend(), handle) == previous->cend()) {
+                    fn(handle);
+                }
+            }
+            previous = &pos->second;
+            previous_end = pos->first.end;
+        }
+    }
+
+    bool empty() const { return segments_.empty(); }
+    size_t SegmentCount() const { return segments_.size(); }
+
+  private:
+    using Handles = std::vector<VulkanTypedHandle>;
+    using SegmentMap = sparse_container::range_map<VkDeviceSize, Handles>;
+
+    static Range MakeRange(VkDeviceSize offset, VkDeviceSize size) {
+        return Range(offset, offset + std::max(size, VkDeviceSize(1)));
+    }
+    // Rejoins adjacent segments around range that list the same objects
+    void Coalesce(const Range &range);
+
+    SegmentMap segments_;
+};
+
 // Data struct for tracking memory object
 struct DEVICE_MEMORY_STATE : public BASE_NODE {
     void *object;  // Dispatchable object used to create this memory (device of swapchain)
@@ -456,16 +596,16 @@ struct DEVICE_MEMORY_STATE : public BASE_NODE {
     std::unordered_set<VulkanTypedHandle> obj_bindings;  // objects bound to this memory
     // Convenience vectors of handles to speed up iterating over objects independently
     std::unordered_set<VkImage> bound_images;
-    // TODO: Convert the two sets to the correct types.
-    std::unordered_set<uint64_t> bound_buffers;
-    std::unordered_set<uint64_t> bound_acceleration_structures;
+    MemoryBindingIndex bound_ranges;  // Non-sparse images, buffers and acceleration structures by bound range
 
     MemRange mapped_range;
     void *shadow_copy_base;    // Base of layer's allocation for guard band, data, and alignment space
+    size_t shadow_copy_size;   // Size of the pages reserved around shadow_copy_base; 0 when it was allocated with calloc
     void *shadow_copy;         // Pointer to start of guard-band data before mapped region
     uint64_t shadow_pad_size;  // Size of the guard-band data before and after actual data. It MUST be a
                                // multiple of limits.minMemoryMapAlignment
     void *p_driver_data;       // Pointer to application's actual memory
+    std::unique_ptr<HostWriteTracker> host_writes;  // Pages of the shadow copy written, with host write tracking enabled
 
     DEVICE_MEMORY_STATE(void *disp_object, const VkDeviceMemory in_mem, const VkMemoryAllocateInfo *p_alloc_info)
         : object(disp_object),
@@ -478,6 +618,7 @@ struct DEVICE_MEMORY_STATE : public BASE_NODE {
           export_handle_type_flags(0),
           mapped_range{},
           shadow_copy_base(0),
+          shadow_copy_size(0),
           shadow_copy(0),
           shadow_pad_size(0),
           p_driver_data(0){};
@@ -584,6 +725,9 @@ enum CBStatusFlagBits {
     // clang-format on
 };
 
+// The state bits a pipeline with the given dynamic state provides when bound
+CBStatusFlags MakeStaticStateMask(VkPipelineDynamicStateCreateInfo const *ds);
+
 struct QueryObject {
     VkQueryPool pool;
     uint32_t query;
@@ -607,19 +751,6 @@ inline bool operator==(const QueryObject &query1, const QueryObject &query2) {
     return ((query1.pool == query2.pool) && (query1.query == query2.query));
 }
 
-struct QueryObjectPass {
-    QueryObject obj;
-    uint32_t perf_pass;
-
-    QueryObjectPass(const QueryObject &obj_, uint32_t perf_pass_) : obj(obj_), perf_pass(perf_pass_) {}
-    QueryObjectPass(const QueryObjectPass &obj_) : obj(obj_.obj), perf_pass(obj_.perf_pass) {}
-    bool operator<(const QueryObjectPass &rhs) const { return (obj == rhs.obj) ? perf_pass < rhs.perf_pass : obj < rhs.obj; }
-};
-
-inline bool operator==(const QueryObjectPass &query1, const QueryObjectPass &query2) {
-    return ((query1.obj == query2.obj) && (query1.perf_pass == query2.perf_pass));
-}
-
 enum QueryState {
     QUERYSTATE_UNKNOWN,    // Initial state.
     QUERYSTATE_RESET,      // After resetting.
@@ -662,13 +793,6 @@ struct hash<QueryObject> {
         return hash<uint64_t>()((uint64_t)(query.pool)) ^ hash<uint32_t>()(query.query);
     }
 };
-
-template <>
-struct hash<QueryObjectPass> {
-    size_t operator()(QueryObjectPass query) const throw() {
-        return hash<QueryObject>()(query.obj) ^ hash<uint32_t>()(query.perf_pass);
-    }
-};
 }  // namespace std
 
 struct CBVertexBufferBindingInfo {
@@ -736,6 +860,40 @@ struct PipelineLayoutCompatDef {
 using PipelineLayoutCompatDict = hash_util::Dictionary<PipelineLayoutCompatDef, hash_util::HasHashMember<PipelineLayoutCompatDef>>;
 using PipelineLayoutCompatId = PipelineLayoutCompatDict::Id;
 
+// Vertex input state of a graphics pipeline, distilled to what draw time validation needs. Many pipelines share the same
+// vertex formats, so the canonical copy is shared through PipelineVertexInputDict.
+struct PipelineVertexInputDef {
+    std::vector<VkVertexInputBindingDescription> bindings;
+    std::vector<VkVertexInputAttributeDescription> attributes;
+    std::vector<VkDeviceSize> attribute_alignments;  // Required alignment of each of attributes
+    // (binding number, index into bindings), sorted by binding number
+    std::vector<std::pair<uint32_t, uint32_t>> binding_to_index;
+
+    PipelineVertexInputDef() = default;
+    explicit PipelineVertexInputDef(const VkPipelineVertexInputStateCreateInfo *vertex_input_state);
+    // Index into bindings of the description for the given binding number, or nullptr if there is none
+    const uint32_t *FindBindingIndex(uint32_t binding) const;
+    size_t hash() const;
+    bool operator==(const PipelineVertexInputDef &other) const;
+};
+
+using PipelineVertexInputDict = hash_util::Dictionary<PipelineVertexInputDef, hash_util::HasHashMember<PipelineVertexInputDef>>;
+using PipelineVertexInputId = PipelineVertexInputDict::Id;
+
+// Color blend state of a graphics pipeline, shared through PipelineColorBlendDict like the vertex input state
+struct PipelineColorBlendDef {
+    std::vector<VkPipelineColorBlendAttachmentState> attachments;
+    bool blend_constants_enabled = false;  // Blend constants enabled for any attachments
+
+    PipelineColorBlendDef() = default;
+    explicit PipelineColorBlendDef(const VkPipelineColorBlendStateCreateInfo *color_blend_state);
+    size_t hash() const;
+    bool operator==(const PipelineColorBlendDef &other) const;
+};
+
+using PipelineColorBlendDict = hash_util::Dictionary<PipelineColorBlendDef, hash_util::HasHashMember<PipelineColorBlendDef>>;
+using PipelineColorBlendId = PipelineColorBlendDict::Id;
+
 // Store layouts and pushconstants for PipelineLayout
 struct PIPELINE_LAYOUT_STATE : public BASE_NODE {
     VkPipelineLayout layout;
@@ -763,93 +921,118 @@ struct interface_var {
     // TODO: collect the name, too? Isn't required to be present.
 };
 typedef std::pair<unsigned, unsigned> descriptor_slot_t;
+struct entrypoint_analysis;
 
 class PIPELINE_STATE : public BASE_NODE {
   public:
+    // Only valid while the pipeline is being created, see ReleaseCreateTimeState()
     struct StageState {
-        std::unordered_set<uint32_t> accessible_ids;
-        std::vector<std::pair<descriptor_slot_t, interface_var>> descriptor_uses;
-        bool has_writable_descriptor;
+        // Shared with every other pipeline using the same entrypoint. Null if the module isn't SPIR-V or lacks the entrypoint.
+        std::shared_ptr<const entrypoint_analysis> analysis;
     };
+    // (set#, bindings) sorted by set#
+    using ActiveSlots = std::vector<std::pair<uint32_t, BindingReqMap>>;
 
     VkPipeline pipeline;
-    safe_VkGraphicsPipelineCreateInfo graphicsPipelineCI;
-    safe_VkComputePipelineCreateInfo computePipelineCI;
-    safe_VkRayTracingPipelineCreateInfoNV raytracingPipelineCI;
+    // Only the create info of the pipeline's type (see getPipelineType()) is live; none is until one of the init*() calls
+    union {
+        safe_VkGraphicsPipelineCreateInfo graphicsPipelineCI;
+        safe_VkComputePipelineCreateInfo computePipelineCI;
+        safe_VkRayTracingPipelineCreateInfoNV raytracingPipelineCI;
+    };
+    VkPipelineBindPoint pipeline_type;
     // Hold shared ptr to RP in case RP itself is destroyed
     std::shared_ptr<const RENDER_PASS_STATE> rp_state;
     // Flag of which shader stages are active for this pipeline
     uint32_t active_shaders;
     uint32_t duplicate_shaders;
     // Capture which slots (set#->bindings) are actually used by the shaders of this pipeline
-    std::unordered_map<uint32_t, BindingReqMap> active_slots;
+    ActiveSlots active_slots;
     uint32_t max_active_slot;  // the highest set number in active_slots for pipeline layout compatibility checks
     // Additional metadata needed by pipeline_state initialization and validation
     std::vector<StageState> stage_state;
-    // Vtx input info (if any)
-    std::vector<VkVertexInputBindingDescription> vertex_binding_descriptions_;
-    std::vector<VkVertexInputAttributeDescription> vertex_attribute_descriptions_;
-    std::vector<VkDeviceSize> vertex_attribute_alignments_;
-    std::unordered_map<uint32_t, uint32_t> vertex_binding_to_index_map_;
-    std::vector<VkPipelineColorBlendAttachmentState> attachments;
-    bool blendConstantsEnabled;  // Blend constants enabled for any attachments
+    // Vtx input and blend info, shared with all pipelines using the same state. Never null.
+    PipelineVertexInputId vertex_input;
+    PipelineColorBlendId color_blend;
+    CBStatusFlags static_state_mask;  // State bits provided by the pipeline rather than set dynamically
     std::shared_ptr<const PIPELINE_LAYOUT_STATE> pipeline_layout;
     VkPrimitiveTopology topology_at_rasterizer;
 
     // Default constructor
     PIPELINE_STATE()
         : pipeline{},
-          graphicsPipelineCI{},
-          computePipelineCI{},
-          raytracingPipelineCI{},
+          pipeline_type(VK_PIPELINE_BIND_POINT_MAX_ENUM),
           rp_state(nullptr),
           active_shaders(0),
           duplicate_shaders(0),
           active_slots(),
           max_active_slot(0),
-          vertex_binding_descriptions_(),
-          vertex_attribute_descriptions_(),
-          vertex_binding_to_index_map_(),
-          attachments(),
-          blendConstantsEnabled(false),
+          vertex_input(),
+          color_blend(),
+          static_state_mask(CBSTATUS_ALL_STATE_SET),
           pipeline_layout(),
           topology_at_rasterizer{} {}
+    ~PIPELINE_STATE() { reset(); }
 
     void reset() {
-        VkGraphicsPipelineCreateInfo emptyGraphicsCI = {};
-        graphicsPipelineCI.initialize(&emptyGraphicsCI, false, false);
-        VkComputePipelineCreateInfo emptyComputeCI = {};
-        computePipelineCI.initialize(&emptyComputeCI);
-        VkRayTracingPipelineCreateInfoNV emptyRayTracingCI = {};
-        raytracingPipelineCI.initialize(&emptyRayTracingCI);
+        switch (pipeline_type) {
+            case VK_PIPELINE_BIND_POINT_GRAPHICS:
+                graphicsPipelineCI.~safe_VkGraphicsPipelineCreateInfo();
+                break;
+            case VK_PIPELINE_BIND_POINT_COMPUTE:
+                computePipelineCI.~safe_VkComputePipelineCreateInfo();
+                break;
+            case VK_PIPELINE_BIND_POINT_RAY_TRACING_NV:
+                raytracingPipelineCI.~safe_VkRayTracingPipelineCreateInfoNV();
+                break;
+            default:
+                break;
+        }
+        pipeline_type = VK_PIPELINE_BIND_POINT_MAX_ENUM;
         stage_state.clear();
     }
 
+    // Descriptor requirements of the given set, or nullptr if no shader of the pipeline uses the set
+    const BindingReqMap *GetActiveSlot(uint32_t set) const {
+        auto it = std::lower_bound(active_slots.cbegin(), active_slots.cend(), set,
+                                   [](const ActiveSlots::value_type &slot, uint32_t value) { return slot.first < value; });
+        return ((it != active_slots.cend()) && (it->first == set)) ? &it->second : nullptr;
+    }
+    BindingReqMap &GetOrAddActiveSlot(uint32_t set) {
+        auto it = std::lower_bound(active_slots.begin(), active_slots.end(), set,
+                                   [](const ActiveSlots::value_type &slot, uint32_t value) { return slot.first < value; });
+        if ((it == active_slots.end()) || (it->first != set)) {
+            it = active_slots.emplace(it, set, BindingReqMap());
+        }
+        return it->second;
+    }
+
+    // Drops the per stage shader analysis, which only create time validation uses, once the pipeline has been created
+    void ReleaseCreateTimeState() {
+        std::vector<StageState>().swap(stage_state);
+        active_slots.shrink_to_fit();
+        for (auto &slot : active_slots) slot.second.shrink_to_fit();
+    }
+
+    void SetEmptyGraphicsState();
     void initGraphicsPipeline(const ValidationStateTracker *state_data, const VkGraphicsPipelineCreateInfo *pCreateInfo,
                               std::shared_ptr<const RENDER_PASS_STATE> &&rpstate);
     void initComputePipeline(const ValidationStateTracker *state_data, const VkComputePipelineCreateInfo *pCreateInfo);
     void initRayTracingPipelineNV(const ValidationStateTracker *state_data, const VkRayTracingPipelineCreateInfoNV *pCreateInfo);
 
-    inline VkPipelineBindPoint getPipelineType() const {
-        if (graphicsPipelineCI.sType == VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO)
-            return VK_PIPELINE_BIND_POINT_GRAPHICS;
-        else if (computePipelineCI.sType == VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO)
-            return VK_PIPELINE_BIND_POINT_COMPUTE;
-        else if (raytracingPipelineCI.sType == VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_NV)
-            return VK_PIPELINE_BIND_POINT_RAY_TRACING_NV;
-        else
-            return VK_PIPELINE_BIND_POINT_MAX_ENUM;
-    }
+    inline VkPipelineBindPoint getPipelineType() const { return pipeline_type; }
 
     inline VkPipelineCreateFlags getPipelineCreateFlags() const {
-        if (graphicsPipelineCI.sType == VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO)
-            return graphicsPipelineCI.flags;
-        else if (computePipelineCI.sType == VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO)
-            return computePipelineCI.flags;
-        else if (raytracingPipelineCI.sType == VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_NV)
-            return raytracingPipelineCI.flags;
-        else
-            return 0;
+        switch (pipeline_type) {
+            case VK_PIPELINE_BIND_POINT_GRAPHICS:
+                return graphicsPipelineCI.flags;
+            case VK_PIPELINE_BIND_POINT_COMPUTE:
+                return computePipelineCI.flags;
+            case VK_PIPELINE_BIND_POINT_RAY_TRACING_NV:
+                return raytracingPipelineCI.flags;
+            default:
+                return 0;
+        }
     }
 };
 
@@ -1043,10 +1226,69 @@ struct QFOTransferCBScoreboards {
     QFOTransferCBScoreboard<Barrier> release;
 };
 
-typedef std::map<QueryObject, QueryState> QueryMap;
-typedef std::map<QueryObjectPass, QueryState> QueryPassMap;
+// Query state changes made by the command buffers of a submission, layered over the state the query pools hold. Each pool
+// written gets a dense array indexed by query, so a reset of a large range is a single fill.
+class QueryMap {
+  public:
+    // pool_query_count is the pool's createInfo.queryCount. Queries past it are ignored, since the record paths still run after
+    // an out-of-range query has been reported.
+    void Set(VkQueryPool pool, uint32_t pool_query_count, uint32_t query, QueryState state) {
+        SetRange(pool, pool_query_count, query, 1, state);
+    }
+    void SetRange(VkQueryPool pool, uint32_t pool_query_count, uint32_t first_query, uint32_t query_count, QueryState state) {
+        if (first_query >= pool_query_count) return;
+        const size_t end = std::min(static_cast<size_t>(first_query) + query_count, static_cast<size_t>(pool_query_count));
+        auto &states = GetPoolStates(pool);
+        if (states.size() < end) {
+            states.resize(end, static_cast<uint8_t>(kUnset));
+        }
+        std::fill(states.begin() + first_query, states.begin() + end, static_cast<uint8_t>(state));
+    }
+    // Returns false if no command buffer changed the state of the query
+    bool Find(VkQueryPool pool, uint32_t query, QueryState *state) const {
+        for (const auto &pool_states : pools_) {
+            if (pool_states.first != pool) continue;
+            if ((query >= pool_states.second.size()) || (pool_states.second[query] == kUnset)) return false;
+            *state = static_cast<QueryState>(pool_states.second[query]);
+            return true;
+        }
+        return false;
+    }
+    // Calls fn(pool, query, state) for each query whose state was changed
+    template <typename Fn>
+    void ForEach(Fn &&fn) const {
+        for (const auto &pool_states : pools_) {
+            const auto &states = pool_states.second;
+            for (uint32_t query = 0; query < states.size(); ++query) {
+                if (states[query] != kUnset) fn(pool_states.first, query, static_cast<QueryState>(states[query]));
+            }
+        }
+    }
+
+  private:
+    static const uint8_t kUnset = 0xFF;
+
+    std::vector<uint8_t> &GetPoolStates(VkQueryPool pool) {
+        for (auto &pool_states : pools_) {
+            if (pool_states.first == pool) return pool_states.second;
+        }
+        pools_.emplace_back(pool, std::vector<uint8_t>());
+        return pools_.back().second;
+    }
+
+    // A submission rarely touches more than a handful of pools, so a linear search beats hashing
+    std::vector<std::pair<VkQueryPool, std::vector<uint8_t>>> pools_;
+};
 typedef std::unordered_map<VkEvent, VkPipelineStageFlags> EventToStageMap;
 
+// An object bound to a command buffer, stamped with the object's uid and generation at the time it was bound. The binding is
+// stale once the handle no longer resolves to a node with the same uid (destroyed) or the generation differs (modified).
+struct CommandBufferBinding {
+    VulkanTypedHandle object;
+    uint64_t uid;
+    uint64_t generation;
+};
+
 // Cmd Buffer Wrapper Struct - TODO : This desperately needs its own class
 struct CMD_BUFFER_STATE : public BASE_NODE {
     VkCommandBuffer commandBuffer;
@@ -1091,8 +1333,13 @@ struct CMD_BUFFER_STATE : public BASE_NODE {
     std::unordered_set<VkFramebuffer> framebuffers;
     // Unified data structs to track objects bound to this command buffer as well as object
     //  dependencies that have been broken : either destroyed objects, or updated descriptor sets
-    std::vector<VulkanTypedHandle> object_bindings;
+    std::vector<CommandBufferBinding> object_bindings;
+    std::unordered_set<VulkanTypedHandle> bound_objects;  // Handles in object_bindings, to bind each object once
     std::vector<VulkanTypedHandle> broken_bindings;
+    // The device's destroyed/modified object counts when object_bindings were last checked for stale entries. While they
+    // still match, no bound object can have been destroyed or modified and the check can be skipped.
+    uint64_t bindings_destroy_count;
+    uint64_t bindings_modify_count;
 
     QFOTransferBarrierSets<VkBufferMemoryBarrier> qfo_transfer_buffer_barriers;
     QFOTransferBarrierSets<VkImageMemoryBarrier> qfo_transfer_image_barriers;
@@ -1120,6 +1367,10 @@ struct CMD_BUFFER_STATE : public BASE_NODE {
         eventUpdates;
     std::vector<std::function<bool(const ValidationStateTracker *device_data, bool do_validate, QueryMap *localQueryToStateMap)>>
         queryUpdates;
+    // The queries that queryUpdates leave ended, which become available as each submission retires. Worked out at the first
+    // retire after recording rather than replayed at every retire.
+    std::vector<std::pair<VkQueryPool, uint32_t>> ended_queries;
+    bool ended_queries_valid = false;
     std::unordered_set<cvdescriptorset::DescriptorSet *> validated_descriptor_sets;
     // Contents valid only after an index buffer is bound (CBSTATUS_INDEX_BUFFER_BOUND set)
     IndexBufferBinding index_buffer_binding;
@@ -1173,6 +1424,10 @@ struct CB_SUBMISSION {
     std::vector<VkSemaphore> externalSemaphores;
     VkFence fence;
     uint32_t perf_submit_pass;
+    // Indexed by QUEUE_STATE::ordinal: the seq through which this submission depends on each queue, directly or through its
+    // semaphore waits and earlier submissions on its own queue. Its own queue's entry is its own seq. Queues created after the
+    // submission have no entry.
+    std::vector<uint64_t> dependency_seqs;
 };
 
 struct IMAGE_LAYOUT_STATE {
@@ -684,7 +684,7 @@ unsigned DescriptorRequirementsBitsFromFormat(VkFormat fmt) {
 //  This includes validating that all descriptors in the given bindings are updated,
 //  that any update buffers are valid, and that any dynamic offsets are within the bounds of their buffers.
 // Return true if state is acceptable, or false and write an error message into error string
-bool CoreChecks::ValidateDrawState(const DescriptorSet *descriptor_set, const std::map<uint32_t, descriptor_req> &bindings,
+bool CoreChecks::ValidateDrawState(const DescriptorSet *descriptor_set, const BindingReqMap &bindings,
                                    const std::vector<uint32_t> &dynamic_offsets, const CMD_BUFFER_STATE *cb_node,
                                    const char *caller, std::string *error) const {
     for (auto binding_pair : bindings) {
@@ -943,9 +943,9 @@ bool CoreChecks::ValidateDescriptorSetBindingData(const CMD_BUFFER_STATE *cb_nod
     return true;
 }
 
-// Set is being deleted or updates so invalidate all bound cmd buffers
+// Set is being updated so invalidate all bound cmd buffers
 void cvdescriptorset::DescriptorSet::InvalidateBoundCmdBuffers(ValidationStateTracker *state_data) {
-    state_data->InvalidateCommandBuffers(cb_bindings, VulkanTypedHandle(set_, kVulkanObjectTypeDescriptorSet), /*unlink*/ false);
+    state_data->InvalidateCommandBuffers(this, /*destroyed*/ false);
 }
 
 // Loop through the write updates to do for a push descriptor set, ignoring dstSet
@@ -1054,7 +1054,7 @@ bool CoreChecks::ValidateCopyUpdate(const VkCopyDescriptorSet *update, const Des
         return false;
     }
     // Verify idle ds
-    if (dst_set->in_use.load() &&
+    if (dst_set->InUse() &&
         !(dst_layout->GetDescriptorBindingFlagsFromBinding(update->dstBinding) &
           (VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT))) {
         // TODO : Re-using Free Idle error code, need copy update idle error code
@@ -1243,15 +1243,12 @@ void cvdescriptorset::DescriptorSet::PerformCopyUpdate(ValidationStateTracker *d
 // Prereq: This should be called for a set that has been confirmed to be active for the given cb_node, meaning it's going
 //   to be used in a draw by the given cb_node
 void cvdescriptorset::DescriptorSet::UpdateDrawState(ValidationStateTracker *device_data, CMD_BUFFER_STATE *cb_node,
-                                                     const PIPELINE_STATE *pipe,
-                                                     const std::map<uint32_t, descriptor_req> &binding_req_map) {
+                                                     const PIPELINE_STATE *pipe, const BindingReqMap &binding_req_map) {
     if (!device_data->disabled.command_buffer_state) {
         // bind cb to this descriptor set
         // Add bindings for descriptor set, the set's pool, and individual objects in the set
-        if (device_data->AddCommandBufferBinding(cb_bindings, VulkanTypedHandle(set_, kVulkanObjectTypeDescriptorSet, this),
-                                                 cb_node)) {
-            device_data->AddCommandBufferBinding(pool_state_->cb_bindings,
-                                                 VulkanTypedHandle(pool_state_->pool, kVulkanObjectTypeDescriptorPool, pool_state_),
+        if (device_data->AddCommandBufferBinding(VulkanTypedHandle(set_, kVulkanObjectTypeDescriptorSet, this), cb_node)) {
+            device_data->AddCommandBufferBinding(VulkanTypedHandle(pool_state_->pool, kVulkanObjectTypeDescriptorPool, pool_state_),
                                                  cb_node);
         }
     }
@@ -1294,15 +1291,20 @@ void cvdescriptorset::DescriptorSet::FilterOneBindingReq(const BindingReqMap::va
 void cvdescriptorset::DescriptorSet::FilterBindingReqs(const CMD_BUFFER_STATE &cb_state, const PIPELINE_STATE &pipeline,
                                                        const BindingReqMap &in_req, BindingReqMap *out_req) const {
     // For const cleanliness we have to find in the maps...
-    const auto validated_it = cached_validation_.find(&cb_state);
-    if (validated_it == cached_validation_.cend()) {
+    const CachedValidation *cached = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(cached_validation_mutex_);
+        const auto validated_it = cached_validation_.find(&cb_state);
+        if (validated_it != cached_validation_.cend()) cached = &validated_it->second;
+    }
+    if (!cached) {
         // We have nothing validated, copy in to out
         for (const auto &binding_req_pair : in_req) {
             out_req->emplace(binding_req_pair);
         }
         return;
     }
-    const auto &validated = validated_it->second;
+    const auto &validated = *cached;
 
     const auto image_sample_version_it = validated.image_samplers.find(&pipeline);
     const VersionedBindings *image_sample_version = nullptr;
@@ -1346,7 +1348,12 @@ void cvdescriptorset::DescriptorSet::FilterBindingReqs(const CMD_BUFFER_STATE &c
 void cvdescriptorset::DescriptorSet::UpdateValidationCache(const CMD_BUFFER_STATE &cb_state, const PIPELINE_STATE &pipeline,
                                                            const BindingReqMap &updated_bindings) {
     // For const cleanliness we have to find in the maps...
-    auto &validated = cached_validation_[&cb_state];
+    CachedValidation *cached = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(cached_validation_mutex_);
+        cached = &cached_validation_[&cb_state];
+    }
+    auto &validated = *cached;
 
     auto &image_sample_version = validated.image_samplers[&pipeline];
     auto &dynamic_buffers = validated.dynamic_buffers;
@@ -2340,7 +2347,7 @@ bool CoreChecks::ValidateAllocateDescriptorSets(const VkDescriptorSetAllocateInf
 const BindingReqMap &cvdescriptorset::PrefilterBindRequestMap::FilteredMap(const CMD_BUFFER_STATE &cb_state,
                                                                            const PIPELINE_STATE &pipeline) {
     if (IsManyDescriptors()) {
-        filtered_map_.reset(new std::map<uint32_t, descriptor_req>());
+        filtered_map_.reset(new BindingReqMap());
         descriptor_set_.FilterBindingReqs(cb_state, pipeline, orig_map_, filtered_map_.get());
         return *filtered_map_;
     }
@@ -2440,7 +2447,7 @@ bool CoreChecks::ValidateWriteUpdate(const DescriptorSet *dest_set, const VkWrit
     }
 
     // Verify idle ds
-    if (dest_set->in_use.load() && !(dest.GetDescriptorBindingFlags() & (VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT |
+    if (dest_set->InUse() && !(dest.GetDescriptorBindingFlags() & (VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT |
                                                                          VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT))) {
         // TODO : Re-using Free Idle error code, need write update idle error code
         *error_code = "VUID-vkFreeDescriptorSets-pDescriptorSets-00309";
@@ -29,6 +29,7 @@
 #include "vk_object_types.h"
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <unordered_map>
 #include <unordered_set>
@@ -623,7 +624,7 @@ class DescriptorSet : public BASE_NODE {
     // Bind given cmd_buffer to this descriptor set and
     // update CB image layout map with image/imagesampler descriptor image layouts
     void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *, const PIPELINE_STATE *,
-                         const std::map<uint32_t, descriptor_req> &);
+                         const BindingReqMap &);
 
     // Track work that has been bound or validated to avoid duplicate work, important when large descriptor arrays
     // are present
@@ -635,9 +636,13 @@ class DescriptorSet : public BASE_NODE {
     void UpdateValidationCache(const CMD_BUFFER_STATE &cb_state, const PIPELINE_STATE &pipeline,
                                const BindingReqMap &updated_bindings);
     void ClearCachedDynamicDescriptorValidation(CMD_BUFFER_STATE *cb_state) {
+        std::unique_lock<std::mutex> lock(cached_validation_mutex_);
         cached_validation_[cb_state].dynamic_buffers.clear();
     }
-    void ClearCachedValidation(CMD_BUFFER_STATE *cb_state) { cached_validation_.erase(cb_state); }
+    void ClearCachedValidation(CMD_BUFFER_STATE *cb_state) {
+        std::unique_lock<std::mutex> lock(cached_validation_mutex_);
+        cached_validation_.erase(cb_state);
+    }
     VkSampler const *GetImmutableSamplerPtrFromBinding(const uint32_t index) const {
         return p_layout_->GetImmutableSamplerPtrFromBinding(index);
     };
@@ -705,6 +710,9 @@ class DescriptorSet : public BASE_NODE {
     typedef std::unordered_map<const CMD_BUFFER_STATE *, CachedValidation> CachedValidationMap;
     // Image and ImageView bindings are validated per pipeline and not invalidate by repeated binding
     CachedValidationMap cached_validation_;
+    // A set can be bound in several command buffers recorded on different threads at once. The mutex guards the map itself;
+    // each entry is only touched by the thread recording its command buffer.
+    mutable std::mutex cached_validation_mutex_;
 };
 // For the "bindless" style resource usage with many descriptors, need to optimize binding and validation
 class PrefilterBindRequestMap {
@@ -45,13 +45,26 @@ bool wrap_handles = true;
 #define OBJECT_LAYER_DESCRIPTION "khronos_validation"
 
 // Include layer validation object definitions
+#if VVL_ENABLE_BEST_PRACTICES
 #include "best_practices.h"
+#endif
+#if VVL_ENABLE_CORE
 #include "core_validation.h"
 #include "command_counter.h"
+#endif
+#if VVL_ENABLE_GPU_ASSISTED
 #include "gpu_validation.h"
+#endif
+#if VVL_ENABLE_OBJECT_LIFETIMES
 #include "object_lifetime_validation.h"
+#endif
+#if VVL_ENABLE_STATELESS
 #include "stateless_validation.h"
+#endif
+#if VVL_ENABLE_THREADING
 #include "thread_safety.h"
+#endif
+#include "layer_profiler.h"
 
 namespace vulkan_layer_chassis {
 
@@ -75,6 +88,7 @@ typedef struct {
 } function_data;
 
 extern const std::unordered_map<std::string, function_data> name_to_funcptr_map;
+extern const char *const profiled_entry_point_names[];
 
 // Manually written functions
 
@@ -134,6 +148,10 @@ static const std::unordered_map<std::string, ValidationCheckDisables> Validation
     {"VALIDATION_CHECK_DISABLE_IMAGE_LAYOUT_VALIDATION", VALIDATION_CHECK_DISABLE_IMAGE_LAYOUT_VALIDATION},
 };
 
+static const std::unordered_map<std::string, ValidationCheckEnables> ValidationEnableLookup = {
+    {"VALIDATION_CHECK_ENABLE_PROFILING", VALIDATION_CHECK_ENABLE_PROFILING},
+};
+
 // Set the local disable flag for the appropriate VALIDATION_CHECK_DISABLE enum
 void SetValidationDisable(CHECK_DISABLED* disable_data, const ValidationCheckDisables disable_id) {
     switch (disable_id) {
@@ -160,6 +178,17 @@ void SetValidationDisable(CHECK_DISABLED* disable_data, const ValidationCheckDis
     }
 }
 
+// Set the local enable flag for the appropriate VALIDATION_CHECK_ENABLE enum
+void SetValidationEnable(CHECK_ENABLED* enable_data, const ValidationCheckEnables enable_id) {
+    switch (enable_id) {
+        case VALIDATION_CHECK_ENABLE_PROFILING:
+            enable_data->profiling = true;
+            break;
+        default:
+            assert(false);
+    }
+}
+
 // Set the local disable flag for a single VK_VALIDATION_FEATURE_DISABLE_* flag
 void SetValidationFeatureDisable(CHECK_DISABLED* disable_data, const VkValidationFeatureDisableEXT feature_disable) {
     switch (feature_disable) {
@@ -253,6 +282,12 @@ void SetLocalEnableSetting(std::string list_of_enables, std::string delimiter, C
                 SetValidationFeatureEnable(enables, result->second);
             }
         }
+        if (token.find("VALIDATION_CHECK_ENABLE_") != std::string::npos) {
+            auto result = ValidationEnableLookup.find(token);
+            if (result != ValidationEnableLookup.end()) {
+                SetValidationEnable(enables, result->second);
+            }
+        }
         list_of_enables.erase(0, pos + delimiter.length());
     }
 }
@@ -306,6 +341,33 @@ void ProcessConfigAndEnvSettings(const char* layer_description, CHECK_ENABLED* e
     SetLocalDisableSetting(list_of_env_disables, env_delimiter, disables);
 }
 
+// Names reported by the layer profiler, indexed by LayerObjectTypeId. LayerObjectTypeDevice only appears in the dispatch
+// list as the CommandCounter object.
+static const char *const layer_object_type_names[] = {
+    "Instance", "CommandCounter", "ThreadSafety", "StatelessValidation", "ObjectLifetimes", "CoreChecks", "BestPractices",
+    "GpuAssisted",
+};
+
+// Start the layer profiler using the <layer_description>.profiling_* settings from the config file
+void EnableProfiling(const char* layer_description) {
+    static_assert(LayerObjectTypeMaxEnum <= layer_profiler::kMaxProfiledObjectTypes, "Too many layer object types to profile");
+    static_assert(sizeof(layer_object_type_names) / sizeof(layer_object_type_names[0]) == LayerObjectTypeMaxEnum,
+                  "layer_object_type_names must name every LayerObjectTypeId");
+    const std::string prefix = layer_description;
+    const std::string format = getLayerOption((prefix + ".profiling_format").c_str());
+    const std::string trace_events = getLayerOption((prefix + ".profiling_trace_events").c_str());
+
+    layer_profiler::ProfileSettings settings = {};
+    settings.entry_point_names = profiled_entry_point_names;
+    settings.entry_point_count = kProfiledEntryPointCount;
+    settings.object_type_names = layer_object_type_names;
+    settings.object_type_count = LayerObjectTypeMaxEnum;
+    settings.format = (format == "chrome_trace") ? layer_profiler::kProfileOutputChromeTrace : layer_profiler::kProfileOutputReport;
+    settings.output_path = getLayerOption((prefix + ".profiling_output").c_str());
+    settings.trace_events_per_thread = trace_events.empty() ? 65536 : static_cast<uint32_t>(strtoul(trace_events.c_str(), nullptr, 10));
+    layer_profiler::Enable(settings);
+}
+
 
 // Non-code-generated chassis API functions
 
@@ -406,10 +468,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
         SetValidationFlags(&local_disables, validation_flags_ext);
     }
     ProcessConfigAndEnvSettings(OBJECT_LAYER_DESCRIPTION, &local_enables, &local_disables);
+    if (local_enables.profiling) {
+        EnableProfiling(OBJECT_LAYER_DESCRIPTION);
+    }
 
     // Create temporary dispatch vector for pre-calls until instance is created
     std::vector<ValidationObject*> local_object_dispatch;
     // Add VOs to dispatch vector. Order here will be the validation dispatch order!
+#if VVL_ENABLE_THREADING
     auto thread_checker = new ThreadSafety(nullptr);
     if (!local_disables.thread_safety) {
         local_object_dispatch.emplace_back(thread_checker);
@@ -417,6 +483,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     thread_checker->container_type = LayerObjectTypeThreading;
     thread_checker->api_version = api_version;
     thread_checker->report_data = report_data;
+#endif
+#if VVL_ENABLE_STATELESS
     auto parameter_validation = new StatelessValidation;
     if (!local_disables.stateless_checks) {
         local_object_dispatch.emplace_back(parameter_validation);
@@ -424,6 +492,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     parameter_validation->container_type = LayerObjectTypeParameterValidation;
     parameter_validation->api_version = api_version;
     parameter_validation->report_data = report_data;
+#endif
+#if VVL_ENABLE_OBJECT_LIFETIMES
     auto object_tracker = new ObjectLifetimes;
     if (!local_disables.object_tracking) {
         local_object_dispatch.emplace_back(object_tracker);
@@ -431,6 +501,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     object_tracker->container_type = LayerObjectTypeObjectTracker;
     object_tracker->api_version = api_version;
     object_tracker->report_data = report_data;
+#endif
+#if VVL_ENABLE_CORE
     auto core_checks = new CoreChecks;
     if (!local_disables.core_checks) {
         local_object_dispatch.emplace_back(core_checks);
@@ -438,6 +510,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     core_checks->container_type = LayerObjectTypeCoreValidation;
     core_checks->api_version = api_version;
     core_checks->report_data = report_data;
+#endif
+#if VVL_ENABLE_BEST_PRACTICES
     auto best_practices = new BestPractices;
     if (local_enables.best_practices) {
         local_object_dispatch.emplace_back(best_practices);
@@ -445,6 +519,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     best_practices->container_type = LayerObjectTypeBestPractices;
     best_practices->api_version = api_version;
     best_practices->report_data = report_data;
+#endif
+#if VVL_ENABLE_GPU_ASSISTED
     auto gpu_assisted = new GpuAssisted;
     if (local_enables.gpu_validation) {
         local_object_dispatch.emplace_back(gpu_assisted);
@@ -452,6 +528,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     gpu_assisted->container_type = LayerObjectTypeGpuAssisted;
     gpu_assisted->api_version = api_version;
     gpu_assisted->report_data = report_data;
+#endif
 
     // If handle wrapping is disabled via the ValidationFeatures extension, override build flag
     if (local_disables.handle_wrapping) {
@@ -484,26 +561,38 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
 
     layer_debug_messenger_actions(framework->report_data, pAllocator, OBJECT_LAYER_DESCRIPTION);
 
+#if VVL_ENABLE_OBJECT_LIFETIMES
     object_tracker->instance_dispatch_table = framework->instance_dispatch_table;
     object_tracker->enabled = framework->enabled;
     object_tracker->disabled = framework->disabled;
+#endif
+#if VVL_ENABLE_THREADING
     thread_checker->instance_dispatch_table = framework->instance_dispatch_table;
     thread_checker->enabled = framework->enabled;
     thread_checker->disabled = framework->disabled;
+#endif
+#if VVL_ENABLE_STATELESS
     parameter_validation->instance_dispatch_table = framework->instance_dispatch_table;
     parameter_validation->enabled = framework->enabled;
     parameter_validation->disabled = framework->disabled;
+#endif
+#if VVL_ENABLE_CORE
     core_checks->instance_dispatch_table = framework->instance_dispatch_table;
     core_checks->instance = *pInstance;
     core_checks->enabled = framework->enabled;
     core_checks->disabled = framework->disabled;
     core_checks->instance_state = core_checks;
+#endif
+#if VVL_ENABLE_BEST_PRACTICES
     best_practices->instance_dispatch_table = framework->instance_dispatch_table;
     best_practices->enabled = framework->enabled;
     best_practices->disabled = framework->disabled;
+#endif
+#if VVL_ENABLE_GPU_ASSISTED
     gpu_assisted->instance_dispatch_table = framework->instance_dispatch_table;
     gpu_assisted->enabled = framework->enabled;
     gpu_assisted->disabled = framework->disabled;
+#endif
 
     for (auto intercept : framework->object_dispatch) {
         intercept->PostCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance, result);
@@ -521,10 +610,12 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyInstance, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyInstance(instance, pAllocator);
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyInstance, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyInstance(instance, pAllocator);
     }
 
@@ -532,6 +623,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyInstance, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyInstance(instance, pAllocator);
     }
 
@@ -578,11 +670,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
     bool skip = false;
     for (auto intercept : instance_interceptor->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDevice, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDevice(gpu, pCreateInfo, pAllocator, pDevice);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : instance_interceptor->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDevice, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, &modified_create_info);
     }
 
@@ -608,21 +702,28 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
     device_interceptor->report_data = instance_interceptor->report_data;
 
     // Note that this defines the order in which the layer validation objects are called
+#if VVL_ENABLE_THREADING
     auto thread_safety = new ThreadSafety(reinterpret_cast<ThreadSafety *>(instance_interceptor->GetValidationObject(instance_interceptor->object_dispatch, LayerObjectTypeThreading)));
     thread_safety->container_type = LayerObjectTypeThreading;
     if (!instance_interceptor->disabled.thread_safety) {
         device_interceptor->object_dispatch.emplace_back(thread_safety);
     }
+#endif
+#if VVL_ENABLE_STATELESS
     auto stateless_validation = new StatelessValidation;
     stateless_validation->container_type = LayerObjectTypeParameterValidation;
     if (!instance_interceptor->disabled.stateless_checks) {
         device_interceptor->object_dispatch.emplace_back(stateless_validation);
     }
+#endif
+#if VVL_ENABLE_OBJECT_LIFETIMES
     auto object_tracker = new ObjectLifetimes;
     object_tracker->container_type = LayerObjectTypeObjectTracker;
     if (!instance_interceptor->disabled.object_tracking) {
         device_interceptor->object_dispatch.emplace_back(object_tracker);
     }
+#endif
+#if VVL_ENABLE_CORE
     auto core_checks = new CoreChecks;
     core_checks->container_type = LayerObjectTypeCoreValidation;
     core_checks->instance_state = reinterpret_cast<CoreChecks *>(
@@ -636,6 +737,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
         }
         device_interceptor->object_dispatch.emplace_back(core_checks);
     }
+#endif
+#if VVL_ENABLE_BEST_PRACTICES
     auto best_practices = new BestPractices;
     best_practices->container_type = LayerObjectTypeBestPractices;
     best_practices->instance_state = reinterpret_cast<BestPractices *>(
@@ -643,6 +746,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
     if (instance_interceptor->enabled.best_practices) {
         device_interceptor->object_dispatch.emplace_back(best_practices);
     }
+#endif
+#if VVL_ENABLE_GPU_ASSISTED
     auto gpu_assisted = new GpuAssisted;
     gpu_assisted->container_type = LayerObjectTypeGpuAssisted;
     gpu_assisted->instance_state = reinterpret_cast<GpuAssisted *>(
@@ -650,6 +755,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
     if (instance_interceptor->enabled.gpu_validation) {
         device_interceptor->object_dispatch.emplace_back(gpu_assisted);
     }
+#endif
 
     // Set per-intercept common data items
     for (auto dev_intercept : device_interceptor->object_dispatch) {
@@ -668,6 +774,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
 
     for (auto intercept : instance_interceptor->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDevice, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, result);
     }
 
@@ -681,10 +788,12 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     auto layer_data = GetLayerDataPtr(key, layer_data_map);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyDevice, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDevice(device, pAllocator);
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyDevice, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyDevice(device, pAllocator);
     }
 
@@ -692,6 +801,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyDevice, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyDevice(device, pAllocator);
     }
 
@@ -699,6 +809,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
         delete *item;
     }
     FreeLayerDataPtr(key, layer_data_map);
+
+    // Results accumulate across devices; each device destruction writes everything recorded so far
+    layer_profiler::WriteResults();
 }
 
 
@@ -719,11 +832,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
     for (auto intercept : layer_data->object_dispatch) {
         cgpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateGraphicsPipelines, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateGraphicsPipelines, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
     }
 
@@ -733,6 +848,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateGraphicsPipelines, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, &(cgpl_state[intercept->container_type]));
     }
     return result;
@@ -754,11 +870,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
     for (auto intercept : layer_data->object_dispatch) {
         ccpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateComputePipelines, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateComputePipelines, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
     }
 
@@ -768,6 +886,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateComputePipelines, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, &(ccpl_state[intercept->container_type]));
     }
     return result;
@@ -788,12 +907,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
     for (auto intercept : layer_data->object_dispatch) {
         crtpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateRayTracingPipelinesNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos,
                                                                       pAllocator, pPipelines, &(crtpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateRayTracingPipelinesNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                             pPipelines, &(crtpl_state[intercept->container_type]));
     }
@@ -802,6 +923,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateRayTracingPipelinesNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                              pPipelines, result, &(crtpl_state[intercept->container_type]));
     }
@@ -822,16 +944,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreatePipelineLayout, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreatePipelineLayout, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, &cpl_state);
     }
     VkResult result = DispatchCreatePipelineLayout(device, &cpl_state.modified_create_info, pAllocator, pPipelineLayout);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreatePipelineLayout, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, result);
     }
     return result;
@@ -851,16 +976,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateShaderModule, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateShaderModule, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
     }
     VkResult result = DispatchCreateShaderModule(device, &csm_state.instrumented_create_info, pAllocator, pShaderModule);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateShaderModule, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, result, &csm_state);
     }
     return result;
@@ -877,16 +1005,19 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAllocateDescriptorSets, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, &ads_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAllocateDescriptorSets, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     }
     VkResult result = DispatchAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAllocateDescriptorSets, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, result, &ads_state);
     }
     return result;
@@ -906,16 +1037,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateBuffer, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateBuffer(device, pCreateInfo, pAllocator, pBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateBuffer, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, &cb_state);
     }
     VkResult result = DispatchCreateBuffer(device, &cb_state.modified_create_info, pAllocator, pBuffer);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateBuffer, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, result);
     }
     return result;
@@ -952,12 +1086,14 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceToolPropertiesEXT(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceToolPropertiesEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceToolPropertiesEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties);
     }
 
@@ -970,6 +1106,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceToolPropertiesEXT(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceToolPropertiesEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, result);
     }
     return result;
@@ -1049,16 +1186,19 @@ VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDevices(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledEnumeratePhysicalDevices, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateEnumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledEnumeratePhysicalDevices, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordEnumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices);
     }
     VkResult result = DispatchEnumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledEnumeratePhysicalDevices, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordEnumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices, result);
     }
     return result;
@@ -1071,16 +1211,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFeatures(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceFeatures, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFeatures(physicalDevice, pFeatures);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceFeatures, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceFeatures(physicalDevice, pFeatures);
     }
     DispatchGetPhysicalDeviceFeatures(physicalDevice, pFeatures);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceFeatures, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceFeatures(physicalDevice, pFeatures);
     }
 }
@@ -1093,16 +1236,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFormatProperties(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceFormatProperties, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFormatProperties(physicalDevice, format, pFormatProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceFormatProperties, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceFormatProperties(physicalDevice, format, pFormatProperties);
     }
     DispatchGetPhysicalDeviceFormatProperties(physicalDevice, format, pFormatProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceFormatProperties, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceFormatProperties(physicalDevice, format, pFormatProperties);
     }
 }
@@ -1119,16 +1265,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceImageFormatProperties(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceImageFormatProperties, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceImageFormatProperties, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceImageFormatProperties, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties, result);
     }
     return result;
@@ -1141,16 +1290,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceProperties(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceProperties, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceProperties(physicalDevice, pProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceProperties, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceProperties(physicalDevice, pProperties);
     }
     DispatchGetPhysicalDeviceProperties(physicalDevice, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceProperties, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceProperties(physicalDevice, pProperties);
     }
 }
@@ -1163,16 +1315,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyProperties(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceQueueFamilyProperties, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceQueueFamilyProperties, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     }
     DispatchGetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceQueueFamilyProperties, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     }
 }
@@ -1184,16 +1339,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMemoryProperties(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceMemoryProperties, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceMemoryProperties(physicalDevice, pMemoryProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceMemoryProperties, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceMemoryProperties(physicalDevice, pMemoryProperties);
     }
     DispatchGetPhysicalDeviceMemoryProperties(physicalDevice, pMemoryProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceMemoryProperties, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceMemoryProperties(physicalDevice, pMemoryProperties);
     }
 }
@@ -1207,16 +1365,19 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceQueue(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceQueue, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceQueue, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
     }
     DispatchGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceQueue, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
     }
 }
@@ -1230,16 +1391,19 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledQueueSubmit, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueSubmit(queue, submitCount, pSubmits, fence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledQueueSubmit, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordQueueSubmit(queue, submitCount, pSubmits, fence);
     }
     VkResult result = DispatchQueueSubmit(queue, submitCount, pSubmits, fence);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledQueueSubmit, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, result);
     }
     return result;
@@ -1251,16 +1415,19 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueWaitIdle(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledQueueWaitIdle, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueWaitIdle(queue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledQueueWaitIdle, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordQueueWaitIdle(queue);
     }
     VkResult result = DispatchQueueWaitIdle(queue);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledQueueWaitIdle, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordQueueWaitIdle(queue, result);
     }
     return result;
@@ -1272,16 +1439,19 @@ VKAPI_ATTR VkResult VKAPI_CALL DeviceWaitIdle(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDeviceWaitIdle, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDeviceWaitIdle(device);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDeviceWaitIdle, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDeviceWaitIdle(device);
     }
     VkResult result = DispatchDeviceWaitIdle(device);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDeviceWaitIdle, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDeviceWaitIdle(device, result);
     }
     return result;
@@ -1296,16 +1466,19 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAllocateMemory, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAllocateMemory, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
     }
     VkResult result = DispatchAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAllocateMemory, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordAllocateMemory(device, pAllocateInfo, pAllocator, pMemory, result);
     }
     return result;
@@ -1319,16 +1492,19 @@ VKAPI_ATTR void VKAPI_CALL FreeMemory(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledFreeMemory, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFreeMemory(device, memory, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledFreeMemory, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordFreeMemory(device, memory, pAllocator);
     }
     DispatchFreeMemory(device, memory, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledFreeMemory, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordFreeMemory(device, memory, pAllocator);
     }
 }
@@ -1344,16 +1520,19 @@ VKAPI_ATTR VkResult VKAPI_CALL MapMemory(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledMapMemory, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateMapMemory(device, memory, offset, size, flags, ppData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledMapMemory, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordMapMemory(device, memory, offset, size, flags, ppData);
     }
     VkResult result = DispatchMapMemory(device, memory, offset, size, flags, ppData);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledMapMemory, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordMapMemory(device, memory, offset, size, flags, ppData, result);
     }
     return result;
@@ -1366,16 +1545,19 @@ VKAPI_ATTR void VKAPI_CALL UnmapMemory(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledUnmapMemory, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUnmapMemory(device, memory);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledUnmapMemory, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordUnmapMemory(device, memory);
     }
     DispatchUnmapMemory(device, memory);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledUnmapMemory, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordUnmapMemory(device, memory);
     }
 }
@@ -1388,16 +1570,19 @@ VKAPI_ATTR VkResult VKAPI_CALL FlushMappedMemoryRanges(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledFlushMappedMemoryRanges, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledFlushMappedMemoryRanges, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
     }
     VkResult result = DispatchFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledFlushMappedMemoryRanges, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges, result);
     }
     return result;
@@ -1411,16 +1596,19 @@ VKAPI_ATTR VkResult VKAPI_CALL InvalidateMappedMemoryRanges(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledInvalidateMappedMemoryRanges, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledInvalidateMappedMemoryRanges, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
     }
     VkResult result = DispatchInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledInvalidateMappedMemoryRanges, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges, result);
     }
     return result;
@@ -1434,16 +1622,19 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceMemoryCommitment(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceMemoryCommitment, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceMemoryCommitment, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
     }
     DispatchGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceMemoryCommitment, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
     }
 }
@@ -1457,16 +1648,19 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledBindBufferMemory, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindBufferMemory(device, buffer, memory, memoryOffset);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledBindBufferMemory, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordBindBufferMemory(device, buffer, memory, memoryOffset);
     }
     VkResult result = DispatchBindBufferMemory(device, buffer, memory, memoryOffset);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledBindBufferMemory, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordBindBufferMemory(device, buffer, memory, memoryOffset, result);
     }
     return result;
@@ -1481,16 +1675,19 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledBindImageMemory, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindImageMemory(device, image, memory, memoryOffset);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledBindImageMemory, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordBindImageMemory(device, image, memory, memoryOffset);
     }
     VkResult result = DispatchBindImageMemory(device, image, memory, memoryOffset);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledBindImageMemory, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordBindImageMemory(device, image, memory, memoryOffset, result);
     }
     return result;
@@ -1504,16 +1701,19 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetBufferMemoryRequirements, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetBufferMemoryRequirements, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
     }
     DispatchGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetBufferMemoryRequirements, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
     }
 }
@@ -1526,16 +1726,19 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageMemoryRequirements, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageMemoryRequirements(device, image, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageMemoryRequirements, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetImageMemoryRequirements(device, image, pMemoryRequirements);
     }
     DispatchGetImageMemoryRequirements(device, image, pMemoryRequirements);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageMemoryRequirements, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetImageMemoryRequirements(device, image, pMemoryRequirements);
     }
 }
@@ -1549,16 +1752,19 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageSparseMemoryRequirements, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageSparseMemoryRequirements, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
     DispatchGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageSparseMemoryRequirements, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
 }
@@ -1576,16 +1782,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSparseImageFormatProperties, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSparseImageFormatProperties(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSparseImageFormatProperties, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceSparseImageFormatProperties(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
     }
     DispatchGetPhysicalDeviceSparseImageFormatProperties(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSparseImageFormatProperties, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceSparseImageFormatProperties(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
     }
 }
@@ -1599,16 +1808,19 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueBindSparse(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledQueueBindSparse, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledQueueBindSparse, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
     }
     VkResult result = DispatchQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledQueueBindSparse, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordQueueBindSparse(queue, bindInfoCount, pBindInfo, fence, result);
     }
     return result;
@@ -1623,16 +1835,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateFence(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateFence, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateFence(device, pCreateInfo, pAllocator, pFence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateFence, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateFence(device, pCreateInfo, pAllocator, pFence);
     }
     VkResult result = DispatchCreateFence(device, pCreateInfo, pAllocator, pFence);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateFence, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateFence(device, pCreateInfo, pAllocator, pFence, result);
     }
     return result;
@@ -1646,16 +1861,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyFence(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyFence, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyFence(device, fence, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyFence, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyFence(device, fence, pAllocator);
     }
     DispatchDestroyFence(device, fence, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyFence, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyFence(device, fence, pAllocator);
     }
 }
@@ -1668,16 +1886,19 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetFences(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledResetFences, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetFences(device, fenceCount, pFences);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledResetFences, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordResetFences(device, fenceCount, pFences);
     }
     VkResult result = DispatchResetFences(device, fenceCount, pFences);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledResetFences, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordResetFences(device, fenceCount, pFences, result);
     }
     return result;
@@ -1690,16 +1911,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceStatus(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetFenceStatus, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetFenceStatus(device, fence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetFenceStatus, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetFenceStatus(device, fence);
     }
     VkResult result = DispatchGetFenceStatus(device, fence);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetFenceStatus, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetFenceStatus(device, fence, result);
     }
     return result;
@@ -1715,16 +1939,19 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitForFences(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledWaitForFences, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWaitForFences(device, fenceCount, pFences, waitAll, timeout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledWaitForFences, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout);
     }
     VkResult result = DispatchWaitForFences(device, fenceCount, pFences, waitAll, timeout);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledWaitForFences, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout, result);
     }
     return result;
@@ -1739,16 +1966,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSemaphore(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateSemaphore, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateSemaphore, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
     }
     VkResult result = DispatchCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateSemaphore, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore, result);
     }
     return result;
@@ -1762,16 +1992,19 @@ VKAPI_ATTR void VKAPI_CALL DestroySemaphore(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroySemaphore, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySemaphore(device, semaphore, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroySemaphore, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroySemaphore(device, semaphore, pAllocator);
     }
     DispatchDestroySemaphore(device, semaphore, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroySemaphore, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroySemaphore(device, semaphore, pAllocator);
     }
 }
@@ -1785,16 +2018,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateEvent(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateEvent, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateEvent(device, pCreateInfo, pAllocator, pEvent);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateEvent, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateEvent(device, pCreateInfo, pAllocator, pEvent);
     }
     VkResult result = DispatchCreateEvent(device, pCreateInfo, pAllocator, pEvent);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateEvent, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateEvent(device, pCreateInfo, pAllocator, pEvent, result);
     }
     return result;
@@ -1808,16 +2044,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyEvent(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyEvent, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyEvent(device, event, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyEvent, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyEvent(device, event, pAllocator);
     }
     DispatchDestroyEvent(device, event, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyEvent, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyEvent(device, event, pAllocator);
     }
 }
@@ -1829,16 +2068,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetEventStatus(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetEventStatus, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetEventStatus(device, event);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetEventStatus, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetEventStatus(device, event);
     }
     VkResult result = DispatchGetEventStatus(device, event);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetEventStatus, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetEventStatus(device, event, result);
     }
     return result;
@@ -1851,16 +2093,19 @@ VKAPI_ATTR VkResult VKAPI_CALL SetEvent(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledSetEvent, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetEvent(device, event);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledSetEvent, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordSetEvent(device, event);
     }
     VkResult result = DispatchSetEvent(device, event);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledSetEvent, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordSetEvent(device, event, result);
     }
     return result;
@@ -1873,16 +2118,19 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetEvent(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledResetEvent, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetEvent(device, event);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledResetEvent, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordResetEvent(device, event);
     }
     VkResult result = DispatchResetEvent(device, event);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledResetEvent, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordResetEvent(device, event, result);
     }
     return result;
@@ -1897,16 +2145,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateQueryPool(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateQueryPool, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateQueryPool, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
     }
     VkResult result = DispatchCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateQueryPool, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool, result);
     }
     return result;
@@ -1920,16 +2171,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyQueryPool(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyQueryPool, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyQueryPool(device, queryPool, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyQueryPool, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyQueryPool(device, queryPool, pAllocator);
     }
     DispatchDestroyQueryPool(device, queryPool, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyQueryPool, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyQueryPool(device, queryPool, pAllocator);
     }
 }
@@ -1947,16 +2201,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetQueryPoolResults(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetQueryPoolResults, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetQueryPoolResults, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
     }
     VkResult result = DispatchGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetQueryPoolResults, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags, result);
     }
     return result;
@@ -1970,16 +2227,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyBuffer(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyBuffer, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyBuffer(device, buffer, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyBuffer, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyBuffer(device, buffer, pAllocator);
     }
     DispatchDestroyBuffer(device, buffer, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyBuffer, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyBuffer(device, buffer, pAllocator);
     }
 }
@@ -1993,16 +2253,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBufferView(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateBufferView, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateBufferView(device, pCreateInfo, pAllocator, pView);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateBufferView, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateBufferView(device, pCreateInfo, pAllocator, pView);
     }
     VkResult result = DispatchCreateBufferView(device, pCreateInfo, pAllocator, pView);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateBufferView, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateBufferView(device, pCreateInfo, pAllocator, pView, result);
     }
     return result;
@@ -2016,16 +2279,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyBufferView(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyBufferView, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyBufferView(device, bufferView, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyBufferView, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyBufferView(device, bufferView, pAllocator);
     }
     DispatchDestroyBufferView(device, bufferView, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyBufferView, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyBufferView(device, bufferView, pAllocator);
     }
 }
@@ -2039,16 +2305,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImage(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateImage, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateImage(device, pCreateInfo, pAllocator, pImage);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateImage, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateImage(device, pCreateInfo, pAllocator, pImage);
     }
     VkResult result = DispatchCreateImage(device, pCreateInfo, pAllocator, pImage);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateImage, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateImage(device, pCreateInfo, pAllocator, pImage, result);
     }
     return result;
@@ -2062,16 +2331,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyImage(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyImage, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyImage(device, image, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyImage, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyImage(device, image, pAllocator);
     }
     DispatchDestroyImage(device, image, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyImage, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyImage(device, image, pAllocator);
     }
 }
@@ -2085,16 +2357,19 @@ VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageSubresourceLayout, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSubresourceLayout(device, image, pSubresource, pLayout);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageSubresourceLayout, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetImageSubresourceLayout(device, image, pSubresource, pLayout);
     }
     DispatchGetImageSubresourceLayout(device, image, pSubresource, pLayout);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageSubresourceLayout, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetImageSubresourceLayout(device, image, pSubresource, pLayout);
     }
 }
@@ -2108,16 +2383,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImageView(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateImageView, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateImageView(device, pCreateInfo, pAllocator, pView);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateImageView, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateImageView(device, pCreateInfo, pAllocator, pView);
     }
     VkResult result = DispatchCreateImageView(device, pCreateInfo, pAllocator, pView);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateImageView, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateImageView(device, pCreateInfo, pAllocator, pView, result);
     }
     return result;
@@ -2131,16 +2409,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyImageView(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyImageView, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyImageView(device, imageView, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyImageView, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyImageView(device, imageView, pAllocator);
     }
     DispatchDestroyImageView(device, imageView, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyImageView, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyImageView(device, imageView, pAllocator);
     }
 }
@@ -2153,16 +2434,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyShaderModule(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyShaderModule, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyShaderModule(device, shaderModule, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyShaderModule, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyShaderModule(device, shaderModule, pAllocator);
     }
     DispatchDestroyShaderModule(device, shaderModule, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyShaderModule, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyShaderModule(device, shaderModule, pAllocator);
     }
 }
@@ -2176,16 +2460,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineCache(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreatePipelineCache, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreatePipelineCache, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
     }
     VkResult result = DispatchCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreatePipelineCache, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache, result);
     }
     return result;
@@ -2199,16 +2486,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipelineCache(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyPipelineCache, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPipelineCache(device, pipelineCache, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyPipelineCache, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyPipelineCache(device, pipelineCache, pAllocator);
     }
     DispatchDestroyPipelineCache(device, pipelineCache, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyPipelineCache, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyPipelineCache(device, pipelineCache, pAllocator);
     }
 }
@@ -2222,16 +2512,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineCacheData(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPipelineCacheData, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPipelineCacheData, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
     }
     VkResult result = DispatchGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPipelineCacheData, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPipelineCacheData(device, pipelineCache, pDataSize, pData, result);
     }
     return result;
@@ -2246,16 +2539,19 @@ VKAPI_ATTR VkResult VKAPI_CALL MergePipelineCaches(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledMergePipelineCaches, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledMergePipelineCaches, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
     }
     VkResult result = DispatchMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledMergePipelineCaches, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches, result);
     }
     return result;
@@ -2269,16 +2565,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipeline(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyPipeline, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPipeline(device, pipeline, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyPipeline, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyPipeline(device, pipeline, pAllocator);
     }
     DispatchDestroyPipeline(device, pipeline, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyPipeline, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyPipeline(device, pipeline, pAllocator);
     }
 }
@@ -2291,16 +2590,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipelineLayout(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyPipelineLayout, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPipelineLayout(device, pipelineLayout, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyPipelineLayout, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyPipelineLayout(device, pipelineLayout, pAllocator);
     }
     DispatchDestroyPipelineLayout(device, pipelineLayout, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyPipelineLayout, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyPipelineLayout(device, pipelineLayout, pAllocator);
     }
 }
@@ -2314,16 +2616,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSampler(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateSampler, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSampler(device, pCreateInfo, pAllocator, pSampler);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateSampler, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateSampler(device, pCreateInfo, pAllocator, pSampler);
     }
     VkResult result = DispatchCreateSampler(device, pCreateInfo, pAllocator, pSampler);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateSampler, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateSampler(device, pCreateInfo, pAllocator, pSampler, result);
     }
     return result;
@@ -2337,16 +2642,19 @@ VKAPI_ATTR void VKAPI_CALL DestroySampler(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroySampler, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySampler(device, sampler, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroySampler, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroySampler(device, sampler, pAllocator);
     }
     DispatchDestroySampler(device, sampler, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroySampler, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroySampler(device, sampler, pAllocator);
     }
 }
@@ -2360,16 +2668,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorSetLayout(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDescriptorSetLayout, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDescriptorSetLayout, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
     }
     VkResult result = DispatchCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDescriptorSetLayout, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout, result);
     }
     return result;
@@ -2383,16 +2694,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorSetLayout(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyDescriptorSetLayout, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyDescriptorSetLayout, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
     }
     DispatchDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyDescriptorSetLayout, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
     }
 }
@@ -2406,16 +2720,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorPool(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDescriptorPool, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDescriptorPool, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
     }
     VkResult result = DispatchCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDescriptorPool, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool, result);
     }
     return result;
@@ -2429,16 +2746,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorPool(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyDescriptorPool, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorPool(device, descriptorPool, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyDescriptorPool, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyDescriptorPool(device, descriptorPool, pAllocator);
     }
     DispatchDestroyDescriptorPool(device, descriptorPool, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyDescriptorPool, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyDescriptorPool(device, descriptorPool, pAllocator);
     }
 }
@@ -2451,16 +2771,19 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetDescriptorPool(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledResetDescriptorPool, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetDescriptorPool(device, descriptorPool, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledResetDescriptorPool, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordResetDescriptorPool(device, descriptorPool, flags);
     }
     VkResult result = DispatchResetDescriptorPool(device, descriptorPool, flags);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledResetDescriptorPool, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordResetDescriptorPool(device, descriptorPool, flags, result);
     }
     return result;
@@ -2475,16 +2798,19 @@ VKAPI_ATTR VkResult VKAPI_CALL FreeDescriptorSets(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledFreeDescriptorSets, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledFreeDescriptorSets, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
     }
     VkResult result = DispatchFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledFreeDescriptorSets, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets, result);
     }
     return result;
@@ -2500,16 +2826,19 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSets(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledUpdateDescriptorSets, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledUpdateDescriptorSets, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
     }
     DispatchUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledUpdateDescriptorSets, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
     }
 }
@@ -2523,16 +2852,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateFramebuffer(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateFramebuffer, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateFramebuffer, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
     }
     VkResult result = DispatchCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateFramebuffer, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer, result);
     }
     return result;
@@ -2546,16 +2878,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyFramebuffer(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyFramebuffer, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyFramebuffer(device, framebuffer, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyFramebuffer, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyFramebuffer(device, framebuffer, pAllocator);
     }
     DispatchDestroyFramebuffer(device, framebuffer, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyFramebuffer, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyFramebuffer(device, framebuffer, pAllocator);
     }
 }
@@ -2569,16 +2904,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateRenderPass, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateRenderPass, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
     }
     VkResult result = DispatchCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateRenderPass, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass, result);
     }
     return result;
@@ -2592,16 +2930,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyRenderPass(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyRenderPass, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyRenderPass(device, renderPass, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyRenderPass, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyRenderPass(device, renderPass, pAllocator);
     }
     DispatchDestroyRenderPass(device, renderPass, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyRenderPass, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyRenderPass(device, renderPass, pAllocator);
     }
 }
@@ -2614,16 +2955,19 @@ VKAPI_ATTR void VKAPI_CALL GetRenderAreaGranularity(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetRenderAreaGranularity, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRenderAreaGranularity(device, renderPass, pGranularity);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetRenderAreaGranularity, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetRenderAreaGranularity(device, renderPass, pGranularity);
     }
     DispatchGetRenderAreaGranularity(device, renderPass, pGranularity);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetRenderAreaGranularity, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetRenderAreaGranularity(device, renderPass, pGranularity);
     }
 }
@@ -2637,16 +2981,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCommandPool(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateCommandPool, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateCommandPool, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
     }
     VkResult result = DispatchCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateCommandPool, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool, result);
     }
     return result;
@@ -2660,16 +3007,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyCommandPool(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyCommandPool, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyCommandPool(device, commandPool, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyCommandPool, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyCommandPool(device, commandPool, pAllocator);
     }
     DispatchDestroyCommandPool(device, commandPool, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyCommandPool, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyCommandPool(device, commandPool, pAllocator);
     }
 }
@@ -2682,16 +3032,19 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetCommandPool(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledResetCommandPool, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetCommandPool(device, commandPool, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledResetCommandPool, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordResetCommandPool(device, commandPool, flags);
     }
     VkResult result = DispatchResetCommandPool(device, commandPool, flags);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledResetCommandPool, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordResetCommandPool(device, commandPool, flags, result);
     }
     return result;
@@ -2705,16 +3058,19 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateCommandBuffers(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAllocateCommandBuffers, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAllocateCommandBuffers, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
     }
     VkResult result = DispatchAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAllocateCommandBuffers, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers, result);
     }
     return result;
@@ -2729,16 +3085,19 @@ VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledFreeCommandBuffers, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledFreeCommandBuffers, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
     }
     DispatchFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledFreeCommandBuffers, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
     }
 }
@@ -2750,16 +3109,19 @@ VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledBeginCommandBuffer, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBeginCommandBuffer(commandBuffer, pBeginInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledBeginCommandBuffer, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo);
     }
     VkResult result = DispatchBeginCommandBuffer(commandBuffer, pBeginInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledBeginCommandBuffer, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo, result);
     }
     return result;
@@ -2771,16 +3133,19 @@ VKAPI_ATTR VkResult VKAPI_CALL EndCommandBuffer(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledEndCommandBuffer, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateEndCommandBuffer(commandBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledEndCommandBuffer, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordEndCommandBuffer(commandBuffer);
     }
     VkResult result = DispatchEndCommandBuffer(commandBuffer);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledEndCommandBuffer, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordEndCommandBuffer(commandBuffer, result);
     }
     return result;
@@ -2793,16 +3158,19 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetCommandBuffer(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledResetCommandBuffer, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetCommandBuffer(commandBuffer, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledResetCommandBuffer, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordResetCommandBuffer(commandBuffer, flags);
     }
     VkResult result = DispatchResetCommandBuffer(commandBuffer, flags);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledResetCommandBuffer, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordResetCommandBuffer(commandBuffer, flags, result);
     }
     return result;
@@ -2815,17 +3183,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBindPipeline, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBindPipeline, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
     }
     DispatchCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBindPipeline, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
     }
 }
@@ -2838,17 +3209,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewport(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetViewport, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetViewport, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
     }
     DispatchCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetViewport, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
     }
 }
@@ -2861,17 +3235,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissor(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetScissor, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetScissor, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
     }
     DispatchCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetScissor, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
     }
 }
@@ -2882,17 +3259,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineWidth(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetLineWidth, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetLineWidth(commandBuffer, lineWidth);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetLineWidth, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdSetLineWidth(commandBuffer, lineWidth);
     }
     DispatchCmdSetLineWidth(commandBuffer, lineWidth);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetLineWidth, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdSetLineWidth(commandBuffer, lineWidth);
     }
 }
@@ -2905,17 +3285,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetDepthBias, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetDepthBias, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
     }
     DispatchCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetDepthBias, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
     }
 }
@@ -2926,17 +3309,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetBlendConstants(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetBlendConstants, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetBlendConstants(commandBuffer, blendConstants);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetBlendConstants, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdSetBlendConstants(commandBuffer, blendConstants);
     }
     DispatchCmdSetBlendConstants(commandBuffer, blendConstants);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetBlendConstants, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdSetBlendConstants(commandBuffer, blendConstants);
     }
 }
@@ -2948,17 +3334,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBounds(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetDepthBounds, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetDepthBounds, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
     }
     DispatchCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetDepthBounds, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
     }
 }
@@ -2970,17 +3359,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilCompareMask(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetStencilCompareMask, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetStencilCompareMask, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
     }
     DispatchCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetStencilCompareMask, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
     }
 }
@@ -2992,17 +3384,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilWriteMask(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetStencilWriteMask, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetStencilWriteMask, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
     }
     DispatchCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetStencilWriteMask, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
     }
 }
@@ -3014,17 +3409,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilReference(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetStencilReference, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilReference(commandBuffer, faceMask, reference);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetStencilReference, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdSetStencilReference(commandBuffer, faceMask, reference);
     }
     DispatchCmdSetStencilReference(commandBuffer, faceMask, reference);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetStencilReference, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdSetStencilReference(commandBuffer, faceMask, reference);
     }
 }
@@ -3041,17 +3439,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBindDescriptorSets, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBindDescriptorSets, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     }
     DispatchCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBindDescriptorSets, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     }
 }
@@ -3064,17 +3465,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBindIndexBuffer, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBindIndexBuffer, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
     }
     DispatchCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBindIndexBuffer, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
     }
 }
@@ -3088,17 +3492,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBindVertexBuffers, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBindVertexBuffers, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
     }
     DispatchCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBindVertexBuffers, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
     }
 }
@@ -3112,17 +3519,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDraw(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDraw, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDraw, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
     }
     DispatchCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDraw, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
     }
 }
@@ -3137,17 +3547,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexed(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndexed, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndexed, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
     }
     DispatchCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndexed, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
     }
 }
@@ -3161,17 +3574,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirect(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndirect, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndirect, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
     DispatchCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndirect, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
 }
@@ -3185,17 +3601,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirect(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndexedIndirect, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndexedIndirect, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
     DispatchCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndexedIndirect, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
 }
@@ -3208,17 +3627,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatch(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDispatch, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDispatch, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
     }
     DispatchCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDispatch, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
     }
 }
@@ -3230,17 +3652,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDispatchIndirect, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatchIndirect(commandBuffer, buffer, offset);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDispatchIndirect, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdDispatchIndirect(commandBuffer, buffer, offset);
     }
     DispatchCmdDispatchIndirect(commandBuffer, buffer, offset);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDispatchIndirect, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdDispatchIndirect(commandBuffer, buffer, offset);
     }
 }
@@ -3254,17 +3679,20 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdCopyBuffer, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdCopyBuffer, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
     }
     DispatchCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdCopyBuffer, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
     }
 }
@@ -3280,17 +3708,20 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdCopyImage, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdCopyImage, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
     DispatchCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdCopyImage, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
 }
@@ -3307,17 +3738,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBlitImage, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBlitImage, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
     }
     DispatchCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBlitImage, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
     }
 }
@@ -3332,17 +3766,20 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdCopyBufferToImage, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdCopyBufferToImage, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
     }
     DispatchCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdCopyBufferToImage, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
     }
 }
@@ -3357,17 +3794,20 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdCopyImageToBuffer, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdCopyImageToBuffer, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
     }
     DispatchCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdCopyImageToBuffer, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
     }
 }
@@ -3381,17 +3821,20 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdateBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdUpdateBuffer, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdUpdateBuffer, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
     }
     DispatchCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdUpdateBuffer, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
     }
 }
@@ -3405,17 +3848,20 @@ VKAPI_ATTR void VKAPI_CALL CmdFillBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdFillBuffer, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdFillBuffer, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
     }
     DispatchCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdFillBuffer, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
     }
 }
@@ -3430,17 +3876,20 @@ VKAPI_ATTR void VKAPI_CALL CmdClearColorImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdClearColorImage, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdClearColorImage, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
     }
     DispatchCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdClearColorImage, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
     }
 }
@@ -3455,17 +3904,20 @@ VKAPI_ATTR void VKAPI_CALL CmdClearDepthStencilImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdClearDepthStencilImage, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdClearDepthStencilImage, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
     }
     DispatchCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdClearDepthStencilImage, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
     }
 }
@@ -3479,17 +3931,20 @@ VKAPI_ATTR void VKAPI_CALL CmdClearAttachments(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdClearAttachments, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdClearAttachments, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
     }
     DispatchCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdClearAttachments, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
     }
 }
@@ -3505,17 +3960,20 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdResolveImage, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdResolveImage, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
     DispatchCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdResolveImage, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
 }
@@ -3527,17 +3985,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetEvent, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetEvent(commandBuffer, event, stageMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetEvent, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdSetEvent(commandBuffer, event, stageMask);
     }
     DispatchCmdSetEvent(commandBuffer, event, stageMask);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetEvent, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdSetEvent(commandBuffer, event, stageMask);
     }
 }
@@ -3549,17 +4010,20 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdResetEvent, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResetEvent(commandBuffer, event, stageMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdResetEvent, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdResetEvent(commandBuffer, event, stageMask);
     }
     DispatchCmdResetEvent(commandBuffer, event, stageMask);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdResetEvent, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdResetEvent(commandBuffer, event, stageMask);
     }
 }
@@ -3579,17 +4043,20 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdWaitEvents, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdWaitEvents, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
     DispatchCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdWaitEvents, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
 }
@@ -3608,17 +4075,20 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdPipelineBarrier, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdPipelineBarrier, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
     DispatchCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdPipelineBarrier, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
 }
@@ -3631,17 +4101,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQuery(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBeginQuery, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginQuery(commandBuffer, queryPool, query, flags);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBeginQuery, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdBeginQuery(commandBuffer, queryPool, query, flags);
     }
     DispatchCmdBeginQuery(commandBuffer, queryPool, query, flags);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBeginQuery, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdBeginQuery(commandBuffer, queryPool, query, flags);
     }
 }
@@ -3653,17 +4126,20 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQuery(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdEndQuery, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndQuery(commandBuffer, queryPool, query);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdEndQuery, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdEndQuery(commandBuffer, queryPool, query);
     }
     DispatchCmdEndQuery(commandBuffer, queryPool, query);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdEndQuery, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdEndQuery(commandBuffer, queryPool, query);
     }
 }
@@ -3676,17 +4152,20 @@ VKAPI_ATTR void VKAPI_CALL CmdResetQueryPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdResetQueryPool, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdResetQueryPool, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
     }
     DispatchCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdResetQueryPool, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
     }
 }
@@ -3699,17 +4178,20 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdWriteTimestamp, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdWriteTimestamp, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
     }
     DispatchCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdWriteTimestamp, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
     }
 }
@@ -3726,17 +4208,20 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyQueryPoolResults(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdCopyQueryPoolResults, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdCopyQueryPoolResults, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
     }
     DispatchCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdCopyQueryPoolResults, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
     }
 }
@@ -3751,17 +4236,20 @@ VKAPI_ATTR void VKAPI_CALL CmdPushConstants(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdPushConstants, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdPushConstants, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
     }
     DispatchCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdPushConstants, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
     }
 }
@@ -3773,17 +4261,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBeginRenderPass, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBeginRenderPass, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
     }
     DispatchCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBeginRenderPass, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
     }
 }
@@ -3794,17 +4285,20 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdNextSubpass, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdNextSubpass(commandBuffer, contents);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdNextSubpass, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdNextSubpass(commandBuffer, contents);
     }
     DispatchCmdNextSubpass(commandBuffer, contents);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdNextSubpass, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdNextSubpass(commandBuffer, contents);
     }
 }
@@ -3814,17 +4308,20 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdEndRenderPass, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndRenderPass(commandBuffer);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdEndRenderPass, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdEndRenderPass(commandBuffer);
     }
     DispatchCmdEndRenderPass(commandBuffer);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdEndRenderPass, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdEndRenderPass(commandBuffer);
     }
 }
@@ -3837,16 +4334,19 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteCommands(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdExecuteCommands, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdExecuteCommands, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
     }
     DispatchCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdExecuteCommands, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
     }
 }
@@ -3860,16 +4360,19 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledBindBufferMemory2, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindBufferMemory2(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledBindBufferMemory2, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordBindBufferMemory2(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindBufferMemory2(device, bindInfoCount, pBindInfos);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledBindBufferMemory2, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordBindBufferMemory2(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -3883,16 +4386,19 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory2(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledBindImageMemory2, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindImageMemory2(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledBindImageMemory2, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordBindImageMemory2(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindImageMemory2(device, bindInfoCount, pBindInfos);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledBindImageMemory2, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordBindImageMemory2(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -3908,16 +4414,19 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceGroupPeerMemoryFeatures(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceGroupPeerMemoryFeatures, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceGroupPeerMemoryFeatures, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
     DispatchGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceGroupPeerMemoryFeatures, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
 }
@@ -3928,17 +4437,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMask(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetDeviceMask, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDeviceMask(commandBuffer, deviceMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetDeviceMask, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdSetDeviceMask(commandBuffer, deviceMask);
     }
     DispatchCmdSetDeviceMask(commandBuffer, deviceMask);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetDeviceMask, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdSetDeviceMask(commandBuffer, deviceMask);
     }
 }
@@ -3954,17 +4466,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBase(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDispatchBase, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDispatchBase, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
     DispatchCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDispatchBase, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
 }
@@ -3977,16 +4492,19 @@ VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDeviceGroups(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledEnumeratePhysicalDeviceGroups, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateEnumeratePhysicalDeviceGroups(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledEnumeratePhysicalDeviceGroups, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordEnumeratePhysicalDeviceGroups(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
     }
     VkResult result = DispatchEnumeratePhysicalDeviceGroups(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledEnumeratePhysicalDeviceGroups, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordEnumeratePhysicalDeviceGroups(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties, result);
     }
     return result;
@@ -4000,16 +4518,19 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageMemoryRequirements2, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageMemoryRequirements2, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
     DispatchGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageMemoryRequirements2, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
 }
@@ -4022,16 +4543,19 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements2(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetBufferMemoryRequirements2, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetBufferMemoryRequirements2, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
     DispatchGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetBufferMemoryRequirements2, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
 }
@@ -4045,16 +4569,19 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements2(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageSparseMemoryRequirements2, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageSparseMemoryRequirements2, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
     DispatchGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageSparseMemoryRequirements2, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
 }
@@ -4066,16 +4593,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFeatures2(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceFeatures2, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFeatures2(physicalDevice, pFeatures);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceFeatures2, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceFeatures2(physicalDevice, pFeatures);
     }
     DispatchGetPhysicalDeviceFeatures2(physicalDevice, pFeatures);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceFeatures2, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceFeatures2(physicalDevice, pFeatures);
     }
 }
@@ -4087,16 +4617,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceProperties2(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceProperties2, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceProperties2(physicalDevice, pProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceProperties2, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceProperties2(physicalDevice, pProperties);
     }
     DispatchGetPhysicalDeviceProperties2(physicalDevice, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceProperties2, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceProperties2(physicalDevice, pProperties);
     }
 }
@@ -4109,16 +4642,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFormatProperties2(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceFormatProperties2, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFormatProperties2(physicalDevice, format, pFormatProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceFormatProperties2, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceFormatProperties2(physicalDevice, format, pFormatProperties);
     }
     DispatchGetPhysicalDeviceFormatProperties2(physicalDevice, format, pFormatProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceFormatProperties2, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceFormatProperties2(physicalDevice, format, pFormatProperties);
     }
 }
@@ -4131,16 +4667,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceImageFormatProperties2(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceImageFormatProperties2, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceImageFormatProperties2(physicalDevice, pImageFormatInfo, pImageFormatProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceImageFormatProperties2, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceImageFormatProperties2(physicalDevice, pImageFormatInfo, pImageFormatProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceImageFormatProperties2(physicalDevice, pImageFormatInfo, pImageFormatProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceImageFormatProperties2, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceImageFormatProperties2(physicalDevice, pImageFormatInfo, pImageFormatProperties, result);
     }
     return result;
@@ -4154,16 +4693,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyProperties2(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceQueueFamilyProperties2, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceQueueFamilyProperties2(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceQueueFamilyProperties2, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceQueueFamilyProperties2(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     }
     DispatchGetPhysicalDeviceQueueFamilyProperties2(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceQueueFamilyProperties2, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceQueueFamilyProperties2(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     }
 }
@@ -4175,16 +4717,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMemoryProperties2(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceMemoryProperties2, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceMemoryProperties2(physicalDevice, pMemoryProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceMemoryProperties2, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceMemoryProperties2(physicalDevice, pMemoryProperties);
     }
     DispatchGetPhysicalDeviceMemoryProperties2(physicalDevice, pMemoryProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceMemoryProperties2, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceMemoryProperties2(physicalDevice, pMemoryProperties);
     }
 }
@@ -4198,16 +4743,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties2(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSparseImageFormatProperties2, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSparseImageFormatProperties2(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSparseImageFormatProperties2, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceSparseImageFormatProperties2(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
     }
     DispatchGetPhysicalDeviceSparseImageFormatProperties2(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSparseImageFormatProperties2, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceSparseImageFormatProperties2(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
     }
 }
@@ -4220,16 +4768,19 @@ VKAPI_ATTR void VKAPI_CALL TrimCommandPool(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledTrimCommandPool, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateTrimCommandPool(device, commandPool, flags);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledTrimCommandPool, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordTrimCommandPool(device, commandPool, flags);
     }
     DispatchTrimCommandPool(device, commandPool, flags);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledTrimCommandPool, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordTrimCommandPool(device, commandPool, flags);
     }
 }
@@ -4242,16 +4793,19 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceQueue2(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceQueue2, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceQueue2(device, pQueueInfo, pQueue);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceQueue2, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetDeviceQueue2(device, pQueueInfo, pQueue);
     }
     DispatchGetDeviceQueue2(device, pQueueInfo, pQueue);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceQueue2, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetDeviceQueue2(device, pQueueInfo, pQueue);
     }
 }
@@ -4265,16 +4819,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversion(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateSamplerYcbcrConversion, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateSamplerYcbcrConversion, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
     }
     VkResult result = DispatchCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateSamplerYcbcrConversion, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion, result);
     }
     return result;
@@ -4288,16 +4845,19 @@ VKAPI_ATTR void VKAPI_CALL DestroySamplerYcbcrConversion(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroySamplerYcbcrConversion, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroySamplerYcbcrConversion, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
     }
     DispatchDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroySamplerYcbcrConversion, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
     }
 }
@@ -4311,16 +4871,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplate(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDescriptorUpdateTemplate, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDescriptorUpdateTemplate, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     }
     VkResult result = DispatchCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDescriptorUpdateTemplate, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate, result);
     }
     return result;
@@ -4334,16 +4897,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplate(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyDescriptorUpdateTemplate, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyDescriptorUpdateTemplate, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
     }
     DispatchDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyDescriptorUpdateTemplate, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
     }
 }
@@ -4357,16 +4923,19 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSetWithTemplate(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledUpdateDescriptorSetWithTemplate, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledUpdateDescriptorSetWithTemplate, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
     DispatchUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledUpdateDescriptorSetWithTemplate, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
 }
@@ -4379,16 +4948,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalBufferProperties(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceExternalBufferProperties, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalBufferProperties(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceExternalBufferProperties, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceExternalBufferProperties(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
     }
     DispatchGetPhysicalDeviceExternalBufferProperties(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceExternalBufferProperties, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceExternalBufferProperties(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
     }
 }
@@ -4401,16 +4973,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalFenceProperties(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceExternalFenceProperties, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalFenceProperties(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceExternalFenceProperties, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceExternalFenceProperties(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
     }
     DispatchGetPhysicalDeviceExternalFenceProperties(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceExternalFenceProperties, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceExternalFenceProperties(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
     }
 }
@@ -4423,16 +4998,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalSemaphoreProperties(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceExternalSemaphoreProperties, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalSemaphoreProperties(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceExternalSemaphoreProperties, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceExternalSemaphoreProperties(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
     }
     DispatchGetPhysicalDeviceExternalSemaphoreProperties(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceExternalSemaphoreProperties, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceExternalSemaphoreProperties(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
     }
 }
@@ -4445,16 +5023,19 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSupport(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDescriptorSetLayoutSupport, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDescriptorSetLayoutSupport, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
     }
     DispatchGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDescriptorSetLayoutSupport, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
     }
 }
@@ -4471,17 +5052,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCount(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndirectCount, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndirectCount, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndirectCount, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -4497,17 +5081,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCount(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndexedIndirectCount, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndexedIndirectCount, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndexedIndirectCount, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -4521,16 +5108,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateRenderPass2, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateRenderPass2, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
     }
     VkResult result = DispatchCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateRenderPass2, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass, result);
     }
     return result;
@@ -4543,17 +5133,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBeginRenderPass2, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBeginRenderPass2, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
     DispatchCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBeginRenderPass2, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
 }
@@ -4565,17 +5158,20 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdNextSubpass2, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdNextSubpass2, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
     DispatchCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdNextSubpass2, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
 }
@@ -4586,17 +5182,20 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdEndRenderPass2, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdEndRenderPass2, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
     }
     DispatchCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdEndRenderPass2, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
     }
 }
@@ -4610,16 +5209,19 @@ VKAPI_ATTR void VKAPI_CALL ResetQueryPool(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledResetQueryPool, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetQueryPool(device, queryPool, firstQuery, queryCount);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledResetQueryPool, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordResetQueryPool(device, queryPool, firstQuery, queryCount);
     }
     DispatchResetQueryPool(device, queryPool, firstQuery, queryCount);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledResetQueryPool, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordResetQueryPool(device, queryPool, firstQuery, queryCount);
     }
 }
@@ -4632,16 +5234,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValue(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetSemaphoreCounterValue, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreCounterValue(device, semaphore, pValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetSemaphoreCounterValue, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetSemaphoreCounterValue(device, semaphore, pValue);
     }
     VkResult result = DispatchGetSemaphoreCounterValue(device, semaphore, pValue);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetSemaphoreCounterValue, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetSemaphoreCounterValue(device, semaphore, pValue, result);
     }
     return result;
@@ -4655,16 +5260,19 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphores(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledWaitSemaphores, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWaitSemaphores(device, pWaitInfo, timeout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledWaitSemaphores, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordWaitSemaphores(device, pWaitInfo, timeout);
     }
     VkResult result = DispatchWaitSemaphores(device, pWaitInfo, timeout);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledWaitSemaphores, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordWaitSemaphores(device, pWaitInfo, timeout, result);
     }
     return result;
@@ -4677,16 +5285,19 @@ VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphore(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledSignalSemaphore, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSignalSemaphore(device, pSignalInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledSignalSemaphore, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordSignalSemaphore(device, pSignalInfo);
     }
     VkResult result = DispatchSignalSemaphore(device, pSignalInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledSignalSemaphore, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordSignalSemaphore(device, pSignalInfo, result);
     }
     return result;
@@ -4699,16 +5310,19 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddress(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetBufferDeviceAddress, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferDeviceAddress(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetBufferDeviceAddress, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetBufferDeviceAddress(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetBufferDeviceAddress(device, pInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetBufferDeviceAddress, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetBufferDeviceAddress(device, pInfo, result);
     }
     return result;
@@ -4721,16 +5335,19 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetBufferOpaqueCaptureAddress(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetBufferOpaqueCaptureAddress, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferOpaqueCaptureAddress(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetBufferOpaqueCaptureAddress, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetBufferOpaqueCaptureAddress(device, pInfo);
     }
     uint64_t result = DispatchGetBufferOpaqueCaptureAddress(device, pInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetBufferOpaqueCaptureAddress, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetBufferOpaqueCaptureAddress(device, pInfo);
     }
     return result;
@@ -4743,16 +5360,19 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddress(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceMemoryOpaqueCaptureAddress, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceMemoryOpaqueCaptureAddress, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
     }
     uint64_t result = DispatchGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceMemoryOpaqueCaptureAddress, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
     }
     return result;
@@ -4767,16 +5387,19 @@ VKAPI_ATTR void VKAPI_CALL DestroySurfaceKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroySurfaceKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySurfaceKHR(instance, surface, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroySurfaceKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroySurfaceKHR(instance, surface, pAllocator);
     }
     DispatchDestroySurfaceKHR(instance, surface, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroySurfaceKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroySurfaceKHR(instance, surface, pAllocator);
     }
 }
@@ -4790,16 +5413,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceSupportKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSurfaceSupportKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSurfaceSupportKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSurfaceSupportKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported, result);
     }
     return result;
@@ -4813,16 +5439,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceCapabilitiesKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSurfaceCapabilitiesKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSurfaceCapabilitiesKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSurfaceCapabilitiesKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities, result);
     }
     return result;
@@ -4837,16 +5466,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceFormatsKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSurfaceFormatsKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSurfaceFormatsKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSurfaceFormatsKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats, result);
     }
     return result;
@@ -4861,16 +5493,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfacePresentModesKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSurfacePresentModesKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSurfacePresentModesKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSurfacePresentModesKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes, result);
     }
     return result;
@@ -4886,16 +5521,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSwapchainKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateSwapchainKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateSwapchainKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
     }
     VkResult result = DispatchCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateSwapchainKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain, result);
     }
     return result;
@@ -4909,16 +5547,19 @@ VKAPI_ATTR void VKAPI_CALL DestroySwapchainKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroySwapchainKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySwapchainKHR(device, swapchain, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroySwapchainKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroySwapchainKHR(device, swapchain, pAllocator);
     }
     DispatchDestroySwapchainKHR(device, swapchain, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroySwapchainKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroySwapchainKHR(device, swapchain, pAllocator);
     }
 }
@@ -4932,16 +5573,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImagesKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetSwapchainImagesKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetSwapchainImagesKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
     }
     VkResult result = DispatchGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetSwapchainImagesKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages, result);
     }
     return result;
@@ -4958,16 +5602,19 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImageKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAcquireNextImageKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAcquireNextImageKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
     }
     VkResult result = DispatchAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAcquireNextImageKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex, result);
     }
     return result;
@@ -4980,16 +5627,19 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledQueuePresentKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueuePresentKHR(queue, pPresentInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledQueuePresentKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordQueuePresentKHR(queue, pPresentInfo);
     }
     VkResult result = DispatchQueuePresentKHR(queue, pPresentInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledQueuePresentKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordQueuePresentKHR(queue, pPresentInfo, result);
     }
     return result;
@@ -5002,16 +5652,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupPresentCapabilitiesKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceGroupPresentCapabilitiesKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceGroupPresentCapabilitiesKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
     }
     VkResult result = DispatchGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceGroupPresentCapabilitiesKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities, result);
     }
     return result;
@@ -5025,16 +5678,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupSurfacePresentModesKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceGroupSurfacePresentModesKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceGroupSurfacePresentModesKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
     }
     VkResult result = DispatchGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceGroupSurfacePresentModesKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes, result);
     }
     return result;
@@ -5049,16 +5705,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDevicePresentRectanglesKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDevicePresentRectanglesKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDevicePresentRectanglesKHR(physicalDevice, surface, pRectCount, pRects);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDevicePresentRectanglesKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDevicePresentRectanglesKHR(physicalDevice, surface, pRectCount, pRects);
     }
     VkResult result = DispatchGetPhysicalDevicePresentRectanglesKHR(physicalDevice, surface, pRectCount, pRects);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDevicePresentRectanglesKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDevicePresentRectanglesKHR(physicalDevice, surface, pRectCount, pRects, result);
     }
     return result;
@@ -5072,16 +5731,19 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImage2KHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAcquireNextImage2KHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAcquireNextImage2KHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
     }
     VkResult result = DispatchAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAcquireNextImage2KHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex, result);
     }
     return result;
@@ -5096,16 +5758,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayPropertiesKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceDisplayPropertiesKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceDisplayPropertiesKHR(physicalDevice, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceDisplayPropertiesKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceDisplayPropertiesKHR(physicalDevice, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceDisplayPropertiesKHR(physicalDevice, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceDisplayPropertiesKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceDisplayPropertiesKHR(physicalDevice, pPropertyCount, pProperties, result);
     }
     return result;
@@ -5119,16 +5784,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayPlanePropertiesKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceDisplayPlanePropertiesKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceDisplayPlanePropertiesKHR(physicalDevice, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceDisplayPlanePropertiesKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceDisplayPlanePropertiesKHR(physicalDevice, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceDisplayPlanePropertiesKHR(physicalDevice, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceDisplayPlanePropertiesKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceDisplayPlanePropertiesKHR(physicalDevice, pPropertyCount, pProperties, result);
     }
     return result;
@@ -5143,16 +5811,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayPlaneSupportedDisplaysKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDisplayPlaneSupportedDisplaysKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDisplayPlaneSupportedDisplaysKHR(physicalDevice, planeIndex, pDisplayCount, pDisplays);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDisplayPlaneSupportedDisplaysKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetDisplayPlaneSupportedDisplaysKHR(physicalDevice, planeIndex, pDisplayCount, pDisplays);
     }
     VkResult result = DispatchGetDisplayPlaneSupportedDisplaysKHR(physicalDevice, planeIndex, pDisplayCount, pDisplays);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDisplayPlaneSupportedDisplaysKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetDisplayPlaneSupportedDisplaysKHR(physicalDevice, planeIndex, pDisplayCount, pDisplays, result);
     }
     return result;
@@ -5167,16 +5838,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayModePropertiesKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDisplayModePropertiesKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDisplayModePropertiesKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDisplayModePropertiesKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount, pProperties, result);
     }
     return result;
@@ -5192,16 +5866,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDisplayModeKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDisplayModeKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDisplayModeKHR(physicalDevice, display, pCreateInfo, pAllocator, pMode);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDisplayModeKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateDisplayModeKHR(physicalDevice, display, pCreateInfo, pAllocator, pMode);
     }
     VkResult result = DispatchCreateDisplayModeKHR(physicalDevice, display, pCreateInfo, pAllocator, pMode);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDisplayModeKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateDisplayModeKHR(physicalDevice, display, pCreateInfo, pAllocator, pMode, result);
     }
     return result;
@@ -5216,16 +5893,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayPlaneCapabilitiesKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDisplayPlaneCapabilitiesKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDisplayPlaneCapabilitiesKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities);
     }
     VkResult result = DispatchGetDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDisplayPlaneCapabilitiesKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities, result);
     }
     return result;
@@ -5240,16 +5920,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDisplayPlaneSurfaceKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDisplayPlaneSurfaceKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDisplayPlaneSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDisplayPlaneSurfaceKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateDisplayPlaneSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateDisplayPlaneSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDisplayPlaneSurfaceKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateDisplayPlaneSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -5266,16 +5949,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSharedSwapchainsKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateSharedSwapchainsKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateSharedSwapchainsKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
     }
     VkResult result = DispatchCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateSharedSwapchainsKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains, result);
     }
     return result;
@@ -5292,16 +5978,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateXlibSurfaceKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateXlibSurfaceKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateXlibSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateXlibSurfaceKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateXlibSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateXlibSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateXlibSurfaceKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateXlibSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -5316,16 +6005,19 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceXlibPresentationSupportKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceXlibPresentationSupportKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceXlibPresentationSupportKHR(physicalDevice, queueFamilyIndex, dpy, visualID);
         if (skip) return VK_FALSE;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceXlibPresentationSupportKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceXlibPresentationSupportKHR(physicalDevice, queueFamilyIndex, dpy, visualID);
     }
     VkBool32 result = DispatchGetPhysicalDeviceXlibPresentationSupportKHR(physicalDevice, queueFamilyIndex, dpy, visualID);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceXlibPresentationSupportKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceXlibPresentationSupportKHR(physicalDevice, queueFamilyIndex, dpy, visualID);
     }
     return result;
@@ -5343,16 +6035,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateXcbSurfaceKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateXcbSurfaceKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateXcbSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateXcbSurfaceKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateXcbSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateXcbSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateXcbSurfaceKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateXcbSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -5367,16 +6062,19 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceXcbPresentationSupportKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceXcbPresentationSupportKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceXcbPresentationSupportKHR(physicalDevice, queueFamilyIndex, connection, visual_id);
         if (skip) return VK_FALSE;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceXcbPresentationSupportKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceXcbPresentationSupportKHR(physicalDevice, queueFamilyIndex, connection, visual_id);
     }
     VkBool32 result = DispatchGetPhysicalDeviceXcbPresentationSupportKHR(physicalDevice, queueFamilyIndex, connection, visual_id);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceXcbPresentationSupportKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceXcbPresentationSupportKHR(physicalDevice, queueFamilyIndex, connection, visual_id);
     }
     return result;
@@ -5394,16 +6092,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateWaylandSurfaceKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateWaylandSurfaceKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateWaylandSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateWaylandSurfaceKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateWaylandSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateWaylandSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateWaylandSurfaceKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateWaylandSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -5417,16 +6118,19 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceWaylandPresentationSupportKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceWaylandPresentationSupportKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceWaylandPresentationSupportKHR(physicalDevice, queueFamilyIndex, display);
         if (skip) return VK_FALSE;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceWaylandPresentationSupportKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceWaylandPresentationSupportKHR(physicalDevice, queueFamilyIndex, display);
     }
     VkBool32 result = DispatchGetPhysicalDeviceWaylandPresentationSupportKHR(physicalDevice, queueFamilyIndex, display);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceWaylandPresentationSupportKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceWaylandPresentationSupportKHR(physicalDevice, queueFamilyIndex, display);
     }
     return result;
@@ -5444,16 +6148,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAndroidSurfaceKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateAndroidSurfaceKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateAndroidSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateAndroidSurfaceKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateAndroidSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateAndroidSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateAndroidSurfaceKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateAndroidSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -5471,16 +6178,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateWin32SurfaceKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateWin32SurfaceKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateWin32SurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateWin32SurfaceKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateWin32SurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateWin32SurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateWin32SurfaceKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateWin32SurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -5493,16 +6203,19 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceWin32PresentationSupportKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceWin32PresentationSupportKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceWin32PresentationSupportKHR(physicalDevice, queueFamilyIndex);
         if (skip) return VK_FALSE;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceWin32PresentationSupportKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceWin32PresentationSupportKHR(physicalDevice, queueFamilyIndex);
     }
     VkBool32 result = DispatchGetPhysicalDeviceWin32PresentationSupportKHR(physicalDevice, queueFamilyIndex);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceWin32PresentationSupportKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceWin32PresentationSupportKHR(physicalDevice, queueFamilyIndex);
     }
     return result;
@@ -5519,16 +6232,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFeatures2KHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceFeatures2KHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFeatures2KHR(physicalDevice, pFeatures);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceFeatures2KHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceFeatures2KHR(physicalDevice, pFeatures);
     }
     DispatchGetPhysicalDeviceFeatures2KHR(physicalDevice, pFeatures);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceFeatures2KHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceFeatures2KHR(physicalDevice, pFeatures);
     }
 }
@@ -5540,16 +6256,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceProperties2KHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceProperties2KHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceProperties2KHR(physicalDevice, pProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceProperties2KHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceProperties2KHR(physicalDevice, pProperties);
     }
     DispatchGetPhysicalDeviceProperties2KHR(physicalDevice, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceProperties2KHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceProperties2KHR(physicalDevice, pProperties);
     }
 }
@@ -5562,16 +6281,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFormatProperties2KHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceFormatProperties2KHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFormatProperties2KHR(physicalDevice, format, pFormatProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceFormatProperties2KHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceFormatProperties2KHR(physicalDevice, format, pFormatProperties);
     }
     DispatchGetPhysicalDeviceFormatProperties2KHR(physicalDevice, format, pFormatProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceFormatProperties2KHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceFormatProperties2KHR(physicalDevice, format, pFormatProperties);
     }
 }
@@ -5584,16 +6306,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceImageFormatProperties2KHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceImageFormatProperties2KHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceImageFormatProperties2KHR(physicalDevice, pImageFormatInfo, pImageFormatProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceImageFormatProperties2KHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceImageFormatProperties2KHR(physicalDevice, pImageFormatInfo, pImageFormatProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceImageFormatProperties2KHR(physicalDevice, pImageFormatInfo, pImageFormatProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceImageFormatProperties2KHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceImageFormatProperties2KHR(physicalDevice, pImageFormatInfo, pImageFormatProperties, result);
     }
     return result;
@@ -5607,16 +6332,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyProperties2KHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceQueueFamilyProperties2KHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceQueueFamilyProperties2KHR(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceQueueFamilyProperties2KHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceQueueFamilyProperties2KHR(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     }
     DispatchGetPhysicalDeviceQueueFamilyProperties2KHR(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceQueueFamilyProperties2KHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceQueueFamilyProperties2KHR(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     }
 }
@@ -5628,16 +6356,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMemoryProperties2KHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceMemoryProperties2KHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceMemoryProperties2KHR(physicalDevice, pMemoryProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceMemoryProperties2KHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceMemoryProperties2KHR(physicalDevice, pMemoryProperties);
     }
     DispatchGetPhysicalDeviceMemoryProperties2KHR(physicalDevice, pMemoryProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceMemoryProperties2KHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceMemoryProperties2KHR(physicalDevice, pMemoryProperties);
     }
 }
@@ -5651,16 +6382,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties2KHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSparseImageFormatProperties2KHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSparseImageFormatProperties2KHR(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSparseImageFormatProperties2KHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceSparseImageFormatProperties2KHR(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
     }
     DispatchGetPhysicalDeviceSparseImageFormatProperties2KHR(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSparseImageFormatProperties2KHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceSparseImageFormatProperties2KHR(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
     }
 }
@@ -5676,16 +6410,19 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceGroupPeerMemoryFeaturesKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceGroupPeerMemoryFeaturesKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceGroupPeerMemoryFeaturesKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
     DispatchGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceGroupPeerMemoryFeaturesKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
 }
@@ -5696,17 +6433,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMaskKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetDeviceMaskKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetDeviceMaskKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
     }
     DispatchCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetDeviceMaskKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
     }
 }
@@ -5722,17 +6462,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBaseKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDispatchBaseKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDispatchBaseKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
     DispatchCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDispatchBaseKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
 }
@@ -5747,16 +6490,19 @@ VKAPI_ATTR void VKAPI_CALL TrimCommandPoolKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledTrimCommandPoolKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateTrimCommandPoolKHR(device, commandPool, flags);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledTrimCommandPoolKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordTrimCommandPoolKHR(device, commandPool, flags);
     }
     DispatchTrimCommandPoolKHR(device, commandPool, flags);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledTrimCommandPoolKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordTrimCommandPoolKHR(device, commandPool, flags);
     }
 }
@@ -5770,16 +6516,19 @@ VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDeviceGroupsKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledEnumeratePhysicalDeviceGroupsKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateEnumeratePhysicalDeviceGroupsKHR(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledEnumeratePhysicalDeviceGroupsKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordEnumeratePhysicalDeviceGroupsKHR(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
     }
     VkResult result = DispatchEnumeratePhysicalDeviceGroupsKHR(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledEnumeratePhysicalDeviceGroupsKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordEnumeratePhysicalDeviceGroupsKHR(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties, result);
     }
     return result;
@@ -5794,16 +6543,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalBufferPropertiesKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceExternalBufferPropertiesKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalBufferPropertiesKHR(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceExternalBufferPropertiesKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceExternalBufferPropertiesKHR(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
     }
     DispatchGetPhysicalDeviceExternalBufferPropertiesKHR(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceExternalBufferPropertiesKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceExternalBufferPropertiesKHR(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
     }
 }
@@ -5819,16 +6571,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandleKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetMemoryWin32HandleKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetMemoryWin32HandleKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     }
     VkResult result = DispatchGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetMemoryWin32HandleKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle, result);
     }
     return result;
@@ -5843,16 +6598,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandlePropertiesKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetMemoryWin32HandlePropertiesKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetMemoryWin32HandlePropertiesKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
     }
     VkResult result = DispatchGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetMemoryWin32HandlePropertiesKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties, result);
     }
     return result;
@@ -5868,16 +6626,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryFdKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetMemoryFdKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryFdKHR(device, pGetFdInfo, pFd);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetMemoryFdKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetMemoryFdKHR(device, pGetFdInfo, pFd);
     }
     VkResult result = DispatchGetMemoryFdKHR(device, pGetFdInfo, pFd);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetMemoryFdKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetMemoryFdKHR(device, pGetFdInfo, pFd, result);
     }
     return result;
@@ -5892,16 +6653,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryFdPropertiesKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetMemoryFdPropertiesKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetMemoryFdPropertiesKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
     }
     VkResult result = DispatchGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetMemoryFdPropertiesKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties, result);
     }
     return result;
@@ -5919,16 +6683,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalSemaphorePropertiesKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceExternalSemaphorePropertiesKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalSemaphorePropertiesKHR(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceExternalSemaphorePropertiesKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceExternalSemaphorePropertiesKHR(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
     }
     DispatchGetPhysicalDeviceExternalSemaphorePropertiesKHR(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceExternalSemaphorePropertiesKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceExternalSemaphorePropertiesKHR(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
     }
 }
@@ -5943,16 +6710,19 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportSemaphoreWin32HandleKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledImportSemaphoreWin32HandleKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledImportSemaphoreWin32HandleKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
     }
     VkResult result = DispatchImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledImportSemaphoreWin32HandleKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo, result);
     }
     return result;
@@ -5966,16 +6736,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreWin32HandleKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetSemaphoreWin32HandleKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetSemaphoreWin32HandleKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     }
     VkResult result = DispatchGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetSemaphoreWin32HandleKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle, result);
     }
     return result;
@@ -5990,16 +6763,19 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportSemaphoreFdKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledImportSemaphoreFdKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledImportSemaphoreFdKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
     }
     VkResult result = DispatchImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledImportSemaphoreFdKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo, result);
     }
     return result;
@@ -6013,16 +6789,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreFdKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetSemaphoreFdKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetSemaphoreFdKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
     }
     VkResult result = DispatchGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetSemaphoreFdKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetSemaphoreFdKHR(device, pGetFdInfo, pFd, result);
     }
     return result;
@@ -6039,17 +6818,20 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdPushDescriptorSetKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdPushDescriptorSetKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
     }
     DispatchCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdPushDescriptorSetKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
     }
 }
@@ -6063,17 +6845,20 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetWithTemplateKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdPushDescriptorSetWithTemplateKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdPushDescriptorSetWithTemplateKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
     }
     DispatchCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdPushDescriptorSetWithTemplateKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
     }
 }
@@ -6091,16 +6876,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplateKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDescriptorUpdateTemplateKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDescriptorUpdateTemplateKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     }
     VkResult result = DispatchCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDescriptorUpdateTemplateKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate, result);
     }
     return result;
@@ -6114,16 +6902,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplateKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyDescriptorUpdateTemplateKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyDescriptorUpdateTemplateKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
     }
     DispatchDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyDescriptorUpdateTemplateKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
     }
 }
@@ -6137,16 +6928,19 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSetWithTemplateKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledUpdateDescriptorSetWithTemplateKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledUpdateDescriptorSetWithTemplateKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
     DispatchUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledUpdateDescriptorSetWithTemplateKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
 }
@@ -6162,16 +6956,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2KHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateRenderPass2KHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateRenderPass2KHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
     }
     VkResult result = DispatchCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateRenderPass2KHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass, result);
     }
     return result;
@@ -6184,17 +6981,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBeginRenderPass2KHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBeginRenderPass2KHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
     DispatchCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBeginRenderPass2KHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
 }
@@ -6206,17 +7006,20 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdNextSubpass2KHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdNextSubpass2KHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
     DispatchCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdNextSubpass2KHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
 }
@@ -6227,17 +7030,20 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdEndRenderPass2KHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdEndRenderPass2KHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
     }
     DispatchCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdEndRenderPass2KHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
     }
 }
@@ -6250,16 +7056,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainStatusKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetSwapchainStatusKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSwapchainStatusKHR(device, swapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetSwapchainStatusKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetSwapchainStatusKHR(device, swapchain);
     }
     VkResult result = DispatchGetSwapchainStatusKHR(device, swapchain);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetSwapchainStatusKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetSwapchainStatusKHR(device, swapchain, result);
     }
     return result;
@@ -6274,16 +7083,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalFencePropertiesKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceExternalFencePropertiesKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalFencePropertiesKHR(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceExternalFencePropertiesKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceExternalFencePropertiesKHR(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
     }
     DispatchGetPhysicalDeviceExternalFencePropertiesKHR(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceExternalFencePropertiesKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceExternalFencePropertiesKHR(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
     }
 }
@@ -6298,16 +7110,19 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportFenceWin32HandleKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledImportFenceWin32HandleKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledImportFenceWin32HandleKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
     }
     VkResult result = DispatchImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledImportFenceWin32HandleKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo, result);
     }
     return result;
@@ -6321,16 +7136,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceWin32HandleKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetFenceWin32HandleKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetFenceWin32HandleKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     }
     VkResult result = DispatchGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetFenceWin32HandleKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle, result);
     }
     return result;
@@ -6345,16 +7163,19 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportFenceFdKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledImportFenceFdKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportFenceFdKHR(device, pImportFenceFdInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledImportFenceFdKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordImportFenceFdKHR(device, pImportFenceFdInfo);
     }
     VkResult result = DispatchImportFenceFdKHR(device, pImportFenceFdInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledImportFenceFdKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordImportFenceFdKHR(device, pImportFenceFdInfo, result);
     }
     return result;
@@ -6368,16 +7189,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceFdKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetFenceFdKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetFenceFdKHR(device, pGetFdInfo, pFd);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetFenceFdKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetFenceFdKHR(device, pGetFdInfo, pFd);
     }
     VkResult result = DispatchGetFenceFdKHR(device, pGetFdInfo, pFd);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetFenceFdKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetFenceFdKHR(device, pGetFdInfo, pFd, result);
     }
     return result;
@@ -6394,16 +7218,19 @@ VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDeviceQueueFamilyPerformanceQuer
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(physicalDevice, queueFamilyIndex, pCounterCount, pCounters, pCounterDescriptions);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(physicalDevice, queueFamilyIndex, pCounterCount, pCounters, pCounterDescriptions);
     }
     VkResult result = DispatchEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(physicalDevice, queueFamilyIndex, pCounterCount, pCounters, pCounterDescriptions);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(physicalDevice, queueFamilyIndex, pCounterCount, pCounters, pCounterDescriptions, result);
     }
     return result;
@@ -6417,16 +7244,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(physicalDevice, pPerformanceQueryCreateInfo, pNumPasses);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(physicalDevice, pPerformanceQueryCreateInfo, pNumPasses);
     }
     DispatchGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(physicalDevice, pPerformanceQueryCreateInfo, pNumPasses);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(physicalDevice, pPerformanceQueryCreateInfo, pNumPasses);
     }
 }
@@ -6438,16 +7268,19 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireProfilingLockKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAcquireProfilingLockKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireProfilingLockKHR(device, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAcquireProfilingLockKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordAcquireProfilingLockKHR(device, pInfo);
     }
     VkResult result = DispatchAcquireProfilingLockKHR(device, pInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAcquireProfilingLockKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordAcquireProfilingLockKHR(device, pInfo, result);
     }
     return result;
@@ -6459,16 +7292,19 @@ VKAPI_ATTR void VKAPI_CALL ReleaseProfilingLockKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledReleaseProfilingLockKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateReleaseProfilingLockKHR(device);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledReleaseProfilingLockKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordReleaseProfilingLockKHR(device);
     }
     DispatchReleaseProfilingLockKHR(device);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledReleaseProfilingLockKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordReleaseProfilingLockKHR(device);
     }
 }
@@ -6483,16 +7319,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceCapabilities2KHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSurfaceCapabilities2KHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfaceCapabilities2KHR(physicalDevice, pSurfaceInfo, pSurfaceCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSurfaceCapabilities2KHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceSurfaceCapabilities2KHR(physicalDevice, pSurfaceInfo, pSurfaceCapabilities);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfaceCapabilities2KHR(physicalDevice, pSurfaceInfo, pSurfaceCapabilities);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSurfaceCapabilities2KHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceSurfaceCapabilities2KHR(physicalDevice, pSurfaceInfo, pSurfaceCapabilities, result);
     }
     return result;
@@ -6507,16 +7346,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceFormats2KHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSurfaceFormats2KHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfaceFormats2KHR(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSurfaceFormats2KHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceSurfaceFormats2KHR(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfaceFormats2KHR(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSurfaceFormats2KHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceSurfaceFormats2KHR(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats, result);
     }
     return result;
@@ -6532,16 +7374,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayProperties2KHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceDisplayProperties2KHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceDisplayProperties2KHR(physicalDevice, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceDisplayProperties2KHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceDisplayProperties2KHR(physicalDevice, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceDisplayProperties2KHR(physicalDevice, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceDisplayProperties2KHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceDisplayProperties2KHR(physicalDevice, pPropertyCount, pProperties, result);
     }
     return result;
@@ -6555,16 +7400,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayPlaneProperties2KHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceDisplayPlaneProperties2KHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceDisplayPlaneProperties2KHR(physicalDevice, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceDisplayPlaneProperties2KHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceDisplayPlaneProperties2KHR(physicalDevice, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceDisplayPlaneProperties2KHR(physicalDevice, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceDisplayPlaneProperties2KHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceDisplayPlaneProperties2KHR(physicalDevice, pPropertyCount, pProperties, result);
     }
     return result;
@@ -6579,16 +7427,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayModeProperties2KHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDisplayModeProperties2KHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDisplayModeProperties2KHR(physicalDevice, display, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDisplayModeProperties2KHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetDisplayModeProperties2KHR(physicalDevice, display, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetDisplayModeProperties2KHR(physicalDevice, display, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDisplayModeProperties2KHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetDisplayModeProperties2KHR(physicalDevice, display, pPropertyCount, pProperties, result);
     }
     return result;
@@ -6602,16 +7453,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayPlaneCapabilities2KHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDisplayPlaneCapabilities2KHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDisplayPlaneCapabilities2KHR(physicalDevice, pDisplayPlaneInfo, pCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDisplayPlaneCapabilities2KHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetDisplayPlaneCapabilities2KHR(physicalDevice, pDisplayPlaneInfo, pCapabilities);
     }
     VkResult result = DispatchGetDisplayPlaneCapabilities2KHR(physicalDevice, pDisplayPlaneInfo, pCapabilities);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDisplayPlaneCapabilities2KHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetDisplayPlaneCapabilities2KHR(physicalDevice, pDisplayPlaneInfo, pCapabilities, result);
     }
     return result;
@@ -6629,16 +7483,19 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2KHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageMemoryRequirements2KHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageMemoryRequirements2KHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
     DispatchGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageMemoryRequirements2KHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
 }
@@ -6651,16 +7508,19 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements2KHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetBufferMemoryRequirements2KHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetBufferMemoryRequirements2KHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
     DispatchGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetBufferMemoryRequirements2KHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
 }
@@ -6674,16 +7534,19 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements2KHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageSparseMemoryRequirements2KHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageSparseMemoryRequirements2KHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
     DispatchGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageSparseMemoryRequirements2KHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
 }
@@ -6699,16 +7562,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversionKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateSamplerYcbcrConversionKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateSamplerYcbcrConversionKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
     }
     VkResult result = DispatchCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateSamplerYcbcrConversionKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion, result);
     }
     return result;
@@ -6722,16 +7588,19 @@ VKAPI_ATTR void VKAPI_CALL DestroySamplerYcbcrConversionKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroySamplerYcbcrConversionKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroySamplerYcbcrConversionKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
     }
     DispatchDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroySamplerYcbcrConversionKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
     }
 }
@@ -6745,16 +7614,19 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2KHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledBindBufferMemory2KHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledBindBufferMemory2KHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledBindBufferMemory2KHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordBindBufferMemory2KHR(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -6768,16 +7640,19 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory2KHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledBindImageMemory2KHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledBindImageMemory2KHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledBindImageMemory2KHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordBindImageMemory2KHR(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -6792,16 +7667,19 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSupportKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDescriptorSetLayoutSupportKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDescriptorSetLayoutSupportKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
     }
     DispatchGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDescriptorSetLayoutSupportKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
     }
 }
@@ -6818,17 +7696,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndirectCountKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndirectCountKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndirectCountKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -6844,17 +7725,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndexedIndirectCountKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndexedIndirectCountKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndexedIndirectCountKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -6876,16 +7760,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValueKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetSemaphoreCounterValueKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreCounterValueKHR(device, semaphore, pValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetSemaphoreCounterValueKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetSemaphoreCounterValueKHR(device, semaphore, pValue);
     }
     VkResult result = DispatchGetSemaphoreCounterValueKHR(device, semaphore, pValue);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetSemaphoreCounterValueKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetSemaphoreCounterValueKHR(device, semaphore, pValue, result);
     }
     return result;
@@ -6899,16 +7786,19 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphoresKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledWaitSemaphoresKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWaitSemaphoresKHR(device, pWaitInfo, timeout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledWaitSemaphoresKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordWaitSemaphoresKHR(device, pWaitInfo, timeout);
     }
     VkResult result = DispatchWaitSemaphoresKHR(device, pWaitInfo, timeout);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledWaitSemaphoresKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordWaitSemaphoresKHR(device, pWaitInfo, timeout, result);
     }
     return result;
@@ -6921,16 +7811,19 @@ VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphoreKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledSignalSemaphoreKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSignalSemaphoreKHR(device, pSignalInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledSignalSemaphoreKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordSignalSemaphoreKHR(device, pSignalInfo);
     }
     VkResult result = DispatchSignalSemaphoreKHR(device, pSignalInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledSignalSemaphoreKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordSignalSemaphoreKHR(device, pSignalInfo, result);
     }
     return result;
@@ -6949,16 +7842,19 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddressKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetBufferDeviceAddressKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferDeviceAddressKHR(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetBufferDeviceAddressKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetBufferDeviceAddressKHR(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetBufferDeviceAddressKHR(device, pInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetBufferDeviceAddressKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetBufferDeviceAddressKHR(device, pInfo, result);
     }
     return result;
@@ -6971,16 +7867,19 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetBufferOpaqueCaptureAddressKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetBufferOpaqueCaptureAddressKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferOpaqueCaptureAddressKHR(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetBufferOpaqueCaptureAddressKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetBufferOpaqueCaptureAddressKHR(device, pInfo);
     }
     uint64_t result = DispatchGetBufferOpaqueCaptureAddressKHR(device, pInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetBufferOpaqueCaptureAddressKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetBufferOpaqueCaptureAddressKHR(device, pInfo);
     }
     return result;
@@ -6993,16 +7892,19 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddressKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceMemoryOpaqueCaptureAddressKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceMemoryOpaqueCaptureAddressKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
     }
     uint64_t result = DispatchGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceMemoryOpaqueCaptureAddressKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
     }
     return result;
@@ -7018,16 +7920,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutablePropertiesKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPipelineExecutablePropertiesKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPipelineExecutablePropertiesKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
     }
     VkResult result = DispatchGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPipelineExecutablePropertiesKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties, result);
     }
     return result;
@@ -7042,16 +7947,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutableStatisticsKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPipelineExecutableStatisticsKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPipelineExecutableStatisticsKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
     }
     VkResult result = DispatchGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPipelineExecutableStatisticsKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics, result);
     }
     return result;
@@ -7066,16 +7974,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutableInternalRepresentationsKHR(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPipelineExecutableInternalRepresentationsKHR, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPipelineExecutableInternalRepresentationsKHR, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
     }
     VkResult result = DispatchGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPipelineExecutableInternalRepresentationsKHR, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations, result);
     }
     return result;
@@ -7091,17 +8002,20 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDebugReportCallbackEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDebugReportCallbackEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pCallback);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDebugReportCallbackEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pCallback);
     }
     VkResult result = DispatchCreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pCallback);
     layer_create_report_callback(layer_data->report_data, false, pCreateInfo, pAllocator, pCallback);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDebugReportCallbackEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pCallback, result);
     }
     return result;
@@ -7115,17 +8029,20 @@ VKAPI_ATTR void VKAPI_CALL DestroyDebugReportCallbackEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyDebugReportCallbackEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDebugReportCallbackEXT(instance, callback, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyDebugReportCallbackEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyDebugReportCallbackEXT(instance, callback, pAllocator);
     }
     DispatchDestroyDebugReportCallbackEXT(instance, callback, pAllocator);
     layer_destroy_callback(layer_data->report_data, callback, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyDebugReportCallbackEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyDebugReportCallbackEXT(instance, callback, pAllocator);
     }
 }
@@ -7143,16 +8060,19 @@ VKAPI_ATTR void VKAPI_CALL DebugReportMessageEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDebugReportMessageEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDebugReportMessageEXT(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDebugReportMessageEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDebugReportMessageEXT(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
     }
     DispatchDebugReportMessageEXT(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDebugReportMessageEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDebugReportMessageEXT(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
     }
 }
@@ -7171,16 +8091,19 @@ VKAPI_ATTR VkResult VKAPI_CALL DebugMarkerSetObjectTagEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDebugMarkerSetObjectTagEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDebugMarkerSetObjectTagEXT(device, pTagInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDebugMarkerSetObjectTagEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDebugMarkerSetObjectTagEXT(device, pTagInfo);
     }
     VkResult result = DispatchDebugMarkerSetObjectTagEXT(device, pTagInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDebugMarkerSetObjectTagEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDebugMarkerSetObjectTagEXT(device, pTagInfo, result);
     }
     return result;
@@ -7193,17 +8116,20 @@ VKAPI_ATTR VkResult VKAPI_CALL DebugMarkerSetObjectNameEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDebugMarkerSetObjectNameEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDebugMarkerSetObjectNameEXT(device, pNameInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDebugMarkerSetObjectNameEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDebugMarkerSetObjectNameEXT(device, pNameInfo);
     }
     layer_data->report_data->DebugReportSetMarkerObjectName(pNameInfo);
     VkResult result = DispatchDebugMarkerSetObjectNameEXT(device, pNameInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDebugMarkerSetObjectNameEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDebugMarkerSetObjectNameEXT(device, pNameInfo, result);
     }
     return result;
@@ -7215,17 +8141,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerBeginEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDebugMarkerBeginEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDebugMarkerBeginEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
     }
     DispatchCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDebugMarkerBeginEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
     }
 }
@@ -7235,17 +8164,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerEndEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDebugMarkerEndEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDebugMarkerEndEXT(commandBuffer);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDebugMarkerEndEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdDebugMarkerEndEXT(commandBuffer);
     }
     DispatchCmdDebugMarkerEndEXT(commandBuffer);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDebugMarkerEndEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdDebugMarkerEndEXT(commandBuffer);
     }
 }
@@ -7256,17 +8188,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerInsertEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDebugMarkerInsertEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDebugMarkerInsertEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
     }
     DispatchCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDebugMarkerInsertEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
     }
 }
@@ -7284,17 +8219,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBindTransformFeedbackBuffersEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBindTransformFeedbackBuffersEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBindTransformFeedbackBuffersEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
     }
     DispatchCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBindTransformFeedbackBuffersEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
     }
 }
@@ -7308,17 +8246,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginTransformFeedbackEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBeginTransformFeedbackEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBeginTransformFeedbackEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
     DispatchCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBeginTransformFeedbackEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
 }
@@ -7332,17 +8273,20 @@ VKAPI_ATTR void VKAPI_CALL CmdEndTransformFeedbackEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdEndTransformFeedbackEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdEndTransformFeedbackEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
     DispatchCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdEndTransformFeedbackEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
 }
@@ -7356,17 +8300,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQueryIndexedEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBeginQueryIndexedEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBeginQueryIndexedEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
     }
     DispatchCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBeginQueryIndexedEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
     }
 }
@@ -7379,17 +8326,20 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQueryIndexedEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdEndQueryIndexedEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdEndQueryIndexedEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
     }
     DispatchCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdEndQueryIndexedEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
     }
 }
@@ -7405,17 +8355,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectByteCountEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndirectByteCountEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndirectByteCountEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
     }
     DispatchCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndirectByteCountEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
     }
 }
@@ -7428,16 +8381,19 @@ VKAPI_ATTR uint32_t VKAPI_CALL GetImageViewHandleNVX(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageViewHandleNVX, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageViewHandleNVX(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageViewHandleNVX, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetImageViewHandleNVX(device, pInfo);
     }
     uint32_t result = DispatchGetImageViewHandleNVX(device, pInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageViewHandleNVX, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetImageViewHandleNVX(device, pInfo);
     }
     return result;
@@ -7455,17 +8411,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountAMD(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndirectCountAMD, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndirectCountAMD, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndirectCountAMD, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -7481,17 +8440,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountAMD(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndexedIndirectCountAMD, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndexedIndirectCountAMD, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawIndexedIndirectCountAMD, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -7512,16 +8474,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetShaderInfoAMD(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetShaderInfoAMD, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetShaderInfoAMD, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
     }
     VkResult result = DispatchGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetShaderInfoAMD, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo, result);
     }
     return result;
@@ -7539,16 +8504,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateStreamDescriptorSurfaceGGP(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateStreamDescriptorSurfaceGGP, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateStreamDescriptorSurfaceGGP(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateStreamDescriptorSurfaceGGP, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateStreamDescriptorSurfaceGGP(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateStreamDescriptorSurfaceGGP(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateStreamDescriptorSurfaceGGP, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateStreamDescriptorSurfaceGGP(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -7571,16 +8539,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceExternalImageFormatPropertiesNV(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceExternalImageFormatPropertiesNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalImageFormatPropertiesNV(physicalDevice, format, type, tiling, usage, flags, externalHandleType, pExternalImageFormatProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceExternalImageFormatPropertiesNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceExternalImageFormatPropertiesNV(physicalDevice, format, type, tiling, usage, flags, externalHandleType, pExternalImageFormatProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceExternalImageFormatPropertiesNV(physicalDevice, format, type, tiling, usage, flags, externalHandleType, pExternalImageFormatProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceExternalImageFormatPropertiesNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceExternalImageFormatPropertiesNV(physicalDevice, format, type, tiling, usage, flags, externalHandleType, pExternalImageFormatProperties, result);
     }
     return result;
@@ -7598,16 +8569,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandleNV(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetMemoryWin32HandleNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryWin32HandleNV(device, memory, handleType, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetMemoryWin32HandleNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetMemoryWin32HandleNV(device, memory, handleType, pHandle);
     }
     VkResult result = DispatchGetMemoryWin32HandleNV(device, memory, handleType, pHandle);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetMemoryWin32HandleNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetMemoryWin32HandleNV(device, memory, handleType, pHandle, result);
     }
     return result;
@@ -7629,16 +8603,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateViSurfaceNN(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateViSurfaceNN, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateViSurfaceNN(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateViSurfaceNN, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateViSurfaceNN(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateViSurfaceNN(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateViSurfaceNN, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateViSurfaceNN(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -7656,17 +8633,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginConditionalRenderingEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBeginConditionalRenderingEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBeginConditionalRenderingEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
     }
     DispatchCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBeginConditionalRenderingEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
     }
 }
@@ -7676,17 +8656,20 @@ VKAPI_ATTR void VKAPI_CALL CmdEndConditionalRenderingEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdEndConditionalRenderingEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndConditionalRenderingEXT(commandBuffer);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdEndConditionalRenderingEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdEndConditionalRenderingEXT(commandBuffer);
     }
     DispatchCmdEndConditionalRenderingEXT(commandBuffer);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdEndConditionalRenderingEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdEndConditionalRenderingEXT(commandBuffer);
     }
 }
@@ -7698,17 +8681,20 @@ VKAPI_ATTR void VKAPI_CALL CmdProcessCommandsNVX(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdProcessCommandsNVX, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdProcessCommandsNVX(commandBuffer, pProcessCommandsInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdProcessCommandsNVX, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdProcessCommandsNVX(commandBuffer, pProcessCommandsInfo);
     }
     DispatchCmdProcessCommandsNVX(commandBuffer, pProcessCommandsInfo);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdProcessCommandsNVX, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdProcessCommandsNVX(commandBuffer, pProcessCommandsInfo);
     }
 }
@@ -7719,17 +8705,20 @@ VKAPI_ATTR void VKAPI_CALL CmdReserveSpaceForCommandsNVX(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdReserveSpaceForCommandsNVX, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdReserveSpaceForCommandsNVX(commandBuffer, pReserveSpaceInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdReserveSpaceForCommandsNVX, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdReserveSpaceForCommandsNVX(commandBuffer, pReserveSpaceInfo);
     }
     DispatchCmdReserveSpaceForCommandsNVX(commandBuffer, pReserveSpaceInfo);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdReserveSpaceForCommandsNVX, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdReserveSpaceForCommandsNVX(commandBuffer, pReserveSpaceInfo);
     }
 }
@@ -7743,16 +8732,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateIndirectCommandsLayoutNVX(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateIndirectCommandsLayoutNVX, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateIndirectCommandsLayoutNVX(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateIndirectCommandsLayoutNVX, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateIndirectCommandsLayoutNVX(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
     }
     VkResult result = DispatchCreateIndirectCommandsLayoutNVX(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateIndirectCommandsLayoutNVX, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateIndirectCommandsLayoutNVX(device, pCreateInfo, pAllocator, pIndirectCommandsLayout, result);
     }
     return result;
@@ -7766,16 +8758,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyIndirectCommandsLayoutNVX(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyIndirectCommandsLayoutNVX, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyIndirectCommandsLayoutNVX(device, indirectCommandsLayout, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyIndirectCommandsLayoutNVX, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyIndirectCommandsLayoutNVX(device, indirectCommandsLayout, pAllocator);
     }
     DispatchDestroyIndirectCommandsLayoutNVX(device, indirectCommandsLayout, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyIndirectCommandsLayoutNVX, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyIndirectCommandsLayoutNVX(device, indirectCommandsLayout, pAllocator);
     }
 }
@@ -7789,16 +8784,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateObjectTableNVX(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateObjectTableNVX, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateObjectTableNVX(device, pCreateInfo, pAllocator, pObjectTable);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateObjectTableNVX, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateObjectTableNVX(device, pCreateInfo, pAllocator, pObjectTable);
     }
     VkResult result = DispatchCreateObjectTableNVX(device, pCreateInfo, pAllocator, pObjectTable);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateObjectTableNVX, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateObjectTableNVX(device, pCreateInfo, pAllocator, pObjectTable, result);
     }
     return result;
@@ -7812,16 +8810,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyObjectTableNVX(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyObjectTableNVX, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyObjectTableNVX(device, objectTable, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyObjectTableNVX, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyObjectTableNVX(device, objectTable, pAllocator);
     }
     DispatchDestroyObjectTableNVX(device, objectTable, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyObjectTableNVX, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyObjectTableNVX(device, objectTable, pAllocator);
     }
 }
@@ -7836,16 +8837,19 @@ VKAPI_ATTR VkResult VKAPI_CALL RegisterObjectsNVX(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledRegisterObjectsNVX, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateRegisterObjectsNVX(device, objectTable, objectCount, ppObjectTableEntries, pObjectIndices);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledRegisterObjectsNVX, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordRegisterObjectsNVX(device, objectTable, objectCount, ppObjectTableEntries, pObjectIndices);
     }
     VkResult result = DispatchRegisterObjectsNVX(device, objectTable, objectCount, ppObjectTableEntries, pObjectIndices);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledRegisterObjectsNVX, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordRegisterObjectsNVX(device, objectTable, objectCount, ppObjectTableEntries, pObjectIndices, result);
     }
     return result;
@@ -7861,16 +8865,19 @@ VKAPI_ATTR VkResult VKAPI_CALL UnregisterObjectsNVX(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledUnregisterObjectsNVX, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUnregisterObjectsNVX(device, objectTable, objectCount, pObjectEntryTypes, pObjectIndices);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledUnregisterObjectsNVX, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordUnregisterObjectsNVX(device, objectTable, objectCount, pObjectEntryTypes, pObjectIndices);
     }
     VkResult result = DispatchUnregisterObjectsNVX(device, objectTable, objectCount, pObjectEntryTypes, pObjectIndices);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledUnregisterObjectsNVX, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordUnregisterObjectsNVX(device, objectTable, objectCount, pObjectEntryTypes, pObjectIndices, result);
     }
     return result;
@@ -7884,16 +8891,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceGeneratedCommandsPropertiesNVX(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceGeneratedCommandsPropertiesNVX, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceGeneratedCommandsPropertiesNVX(physicalDevice, pFeatures, pLimits);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceGeneratedCommandsPropertiesNVX, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceGeneratedCommandsPropertiesNVX(physicalDevice, pFeatures, pLimits);
     }
     DispatchGetPhysicalDeviceGeneratedCommandsPropertiesNVX(physicalDevice, pFeatures, pLimits);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceGeneratedCommandsPropertiesNVX, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceGeneratedCommandsPropertiesNVX(physicalDevice, pFeatures, pLimits);
     }
 }
@@ -7907,17 +8917,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWScalingNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetViewportWScalingNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetViewportWScalingNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
     }
     DispatchCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetViewportWScalingNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
     }
 }
@@ -7930,16 +8943,19 @@ VKAPI_ATTR VkResult VKAPI_CALL ReleaseDisplayEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledReleaseDisplayEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateReleaseDisplayEXT(physicalDevice, display);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledReleaseDisplayEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordReleaseDisplayEXT(physicalDevice, display);
     }
     VkResult result = DispatchReleaseDisplayEXT(physicalDevice, display);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledReleaseDisplayEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordReleaseDisplayEXT(physicalDevice, display, result);
     }
     return result;
@@ -7955,16 +8971,19 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireXlibDisplayEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAcquireXlibDisplayEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireXlibDisplayEXT(physicalDevice, dpy, display);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAcquireXlibDisplayEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordAcquireXlibDisplayEXT(physicalDevice, dpy, display);
     }
     VkResult result = DispatchAcquireXlibDisplayEXT(physicalDevice, dpy, display);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAcquireXlibDisplayEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordAcquireXlibDisplayEXT(physicalDevice, dpy, display, result);
     }
     return result;
@@ -7979,16 +8998,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRandROutputDisplayEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetRandROutputDisplayEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRandROutputDisplayEXT(physicalDevice, dpy, rrOutput, pDisplay);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetRandROutputDisplayEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetRandROutputDisplayEXT(physicalDevice, dpy, rrOutput, pDisplay);
     }
     VkResult result = DispatchGetRandROutputDisplayEXT(physicalDevice, dpy, rrOutput, pDisplay);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetRandROutputDisplayEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetRandROutputDisplayEXT(physicalDevice, dpy, rrOutput, pDisplay, result);
     }
     return result;
@@ -8004,16 +9026,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceCapabilities2EXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSurfaceCapabilities2EXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfaceCapabilities2EXT(physicalDevice, surface, pSurfaceCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSurfaceCapabilities2EXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceSurfaceCapabilities2EXT(physicalDevice, surface, pSurfaceCapabilities);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfaceCapabilities2EXT(physicalDevice, surface, pSurfaceCapabilities);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSurfaceCapabilities2EXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceSurfaceCapabilities2EXT(physicalDevice, surface, pSurfaceCapabilities, result);
     }
     return result;
@@ -8028,16 +9053,19 @@ VKAPI_ATTR VkResult VKAPI_CALL DisplayPowerControlEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDisplayPowerControlEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDisplayPowerControlEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
     }
     VkResult result = DispatchDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDisplayPowerControlEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDisplayPowerControlEXT(device, display, pDisplayPowerInfo, result);
     }
     return result;
@@ -8052,16 +9080,19 @@ VKAPI_ATTR VkResult VKAPI_CALL RegisterDeviceEventEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledRegisterDeviceEventEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledRegisterDeviceEventEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
     }
     VkResult result = DispatchRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledRegisterDeviceEventEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence, result);
     }
     return result;
@@ -8077,16 +9108,19 @@ VKAPI_ATTR VkResult VKAPI_CALL RegisterDisplayEventEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledRegisterDisplayEventEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledRegisterDisplayEventEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
     }
     VkResult result = DispatchRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledRegisterDisplayEventEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence, result);
     }
     return result;
@@ -8101,16 +9135,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainCounterEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetSwapchainCounterEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetSwapchainCounterEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
     }
     VkResult result = DispatchGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetSwapchainCounterEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue, result);
     }
     return result;
@@ -8125,16 +9162,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRefreshCycleDurationGOOGLE(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetRefreshCycleDurationGOOGLE, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetRefreshCycleDurationGOOGLE, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
     }
     VkResult result = DispatchGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetRefreshCycleDurationGOOGLE, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties, result);
     }
     return result;
@@ -8149,16 +9189,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPastPresentationTimingGOOGLE(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPastPresentationTimingGOOGLE, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPastPresentationTimingGOOGLE, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
     }
     VkResult result = DispatchGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPastPresentationTimingGOOGLE, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings, result);
     }
     return result;
@@ -8178,17 +9221,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetDiscardRectangleEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetDiscardRectangleEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
     }
     DispatchCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetDiscardRectangleEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
     }
 }
@@ -8206,16 +9252,19 @@ VKAPI_ATTR void VKAPI_CALL SetHdrMetadataEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledSetHdrMetadataEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledSetHdrMetadataEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
     }
     DispatchSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledSetHdrMetadataEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
     }
 }
@@ -8231,16 +9280,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateIOSSurfaceMVK(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateIOSSurfaceMVK, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateIOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateIOSSurfaceMVK, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateIOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateIOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateIOSSurfaceMVK, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateIOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -8258,16 +9310,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateMacOSSurfaceMVK(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateMacOSSurfaceMVK, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateMacOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateMacOSSurfaceMVK, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateMacOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateMacOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateMacOSSurfaceMVK, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateMacOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -8284,17 +9339,20 @@ VKAPI_ATTR VkResult VKAPI_CALL SetDebugUtilsObjectNameEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledSetDebugUtilsObjectNameEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetDebugUtilsObjectNameEXT(device, pNameInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledSetDebugUtilsObjectNameEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordSetDebugUtilsObjectNameEXT(device, pNameInfo);
     }
     layer_data->report_data->DebugReportSetUtilsObjectName(pNameInfo);
     VkResult result = DispatchSetDebugUtilsObjectNameEXT(device, pNameInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledSetDebugUtilsObjectNameEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordSetDebugUtilsObjectNameEXT(device, pNameInfo, result);
     }
     return result;
@@ -8307,16 +9365,19 @@ VKAPI_ATTR VkResult VKAPI_CALL SetDebugUtilsObjectTagEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledSetDebugUtilsObjectTagEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetDebugUtilsObjectTagEXT(device, pTagInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledSetDebugUtilsObjectTagEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordSetDebugUtilsObjectTagEXT(device, pTagInfo);
     }
     VkResult result = DispatchSetDebugUtilsObjectTagEXT(device, pTagInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledSetDebugUtilsObjectTagEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordSetDebugUtilsObjectTagEXT(device, pTagInfo, result);
     }
     return result;
@@ -8329,17 +9390,20 @@ VKAPI_ATTR void VKAPI_CALL QueueBeginDebugUtilsLabelEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledQueueBeginDebugUtilsLabelEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledQueueBeginDebugUtilsLabelEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
     }
     BeginQueueDebugUtilsLabel(layer_data->report_data, queue, pLabelInfo);
     DispatchQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledQueueBeginDebugUtilsLabelEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
     }
 }
@@ -8350,17 +9414,20 @@ VKAPI_ATTR void VKAPI_CALL QueueEndDebugUtilsLabelEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledQueueEndDebugUtilsLabelEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueEndDebugUtilsLabelEXT(queue);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledQueueEndDebugUtilsLabelEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordQueueEndDebugUtilsLabelEXT(queue);
     }
     DispatchQueueEndDebugUtilsLabelEXT(queue);
     EndQueueDebugUtilsLabel(layer_data->report_data, queue);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledQueueEndDebugUtilsLabelEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordQueueEndDebugUtilsLabelEXT(queue);
     }
 }
@@ -8372,17 +9439,20 @@ VKAPI_ATTR void VKAPI_CALL QueueInsertDebugUtilsLabelEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledQueueInsertDebugUtilsLabelEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledQueueInsertDebugUtilsLabelEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
     }
     InsertQueueDebugUtilsLabel(layer_data->report_data, queue, pLabelInfo);
     DispatchQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledQueueInsertDebugUtilsLabelEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
     }
 }
@@ -8393,17 +9463,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginDebugUtilsLabelEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBeginDebugUtilsLabelEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBeginDebugUtilsLabelEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
     DispatchCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBeginDebugUtilsLabelEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
 }
@@ -8413,17 +9486,20 @@ VKAPI_ATTR void VKAPI_CALL CmdEndDebugUtilsLabelEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdEndDebugUtilsLabelEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndDebugUtilsLabelEXT(commandBuffer);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdEndDebugUtilsLabelEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdEndDebugUtilsLabelEXT(commandBuffer);
     }
     DispatchCmdEndDebugUtilsLabelEXT(commandBuffer);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdEndDebugUtilsLabelEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdEndDebugUtilsLabelEXT(commandBuffer);
     }
 }
@@ -8434,17 +9510,20 @@ VKAPI_ATTR void VKAPI_CALL CmdInsertDebugUtilsLabelEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdInsertDebugUtilsLabelEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdInsertDebugUtilsLabelEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
     DispatchCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdInsertDebugUtilsLabelEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
 }
@@ -8458,17 +9537,20 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDebugUtilsMessengerEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDebugUtilsMessengerEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDebugUtilsMessengerEXT(instance, pCreateInfo, pAllocator, pMessenger);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDebugUtilsMessengerEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateDebugUtilsMessengerEXT(instance, pCreateInfo, pAllocator, pMessenger);
     }
     VkResult result = DispatchCreateDebugUtilsMessengerEXT(instance, pCreateInfo, pAllocator, pMessenger);
     layer_create_messenger_callback(layer_data->report_data, false, pCreateInfo, pAllocator, pMessenger);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDebugUtilsMessengerEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateDebugUtilsMessengerEXT(instance, pCreateInfo, pAllocator, pMessenger, result);
     }
     return result;
@@ -8482,17 +9564,20 @@ VKAPI_ATTR void VKAPI_CALL DestroyDebugUtilsMessengerEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyDebugUtilsMessengerEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDebugUtilsMessengerEXT(instance, messenger, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyDebugUtilsMessengerEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyDebugUtilsMessengerEXT(instance, messenger, pAllocator);
     }
     DispatchDestroyDebugUtilsMessengerEXT(instance, messenger, pAllocator);
     layer_destroy_callback(layer_data->report_data, messenger, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyDebugUtilsMessengerEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyDebugUtilsMessengerEXT(instance, messenger, pAllocator);
     }
 }
@@ -8506,16 +9591,19 @@ VKAPI_ATTR void VKAPI_CALL SubmitDebugUtilsMessageEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledSubmitDebugUtilsMessageEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSubmitDebugUtilsMessageEXT(instance, messageSeverity, messageTypes, pCallbackData);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledSubmitDebugUtilsMessageEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordSubmitDebugUtilsMessageEXT(instance, messageSeverity, messageTypes, pCallbackData);
     }
     DispatchSubmitDebugUtilsMessageEXT(instance, messageSeverity, messageTypes, pCallbackData);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledSubmitDebugUtilsMessageEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordSubmitDebugUtilsMessageEXT(instance, messageSeverity, messageTypes, pCallbackData);
     }
 }
@@ -8530,16 +9618,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetAndroidHardwareBufferPropertiesANDROID(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetAndroidHardwareBufferPropertiesANDROID, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetAndroidHardwareBufferPropertiesANDROID, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
     }
     VkResult result = DispatchGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetAndroidHardwareBufferPropertiesANDROID, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties, result);
     }
     return result;
@@ -8553,16 +9644,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryAndroidHardwareBufferANDROID(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetMemoryAndroidHardwareBufferANDROID, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetMemoryAndroidHardwareBufferANDROID, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
     }
     VkResult result = DispatchGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetMemoryAndroidHardwareBufferANDROID, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer, result);
     }
     return result;
@@ -8582,17 +9676,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetSampleLocationsEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetSampleLocationsEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetSampleLocationsEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
     }
     DispatchCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetSampleLocationsEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
     }
 }
@@ -8605,16 +9702,19 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMultisamplePropertiesEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceMultisamplePropertiesEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceMultisamplePropertiesEXT(physicalDevice, samples, pMultisampleProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceMultisamplePropertiesEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceMultisamplePropertiesEXT(physicalDevice, samples, pMultisampleProperties);
     }
     DispatchGetPhysicalDeviceMultisamplePropertiesEXT(physicalDevice, samples, pMultisampleProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceMultisamplePropertiesEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceMultisamplePropertiesEXT(physicalDevice, samples, pMultisampleProperties);
     }
 }
@@ -8634,16 +9734,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetImageDrmFormatModifierPropertiesEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageDrmFormatModifierPropertiesEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageDrmFormatModifierPropertiesEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
     }
     VkResult result = DispatchGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetImageDrmFormatModifierPropertiesEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties, result);
     }
     return result;
@@ -8660,17 +9763,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBindShadingRateImageNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBindShadingRateImageNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBindShadingRateImageNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
     }
     DispatchCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBindShadingRateImageNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
     }
 }
@@ -8683,17 +9789,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportShadingRatePaletteNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetViewportShadingRatePaletteNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetViewportShadingRatePaletteNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
     }
     DispatchCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetViewportShadingRatePaletteNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
     }
 }
@@ -8706,17 +9815,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoarseSampleOrderNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetCoarseSampleOrderNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetCoarseSampleOrderNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
     }
     DispatchCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetCoarseSampleOrderNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
     }
 }
@@ -8731,16 +9843,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureNV(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateAccelerationStructureNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateAccelerationStructureNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
     }
     VkResult result = DispatchCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateAccelerationStructureNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure, result);
     }
     return result;
@@ -8754,16 +9869,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyAccelerationStructureNV(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyAccelerationStructureNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyAccelerationStructureNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
     }
     DispatchDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyAccelerationStructureNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
     }
 }
@@ -8776,16 +9894,19 @@ VKAPI_ATTR void VKAPI_CALL GetAccelerationStructureMemoryRequirementsNV(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetAccelerationStructureMemoryRequirementsNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetAccelerationStructureMemoryRequirementsNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     }
     DispatchGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetAccelerationStructureMemoryRequirementsNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     }
 }
@@ -8798,16 +9919,19 @@ VKAPI_ATTR VkResult VKAPI_CALL BindAccelerationStructureMemoryNV(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledBindAccelerationStructureMemoryNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledBindAccelerationStructureMemoryNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledBindAccelerationStructureMemoryNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -8826,17 +9950,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructureNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBuildAccelerationStructureNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBuildAccelerationStructureNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
     }
     DispatchCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdBuildAccelerationStructureNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
     }
 }
@@ -8849,17 +9976,20 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdCopyAccelerationStructureNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdCopyAccelerationStructureNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
     }
     DispatchCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdCopyAccelerationStructureNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
     }
 }
@@ -8883,17 +10013,20 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdTraceRaysNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdTraceRaysNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
     }
     DispatchCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdTraceRaysNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
     }
 }
@@ -8909,16 +10042,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingShaderGroupHandlesNV(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetRayTracingShaderGroupHandlesNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetRayTracingShaderGroupHandlesNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
     }
     VkResult result = DispatchGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetRayTracingShaderGroupHandlesNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData, result);
     }
     return result;
@@ -8933,16 +10069,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetAccelerationStructureHandleNV(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetAccelerationStructureHandleNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetAccelerationStructureHandleNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
     }
     VkResult result = DispatchGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetAccelerationStructureHandleNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData, result);
     }
     return result;
@@ -8958,17 +10097,20 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdWriteAccelerationStructuresPropertiesNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdWriteAccelerationStructuresPropertiesNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     }
     DispatchCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdWriteAccelerationStructuresPropertiesNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     }
 }
@@ -8981,16 +10123,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CompileDeferredNV(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCompileDeferredNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCompileDeferredNV(device, pipeline, shader);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCompileDeferredNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCompileDeferredNV(device, pipeline, shader);
     }
     VkResult result = DispatchCompileDeferredNV(device, pipeline, shader);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCompileDeferredNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCompileDeferredNV(device, pipeline, shader, result);
     }
     return result;
@@ -9009,16 +10154,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryHostPointerPropertiesEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetMemoryHostPointerPropertiesEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetMemoryHostPointerPropertiesEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
     }
     VkResult result = DispatchGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetMemoryHostPointerPropertiesEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties, result);
     }
     return result;
@@ -9034,17 +10182,20 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteBufferMarkerAMD(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdWriteBufferMarkerAMD, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdWriteBufferMarkerAMD, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
     }
     DispatchCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdWriteBufferMarkerAMD, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
     }
 }
@@ -9059,16 +10210,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceCalibrateableTimeDomainsEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceCalibrateableTimeDomainsEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, pTimeDomainCount, pTimeDomains);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceCalibrateableTimeDomainsEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, pTimeDomainCount, pTimeDomains);
     }
     VkResult result = DispatchGetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, pTimeDomainCount, pTimeDomains);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceCalibrateableTimeDomainsEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, pTimeDomainCount, pTimeDomains, result);
     }
     return result;
@@ -9084,16 +10238,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetCalibratedTimestampsEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetCalibratedTimestampsEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetCalibratedTimestampsEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
     }
     VkResult result = DispatchGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetCalibratedTimestampsEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation, result);
     }
     return result;
@@ -9116,17 +10273,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawMeshTasksNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawMeshTasksNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
     }
     DispatchCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawMeshTasksNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
     }
 }
@@ -9140,17 +10300,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawMeshTasksIndirectNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawMeshTasksIndirectNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
     }
     DispatchCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawMeshTasksIndirectNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
     }
 }
@@ -9166,17 +10329,20 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectCountNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawMeshTasksIndirectCountNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawMeshTasksIndirectCountNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdDrawMeshTasksIndirectCountNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -9192,17 +10358,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExclusiveScissorNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetExclusiveScissorNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetExclusiveScissorNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
     }
     DispatchCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetExclusiveScissorNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
     }
 }
@@ -9214,17 +10383,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCheckpointNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetCheckpointNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetCheckpointNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
     }
     DispatchCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetCheckpointNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
     }
 }
@@ -9237,16 +10409,19 @@ VKAPI_ATTR void VKAPI_CALL GetQueueCheckpointDataNV(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetQueueCheckpointDataNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetQueueCheckpointDataNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
     }
     DispatchGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetQueueCheckpointDataNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
     }
 }
@@ -9260,16 +10435,19 @@ VKAPI_ATTR VkResult VKAPI_CALL InitializePerformanceApiINTEL(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledInitializePerformanceApiINTEL, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateInitializePerformanceApiINTEL(device, pInitializeInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledInitializePerformanceApiINTEL, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordInitializePerformanceApiINTEL(device, pInitializeInfo);
     }
     VkResult result = DispatchInitializePerformanceApiINTEL(device, pInitializeInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledInitializePerformanceApiINTEL, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordInitializePerformanceApiINTEL(device, pInitializeInfo, result);
     }
     return result;
@@ -9281,16 +10459,19 @@ VKAPI_ATTR void VKAPI_CALL UninitializePerformanceApiINTEL(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledUninitializePerformanceApiINTEL, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUninitializePerformanceApiINTEL(device);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledUninitializePerformanceApiINTEL, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordUninitializePerformanceApiINTEL(device);
     }
     DispatchUninitializePerformanceApiINTEL(device);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledUninitializePerformanceApiINTEL, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordUninitializePerformanceApiINTEL(device);
     }
 }
@@ -9301,17 +10482,20 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceMarkerINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetPerformanceMarkerINTEL, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetPerformanceMarkerINTEL, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
     }
     VkResult result = DispatchCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetPerformanceMarkerINTEL, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo, result);
     }
     return result;
@@ -9323,17 +10507,20 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceStreamMarkerINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetPerformanceStreamMarkerINTEL, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetPerformanceStreamMarkerINTEL, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
     }
     VkResult result = DispatchCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetPerformanceStreamMarkerINTEL, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo, result);
     }
     return result;
@@ -9345,17 +10532,20 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceOverrideINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetPerformanceOverrideINTEL, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetPerformanceOverrideINTEL, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
     }
     VkResult result = DispatchCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetPerformanceOverrideINTEL, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo, result);
     }
     return result;
@@ -9369,16 +10559,19 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquirePerformanceConfigurationINTEL(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAcquirePerformanceConfigurationINTEL, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAcquirePerformanceConfigurationINTEL, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
     }
     VkResult result = DispatchAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAcquirePerformanceConfigurationINTEL, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration, result);
     }
     return result;
@@ -9391,16 +10584,19 @@ VKAPI_ATTR VkResult VKAPI_CALL ReleasePerformanceConfigurationINTEL(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledReleasePerformanceConfigurationINTEL, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateReleasePerformanceConfigurationINTEL(device, configuration);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledReleasePerformanceConfigurationINTEL, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordReleasePerformanceConfigurationINTEL(device, configuration);
     }
     VkResult result = DispatchReleasePerformanceConfigurationINTEL(device, configuration);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledReleasePerformanceConfigurationINTEL, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordReleasePerformanceConfigurationINTEL(device, configuration, result);
     }
     return result;
@@ -9413,16 +10609,19 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSetPerformanceConfigurationINTEL(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledQueueSetPerformanceConfigurationINTEL, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueSetPerformanceConfigurationINTEL(queue, configuration);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledQueueSetPerformanceConfigurationINTEL, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordQueueSetPerformanceConfigurationINTEL(queue, configuration);
     }
     VkResult result = DispatchQueueSetPerformanceConfigurationINTEL(queue, configuration);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledQueueSetPerformanceConfigurationINTEL, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordQueueSetPerformanceConfigurationINTEL(queue, configuration, result);
     }
     return result;
@@ -9436,16 +10635,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPerformanceParameterINTEL(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPerformanceParameterINTEL, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPerformanceParameterINTEL(device, parameter, pValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPerformanceParameterINTEL, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPerformanceParameterINTEL(device, parameter, pValue);
     }
     VkResult result = DispatchGetPerformanceParameterINTEL(device, parameter, pValue);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPerformanceParameterINTEL, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPerformanceParameterINTEL(device, parameter, pValue, result);
     }
     return result;
@@ -9461,16 +10663,19 @@ VKAPI_ATTR void VKAPI_CALL SetLocalDimmingAMD(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledSetLocalDimmingAMD, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledSetLocalDimmingAMD, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
     }
     DispatchSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledSetLocalDimmingAMD, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
     }
 }
@@ -9486,16 +10691,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImagePipeSurfaceFUCHSIA(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateImagePipeSurfaceFUCHSIA, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateImagePipeSurfaceFUCHSIA(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateImagePipeSurfaceFUCHSIA, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateImagePipeSurfaceFUCHSIA(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateImagePipeSurfaceFUCHSIA(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateImagePipeSurfaceFUCHSIA, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateImagePipeSurfaceFUCHSIA(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -9513,16 +10721,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateMetalSurfaceEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateMetalSurfaceEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateMetalSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateMetalSurfaceEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateMetalSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateMetalSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateMetalSurfaceEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateMetalSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -9547,16 +10758,19 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddressEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetBufferDeviceAddressEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferDeviceAddressEXT(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetBufferDeviceAddressEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetBufferDeviceAddressEXT(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetBufferDeviceAddressEXT(device, pInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetBufferDeviceAddressEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetBufferDeviceAddressEXT(device, pInfo, result);
     }
     return result;
@@ -9574,16 +10788,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceCooperativeMatrixPropertiesNV(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceCooperativeMatrixPropertiesNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceCooperativeMatrixPropertiesNV(physicalDevice, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceCooperativeMatrixPropertiesNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceCooperativeMatrixPropertiesNV(physicalDevice, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceCooperativeMatrixPropertiesNV(physicalDevice, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceCooperativeMatrixPropertiesNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceCooperativeMatrixPropertiesNV(physicalDevice, pPropertyCount, pProperties, result);
     }
     return result;
@@ -9598,16 +10815,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSupportedFramebufferMixedSamples
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(physicalDevice, pCombinationCount, pCombinations);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(physicalDevice, pCombinationCount, pCombinations);
     }
     VkResult result = DispatchGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(physicalDevice, pCombinationCount, pCombinations);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(physicalDevice, pCombinationCount, pCombinations, result);
     }
     return result;
@@ -9626,16 +10846,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfacePresentModes2EXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSurfacePresentModes2EXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfacePresentModes2EXT(physicalDevice, pSurfaceInfo, pPresentModeCount, pPresentModes);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSurfacePresentModes2EXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceSurfacePresentModes2EXT(physicalDevice, pSurfaceInfo, pPresentModeCount, pPresentModes);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfacePresentModes2EXT(physicalDevice, pSurfaceInfo, pPresentModeCount, pPresentModes);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceSurfacePresentModes2EXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceSurfacePresentModes2EXT(physicalDevice, pSurfaceInfo, pPresentModeCount, pPresentModes, result);
     }
     return result;
@@ -9648,16 +10871,19 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireFullScreenExclusiveModeEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAcquireFullScreenExclusiveModeEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireFullScreenExclusiveModeEXT(device, swapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAcquireFullScreenExclusiveModeEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordAcquireFullScreenExclusiveModeEXT(device, swapchain);
     }
     VkResult result = DispatchAcquireFullScreenExclusiveModeEXT(device, swapchain);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAcquireFullScreenExclusiveModeEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordAcquireFullScreenExclusiveModeEXT(device, swapchain, result);
     }
     return result;
@@ -9670,16 +10896,19 @@ VKAPI_ATTR VkResult VKAPI_CALL ReleaseFullScreenExclusiveModeEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledReleaseFullScreenExclusiveModeEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateReleaseFullScreenExclusiveModeEXT(device, swapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledReleaseFullScreenExclusiveModeEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordReleaseFullScreenExclusiveModeEXT(device, swapchain);
     }
     VkResult result = DispatchReleaseFullScreenExclusiveModeEXT(device, swapchain);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledReleaseFullScreenExclusiveModeEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordReleaseFullScreenExclusiveModeEXT(device, swapchain, result);
     }
     return result;
@@ -9693,16 +10922,19 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupSurfacePresentModes2EXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceGroupSurfacePresentModes2EXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceGroupSurfacePresentModes2EXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
     }
     VkResult result = DispatchGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetDeviceGroupSurfacePresentModes2EXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes, result);
     }
     return result;
@@ -9719,16 +10951,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateHeadlessSurfaceEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateHeadlessSurfaceEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateHeadlessSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateHeadlessSurfaceEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateHeadlessSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateHeadlessSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateHeadlessSurfaceEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateHeadlessSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -9742,17 +10977,20 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+        auto lock = intercept->cmd_read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetLineStippleEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetLineStippleEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
     }
     DispatchCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->cmd_local_write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCmdSetLineStippleEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
     }
 }
@@ -9767,16 +11005,19 @@ VKAPI_ATTR void VKAPI_CALL ResetQueryPoolEXT(
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledResetQueryPoolEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledResetQueryPoolEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
     }
     DispatchResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledResetQueryPoolEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
     }
 }
@@ -10242,6 +11483,459 @@ const std::unordered_map<std::string, function_data> name_to_funcptr_map = {
     {"vkResetQueryPoolEXT", {false, (void*)ResetQueryPoolEXT}},
 };
 
+const char *const profiled_entry_point_names[] = {
+    "vkCreateInstance",
+    "vkDestroyInstance",
+    "vkEnumeratePhysicalDevices",
+    "vkGetPhysicalDeviceFeatures",
+    "vkGetPhysicalDeviceFormatProperties",
+    "vkGetPhysicalDeviceImageFormatProperties",
+    "vkGetPhysicalDeviceProperties",
+    "vkGetPhysicalDeviceQueueFamilyProperties",
+    "vkGetPhysicalDeviceMemoryProperties",
+    "vkGetInstanceProcAddr",
+    "vkGetDeviceProcAddr",
+    "vkCreateDevice",
+    "vkDestroyDevice",
+    "vkEnumerateInstanceExtensionProperties",
+    "vkEnumerateDeviceExtensionProperties",
+    "vkEnumerateInstanceLayerProperties",
+    "vkEnumerateDeviceLayerProperties",
+    "vkGetDeviceQueue",
+    "vkQueueSubmit",
+    "vkQueueWaitIdle",
+    "vkDeviceWaitIdle",
+    "vkAllocateMemory",
+    "vkFreeMemory",
+    "vkMapMemory",
+    "vkUnmapMemory",
+    "vkFlushMappedMemoryRanges",
+    "vkInvalidateMappedMemoryRanges",
+    "vkGetDeviceMemoryCommitment",
+    "vkBindBufferMemory",
+    "vkBindImageMemory",
+    "vkGetBufferMemoryRequirements",
+    "vkGetImageMemoryRequirements",
+    "vkGetImageSparseMemoryRequirements",
+    "vkGetPhysicalDeviceSparseImageFormatProperties",
+    "vkQueueBindSparse",
+    "vkCreateFence",
+    "vkDestroyFence",
+    "vkResetFences",
+    "vkGetFenceStatus",
+    "vkWaitForFences",
+    "vkCreateSemaphore",
+    "vkDestroySemaphore",
+    "vkCreateEvent",
+    "vkDestroyEvent",
+    "vkGetEventStatus",
+    "vkSetEvent",
+    "vkResetEvent",
+    "vkCreateQueryPool",
+    "vkDestroyQueryPool",
+    "vkGetQueryPoolResults",
+    "vkCreateBuffer",
+    "vkDestroyBuffer",
+    "vkCreateBufferView",
+    "vkDestroyBufferView",
+    "vkCreateImage",
+    "vkDestroyImage",
+    "vkGetImageSubresourceLayout",
+    "vkCreateImageView",
+    "vkDestroyImageView",
+    "vkCreateShaderModule",
+    "vkDestroyShaderModule",
+    "vkCreatePipelineCache",
+    "vkDestroyPipelineCache",
+    "vkGetPipelineCacheData",
+    "vkMergePipelineCaches",
+    "vkCreateGraphicsPipelines",
+    "vkCreateComputePipelines",
+    "vkDestroyPipeline",
+    "vkCreatePipelineLayout",
+    "vkDestroyPipelineLayout",
+    "vkCreateSampler",
+    "vkDestroySampler",
+    "vkCreateDescriptorSetLayout",
+    "vkDestroyDescriptorSetLayout",
+    "vkCreateDescriptorPool",
+    "vkDestroyDescriptorPool",
+    "vkResetDescriptorPool",
+    "vkAllocateDescriptorSets",
+    "vkFreeDescriptorSets",
+    "vkUpdateDescriptorSets",
+    "vkCreateFramebuffer",
+    "vkDestroyFramebuffer",
+    "vkCreateRenderPass",
+    "vkDestroyRenderPass",
+    "vkGetRenderAreaGranularity",
+    "vkCreateCommandPool",
+    "vkDestroyCommandPool",
+    "vkResetCommandPool",
+    "vkAllocateCommandBuffers",
+    "vkFreeCommandBuffers",
+    "vkBeginCommandBuffer",
+    "vkEndCommandBuffer",
+    "vkResetCommandBuffer",
+    "vkCmdBindPipeline",
+    "vkCmdSetViewport",
+    "vkCmdSetScissor",
+    "vkCmdSetLineWidth",
+    "vkCmdSetDepthBias",
+    "vkCmdSetBlendConstants",
+    "vkCmdSetDepthBounds",
+    "vkCmdSetStencilCompareMask",
+    "vkCmdSetStencilWriteMask",
+    "vkCmdSetStencilReference",
+    "vkCmdBindDescriptorSets",
+    "vkCmdBindIndexBuffer",
+    "vkCmdBindVertexBuffers",
+    "vkCmdDraw",
+    "vkCmdDrawIndexed",
+    "vkCmdDrawIndirect",
+    "vkCmdDrawIndexedIndirect",
+    "vkCmdDispatch",
+    "vkCmdDispatchIndirect",
+    "vkCmdCopyBuffer",
+    "vkCmdCopyImage",
+    "vkCmdBlitImage",
+    "vkCmdCopyBufferToImage",
+    "vkCmdCopyImageToBuffer",
+    "vkCmdUpdateBuffer",
+    "vkCmdFillBuffer",
+    "vkCmdClearColorImage",
+    "vkCmdClearDepthStencilImage",
+    "vkCmdClearAttachments",
+    "vkCmdResolveImage",
+    "vkCmdSetEvent",
+    "vkCmdResetEvent",
+    "vkCmdWaitEvents",
+    "vkCmdPipelineBarrier",
+    "vkCmdBeginQuery",
+    "vkCmdEndQuery",
+    "vkCmdResetQueryPool",
+    "vkCmdWriteTimestamp",
+    "vkCmdCopyQueryPoolResults",
+    "vkCmdPushConstants",
+    "vkCmdBeginRenderPass",
+    "vkCmdNextSubpass",
+    "vkCmdEndRenderPass",
+    "vkCmdExecuteCommands",
+    "vkBindBufferMemory2",
+    "vkBindImageMemory2",
+    "vkGetDeviceGroupPeerMemoryFeatures",
+    "vkCmdSetDeviceMask",
+    "vkCmdDispatchBase",
+    "vkEnumeratePhysicalDeviceGroups",
+    "vkGetImageMemoryRequirements2",
+    "vkGetBufferMemoryRequirements2",
+    "vkGetImageSparseMemoryRequirements2",
+    "vkGetPhysicalDeviceFeatures2",
+    "vkGetPhysicalDeviceProperties2",
+    "vkGetPhysicalDeviceFormatProperties2",
+    "vkGetPhysicalDeviceImageFormatProperties2",
+    "vkGetPhysicalDeviceQueueFamilyProperties2",
+    "vkGetPhysicalDeviceMemoryProperties2",
+    "vkGetPhysicalDeviceSparseImageFormatProperties2",
+    "vkTrimCommandPool",
+    "vkGetDeviceQueue2",
+    "vkCreateSamplerYcbcrConversion",
+    "vkDestroySamplerYcbcrConversion",
+    "vkCreateDescriptorUpdateTemplate",
+    "vkDestroyDescriptorUpdateTemplate",
+    "vkUpdateDescriptorSetWithTemplate",
+    "vkGetPhysicalDeviceExternalBufferProperties",
+    "vkGetPhysicalDeviceExternalFenceProperties",
+    "vkGetPhysicalDeviceExternalSemaphoreProperties",
+    "vkGetDescriptorSetLayoutSupport",
+    "vkCmdDrawIndirectCount",
+    "vkCmdDrawIndexedIndirectCount",
+    "vkCreateRenderPass2",
+    "vkCmdBeginRenderPass2",
+    "vkCmdNextSubpass2",
+    "vkCmdEndRenderPass2",
+    "vkResetQueryPool",
+    "vkGetSemaphoreCounterValue",
+    "vkWaitSemaphores",
+    "vkSignalSemaphore",
+    "vkGetBufferDeviceAddress",
+    "vkGetBufferOpaqueCaptureAddress",
+    "vkGetDeviceMemoryOpaqueCaptureAddress",
+    "vkDestroySurfaceKHR",
+    "vkGetPhysicalDeviceSurfaceSupportKHR",
+    "vkGetPhysicalDeviceSurfaceCapabilitiesKHR",
+    "vkGetPhysicalDeviceSurfaceFormatsKHR",
+    "vkGetPhysicalDeviceSurfacePresentModesKHR",
+    "vkCreateSwapchainKHR",
+    "vkDestroySwapchainKHR",
+    "vkGetSwapchainImagesKHR",
+    "vkAcquireNextImageKHR",
+    "vkQueuePresentKHR",
+    "vkGetDeviceGroupPresentCapabilitiesKHR",
+    "vkGetDeviceGroupSurfacePresentModesKHR",
+    "vkGetPhysicalDevicePresentRectanglesKHR",
+    "vkAcquireNextImage2KHR",
+    "vkGetPhysicalDeviceDisplayPropertiesKHR",
+    "vkGetPhysicalDeviceDisplayPlanePropertiesKHR",
+    "vkGetDisplayPlaneSupportedDisplaysKHR",
+    "vkGetDisplayModePropertiesKHR",
+    "vkCreateDisplayModeKHR",
+    "vkGetDisplayPlaneCapabilitiesKHR",
+    "vkCreateDisplayPlaneSurfaceKHR",
+    "vkCreateSharedSwapchainsKHR",
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+    "vkCreateXlibSurfaceKHR",
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+    "vkGetPhysicalDeviceXlibPresentationSupportKHR",
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+    "vkCreateXcbSurfaceKHR",
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+    "vkGetPhysicalDeviceXcbPresentationSupportKHR",
+#endif
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+    "vkCreateWaylandSurfaceKHR",
+#endif
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+    "vkGetPhysicalDeviceWaylandPresentationSupportKHR",
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    "vkCreateAndroidSurfaceKHR",
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    "vkCreateWin32SurfaceKHR",
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    "vkGetPhysicalDeviceWin32PresentationSupportKHR",
+#endif
+    "vkGetPhysicalDeviceFeatures2KHR",
+    "vkGetPhysicalDeviceProperties2KHR",
+    "vkGetPhysicalDeviceFormatProperties2KHR",
+    "vkGetPhysicalDeviceImageFormatProperties2KHR",
+    "vkGetPhysicalDeviceQueueFamilyProperties2KHR",
+    "vkGetPhysicalDeviceMemoryProperties2KHR",
+    "vkGetPhysicalDeviceSparseImageFormatProperties2KHR",
+    "vkGetDeviceGroupPeerMemoryFeaturesKHR",
+    "vkCmdSetDeviceMaskKHR",
+    "vkCmdDispatchBaseKHR",
+    "vkTrimCommandPoolKHR",
+    "vkEnumeratePhysicalDeviceGroupsKHR",
+    "vkGetPhysicalDeviceExternalBufferPropertiesKHR",
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    "vkGetMemoryWin32HandleKHR",
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    "vkGetMemoryWin32HandlePropertiesKHR",
+#endif
+    "vkGetMemoryFdKHR",
+    "vkGetMemoryFdPropertiesKHR",
+    "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR",
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    "vkImportSemaphoreWin32HandleKHR",
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    "vkGetSemaphoreWin32HandleKHR",
+#endif
+    "vkImportSemaphoreFdKHR",
+    "vkGetSemaphoreFdKHR",
+    "vkCmdPushDescriptorSetKHR",
+    "vkCmdPushDescriptorSetWithTemplateKHR",
+    "vkCreateDescriptorUpdateTemplateKHR",
+    "vkDestroyDescriptorUpdateTemplateKHR",
+    "vkUpdateDescriptorSetWithTemplateKHR",
+    "vkCreateRenderPass2KHR",
+    "vkCmdBeginRenderPass2KHR",
+    "vkCmdNextSubpass2KHR",
+    "vkCmdEndRenderPass2KHR",
+    "vkGetSwapchainStatusKHR",
+    "vkGetPhysicalDeviceExternalFencePropertiesKHR",
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    "vkImportFenceWin32HandleKHR",
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    "vkGetFenceWin32HandleKHR",
+#endif
+    "vkImportFenceFdKHR",
+    "vkGetFenceFdKHR",
+    "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR",
+    "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR",
+    "vkAcquireProfilingLockKHR",
+    "vkReleaseProfilingLockKHR",
+    "vkGetPhysicalDeviceSurfaceCapabilities2KHR",
+    "vkGetPhysicalDeviceSurfaceFormats2KHR",
+    "vkGetPhysicalDeviceDisplayProperties2KHR",
+    "vkGetPhysicalDeviceDisplayPlaneProperties2KHR",
+    "vkGetDisplayModeProperties2KHR",
+    "vkGetDisplayPlaneCapabilities2KHR",
+    "vkGetImageMemoryRequirements2KHR",
+    "vkGetBufferMemoryRequirements2KHR",
+    "vkGetImageSparseMemoryRequirements2KHR",
+    "vkCreateSamplerYcbcrConversionKHR",
+    "vkDestroySamplerYcbcrConversionKHR",
+    "vkBindBufferMemory2KHR",
+    "vkBindImageMemory2KHR",
+    "vkGetDescriptorSetLayoutSupportKHR",
+    "vkCmdDrawIndirectCountKHR",
+    "vkCmdDrawIndexedIndirectCountKHR",
+    "vkGetSemaphoreCounterValueKHR",
+    "vkWaitSemaphoresKHR",
+    "vkSignalSemaphoreKHR",
+    "vkGetBufferDeviceAddressKHR",
+    "vkGetBufferOpaqueCaptureAddressKHR",
+    "vkGetDeviceMemoryOpaqueCaptureAddressKHR",
+    "vkGetPipelineExecutablePropertiesKHR",
+    "vkGetPipelineExecutableStatisticsKHR",
+    "vkGetPipelineExecutableInternalRepresentationsKHR",
+    "vkCreateDebugReportCallbackEXT",
+    "vkDestroyDebugReportCallbackEXT",
+    "vkDebugReportMessageEXT",
+    "vkDebugMarkerSetObjectTagEXT",
+    "vkDebugMarkerSetObjectNameEXT",
+    "vkCmdDebugMarkerBeginEXT",
+    "vkCmdDebugMarkerEndEXT",
+    "vkCmdDebugMarkerInsertEXT",
+    "vkCmdBindTransformFeedbackBuffersEXT",
+    "vkCmdBeginTransformFeedbackEXT",
+    "vkCmdEndTransformFeedbackEXT",
+    "vkCmdBeginQueryIndexedEXT",
+    "vkCmdEndQueryIndexedEXT",
+    "vkCmdDrawIndirectByteCountEXT",
+    "vkGetImageViewHandleNVX",
+    "vkCmdDrawIndirectCountAMD",
+    "vkCmdDrawIndexedIndirectCountAMD",
+    "vkGetShaderInfoAMD",
+#ifdef VK_USE_PLATFORM_GGP
+    "vkCreateStreamDescriptorSurfaceGGP",
+#endif
+    "vkGetPhysicalDeviceExternalImageFormatPropertiesNV",
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    "vkGetMemoryWin32HandleNV",
+#endif
+#ifdef VK_USE_PLATFORM_VI_NN
+    "vkCreateViSurfaceNN",
+#endif
+    "vkCmdBeginConditionalRenderingEXT",
+    "vkCmdEndConditionalRenderingEXT",
+    "vkCmdProcessCommandsNVX",
+    "vkCmdReserveSpaceForCommandsNVX",
+    "vkCreateIndirectCommandsLayoutNVX",
+    "vkDestroyIndirectCommandsLayoutNVX",
+    "vkCreateObjectTableNVX",
+    "vkDestroyObjectTableNVX",
+    "vkRegisterObjectsNVX",
+    "vkUnregisterObjectsNVX",
+    "vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX",
+    "vkCmdSetViewportWScalingNV",
+    "vkReleaseDisplayEXT",
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+    "vkAcquireXlibDisplayEXT",
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+    "vkGetRandROutputDisplayEXT",
+#endif
+    "vkGetPhysicalDeviceSurfaceCapabilities2EXT",
+    "vkDisplayPowerControlEXT",
+    "vkRegisterDeviceEventEXT",
+    "vkRegisterDisplayEventEXT",
+    "vkGetSwapchainCounterEXT",
+    "vkGetRefreshCycleDurationGOOGLE",
+    "vkGetPastPresentationTimingGOOGLE",
+    "vkCmdSetDiscardRectangleEXT",
+    "vkSetHdrMetadataEXT",
+#ifdef VK_USE_PLATFORM_IOS_MVK
+    "vkCreateIOSSurfaceMVK",
+#endif
+#ifdef VK_USE_PLATFORM_MACOS_MVK
+    "vkCreateMacOSSurfaceMVK",
+#endif
+    "vkSetDebugUtilsObjectNameEXT",
+    "vkSetDebugUtilsObjectTagEXT",
+    "vkQueueBeginDebugUtilsLabelEXT",
+    "vkQueueEndDebugUtilsLabelEXT",
+    "vkQueueInsertDebugUtilsLabelEXT",
+    "vkCmdBeginDebugUtilsLabelEXT",
+    "vkCmdEndDebugUtilsLabelEXT",
+    "vkCmdInsertDebugUtilsLabelEXT",
+    "vkCreateDebugUtilsMessengerEXT",
+    "vkDestroyDebugUtilsMessengerEXT",
+    "vkSubmitDebugUtilsMessageEXT",
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    "vkGetAndroidHardwareBufferPropertiesANDROID",
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    "vkGetMemoryAndroidHardwareBufferANDROID",
+#endif
+    "vkCmdSetSampleLocationsEXT",
+    "vkGetPhysicalDeviceMultisamplePropertiesEXT",
+    "vkGetImageDrmFormatModifierPropertiesEXT",
+    "vkCreateValidationCacheEXT",
+    "vkDestroyValidationCacheEXT",
+    "vkMergeValidationCachesEXT",
+    "vkGetValidationCacheDataEXT",
+    "vkCmdBindShadingRateImageNV",
+    "vkCmdSetViewportShadingRatePaletteNV",
+    "vkCmdSetCoarseSampleOrderNV",
+    "vkCreateAccelerationStructureNV",
+    "vkDestroyAccelerationStructureNV",
+    "vkGetAccelerationStructureMemoryRequirementsNV",
+    "vkBindAccelerationStructureMemoryNV",
+    "vkCmdBuildAccelerationStructureNV",
+    "vkCmdCopyAccelerationStructureNV",
+    "vkCmdTraceRaysNV",
+    "vkCreateRayTracingPipelinesNV",
+    "vkGetRayTracingShaderGroupHandlesNV",
+    "vkGetAccelerationStructureHandleNV",
+    "vkCmdWriteAccelerationStructuresPropertiesNV",
+    "vkCompileDeferredNV",
+    "vkGetMemoryHostPointerPropertiesEXT",
+    "vkCmdWriteBufferMarkerAMD",
+    "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT",
+    "vkGetCalibratedTimestampsEXT",
+    "vkCmdDrawMeshTasksNV",
+    "vkCmdDrawMeshTasksIndirectNV",
+    "vkCmdDrawMeshTasksIndirectCountNV",
+    "vkCmdSetExclusiveScissorNV",
+    "vkCmdSetCheckpointNV",
+    "vkGetQueueCheckpointDataNV",
+    "vkInitializePerformanceApiINTEL",
+    "vkUninitializePerformanceApiINTEL",
+    "vkCmdSetPerformanceMarkerINTEL",
+    "vkCmdSetPerformanceStreamMarkerINTEL",
+    "vkCmdSetPerformanceOverrideINTEL",
+    "vkAcquirePerformanceConfigurationINTEL",
+    "vkReleasePerformanceConfigurationINTEL",
+    "vkQueueSetPerformanceConfigurationINTEL",
+    "vkGetPerformanceParameterINTEL",
+    "vkSetLocalDimmingAMD",
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    "vkCreateImagePipeSurfaceFUCHSIA",
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+    "vkCreateMetalSurfaceEXT",
+#endif
+    "vkGetBufferDeviceAddressEXT",
+    "vkGetPhysicalDeviceToolPropertiesEXT",
+    "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV",
+    "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV",
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    "vkGetPhysicalDeviceSurfacePresentModes2EXT",
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    "vkAcquireFullScreenExclusiveModeEXT",
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    "vkReleaseFullScreenExclusiveModeEXT",
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    "vkGetDeviceGroupSurfacePresentModes2EXT",
+#endif
+    "vkCreateHeadlessSurfaceEXT",
+    "vkCmdSetLineStippleEXT",
+    "vkResetQueryPoolEXT",
+};
+
 
 } // namespace vulkan_layer_chassis
 
@@ -51,6 +51,27 @@
 #include "vk_safe_struct.h"
 #include "vk_typemap_helper.h"
 
+// Validation objects compiled into the layer. A build may leave objects out by defining the corresponding macro to 0 (see the
+// VVL_ENABLE_* CMake options); whatever isn't defined is built in.
+#ifndef VVL_ENABLE_THREADING
+#define VVL_ENABLE_THREADING 1
+#endif
+#ifndef VVL_ENABLE_STATELESS
+#define VVL_ENABLE_STATELESS 1
+#endif
+#ifndef VVL_ENABLE_OBJECT_LIFETIMES
+#define VVL_ENABLE_OBJECT_LIFETIMES 1
+#endif
+#ifndef VVL_ENABLE_CORE
+#define VVL_ENABLE_CORE 1
+#endif
+#ifndef VVL_ENABLE_BEST_PRACTICES
+#define VVL_ENABLE_BEST_PRACTICES 1
+#endif
+#ifndef VVL_ENABLE_GPU_ASSISTED
+#define VVL_ENABLE_GPU_ASSISTED 1
+#endif
+
 
 extern std::atomic<uint64_t> global_unique_id;
 
@@ -2502,6 +2523,460 @@ VKAPI_ATTR void VKAPI_CALL ResetQueryPoolEXT(
 
 
 
+// Index of each intercepted entry point in the layer profiler tables
+enum ProfiledEntryPoint {
+    kProfiledCreateInstance,
+    kProfiledDestroyInstance,
+    kProfiledEnumeratePhysicalDevices,
+    kProfiledGetPhysicalDeviceFeatures,
+    kProfiledGetPhysicalDeviceFormatProperties,
+    kProfiledGetPhysicalDeviceImageFormatProperties,
+    kProfiledGetPhysicalDeviceProperties,
+    kProfiledGetPhysicalDeviceQueueFamilyProperties,
+    kProfiledGetPhysicalDeviceMemoryProperties,
+    kProfiledGetInstanceProcAddr,
+    kProfiledGetDeviceProcAddr,
+    kProfiledCreateDevice,
+    kProfiledDestroyDevice,
+    kProfiledEnumerateInstanceExtensionProperties,
+    kProfiledEnumerateDeviceExtensionProperties,
+    kProfiledEnumerateInstanceLayerProperties,
+    kProfiledEnumerateDeviceLayerProperties,
+    kProfiledGetDeviceQueue,
+    kProfiledQueueSubmit,
+    kProfiledQueueWaitIdle,
+    kProfiledDeviceWaitIdle,
+    kProfiledAllocateMemory,
+    kProfiledFreeMemory,
+    kProfiledMapMemory,
+    kProfiledUnmapMemory,
+    kProfiledFlushMappedMemoryRanges,
+    kProfiledInvalidateMappedMemoryRanges,
+    kProfiledGetDeviceMemoryCommitment,
+    kProfiledBindBufferMemory,
+    kProfiledBindImageMemory,
+    kProfiledGetBufferMemoryRequirements,
+    kProfiledGetImageMemoryRequirements,
+    kProfiledGetImageSparseMemoryRequirements,
+    kProfiledGetPhysicalDeviceSparseImageFormatProperties,
+    kProfiledQueueBindSparse,
+    kProfiledCreateFence,
+    kProfiledDestroyFence,
+    kProfiledResetFences,
+    kProfiledGetFenceStatus,
+    kProfiledWaitForFences,
+    kProfiledCreateSemaphore,
+    kProfiledDestroySemaphore,
+    kProfiledCreateEvent,
+    kProfiledDestroyEvent,
+    kProfiledGetEventStatus,
+    kProfiledSetEvent,
+    kProfiledResetEvent,
+    kProfiledCreateQueryPool,
+    kProfiledDestroyQueryPool,
+    kProfiledGetQueryPoolResults,
+    kProfiledCreateBuffer,
+    kProfiledDestroyBuffer,
+    kProfiledCreateBufferView,
+    kProfiledDestroyBufferView,
+    kProfiledCreateImage,
+    kProfiledDestroyImage,
+    kProfiledGetImageSubresourceLayout,
+    kProfiledCreateImageView,
+    kProfiledDestroyImageView,
+    kProfiledCreateShaderModule,
+    kProfiledDestroyShaderModule,
+    kProfiledCreatePipelineCache,
+    kProfiledDestroyPipelineCache,
+    kProfiledGetPipelineCacheData,
+    kProfiledMergePipelineCaches,
+    kProfiledCreateGraphicsPipelines,
+    kProfiledCreateComputePipelines,
+    kProfiledDestroyPipeline,
+    kProfiledCreatePipelineLayout,
+    kProfiledDestroyPipelineLayout,
+    kProfiledCreateSampler,
+    kProfiledDestroySampler,
+    kProfiledCreateDescriptorSetLayout,
+    kProfiledDestroyDescriptorSetLayout,
+    kProfiledCreateDescriptorPool,
+    kProfiledDestroyDescriptorPool,
+    kProfiledResetDescriptorPool,
+    kProfiledAllocateDescriptorSets,
+    kProfiledFreeDescriptorSets,
+    kProfiledUpdateDescriptorSets,
+    kProfiledCreateFramebuffer,
+    kProfiledDestroyFramebuffer,
+    kProfiledCreateRenderPass,
+    kProfiledDestroyRenderPass,
+    kProfiledGetRenderAreaGranularity,
+    kProfiledCreateCommandPool,
+    kProfiledDestroyCommandPool,
+    kProfiledResetCommandPool,
+    kProfiledAllocateCommandBuffers,
+    kProfiledFreeCommandBuffers,
+    kProfiledBeginCommandBuffer,
+    kProfiledEndCommandBuffer,
+    kProfiledResetCommandBuffer,
+    kProfiledCmdBindPipeline,
+    kProfiledCmdSetViewport,
+    kProfiledCmdSetScissor,
+    kProfiledCmdSetLineWidth,
+    kProfiledCmdSetDepthBias,
+    kProfiledCmdSetBlendConstants,
+    kProfiledCmdSetDepthBounds,
+    kProfiledCmdSetStencilCompareMask,
+    kProfiledCmdSetStencilWriteMask,
+    kProfiledCmdSetStencilReference,
+    kProfiledCmdBindDescriptorSets,
+    kProfiledCmdBindIndexBuffer,
+    kProfiledCmdBindVertexBuffers,
+    kProfiledCmdDraw,
+    kProfiledCmdDrawIndexed,
+    kProfiledCmdDrawIndirect,
+    kProfiledCmdDrawIndexedIndirect,
+    kProfiledCmdDispatch,
+    kProfiledCmdDispatchIndirect,
+    kProfiledCmdCopyBuffer,
+    kProfiledCmdCopyImage,
+    kProfiledCmdBlitImage,
+    kProfiledCmdCopyBufferToImage,
+    kProfiledCmdCopyImageToBuffer,
+    kProfiledCmdUpdateBuffer,
+    kProfiledCmdFillBuffer,
+    kProfiledCmdClearColorImage,
+    kProfiledCmdClearDepthStencilImage,
+    kProfiledCmdClearAttachments,
+    kProfiledCmdResolveImage,
+    kProfiledCmdSetEvent,
+    kProfiledCmdResetEvent,
+    kProfiledCmdWaitEvents,
+    kProfiledCmdPipelineBarrier,
+    kProfiledCmdBeginQuery,
+    kProfiledCmdEndQuery,
+    kProfiledCmdResetQueryPool,
+    kProfiledCmdWriteTimestamp,
+    kProfiledCmdCopyQueryPoolResults,
+    kProfiledCmdPushConstants,
+    kProfiledCmdBeginRenderPass,
+    kProfiledCmdNextSubpass,
+    kProfiledCmdEndRenderPass,
+    kProfiledCmdExecuteCommands,
+    kProfiledBindBufferMemory2,
+    kProfiledBindImageMemory2,
+    kProfiledGetDeviceGroupPeerMemoryFeatures,
+    kProfiledCmdSetDeviceMask,
+    kProfiledCmdDispatchBase,
+    kProfiledEnumeratePhysicalDeviceGroups,
+    kProfiledGetImageMemoryRequirements2,
+    kProfiledGetBufferMemoryRequirements2,
+    kProfiledGetImageSparseMemoryRequirements2,
+    kProfiledGetPhysicalDeviceFeatures2,
+    kProfiledGetPhysicalDeviceProperties2,
+    kProfiledGetPhysicalDeviceFormatProperties2,
+    kProfiledGetPhysicalDeviceImageFormatProperties2,
+    kProfiledGetPhysicalDeviceQueueFamilyProperties2,
+    kProfiledGetPhysicalDeviceMemoryProperties2,
+    kProfiledGetPhysicalDeviceSparseImageFormatProperties2,
+    kProfiledTrimCommandPool,
+    kProfiledGetDeviceQueue2,
+    kProfiledCreateSamplerYcbcrConversion,
+    kProfiledDestroySamplerYcbcrConversion,
+    kProfiledCreateDescriptorUpdateTemplate,
+    kProfiledDestroyDescriptorUpdateTemplate,
+    kProfiledUpdateDescriptorSetWithTemplate,
+    kProfiledGetPhysicalDeviceExternalBufferProperties,
+    kProfiledGetPhysicalDeviceExternalFenceProperties,
+    kProfiledGetPhysicalDeviceExternalSemaphoreProperties,
+    kProfiledGetDescriptorSetLayoutSupport,
+    kProfiledCmdDrawIndirectCount,
+    kProfiledCmdDrawIndexedIndirectCount,
+    kProfiledCreateRenderPass2,
+    kProfiledCmdBeginRenderPass2,
+    kProfiledCmdNextSubpass2,
+    kProfiledCmdEndRenderPass2,
+    kProfiledResetQueryPool,
+    kProfiledGetSemaphoreCounterValue,
+    kProfiledWaitSemaphores,
+    kProfiledSignalSemaphore,
+    kProfiledGetBufferDeviceAddress,
+    kProfiledGetBufferOpaqueCaptureAddress,
+    kProfiledGetDeviceMemoryOpaqueCaptureAddress,
+    kProfiledDestroySurfaceKHR,
+    kProfiledGetPhysicalDeviceSurfaceSupportKHR,
+    kProfiledGetPhysicalDeviceSurfaceCapabilitiesKHR,
+    kProfiledGetPhysicalDeviceSurfaceFormatsKHR,
+    kProfiledGetPhysicalDeviceSurfacePresentModesKHR,
+    kProfiledCreateSwapchainKHR,
+    kProfiledDestroySwapchainKHR,
+    kProfiledGetSwapchainImagesKHR,
+    kProfiledAcquireNextImageKHR,
+    kProfiledQueuePresentKHR,
+    kProfiledGetDeviceGroupPresentCapabilitiesKHR,
+    kProfiledGetDeviceGroupSurfacePresentModesKHR,
+    kProfiledGetPhysicalDevicePresentRectanglesKHR,
+    kProfiledAcquireNextImage2KHR,
+    kProfiledGetPhysicalDeviceDisplayPropertiesKHR,
+    kProfiledGetPhysicalDeviceDisplayPlanePropertiesKHR,
+    kProfiledGetDisplayPlaneSupportedDisplaysKHR,
+    kProfiledGetDisplayModePropertiesKHR,
+    kProfiledCreateDisplayModeKHR,
+    kProfiledGetDisplayPlaneCapabilitiesKHR,
+    kProfiledCreateDisplayPlaneSurfaceKHR,
+    kProfiledCreateSharedSwapchainsKHR,
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+    kProfiledCreateXlibSurfaceKHR,
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+    kProfiledGetPhysicalDeviceXlibPresentationSupportKHR,
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+    kProfiledCreateXcbSurfaceKHR,
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+    kProfiledGetPhysicalDeviceXcbPresentationSupportKHR,
+#endif
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+    kProfiledCreateWaylandSurfaceKHR,
+#endif
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+    kProfiledGetPhysicalDeviceWaylandPresentationSupportKHR,
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    kProfiledCreateAndroidSurfaceKHR,
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    kProfiledCreateWin32SurfaceKHR,
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    kProfiledGetPhysicalDeviceWin32PresentationSupportKHR,
+#endif
+    kProfiledGetPhysicalDeviceFeatures2KHR,
+    kProfiledGetPhysicalDeviceProperties2KHR,
+    kProfiledGetPhysicalDeviceFormatProperties2KHR,
+    kProfiledGetPhysicalDeviceImageFormatProperties2KHR,
+    kProfiledGetPhysicalDeviceQueueFamilyProperties2KHR,
+    kProfiledGetPhysicalDeviceMemoryProperties2KHR,
+    kProfiledGetPhysicalDeviceSparseImageFormatProperties2KHR,
+    kProfiledGetDeviceGroupPeerMemoryFeaturesKHR,
+    kProfiledCmdSetDeviceMaskKHR,
+    kProfiledCmdDispatchBaseKHR,
+    kProfiledTrimCommandPoolKHR,
+    kProfiledEnumeratePhysicalDeviceGroupsKHR,
+    kProfiledGetPhysicalDeviceExternalBufferPropertiesKHR,
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    kProfiledGetMemoryWin32HandleKHR,
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    kProfiledGetMemoryWin32HandlePropertiesKHR,
+#endif
+    kProfiledGetMemoryFdKHR,
+    kProfiledGetMemoryFdPropertiesKHR,
+    kProfiledGetPhysicalDeviceExternalSemaphorePropertiesKHR,
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    kProfiledImportSemaphoreWin32HandleKHR,
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    kProfiledGetSemaphoreWin32HandleKHR,
+#endif
+    kProfiledImportSemaphoreFdKHR,
+    kProfiledGetSemaphoreFdKHR,
+    kProfiledCmdPushDescriptorSetKHR,
+    kProfiledCmdPushDescriptorSetWithTemplateKHR,
+    kProfiledCreateDescriptorUpdateTemplateKHR,
+    kProfiledDestroyDescriptorUpdateTemplateKHR,
+    kProfiledUpdateDescriptorSetWithTemplateKHR,
+    kProfiledCreateRenderPass2KHR,
+    kProfiledCmdBeginRenderPass2KHR,
+    kProfiledCmdNextSubpass2KHR,
+    kProfiledCmdEndRenderPass2KHR,
+    kProfiledGetSwapchainStatusKHR,
+    kProfiledGetPhysicalDeviceExternalFencePropertiesKHR,
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    kProfiledImportFenceWin32HandleKHR,
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    kProfiledGetFenceWin32HandleKHR,
+#endif
+    kProfiledImportFenceFdKHR,
+    kProfiledGetFenceFdKHR,
+    kProfiledEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR,
+    kProfiledGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR,
+    kProfiledAcquireProfilingLockKHR,
+    kProfiledReleaseProfilingLockKHR,
+    kProfiledGetPhysicalDeviceSurfaceCapabilities2KHR,
+    kProfiledGetPhysicalDeviceSurfaceFormats2KHR,
+    kProfiledGetPhysicalDeviceDisplayProperties2KHR,
+    kProfiledGetPhysicalDeviceDisplayPlaneProperties2KHR,
+    kProfiledGetDisplayModeProperties2KHR,
+    kProfiledGetDisplayPlaneCapabilities2KHR,
+    kProfiledGetImageMemoryRequirements2KHR,
+    kProfiledGetBufferMemoryRequirements2KHR,
+    kProfiledGetImageSparseMemoryRequirements2KHR,
+    kProfiledCreateSamplerYcbcrConversionKHR,
+    kProfiledDestroySamplerYcbcrConversionKHR,
+    kProfiledBindBufferMemory2KHR,
+    kProfiledBindImageMemory2KHR,
+    kProfiledGetDescriptorSetLayoutSupportKHR,
+    kProfiledCmdDrawIndirectCountKHR,
+    kProfiledCmdDrawIndexedIndirectCountKHR,
+    kProfiledGetSemaphoreCounterValueKHR,
+    kProfiledWaitSemaphoresKHR,
+    kProfiledSignalSemaphoreKHR,
+    kProfiledGetBufferDeviceAddressKHR,
+    kProfiledGetBufferOpaqueCaptureAddressKHR,
+    kProfiledGetDeviceMemoryOpaqueCaptureAddressKHR,
+    kProfiledGetPipelineExecutablePropertiesKHR,
+    kProfiledGetPipelineExecutableStatisticsKHR,
+    kProfiledGetPipelineExecutableInternalRepresentationsKHR,
+    kProfiledCreateDebugReportCallbackEXT,
+    kProfiledDestroyDebugReportCallbackEXT,
+    kProfiledDebugReportMessageEXT,
+    kProfiledDebugMarkerSetObjectTagEXT,
+    kProfiledDebugMarkerSetObjectNameEXT,
+    kProfiledCmdDebugMarkerBeginEXT,
+    kProfiledCmdDebugMarkerEndEXT,
+    kProfiledCmdDebugMarkerInsertEXT,
+    kProfiledCmdBindTransformFeedbackBuffersEXT,
+    kProfiledCmdBeginTransformFeedbackEXT,
+    kProfiledCmdEndTransformFeedbackEXT,
+    kProfiledCmdBeginQueryIndexedEXT,
+    kProfiledCmdEndQueryIndexedEXT,
+    kProfiledCmdDrawIndirectByteCountEXT,
+    kProfiledGetImageViewHandleNVX,
+    kProfiledCmdDrawIndirectCountAMD,
+    kProfiledCmdDrawIndexedIndirectCountAMD,
+    kProfiledGetShaderInfoAMD,
+#ifdef VK_USE_PLATFORM_GGP
+    kProfiledCreateStreamDescriptorSurfaceGGP,
+#endif
+    kProfiledGetPhysicalDeviceExternalImageFormatPropertiesNV,
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    kProfiledGetMemoryWin32HandleNV,
+#endif
+#ifdef VK_USE_PLATFORM_VI_NN
+    kProfiledCreateViSurfaceNN,
+#endif
+    kProfiledCmdBeginConditionalRenderingEXT,
+    kProfiledCmdEndConditionalRenderingEXT,
+    kProfiledCmdProcessCommandsNVX,
+    kProfiledCmdReserveSpaceForCommandsNVX,
+    kProfiledCreateIndirectCommandsLayoutNVX,
+    kProfiledDestroyIndirectCommandsLayoutNVX,
+    kProfiledCreateObjectTableNVX,
+    kProfiledDestroyObjectTableNVX,
+    kProfiledRegisterObjectsNVX,
+    kProfiledUnregisterObjectsNVX,
+    kProfiledGetPhysicalDeviceGeneratedCommandsPropertiesNVX,
+    kProfiledCmdSetViewportWScalingNV,
+    kProfiledReleaseDisplayEXT,
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+    kProfiledAcquireXlibDisplayEXT,
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+    kProfiledGetRandROutputDisplayEXT,
+#endif
+    kProfiledGetPhysicalDeviceSurfaceCapabilities2EXT,
+    kProfiledDisplayPowerControlEXT,
+    kProfiledRegisterDeviceEventEXT,
+    kProfiledRegisterDisplayEventEXT,
+    kProfiledGetSwapchainCounterEXT,
+    kProfiledGetRefreshCycleDurationGOOGLE,
+    kProfiledGetPastPresentationTimingGOOGLE,
+    kProfiledCmdSetDiscardRectangleEXT,
+    kProfiledSetHdrMetadataEXT,
+#ifdef VK_USE_PLATFORM_IOS_MVK
+    kProfiledCreateIOSSurfaceMVK,
+#endif
+#ifdef VK_USE_PLATFORM_MACOS_MVK
+    kProfiledCreateMacOSSurfaceMVK,
+#endif
+    kProfiledSetDebugUtilsObjectNameEXT,
+    kProfiledSetDebugUtilsObjectTagEXT,
+    kProfiledQueueBeginDebugUtilsLabelEXT,
+    kProfiledQueueEndDebugUtilsLabelEXT,
+    kProfiledQueueInsertDebugUtilsLabelEXT,
+    kProfiledCmdBeginDebugUtilsLabelEXT,
+    kProfiledCmdEndDebugUtilsLabelEXT,
+    kProfiledCmdInsertDebugUtilsLabelEXT,
+    kProfiledCreateDebugUtilsMessengerEXT,
+    kProfiledDestroyDebugUtilsMessengerEXT,
+    kProfiledSubmitDebugUtilsMessageEXT,
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    kProfiledGetAndroidHardwareBufferPropertiesANDROID,
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    kProfiledGetMemoryAndroidHardwareBufferANDROID,
+#endif
+    kProfiledCmdSetSampleLocationsEXT,
+    kProfiledGetPhysicalDeviceMultisamplePropertiesEXT,
+    kProfiledGetImageDrmFormatModifierPropertiesEXT,
+    kProfiledCreateValidationCacheEXT,
+    kProfiledDestroyValidationCacheEXT,
+    kProfiledMergeValidationCachesEXT,
+    kProfiledGetValidationCacheDataEXT,
+    kProfiledCmdBindShadingRateImageNV,
+    kProfiledCmdSetViewportShadingRatePaletteNV,
+    kProfiledCmdSetCoarseSampleOrderNV,
+    kProfiledCreateAccelerationStructureNV,
+    kProfiledDestroyAccelerationStructureNV,
+    kProfiledGetAccelerationStructureMemoryRequirementsNV,
+    kProfiledBindAccelerationStructureMemoryNV,
+    kProfiledCmdBuildAccelerationStructureNV,
+    kProfiledCmdCopyAccelerationStructureNV,
+    kProfiledCmdTraceRaysNV,
+    kProfiledCreateRayTracingPipelinesNV,
+    kProfiledGetRayTracingShaderGroupHandlesNV,
+    kProfiledGetAccelerationStructureHandleNV,
+    kProfiledCmdWriteAccelerationStructuresPropertiesNV,
+    kProfiledCompileDeferredNV,
+    kProfiledGetMemoryHostPointerPropertiesEXT,
+    kProfiledCmdWriteBufferMarkerAMD,
+    kProfiledGetPhysicalDeviceCalibrateableTimeDomainsEXT,
+    kProfiledGetCalibratedTimestampsEXT,
+    kProfiledCmdDrawMeshTasksNV,
+    kProfiledCmdDrawMeshTasksIndirectNV,
+    kProfiledCmdDrawMeshTasksIndirectCountNV,
+    kProfiledCmdSetExclusiveScissorNV,
+    kProfiledCmdSetCheckpointNV,
+    kProfiledGetQueueCheckpointDataNV,
+    kProfiledInitializePerformanceApiINTEL,
+    kProfiledUninitializePerformanceApiINTEL,
+    kProfiledCmdSetPerformanceMarkerINTEL,
+    kProfiledCmdSetPerformanceStreamMarkerINTEL,
+    kProfiledCmdSetPerformanceOverrideINTEL,
+    kProfiledAcquirePerformanceConfigurationINTEL,
+    kProfiledReleasePerformanceConfigurationINTEL,
+    kProfiledQueueSetPerformanceConfigurationINTEL,
+    kProfiledGetPerformanceParameterINTEL,
+    kProfiledSetLocalDimmingAMD,
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    kProfiledCreateImagePipeSurfaceFUCHSIA,
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+    kProfiledCreateMetalSurfaceEXT,
+#endif
+    kProfiledGetBufferDeviceAddressEXT,
+    kProfiledGetPhysicalDeviceToolPropertiesEXT,
+    kProfiledGetPhysicalDeviceCooperativeMatrixPropertiesNV,
+    kProfiledGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV,
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    kProfiledGetPhysicalDeviceSurfacePresentModes2EXT,
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    kProfiledAcquireFullScreenExclusiveModeEXT,
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    kProfiledReleaseFullScreenExclusiveModeEXT,
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    kProfiledGetDeviceGroupSurfacePresentModes2EXT,
+#endif
+    kProfiledCreateHeadlessSurfaceEXT,
+    kProfiledCmdSetLineStippleEXT,
+    kProfiledResetQueryPoolEXT,
+    kProfiledEntryPointCount
+};
 // Layer object type identifiers
 enum LayerObjectTypeId {
     LayerObjectTypeInstance,                    // Container for an instance dispatch object
@@ -2539,6 +3014,10 @@ typedef enum ValidationCheckDisables {
     VALIDATION_CHECK_DISABLE_IMAGE_LAYOUT_VALIDATION,
 } ValidationCheckDisables;
 
+typedef enum ValidationCheckEnables {
+    VALIDATION_CHECK_ENABLE_PROFILING,
+} ValidationCheckEnables;
+
 // CHECK_DISABLED struct is a container for bools that can block validation checks from being performed.
 // These bools are all "false" by default meaning that all checks are enabled. Enum values can be specified
 // via the vk_layer_setting.txt config file or at CreateInstance time via the VK_EXT_validation_features extension
@@ -2564,6 +3043,7 @@ struct CHECK_ENABLED {
     bool gpu_validation;
     bool gpu_validation_reserve_binding_slot;
     bool best_practices;
+    bool profiling;                                 // Time each validation object per entry point, see layer_profiler.h
 
     void SetAll(bool value) { std::fill(&gpu_validation, &gpu_validation_reserve_binding_slot + 1, value); }
 };
@@ -2604,6 +3084,25 @@ class ValidationObject {
         virtual write_lock_guard_t write_lock() {
             return write_lock_guard_t(validation_object_mutex);
         }
+        // Holds validation_object_mutex on either side, or not at all
+        struct cmd_lock_guard_t {
+            read_lock_guard_t shared;
+            write_lock_guard_t exclusive;
+        };
+        // Taken instead of read_lock()/write_lock() around commands recorded into a command buffer (vkCmd*): cmd_read_lock()
+        // for validation, cmd_write_lock() for recording, and cmd_local_write_lock() for recording the commands that only
+        // set state of the command buffer itself (dynamic state and the like). Objects that only write the state of the
+        // command buffer being recorded can override these so recording on distinct command buffers doesn't serialize
+        // (see CoreChecks).
+        virtual cmd_lock_guard_t cmd_read_lock() {
+            return {read_lock(), write_lock_guard_t()};
+        }
+        virtual cmd_lock_guard_t cmd_write_lock() {
+            return {read_lock_guard_t(), write_lock()};
+        }
+        virtual cmd_lock_guard_t cmd_local_write_lock() {
+            return cmd_write_lock();
+        }
 
         ValidationObject* GetValidationObject(std::vector<ValidationObject*>& object_dispatch, LayerObjectTypeId object_type) {
             for (auto validation_object : object_dispatch) {
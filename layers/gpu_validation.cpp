@@ -480,6 +480,21 @@ void GpuAssisted::PostCallRecordCreateDevice(VkPhysicalDevice physicalDevice, co
             "UNASSIGNED-GPU-Assisted Validation. ", "Shaders using descriptor set at index %d. ",
             device_gpu_assisted->desc_set_bind_index);
 
+    const std::string instrumentation_threads = getLayerOption("khronos_validation.gpu_validation_instrumentation_threads");
+    const uint32_t thread_count = static_cast<uint32_t>(strtoul(instrumentation_threads.c_str(), nullptr, 10));
+    if (thread_count > 0) {
+        device_gpu_assisted->instrumentation_queue.reset(new GpuAssistedInstrumentationQueue(thread_count));
+    }
+
+    const std::string shader_cache_path = getLayerOption("khronos_validation.gpu_validation_shader_cache");
+    if (!shader_cache_path.empty() &&
+        !device_gpu_assisted->shader_cache.Open(shader_cache_path, device_gpu_assisted->GetShaderCacheConfiguration())) {
+        log_msg(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT, HandleToUint64(device),
+                "UNASSIGNED-GPU-Assisted Validation Warning",
+                "Unable to use %s as the instrumented shader cache.  Shaders will be instrumented without caching.",
+                shader_cache_path.c_str());
+    }
+
     device_gpu_assisted->output_buffer_size = sizeof(uint32_t) * (spvtools::kInstMaxOutCnt + 1);
     VkResult result1 = InitializeVma(physicalDevice, *pDevice, &device_gpu_assisted->vmaAllocator);
     assert(result1 == VK_SUCCESS);
@@ -549,7 +564,7 @@ void GpuAssisted::PostCallRecordGetBufferDeviceAddressEXT(VkDevice device, const
     BUFFER_STATE *buffer_state = GetBufferState(pInfo->buffer);
     // Validate against the size requested when the buffer was created
     if (buffer_state) {
-        buffer_map[address] = buffer_state->createInfo.size;
+        RecordBufferDeviceAddress(address, buffer_state->createInfo.size);
         buffer_state->deviceAddress = address;
     }
 }
@@ -559,14 +574,83 @@ void GpuAssisted::PostCallRecordGetBufferDeviceAddressKHR(VkDevice device, const
     BUFFER_STATE *buffer_state = GetBufferState(pInfo->buffer);
     // Validate against the size requested when the buffer was created
     if (buffer_state) {
-        buffer_map[address] = buffer_state->createInfo.size;
+        RecordBufferDeviceAddress(address, buffer_state->createInfo.size);
         buffer_state->deviceAddress = address;
     }
 }
 
 void GpuAssisted::PreCallRecordDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks *pAllocator) {
     BUFFER_STATE *buffer_state = GetBufferState(buffer);
-    if (buffer_state) buffer_map.erase(buffer_state->deviceAddress);
+    if (buffer_state && buffer_map.erase(buffer_state->deviceAddress)) {
+        buffer_map_version++;
+    }
+}
+
+// Applications query the same address many times; only a new or resized entry starts a new version of the table
+void GpuAssisted::RecordBufferDeviceAddress(VkDeviceAddress address, VkDeviceSize size) {
+    auto &entry = buffer_map[address];
+    if (entry != size) {
+        entry = size;
+        buffer_map_version++;
+    }
+}
+
+// Returns the device address table for the current contents of buffer_map, building a new version only if buffers have
+// been added or removed since the last one was built. Command buffers keep the version they were recorded with alive
+// until they are reset, which cannot happen before their submissions complete, so a table is never modified once built.
+std::shared_ptr<GpuAssistedDeviceMemoryBlock> GpuAssisted::GetBufferDeviceAddressTable() {
+    if (bda_table && (bda_table_version == buffer_map_version)) return bda_table;
+
+    // Example BDA input buffer assuming 2 buffers using BDA:
+    // Word 0 | Index of start of buffer sizes (in this case 5)
+    // Word 1 | 0x0000000000000000
+    // Word 2 | Device Address of first buffer  (Addresses sorted in ascending order)
+    // Word 3 | Device Address of second buffer
+    // Word 4 | 0xffffffffffffffff
+    // Word 5 | 0 (size of pretend buffer at word 1)
+    // Word 6 | Size in bytes of first buffer
+    // Word 7 | Size in bytes of second buffer
+    // Word 8 | 0 (size of pretend buffer in word 4)
+    uint32_t num_buffers = static_cast<uint32_t>(buffer_map.size());
+    uint32_t words_needed = (num_buffers + 3) + (num_buffers + 2);
+    VkBufferCreateInfo bufferInfo = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    bufferInfo.size = words_needed * 8;  // 64 bit words
+    bufferInfo.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    VmaAllocationCreateInfo allocInfo = {};
+    allocInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
+    auto release = [this](GpuAssistedDeviceMemoryBlock *block) {
+        vmaDestroyBuffer(vmaAllocator, block->buffer, block->allocation);
+        delete block;
+    };
+    std::shared_ptr<GpuAssistedDeviceMemoryBlock> table(new GpuAssistedDeviceMemoryBlock(), release);
+    VkResult result = vmaCreateBuffer(vmaAllocator, &bufferInfo, &allocInfo, &table->buffer, &table->allocation, nullptr);
+    if (result != VK_SUCCESS) {
+        ReportSetupProblem(VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT, HandleToUint64(device),
+                           "Unable to allocate device memory.  Device could become unstable.");
+        aborted = true;
+        return nullptr;
+    }
+    uint64_t *bda_data;
+    result = vmaMapMemory(vmaAllocator, table->allocation, (void **)&bda_data);
+    uint32_t address_index = 1;
+    uint32_t size_index = 3 + num_buffers;
+    memset(bda_data, 0, static_cast<size_t>(bufferInfo.size));
+    bda_data[0] = size_index;       // Start of buffer sizes
+    bda_data[address_index++] = 0;  // NULL address
+    bda_data[size_index++] = 0;
+
+    for (auto const &value : buffer_map) {
+        bda_data[address_index++] = value.first;
+        bda_data[size_index++] = value.second;
+    }
+    bda_data[address_index] = UINTPTR_MAX;
+    bda_data[size_index] = 0;
+    vmaUnmapMemory(vmaAllocator, table->allocation);
+
+    // The previous version is freed once the last command buffer recorded with it is reset
+    bda_table = std::move(table);
+    bda_table_version = buffer_map_version;
+    return bda_table;
 }
 // Clean up device-related resources
 void GpuAssisted::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
@@ -593,6 +677,17 @@ void GpuAssisted::PreCallRecordDestroyDevice(VkDevice device, const VkAllocation
 
     DestroyAccelerationStructureBuildValidationState();
 
+    instrumentation_queue.reset();
+    for (auto &deferred : deferred_shaders) {
+        if (deferred.second->instrumented_module != VK_NULL_HANDLE) {
+            DispatchDestroyShaderModule(device, deferred.second->instrumented_module, nullptr);
+        }
+    }
+    deferred_shaders.clear();
+
+    // Releases the last references to the shared input buffers while the allocator still exists
+    command_buffer_map.clear();
+    bda_table.reset();
     if (vmaAllocator) {
         vmaDestroyAllocator(vmaAllocator);
     }
@@ -1080,7 +1175,7 @@ void GpuAssisted::PreCallRecordCmdBuildAccelerationStructureNV(VkCommandBuffer c
     assert(cb_state != nullptr);
 
     std::vector<uint64_t> current_valid_handles;
-    for (const auto &as_state_kv : accelerationStructureMap) {
+    for (const auto &as_state_kv : accelerationStructureMap.snapshot()) {
         const ACCELERATION_STRUCTURE_STATE &as_state = *as_state_kv.second;
         if (as_state.built && as_state.create_info.info.type == VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_NV) {
             current_valid_handles.push_back(as_state.opaque_handle);
@@ -1322,15 +1417,10 @@ void GpuAssisted::ResetCommandBuffer(VkCommandBuffer commandBuffer) {
     if (aborted) {
         return;
     }
-    auto gpuav_buffer_list = GetGpuAssistedBufferInfo(commandBuffer);
-    for (auto buffer_info : gpuav_buffer_list) {
+    auto &gpuav_buffer_list = GetGpuAssistedBufferInfo(commandBuffer);
+    for (auto &buffer_info : gpuav_buffer_list) {
         vmaDestroyBuffer(vmaAllocator, buffer_info.output_mem_block.buffer, buffer_info.output_mem_block.allocation);
-        if (buffer_info.di_input_mem_block.buffer) {
-            vmaDestroyBuffer(vmaAllocator, buffer_info.di_input_mem_block.buffer, buffer_info.di_input_mem_block.allocation);
-        }
-        if (buffer_info.bda_input_mem_block.buffer) {
-            vmaDestroyBuffer(vmaAllocator, buffer_info.bda_input_mem_block.buffer, buffer_info.bda_input_mem_block.allocation);
-        }
+        // Input buffers may be shared with other command buffers; dropping the list releases this one's references
         if (buffer_info.desc_set != VK_NULL_HANDLE) {
             desc_set_manager->PutBackDescriptorSet(buffer_info.desc_pool, buffer_info.desc_set);
         }
@@ -1473,6 +1563,8 @@ struct CreatePipelineTraits<VkRayTracingPipelineCreateInfoNV> {
 // Examine the pipelines to see if they use the debug descriptor set binding index.
 // If any do, create new non-instrumented shader modules and use them to replace the instrumented
 // shaders in the pipeline.  Return the (possibly) modified create infos to the caller.
+// When instrumentation is deferred the application's modules are not instrumented, so it is the other way around: pipelines that
+// leave the debug descriptor set free get the instrumented modules instead.
 template <typename CreateInfo, typename SafeCreateInfo>
 void GpuAssisted::PreCallRecordPipelineCreations(uint32_t count, const CreateInfo *pCreateInfos,
                                                  const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
@@ -1492,7 +1584,7 @@ void GpuAssisted::PreCallRecordPipelineCreations(uint32_t count, const CreateInf
         new_pipeline_create_infos->push_back(Accessor::GetPipelineCI(pipe_state[pipeline].get()));
 
         bool replace_shaders = false;
-        if (pipe_state[pipeline]->active_slots.find(desc_set_bind_index) != pipe_state[pipeline]->active_slots.end()) {
+        if (pipe_state[pipeline]->GetActiveSlot(desc_set_bind_index)) {
             replace_shaders = true;
         }
         // If the app requests all available sets, the pipeline layout was not modified at pipeline layout creation and the already
@@ -1501,7 +1593,16 @@ void GpuAssisted::PreCallRecordPipelineCreations(uint32_t count, const CreateInf
             replace_shaders = true;
         }
 
-        if (replace_shaders) {
+        if (instrumentation_queue) {
+            if (replace_shaders) continue;
+            for (uint32_t stage = 0; stage < stageCount; ++stage) {
+                const SHADER_MODULE_STATE *shader = GetShaderModuleState(Accessor::GetShaderModule(pCreateInfos[pipeline], stage));
+                VkShaderModule instrumented_module = GetDeferredInstrumentedModule(shader);
+                if (instrumented_module != VK_NULL_HANDLE) {
+                    Accessor::SetShaderModule(&(*new_pipeline_create_infos)[pipeline], instrumented_module, stage);
+                }
+            }
+        } else if (replace_shaders) {
             for (uint32_t stage = 0; stage < stageCount; ++stage) {
                 const SHADER_MODULE_STATE *shader = GetShaderModuleState(Accessor::GetShaderModule(pCreateInfos[pipeline], stage));
 
@@ -1530,7 +1631,9 @@ void GpuAssisted::PostCallRecordCreateGraphicsPipelines(VkDevice device, VkPipel
                                                         VkResult result, void *cgpl_state_data) {
     ValidationStateTracker::PostCallRecordCreateGraphicsPipelines(device, pipelineCache, count, pCreateInfos, pAllocator,
                                                                   pPipelines, result, cgpl_state_data);
-    PostCallRecordPipelineCreations(count, pCreateInfos, pAllocator, pPipelines, VK_PIPELINE_BIND_POINT_GRAPHICS);
+    auto *cgpl_state = reinterpret_cast<create_graphics_pipeline_api_state *>(cgpl_state_data);
+    PostCallRecordPipelineCreations(count, pCreateInfos, cgpl_state->gpu_create_infos, pAllocator, pPipelines,
+                                    VK_PIPELINE_BIND_POINT_GRAPHICS);
 }
 
 void GpuAssisted::PostCallRecordCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
@@ -1539,7 +1642,9 @@ void GpuAssisted::PostCallRecordCreateComputePipelines(VkDevice device, VkPipeli
                                                        VkResult result, void *ccpl_state_data) {
     ValidationStateTracker::PostCallRecordCreateComputePipelines(device, pipelineCache, count, pCreateInfos, pAllocator, pPipelines,
                                                                  result, ccpl_state_data);
-    PostCallRecordPipelineCreations(count, pCreateInfos, pAllocator, pPipelines, VK_PIPELINE_BIND_POINT_COMPUTE);
+    auto *ccpl_state = reinterpret_cast<create_compute_pipeline_api_state *>(ccpl_state_data);
+    PostCallRecordPipelineCreations(count, pCreateInfos, ccpl_state->gpu_create_infos, pAllocator, pPipelines,
+                                    VK_PIPELINE_BIND_POINT_COMPUTE);
 }
 
 void GpuAssisted::PostCallRecordCreateRayTracingPipelinesNV(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
@@ -1548,17 +1653,21 @@ void GpuAssisted::PostCallRecordCreateRayTracingPipelinesNV(VkDevice device, VkP
                                                             VkResult result, void *crtpl_state_data) {
     ValidationStateTracker::PostCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, count, pCreateInfos, pAllocator,
                                                                       pPipelines, result, crtpl_state_data);
-    PostCallRecordPipelineCreations(count, pCreateInfos, pAllocator, pPipelines, VK_PIPELINE_BIND_POINT_RAY_TRACING_NV);
+    auto *crtpl_state = reinterpret_cast<create_ray_tracing_pipeline_api_state *>(crtpl_state_data);
+    PostCallRecordPipelineCreations(count, pCreateInfos, crtpl_state->gpu_create_infos, pAllocator, pPipelines,
+                                    VK_PIPELINE_BIND_POINT_RAY_TRACING_NV);
 }
 
 // For every pipeline:
 // - For every shader in a pipeline:
 //   - If the shader had to be replaced in PreCallRecord (because the pipeline is using the debug desc set index):
 //     - Destroy it since it has been bound into the pipeline by now.  This is our only chance to delete it.
+//       Deferred instrumented modules are substituted the same way but belong to the application's module and are kept.
 //   - Track the shader in the shader_map
 //   - Save the shader binary if it contains debug code
-template <typename CreateInfo>
+template <typename CreateInfo, typename SafeCreateInfo>
 void GpuAssisted::PostCallRecordPipelineCreations(const uint32_t count, const CreateInfo *pCreateInfos,
+                                                  const std::vector<SafeCreateInfo> &new_pipeline_create_infos,
                                                   const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                   const VkPipelineBindPoint bind_point) {
     using Accessor = CreatePipelineTraits<CreateInfo>;
@@ -1567,6 +1676,16 @@ void GpuAssisted::PostCallRecordPipelineCreations(const uint32_t count, const Cr
         return;
     }
     for (uint32_t pipeline = 0; pipeline < count; ++pipeline) {
+        if (!instrumentation_queue && (pipeline < new_pipeline_create_infos.size())) {
+            const uint32_t stageCount = Accessor::GetStageCount(pCreateInfos[pipeline]);
+            for (uint32_t stage = 0; stage < stageCount; ++stage) {
+                const VkShaderModule used_module = Accessor::GetShaderModule(*new_pipeline_create_infos[pipeline].ptr(), stage);
+                if (used_module != Accessor::GetShaderModule(pCreateInfos[pipeline], stage)) {
+                    DispatchDestroyShaderModule(device, used_module, pAllocator);
+                }
+            }
+        }
+
         auto pipeline_state = ValidationStateTracker::GetPipelineState(pPipelines[pipeline]);
         if (nullptr == pipeline_state) continue;
 
@@ -1582,10 +1701,6 @@ void GpuAssisted::PostCallRecordPipelineCreations(const uint32_t count, const Cr
         }
 
         for (uint32_t stage = 0; stage < stageCount; ++stage) {
-            if (pipeline_state->active_slots.find(desc_set_bind_index) != pipeline_state->active_slots.end()) {
-                DispatchDestroyShaderModule(device, Accessor::GetShaderModule(pCreateInfos[pipeline], stage), pAllocator);
-            }
-
             const SHADER_MODULE_STATE *shader_state = nullptr;
             if (bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
                 shader_state = GetShaderModuleState(pipeline_state->graphicsPipelineCI.pStages[stage].module);
@@ -1645,50 +1760,183 @@ void GpuAssisted::PreCallRecordDestroyPipeline(VkDevice device, VkPipeline pipel
     ValidationStateTracker::PreCallRecordDestroyPipeline(device, pipeline, pAllocator);
 }
 
-// Call the SPIR-V Optimizer to run the instrumentation pass on the shader.
-bool GpuAssisted::InstrumentShader(const VkShaderModuleCreateInfo *pCreateInfo, std::vector<unsigned int> &new_pgm,
-                                   uint32_t *unique_shader_id) {
-    if (aborted) return false;
-    if (pCreateInfo->pCode[0] != spv::MagicNumber) return false;
-
+// Everything besides the shader itself that InstrumentShader's output depends on
+std::string GpuAssisted::GetShaderCacheConfiguration() const {
+    const bool descriptor_indexing = IsExtEnabled(device_extensions.vk_ext_descriptor_indexing);
+    const bool buffer_device_address =
+        (device_extensions.vk_ext_buffer_device_address || device_extensions.vk_khr_buffer_device_address) && shaderInt64;
+    std::ostringstream configuration;
+    configuration << "spirv-tools " << SPIRV_TOOLS_COMMIT_ID << "; target vulkan1.1; bindless(" << desc_set_bind_index << ", "
+                  << descriptor_indexing << ", " << descriptor_indexing << "); adce";
+    if (buffer_device_address) configuration << "; buff_addr(" << desc_set_bind_index << ")";
+    return configuration.str();
+}
+
+// Call the SPIR-V Optimizer to run the instrumentation pass on the shader, giving it the shader ID shader_id.
+// Runs on the instrumentation queue's threads when instrumentation is deferred, so it only uses state that is fixed at device
+// creation, plus the shader cache under its lock.
+bool GpuAssisted::InstrumentShader(const uint32_t *code, uint32_t num_words, uint32_t shader_id,
+                                   std::vector<unsigned int> &new_pgm) {
+    {
+        std::lock_guard<std::mutex> lock(shader_cache_lock);
+        if (shader_cache.IsOpen() && shader_cache.Find(code, num_words, shader_id, &new_pgm)) return true;
+    }
     // Load original shader SPIR-V
-    uint32_t num_words = static_cast<uint32_t>(pCreateInfo->codeSize / 4);
     new_pgm.clear();
     new_pgm.reserve(num_words);
-    new_pgm.insert(new_pgm.end(), &pCreateInfo->pCode[0], &pCreateInfo->pCode[num_words]);
+    new_pgm.insert(new_pgm.end(), &code[0], &code[num_words]);
+
+    // A shader instrumented with the placeholder ID can be cached and given any module's ID later. The placeholder is only
+    // used if the shader does not already contain a constant with the same value.
+    const bool cacheable = shader_cache.IsOpen() && GpuAssistedShaderCache::FindPlaceholderConstants(code, num_words).empty();
+    const uint32_t instrumented_shader_id = cacheable ? GpuAssistedShaderCache::kPlaceholderShaderId : shader_id;
 
     // Call the optimizer to instrument the shader.
     // Use the unique_shader_module_id as a shader ID so we can look up its handle later in the shader_map.
     // If descriptor indexing is enabled, enable length checks and updated descriptor checks
+    // The passes and their options must stay in sync with GetShaderCacheConfiguration().
     const bool descriptor_indexing = IsExtEnabled(device_extensions.vk_ext_descriptor_indexing);
     using namespace spvtools;
     spv_target_env target_env = SPV_ENV_VULKAN_1_1;
     Optimizer optimizer(target_env);
     optimizer.RegisterPass(
-        CreateInstBindlessCheckPass(desc_set_bind_index, unique_shader_module_id, descriptor_indexing, descriptor_indexing));
+        CreateInstBindlessCheckPass(desc_set_bind_index, instrumented_shader_id, descriptor_indexing, descriptor_indexing));
     optimizer.RegisterPass(CreateAggressiveDCEPass());
     if ((device_extensions.vk_ext_buffer_device_address || device_extensions.vk_khr_buffer_device_address) && shaderInt64)
-        optimizer.RegisterPass(CreateInstBuffAddrCheckPass(desc_set_bind_index, unique_shader_module_id));
+        optimizer.RegisterPass(CreateInstBuffAddrCheckPass(desc_set_bind_index, instrumented_shader_id));
     bool pass = optimizer.Run(new_pgm.data(), new_pgm.size(), &new_pgm);
     if (!pass) {
         ReportSetupProblem(VK_DEBUG_REPORT_OBJECT_TYPE_SHADER_MODULE_EXT, VK_NULL_HANDLE,
                            "Failure to instrument shader.  Proceeding with non-instrumented shader.");
+    } else if (cacheable) {
+        const auto patch_offsets = GpuAssistedShaderCache::FindPlaceholderConstants(new_pgm.data(), new_pgm.size());
+        {
+            std::lock_guard<std::mutex> lock(shader_cache_lock);
+            shader_cache.Add(code, num_words, new_pgm, patch_offsets);
+        }
+        for (auto offset : patch_offsets) {
+            new_pgm[offset] = shader_id;
+        }
     }
-    *unique_shader_id = unique_shader_module_id++;
     return pass;
 }
-// Create the instrumented shader data to provide to the driver.
+
+// Create the instrumented shader data to provide to the driver, or, when instrumentation is deferred, start instrumenting it in
+// the background and let the original shader through.
 void GpuAssisted::PreCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
                                                   const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule,
                                                   void *csm_state_data) {
     create_shader_module_api_state *csm_state = reinterpret_cast<create_shader_module_api_state *>(csm_state_data);
-    bool pass = InstrumentShader(pCreateInfo, csm_state->instrumented_pgm, &csm_state->unique_shader_id);
+    if (aborted) return;
+    if (pCreateInfo->pCode[0] != spv::MagicNumber) return;
+
+    const uint32_t num_words = static_cast<uint32_t>(pCreateInfo->codeSize / 4);
+    csm_state->unique_shader_id = unique_shader_module_id++;
+    if (instrumentation_queue) {
+        std::shared_ptr<GpuAssistedDeferredShader> deferred(new GpuAssistedDeferredShader());
+        deferred->original_pgm.assign(pCreateInfo->pCode, pCreateInfo->pCode + num_words);
+        const uint32_t shader_id = csm_state->unique_shader_id;
+        deferred->pass = instrumentation_queue->Push([this, deferred, shader_id]() {
+            const bool pass = InstrumentShader(deferred->original_pgm.data(), static_cast<uint32_t>(deferred->original_pgm.size()),
+                                               shader_id, deferred->instrumented_pgm);
+            std::vector<unsigned int>().swap(deferred->original_pgm);
+            return pass;
+        });
+        deferred_shaders[shader_id] = std::move(deferred);
+        return;
+    }
+    bool pass = InstrumentShader(pCreateInfo->pCode, num_words, csm_state->unique_shader_id, csm_state->instrumented_pgm);
     if (pass) {
         csm_state->instrumented_create_info.pCode = csm_state->instrumented_pgm.data();
         csm_state->instrumented_create_info.codeSize = csm_state->instrumented_pgm.size() * sizeof(unsigned int);
     }
 }
 
+// Returns the instrumented counterpart of a shader module whose instrumentation was deferred, waiting for the instrumentation
+// queue and creating the module the first time it is asked for. Returns VK_NULL_HANDLE if there is none.
+VkShaderModule GpuAssisted::GetDeferredInstrumentedModule(const SHADER_MODULE_STATE *shader) {
+    if (!shader) return VK_NULL_HANDLE;
+    auto it = deferred_shaders.find(shader->gpu_validation_shader_id);
+    if (it == deferred_shaders.end()) return VK_NULL_HANDLE;
+    auto &deferred = *it->second;
+    if (deferred.pass.valid()) {
+        if (deferred.pass.get()) {
+            VkShaderModuleCreateInfo create_info = {};
+            create_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+            create_info.pCode = deferred.instrumented_pgm.data();
+            create_info.codeSize = deferred.instrumented_pgm.size() * sizeof(unsigned int);
+            VkResult result = DispatchCreateShaderModule(device, &create_info, nullptr, &deferred.instrumented_module);
+            if (result != VK_SUCCESS) {
+                deferred.instrumented_module = VK_NULL_HANDLE;
+                ReportSetupProblem(VK_DEBUG_REPORT_OBJECT_TYPE_SHADER_MODULE_EXT, HandleToUint64(shader->vk_shader_module),
+                                   "Unable to create instrumented shader module.  Proceeding with non-instrumented shader.");
+            }
+        }
+        std::vector<unsigned int>().swap(deferred.instrumented_pgm);
+    }
+    return deferred.instrumented_module;
+}
+
+void GpuAssisted::PreCallRecordDestroyShaderModule(VkDevice device, VkShaderModule shaderModule,
+                                                   const VkAllocationCallbacks *pAllocator) {
+    const SHADER_MODULE_STATE *shader = GetShaderModuleState(shaderModule);
+    if (shader) {
+        // Pipelines already created with the instrumented module do not need it anymore. A pending instrumentation finishes
+        // on its own and its result is dropped.
+        auto it = deferred_shaders.find(shader->gpu_validation_shader_id);
+        if (it != deferred_shaders.end()) {
+            if (it->second->instrumented_module != VK_NULL_HANDLE) {
+                DispatchDestroyShaderModule(device, it->second->instrumented_module, nullptr);
+            }
+            deferred_shaders.erase(it);
+        }
+    }
+    ValidationStateTracker::PreCallRecordDestroyShaderModule(device, shaderModule, pAllocator);
+}
+
+GpuAssistedInstrumentationQueue::GpuAssistedInstrumentationQueue(uint32_t thread_count) {
+    for (uint32_t i = 0; i < thread_count; ++i) {
+        threads_.emplace_back(&GpuAssistedInstrumentationQueue::Run, this);
+    }
+}
+
+GpuAssistedInstrumentationQueue::~GpuAssistedInstrumentationQueue() {
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        stopping_ = true;
+        queue_.clear();
+    }
+    wake_.notify_all();
+    for (auto &thread : threads_) {
+        thread.join();
+    }
+}
+
+std::future<bool> GpuAssistedInstrumentationQueue::Push(std::function<bool()> work) {
+    std::packaged_task<bool()> task(std::move(work));
+    auto result = task.get_future();
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        queue_.emplace_back(std::move(task));
+    }
+    wake_.notify_one();
+    return result;
+}
+
+void GpuAssistedInstrumentationQueue::Run() {
+    for (;;) {
+        std::packaged_task<bool()> task;
+        {
+            std::unique_lock<std::mutex> lock(lock_);
+            wake_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+            if (stopping_) return;
+            task = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        task();
+    }
+}
+
 // Generate the stage-specific part of the message.
 static void GenerateStageMessage(const uint32_t *debug_record, std::string &msg) {
     using namespace spvtools;
@@ -2095,7 +2343,7 @@ void GpuAssisted::AnalyzeAndReportError(CMD_BUFFER_STATE *cb_node, VkQueue queue
 // For the given command buffer, map its debug data buffers and read their contents for analysis.
 void GpuAssisted::ProcessInstrumentationBuffer(VkQueue queue, CMD_BUFFER_STATE *cb_node) {
     if (cb_node && (cb_node->hasDrawCmd || cb_node->hasTraceRaysCmd || cb_node->hasDispatchCmd)) {
-        auto gpu_buffer_list = GetGpuAssistedBufferInfo(cb_node->commandBuffer);
+        auto &gpu_buffer_list = GetGpuAssistedBufferInfo(cb_node->commandBuffer);
         uint32_t draw_index = 0;
         uint32_t compute_index = 0;
         uint32_t ray_trace_index = 0;
@@ -2135,16 +2383,23 @@ void GpuAssisted::ProcessInstrumentationBuffer(VkQueue queue, CMD_BUFFER_STATE *
 
 // For the given command buffer, map its debug data buffers and update the status of any update after bind descriptors
 void GpuAssisted::UpdateInstrumentationBuffer(CMD_BUFFER_STATE *cb_node) {
-    auto gpu_buffer_list = GetGpuAssistedBufferInfo(cb_node->commandBuffer);
+    auto &gpu_buffer_list = GetGpuAssistedBufferInfo(cb_node->commandBuffer);
     uint32_t *pData;
     for (auto &buffer_info : gpu_buffer_list) {
-        if (buffer_info.di_input_mem_block.update_at_submit.size() > 0) {
-            VkResult result = vmaMapMemory(vmaAllocator, buffer_info.di_input_mem_block.allocation, (void **)&pData);
+        auto &di_input_block = buffer_info.di_input_mem_block;
+        if (di_input_block && (di_input_block->update_at_submit.size() > 0)) {
+            VkResult result = vmaMapMemory(vmaAllocator, di_input_block->allocation, (void **)&pData);
             if (result == VK_SUCCESS) {
-                for (auto update : buffer_info.di_input_mem_block.update_at_submit) {
-                    if (update.second->updated) pData[update.first] = 1;
+                // Only unshared buffers have pending updates; once a descriptor is seen as written it need not be checked again
+                for (auto update = di_input_block->update_at_submit.begin(); update != di_input_block->update_at_submit.end();) {
+                    if (update->second->updated) {
+                        pData[update->first] = 1;
+                        update = di_input_block->update_at_submit.erase(update);
+                    } else {
+                        ++update;
+                    }
                 }
-                vmaUnmapMemory(vmaAllocator, buffer_info.di_input_mem_block.allocation);
+                vmaUnmapMemory(vmaAllocator, di_input_block->allocation);
             }
         }
     }
@@ -2325,6 +2580,164 @@ void GpuAssisted::PostCallRecordCmdTraceRaysNV(VkCommandBuffer commandBuffer, Vk
     cb_state->hasTraceRaysCmd = true;
 }
 
+// Returns the descriptor indexing input buffer describing the sets bound at the given bind point, or nullptr (with aborted
+// set) if it could not be created. The contents depend only on which sets are bound and on their descriptors, so the buffer
+// is shared by every draw, in any command buffer, that binds the same sets while they are unchanged. Buffers that must be
+// patched at submit are never shared.
+std::shared_ptr<GpuAssistedDeviceMemoryBlock> GpuAssisted::GetDescriptorIndexingInputBuffer(const LAST_BOUND_STATE &state) {
+    const uint32_t number_of_sets = static_cast<uint32_t>(state.per_set.size());
+
+    // A set is identified by its uid, which is never reused, and its contents by its change count
+    GpuAssistedDIInputKey key;
+    key.reserve(number_of_sets * 2);
+    for (const auto &per_set : state.per_set) {
+        key.push_back(per_set.bound_descriptor_set ? per_set.bound_descriptor_set->uid : 0);
+        key.push_back(per_set.bound_descriptor_set ? per_set.bound_descriptor_set->GetChangeCount() : 0);
+    }
+    auto cached = di_input_cache.find(key);
+    if (cached != di_input_cache.end()) {
+        auto di_input_block = cached->second.lock();
+        if (di_input_block) return di_input_block;
+    }
+
+    // Figure out how much memory we need for the input block based on how many sets and bindings there are
+    // and how big each of the bindings is
+    uint32_t descriptor_count = 0;  // Number of descriptors, including all array elements
+    uint32_t binding_count = 0;     // Number of bindings based on the max binding number used
+    for (const auto &s : state.per_set) {
+        auto desc = s.bound_descriptor_set;
+        if (desc && (desc->GetBindingCount() > 0)) {
+            auto bindings = desc->GetLayout()->GetSortedBindingSet();
+            binding_count += desc->GetLayout()->GetMaxBinding() + 1;
+            for (auto binding : bindings) {
+                // Shader instrumentation is tracking inline uniform blocks as scalers. Don't try to validate inline uniform
+                // blocks
+                if (VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT == desc->GetLayout()->GetTypeFromBinding(binding)) {
+                    descriptor_count++;
+                    log_msg(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT,
+                            VK_NULL_HANDLE, "UNASSIGNED-GPU-Assisted Validation Warning",
+                            "VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT descriptors will not be validated by GPU assisted "
+                            "validation");
+                } else if (binding == desc->GetLayout()->GetMaxBinding() && desc->IsVariableDescriptorCount(binding)) {
+                    descriptor_count += desc->GetVariableDescriptorCount();
+                } else {
+                    descriptor_count += desc->GetDescriptorCountFromBinding(binding);
+                }
+            }
+        }
+    }
+
+    // Note that the size of the input buffer is dependent on the maximum binding number, which
+    // can be very large.  This is because for (set = s, binding = b, index = i), the validation
+    // code is going to dereference Input[ i + Input[ b + Input[ s + Input[ Input[0] ] ] ] ] to
+    // see if descriptors have been written. In gpu_validation.md, we note this and advise
+    // using densely packed bindings as a best practice when using gpu-av with descriptor indexing
+    uint32_t words_needed = 1 + (number_of_sets * 2) + (binding_count * 2) + descriptor_count;
+    VkBufferCreateInfo bufferInfo = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    bufferInfo.size = words_needed * 4;
+    bufferInfo.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    VmaAllocationCreateInfo allocInfo = {};
+    allocInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
+    // The last command buffer to let go of the buffer frees it and drops it from the cache
+    auto release = [this, key](GpuAssistedDeviceMemoryBlock *block) {
+        auto entry = di_input_cache.find(key);
+        if ((entry != di_input_cache.end()) && entry->second.expired()) {
+            di_input_cache.erase(entry);
+        }
+        vmaDestroyBuffer(vmaAllocator, block->buffer, block->allocation);
+        delete block;
+    };
+    std::shared_ptr<GpuAssistedDeviceMemoryBlock> di_input_block(new GpuAssistedDeviceMemoryBlock(), release);
+    VkResult result = vmaCreateBuffer(vmaAllocator, &bufferInfo, &allocInfo, &di_input_block->buffer,
+                                      &di_input_block->allocation, nullptr);
+    if (result != VK_SUCCESS) {
+        ReportSetupProblem(VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT, HandleToUint64(device),
+                           "Unable to allocate device memory.  Device could become unstable.");
+        aborted = true;
+        return nullptr;
+    }
+
+    // Populate input buffer first with the sizes of every descriptor in every set, then with whether
+    // each element of each descriptor has been written or not.  See gpu_validation.md for a more thourough
+    // outline of the input buffer format
+    uint32_t *pData;
+    result = vmaMapMemory(vmaAllocator, di_input_block->allocation, (void **)&pData);
+    memset(pData, 0, static_cast<size_t>(bufferInfo.size));
+    // Pointer to a sets array that points into the sizes array
+    uint32_t *sets_to_sizes = pData + 1;
+    // Pointer to the sizes array that contains the array size of the descriptor at each binding
+    uint32_t *sizes = sets_to_sizes + number_of_sets;
+    // Pointer to another sets array that points into the bindings array that points into the written array
+    uint32_t *sets_to_bindings = sizes + binding_count;
+    // Pointer to the bindings array that points at the start of the writes in the writes array for each binding
+    uint32_t *bindings_to_written = sets_to_bindings + number_of_sets;
+    // Index of the next entry in the written array to be updated
+    uint32_t written_index = 1 + (number_of_sets * 2) + (binding_count * 2);
+    uint32_t bindCounter = number_of_sets + 1;
+    // Index of the start of the sets_to_bindings array
+    pData[0] = number_of_sets + binding_count + 1;
+
+    for (const auto &s : state.per_set) {
+        auto desc = s.bound_descriptor_set;
+        if (desc && (desc->GetBindingCount() > 0)) {
+            auto layout = desc->GetLayout();
+            auto bindings = layout->GetSortedBindingSet();
+            // For each set, fill in index of its bindings sizes in the sizes array
+            *sets_to_sizes++ = bindCounter;
+            // For each set, fill in the index of its bindings in the bindings_to_written array
+            *sets_to_bindings++ = bindCounter + number_of_sets + binding_count;
+            for (auto binding : bindings) {
+                // For each binding, fill in its size in the sizes array
+                // Shader instrumentation is tracking inline uniform blocks as scalers. Don't try to validate inline uniform
+                // blocks
+                if (VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT == desc->GetLayout()->GetTypeFromBinding(binding)) {
+                    sizes[binding] = 1;
+                } else if (binding == layout->GetMaxBinding() && desc->IsVariableDescriptorCount(binding)) {
+                    sizes[binding] = desc->GetVariableDescriptorCount();
+                } else {
+                    sizes[binding] = desc->GetDescriptorCountFromBinding(binding);
+                }
+                // Fill in the starting index for this binding in the written array in the bindings_to_written array
+                bindings_to_written[binding] = written_index;
+
+                // Shader instrumentation is tracking inline uniform blocks as scalers. Don't try to validate inline uniform
+                // blocks
+                if (VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT == desc->GetLayout()->GetTypeFromBinding(binding)) {
+                    pData[written_index++] = 1;
+                    continue;
+                }
+
+                auto index_range = desc->GetGlobalIndexRangeFromBinding(binding, true);
+                // For each array element in the binding, update the written array with whether it has been written
+                for (uint32_t i = index_range.start; i < index_range.end; ++i) {
+                    auto *descriptor = desc->GetDescriptorFromGlobalIndex(i);
+                    if (descriptor->updated) {
+                        pData[written_index] = 1;
+                    } else if (desc->IsUpdateAfterBind(binding)) {
+                        // If it hasn't been written now and it's update after bind, put it in a list to check at QueueSubmit
+                        di_input_block->update_at_submit[written_index] = descriptor;
+                    }
+                    written_index++;
+                }
+            }
+            auto last = desc->GetLayout()->GetMaxBinding();
+            bindings_to_written += last + 1;
+            bindCounter += last + 1;
+            sizes += last + 1;
+        } else {
+            *sets_to_sizes++ = 0;
+            *sets_to_bindings++ = 0;
+        }
+    }
+    vmaUnmapMemory(vmaAllocator, di_input_block->allocation);
+
+    // A buffer still waiting on update after bind descriptors is patched at submit, so it stays private to this draw
+    if (di_input_block->update_at_submit.empty()) {
+        di_input_cache[key] = di_input_block;
+    }
+    return di_input_block;
+}
+
 void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer, const VkPipelineBindPoint bind_point) {
     if (bind_point != VK_PIPELINE_BIND_POINT_GRAPHICS && bind_point != VK_PIPELINE_BIND_POINT_COMPUTE &&
         bind_point != VK_PIPELINE_BIND_POINT_RAY_TRACING_NV) {
@@ -2378,7 +2791,7 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
         vmaUnmapMemory(vmaAllocator, output_block.allocation);
     }
 
-    GpuAssistedDeviceMemoryBlock di_input_block = {}, bda_input_block = {};
+    std::shared_ptr<GpuAssistedDeviceMemoryBlock> di_input_block, bda_input_block;
     VkDescriptorBufferInfo di_input_desc_buffer_info = {};
     VkDescriptorBufferInfo bda_input_desc_buffer_info = {};
     VkWriteDescriptorSet desc_writes[3] = {};
@@ -2386,126 +2799,15 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
     auto const &state = cb_node->lastBound[bind_point];
     uint32_t number_of_sets = (uint32_t)state.per_set.size();
 
-    // Figure out how much memory we need for the input block based on how many sets and bindings there are
-    // and how big each of the bindings is
     if (number_of_sets > 0 && device_extensions.vk_ext_descriptor_indexing) {
-        uint32_t descriptor_count = 0;  // Number of descriptors, including all array elements
-        uint32_t binding_count = 0;     // Number of bindings based on the max binding number used
-        for (auto s : state.per_set) {
-            auto desc = s.bound_descriptor_set;
-            if (desc && (desc->GetBindingCount() > 0)) {
-                auto bindings = desc->GetLayout()->GetSortedBindingSet();
-                binding_count += desc->GetLayout()->GetMaxBinding() + 1;
-                for (auto binding : bindings) {
-                    // Shader instrumentation is tracking inline uniform blocks as scalers. Don't try to validate inline uniform
-                    // blocks
-                    if (VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT == desc->GetLayout()->GetTypeFromBinding(binding)) {
-                        descriptor_count++;
-                        log_msg(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT,
-                                VK_NULL_HANDLE, "UNASSIGNED-GPU-Assisted Validation Warning",
-                                "VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT descriptors will not be validated by GPU assisted "
-                                "validation");
-                    } else if (binding == desc->GetLayout()->GetMaxBinding() && desc->IsVariableDescriptorCount(binding)) {
-                        descriptor_count += desc->GetVariableDescriptorCount();
-                    } else {
-                        descriptor_count += desc->GetDescriptorCountFromBinding(binding);
-                    }
-                }
-            }
-        }
-
-        // Note that the size of the input buffer is dependent on the maximum binding number, which
-        // can be very large.  This is because for (set = s, binding = b, index = i), the validation
-        // code is going to dereference Input[ i + Input[ b + Input[ s + Input[ Input[0] ] ] ] ] to
-        // see if descriptors have been written. In gpu_validation.md, we note this and advise
-        // using densely packed bindings as a best practice when using gpu-av with descriptor indexing
-        uint32_t words_needed = 1 + (number_of_sets * 2) + (binding_count * 2) + descriptor_count;
-        allocInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
-        bufferInfo.size = words_needed * 4;
-        result =
-            vmaCreateBuffer(vmaAllocator, &bufferInfo, &allocInfo, &di_input_block.buffer, &di_input_block.allocation, nullptr);
-        if (result != VK_SUCCESS) {
-            ReportSetupProblem(VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT, HandleToUint64(device),
-                               "Unable to allocate device memory.  Device could become unstable.");
-            aborted = true;
+        di_input_block = GetDescriptorIndexingInputBuffer(state);
+        if (!di_input_block) {
+            vmaDestroyBuffer(vmaAllocator, output_block.buffer, output_block.allocation);
             return;
         }
 
-        // Populate input buffer first with the sizes of every descriptor in every set, then with whether
-        // each element of each descriptor has been written or not.  See gpu_validation.md for a more thourough
-        // outline of the input buffer format
-        result = vmaMapMemory(vmaAllocator, di_input_block.allocation, (void **)&pData);
-        memset(pData, 0, static_cast<size_t>(bufferInfo.size));
-        // Pointer to a sets array that points into the sizes array
-        uint32_t *sets_to_sizes = pData + 1;
-        // Pointer to the sizes array that contains the array size of the descriptor at each binding
-        uint32_t *sizes = sets_to_sizes + number_of_sets;
-        // Pointer to another sets array that points into the bindings array that points into the written array
-        uint32_t *sets_to_bindings = sizes + binding_count;
-        // Pointer to the bindings array that points at the start of the writes in the writes array for each binding
-        uint32_t *bindings_to_written = sets_to_bindings + number_of_sets;
-        // Index of the next entry in the written array to be updated
-        uint32_t written_index = 1 + (number_of_sets * 2) + (binding_count * 2);
-        uint32_t bindCounter = number_of_sets + 1;
-        // Index of the start of the sets_to_bindings array
-        pData[0] = number_of_sets + binding_count + 1;
-
-        for (auto s : state.per_set) {
-            auto desc = s.bound_descriptor_set;
-            if (desc && (desc->GetBindingCount() > 0)) {
-                auto layout = desc->GetLayout();
-                auto bindings = layout->GetSortedBindingSet();
-                // For each set, fill in index of its bindings sizes in the sizes array
-                *sets_to_sizes++ = bindCounter;
-                // For each set, fill in the index of its bindings in the bindings_to_written array
-                *sets_to_bindings++ = bindCounter + number_of_sets + binding_count;
-                for (auto binding : bindings) {
-                    // For each binding, fill in its size in the sizes array
-                    // Shader instrumentation is tracking inline uniform blocks as scalers. Don't try to validate inline uniform
-                    // blocks
-                    if (VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT == desc->GetLayout()->GetTypeFromBinding(binding)) {
-                        sizes[binding] = 1;
-                    } else if (binding == layout->GetMaxBinding() && desc->IsVariableDescriptorCount(binding)) {
-                        sizes[binding] = desc->GetVariableDescriptorCount();
-                    } else {
-                        sizes[binding] = desc->GetDescriptorCountFromBinding(binding);
-                    }
-                    // Fill in the starting index for this binding in the written array in the bindings_to_written array
-                    bindings_to_written[binding] = written_index;
-
-                    // Shader instrumentation is tracking inline uniform blocks as scalers. Don't try to validate inline uniform
-                    // blocks
-                    if (VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT == desc->GetLayout()->GetTypeFromBinding(binding)) {
-                        pData[written_index++] = 1;
-                        continue;
-                    }
-
-                    auto index_range = desc->GetGlobalIndexRangeFromBinding(binding, true);
-                    // For each array element in the binding, update the written array with whether it has been written
-                    for (uint32_t i = index_range.start; i < index_range.end; ++i) {
-                        auto *descriptor = desc->GetDescriptorFromGlobalIndex(i);
-                        if (descriptor->updated) {
-                            pData[written_index] = 1;
-                        } else if (desc->IsUpdateAfterBind(binding)) {
-                            // If it hasn't been written now and it's update after bind, put it in a list to check at QueueSubmit
-                            di_input_block.update_at_submit[written_index] = descriptor;
-                        }
-                        written_index++;
-                    }
-                }
-                auto last = desc->GetLayout()->GetMaxBinding();
-                bindings_to_written += last + 1;
-                bindCounter += last + 1;
-                sizes += last + 1;
-            } else {
-                *sets_to_sizes++ = 0;
-                *sets_to_bindings++ = 0;
-            }
-        }
-        vmaUnmapMemory(vmaAllocator, di_input_block.allocation);
-
-        di_input_desc_buffer_info.range = (words_needed * 4);
-        di_input_desc_buffer_info.buffer = di_input_block.buffer;
+        di_input_desc_buffer_info.range = VK_WHOLE_SIZE;
+        di_input_desc_buffer_info.buffer = di_input_block->buffer;
         di_input_desc_buffer_info.offset = 0;
 
         desc_writes[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
@@ -2520,48 +2822,14 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
 
     if (number_of_sets > 0 && (device_extensions.vk_ext_buffer_device_address || device_extensions.vk_khr_buffer_device_address) &&
         buffer_map.size() && shaderInt64) {
-        // Example BDA input buffer assuming 2 buffers using BDA:
-        // Word 0 | Index of start of buffer sizes (in this case 5)
-        // Word 1 | 0x0000000000000000
-        // Word 2 | Device Address of first buffer  (Addresses sorted in ascending order)
-        // Word 3 | Device Address of second buffer
-        // Word 4 | 0xffffffffffffffff
-        // Word 5 | 0 (size of pretend buffer at word 1)
-        // Word 6 | Size in bytes of first buffer
-        // Word 7 | Size in bytes of second buffer
-        // Word 8 | 0 (size of pretend buffer in word 4)
-
-        uint32_t num_buffers = static_cast<uint32_t>(buffer_map.size());
-        uint32_t words_needed = (num_buffers + 3) + (num_buffers + 2);
-        allocInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
-        bufferInfo.size = words_needed * 8;  // 64 bit words
-        result =
-            vmaCreateBuffer(vmaAllocator, &bufferInfo, &allocInfo, &bda_input_block.buffer, &bda_input_block.allocation, nullptr);
-        if (result != VK_SUCCESS) {
-            ReportSetupProblem(VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT, HandleToUint64(device),
-                               "Unable to allocate device memory.  Device could become unstable.");
-            aborted = true;
+        bda_input_block = GetBufferDeviceAddressTable();
+        if (!bda_input_block) {
+            vmaDestroyBuffer(vmaAllocator, output_block.buffer, output_block.allocation);
             return;
         }
-        uint64_t *bda_data;
-        result = vmaMapMemory(vmaAllocator, bda_input_block.allocation, (void **)&bda_data);
-        uint32_t address_index = 1;
-        uint32_t size_index = 3 + num_buffers;
-        memset(bda_data, 0, static_cast<size_t>(bufferInfo.size));
-        bda_data[0] = size_index;       // Start of buffer sizes
-        bda_data[address_index++] = 0;  // NULL address
-        bda_data[size_index++] = 0;
-
-        for (auto const &value : buffer_map) {
-            bda_data[address_index++] = value.first;
-            bda_data[size_index++] = value.second;
-        }
-        bda_data[address_index] = UINTPTR_MAX;
-        bda_data[size_index] = 0;
-        vmaUnmapMemory(vmaAllocator, bda_input_block.allocation);
-
-        bda_input_desc_buffer_info.range = (words_needed * 8);
-        bda_input_desc_buffer_info.buffer = bda_input_block.buffer;
+
+        bda_input_desc_buffer_info.range = VK_WHOLE_SIZE;
+        bda_input_desc_buffer_info.buffer = bda_input_block->buffer;
         bda_input_desc_buffer_info.offset = 0;
 
         desc_writes[desc_count].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
@@ -2596,8 +2864,6 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
             .emplace_back(output_block, di_input_block, bda_input_block, desc_sets[0], desc_pool, bind_point);
     } else {
         ReportSetupProblem(VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT, HandleToUint64(device), "Unable to find pipeline state");
-        vmaDestroyBuffer(vmaAllocator, di_input_block.buffer, di_input_block.allocation);
-        vmaDestroyBuffer(vmaAllocator, bda_input_block.buffer, bda_input_block.allocation);
         vmaDestroyBuffer(vmaAllocator, output_block.buffer, output_block.allocation);
         aborted = true;
         return;
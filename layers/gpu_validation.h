@@ -23,6 +23,15 @@
 #include "chassis.h"
 #include "state_tracker.h"
 #include "vk_mem_alloc.h"
+#include "gpu_validation_shader_cache.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+
 class GpuAssisted;
 
 struct GpuAssistedDeviceMemoryBlock {
@@ -33,14 +42,15 @@ struct GpuAssistedDeviceMemoryBlock {
 
 struct GpuAssistedBufferInfo {
     GpuAssistedDeviceMemoryBlock output_mem_block;
-    GpuAssistedDeviceMemoryBlock di_input_mem_block;   // Descriptor Indexing input
-    GpuAssistedDeviceMemoryBlock bda_input_mem_block;  // Buffer Device Address input
+    std::shared_ptr<GpuAssistedDeviceMemoryBlock> di_input_mem_block;  // Descriptor Indexing input, shared between draws
+    std::shared_ptr<GpuAssistedDeviceMemoryBlock> bda_input_mem_block;  // Buffer Device Address input, shared between draws
     VkDescriptorSet desc_set;
     VkDescriptorPool desc_pool;
     VkPipelineBindPoint pipeline_bind_point;
-    GpuAssistedBufferInfo(GpuAssistedDeviceMemoryBlock output_mem_block, GpuAssistedDeviceMemoryBlock di_input_mem_block,
-                          GpuAssistedDeviceMemoryBlock bda_input_mem_block, VkDescriptorSet desc_set, VkDescriptorPool desc_pool,
-                          VkPipelineBindPoint pipeline_bind_point)
+    GpuAssistedBufferInfo(GpuAssistedDeviceMemoryBlock output_mem_block,
+                          std::shared_ptr<GpuAssistedDeviceMemoryBlock> di_input_mem_block,
+                          std::shared_ptr<GpuAssistedDeviceMemoryBlock> bda_input_mem_block, VkDescriptorSet desc_set,
+                          VkDescriptorPool desc_pool, VkPipelineBindPoint pipeline_bind_point)
         : output_mem_block(output_mem_block),
           di_input_mem_block(di_input_mem_block),
           bda_input_mem_block(bda_input_mem_block),
@@ -49,6 +59,37 @@ struct GpuAssistedBufferInfo {
           pipeline_bind_point(pipeline_bind_point){};
 };
 
+// Uid and change count of each bound descriptor set, in set order (zeros for unbound sets)
+using GpuAssistedDIInputKey = std::vector<uint64_t>;
+
+// A shader module whose instrumentation runs on the instrumentation queue. The application's module is created from the original
+// SPIR-V; the instrumented module is only created when a pipeline first uses it.
+struct GpuAssistedDeferredShader {
+    std::vector<unsigned int> original_pgm;      // Owned by the queue until pass is ready
+    std::vector<unsigned int> instrumented_pgm;  // Owned by the queue until pass is ready
+    std::future<bool> pass;                      // False if instrumentation failed; consumed by the first pipeline using it
+    VkShaderModule instrumented_module = VK_NULL_HANDLE;
+};
+
+// Worker threads that instrument shaders in the order they were created
+class GpuAssistedInstrumentationQueue {
+  public:
+    explicit GpuAssistedInstrumentationQueue(uint32_t thread_count);
+    // Work that has not started is dropped; work in progress is finished
+    ~GpuAssistedInstrumentationQueue();
+
+    std::future<bool> Push(std::function<bool()> work);
+
+  private:
+    void Run();
+
+    std::mutex lock_;
+    std::condition_variable wake_;
+    std::deque<std::packaged_task<bool()>> queue_;
+    bool stopping_ = false;
+    std::vector<std::thread> threads_;
+};
+
 struct GpuAssistedQueueBarrierCommandInfo {
     VkCommandPool barrier_command_pool = VK_NULL_HANDLE;
     VkCommandBuffer barrier_command_buffer = VK_NULL_HANDLE;
@@ -115,14 +156,28 @@ class GpuAssisted : public ValidationStateTracker {
     uint32_t adjusted_max_desc_sets;
     uint32_t desc_set_bind_index;
     uint32_t unique_shader_module_id = 0;
+    std::mutex shader_cache_lock;
+    GpuAssistedShaderCache shader_cache;  // Only open when gpu_validation_shader_cache is set
+    // Only set when gpu_validation_instrumentation_threads is set. Declared after everything InstrumentShader uses, so that
+    // its threads are joined first.
+    std::unique_ptr<GpuAssistedInstrumentationQueue> instrumentation_queue;
+    std::unordered_map<uint32_t, std::shared_ptr<GpuAssistedDeferredShader>> deferred_shaders;  // By unique shader id
     std::unordered_map<uint32_t, GpuAssistedShaderTracker> shader_map;
     std::unique_ptr<GpuAssistedDescriptorSetManager> desc_set_manager;
     std::map<VkQueue, GpuAssistedQueueBarrierCommandInfo> queue_barrier_command_infos;
+    // Descriptor indexing input buffers by the bound sets they describe. Declared before command_buffer_map, whose entries
+    // own the buffers and remove themselves from here when released.
+    std::unordered_map<GpuAssistedDIInputKey, std::weak_ptr<GpuAssistedDeviceMemoryBlock>,
+                       hash_util::IsOrderedContainer<GpuAssistedDIInputKey>>
+        di_input_cache;
     std::unordered_map<VkCommandBuffer, std::vector<GpuAssistedBufferInfo>> command_buffer_map;  // gpu_buffer_list;
     uint32_t output_buffer_size;
     VmaAllocator vmaAllocator = {};
     PFN_vkSetDeviceLoaderData vkSetDeviceLoaderData;
     std::map<VkDeviceAddress, VkDeviceSize> buffer_map;
+    uint64_t buffer_map_version = 0;  // Bumped whenever buffer_map changes
+    std::shared_ptr<GpuAssistedDeviceMemoryBlock> bda_table;  // Device address table built from buffer_map
+    uint64_t bda_table_version = 0;                           // Value of buffer_map_version when bda_table was built
     GpuAssistedAccelerationStructureBuildValidationState acceleration_structure_validation_state;
     std::vector<GpuAssistedBufferInfo>& GetGpuAssistedBufferInfo(const VkCommandBuffer command_buffer) {
         auto buffer_list = command_buffer_map.find(command_buffer);
@@ -191,8 +246,9 @@ class GpuAssisted : public ValidationStateTracker {
                                         VkPipeline* pPipelines, std::vector<std::shared_ptr<PIPELINE_STATE>>& pipe_state,
                                         std::vector<SafeCreateInfo>* new_pipeline_create_infos,
                                         const VkPipelineBindPoint bind_point);
-    template <typename CreateInfo>
+    template <typename CreateInfo, typename SafeCreateInfo>
     void PostCallRecordPipelineCreations(const uint32_t count, const CreateInfo* pCreateInfos,
+                                         const std::vector<SafeCreateInfo>& new_pipeline_create_infos,
                                          const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines,
                                          const VkPipelineBindPoint bind_point);
     void PostCallRecordCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
@@ -208,11 +264,12 @@ class GpuAssisted : public ValidationStateTracker {
                                                    const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, VkResult result,
                                                    void* crtpl_state_data);
     void PreCallRecordDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator);
-    bool InstrumentShader(const VkShaderModuleCreateInfo* pCreateInfo, std::vector<unsigned int>& new_pgm,
-                          uint32_t* unique_shader_id);
+    bool InstrumentShader(const uint32_t* code, uint32_t num_words, uint32_t shader_id, std::vector<unsigned int>& new_pgm);
     void PreCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
                                          const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule,
                                          void* csm_state_data);
+    VkShaderModule GetDeferredInstrumentedModule(const SHADER_MODULE_STATE* shader);
+    void PreCallRecordDestroyShaderModule(VkDevice device, VkShaderModule shaderModule, const VkAllocationCallbacks* pAllocator);
     void AnalyzeAndReportError(CMD_BUFFER_STATE* cb_node, VkQueue queue, VkPipelineBindPoint pipeline_bind_point,
                                uint32_t operation_index, uint32_t* const debug_output_buffer);
     void ProcessInstrumentationBuffer(VkQueue queue, CMD_BUFFER_STATE* cb_node);
@@ -245,6 +302,10 @@ class GpuAssisted : public ValidationStateTracker {
                                       VkDeviceSize hitShaderBindingStride, VkBuffer callableShaderBindingTableBuffer,
                                       VkDeviceSize callableShaderBindingOffset, VkDeviceSize callableShaderBindingStride,
                                       uint32_t width, uint32_t height, uint32_t depth);
+    std::shared_ptr<GpuAssistedDeviceMemoryBlock> GetDescriptorIndexingInputBuffer(const LAST_BOUND_STATE& state);
+    std::string GetShaderCacheConfiguration() const;
+    void RecordBufferDeviceAddress(VkDeviceAddress address, VkDeviceSize size);
+    std::shared_ptr<GpuAssistedDeviceMemoryBlock> GetBufferDeviceAddressTable();
     void AllocateValidationResources(const VkCommandBuffer cmd_buffer, const VkPipelineBindPoint bind_point);
     void PostCallRecordGetPhysicalDeviceProperties(VkPhysicalDevice physicalDevice,
                                                    VkPhysicalDeviceProperties* pPhysicalDeviceProperties);
@@ -0,0 +1,193 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gpu_validation_shader_cache.h"
+
+#include <cstdio>
+#include <cstring>
+
+#include <SPIRV/spirv.hpp>
+#include "xxhash.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// File layout, in 32-bit words:
+//   Header | kMagic, kFormatVersion
+//   Record | hash (2 words), check (2 words), original word count, patch count, instrumented word count,
+//          | patch offsets (patch count words), instrumented SPIR-V (instrumented word count words)
+static const uint32_t kMagic = 0x43564147;  // "GAVC"
+static const uint32_t kFormatVersion = 1;
+static const size_t kHeaderWords = 2;
+static const size_t kRecordHeaderWords = 7;
+
+GpuAssistedShaderCache::~GpuAssistedShaderCache() {
+#ifdef _WIN32
+    if (mapping_) UnmapViewOfFile(mapping_);
+    if (mapping_handle_) CloseHandle(mapping_handle_);
+    if (file_handle_) CloseHandle(file_handle_);
+#else
+    if (mapping_) munmap(const_cast<uint8_t *>(mapping_), mapping_size_);
+#endif
+}
+
+bool GpuAssistedShaderCache::Open(const std::string &path, const std::string &configuration) {
+    seed_ = XXH64(configuration.data(), configuration.size(), 0);
+
+    // Map whatever is already there; the mapping is never extended, records added later are kept in memory
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file != INVALID_HANDLE_VALUE) {
+        LARGE_INTEGER size = {};
+        if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping) {
+                mapping_ = static_cast<const uint8_t *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+                mapping_size_ = mapping_ ? static_cast<size_t>(size.QuadPart) : 0;
+                mapping_handle_ = mapping;
+            }
+        }
+        file_handle_ = file;
+    }
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        struct stat st = {};
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            void *mapping = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping != MAP_FAILED) {
+                mapping_ = static_cast<const uint8_t *>(mapping);
+                mapping_size_ = static_cast<size_t>(st.st_size);
+            }
+        }
+        close(fd);
+    }
+#endif
+
+    if (mapping_size_ == 0) {
+        // New (or empty) cache: start it with a header
+        FILE *out = fopen(path.c_str(), "wb");
+        if (!out) return false;
+        const uint32_t header[kHeaderWords] = {kMagic, kFormatVersion};
+        const bool written = fwrite(header, sizeof(header), 1, out) == 1;
+        fclose(out);
+        if (!written) return false;
+    } else {
+        const uint32_t *header = reinterpret_cast<const uint32_t *>(mapping_);
+        // Never truncate a file with an unknown layout; another process may have it mapped
+        if (mapping_size_ < kHeaderWords * sizeof(uint32_t) || header[0] != kMagic || header[1] != kFormatVersion) return false;
+        Index(mapping_ + kHeaderWords * sizeof(uint32_t), mapping_size_ - kHeaderWords * sizeof(uint32_t));
+    }
+    path_ = path;
+    return true;
+}
+
+GpuAssistedShaderCache::Key GpuAssistedShaderCache::MakeKey(const uint32_t *code, size_t word_count) const {
+    const size_t size = word_count * sizeof(uint32_t);
+    return {XXH64(code, size, seed_), XXH64(code, size, ~seed_), static_cast<uint32_t>(word_count)};
+}
+
+void GpuAssistedShaderCache::Index(const uint8_t *data, size_t size) {
+    const uint32_t *words = reinterpret_cast<const uint32_t *>(data);
+    const size_t total = size / sizeof(uint32_t);
+    size_t pos = 0;
+    while (total - pos >= kRecordHeaderWords) {
+        const uint32_t *record = words + pos;
+        Key key;
+        key.hash = record[0] | (static_cast<uint64_t>(record[1]) << 32);
+        key.check = record[2] | (static_cast<uint64_t>(record[3]) << 32);
+        key.word_count = record[4];
+        Entry entry;
+        entry.patch_count = record[5];
+        entry.word_count = record[6];
+        const size_t record_words = kRecordHeaderWords + static_cast<size_t>(entry.patch_count) + entry.word_count;
+        if (total - pos < record_words) break;
+        entry.patch_offsets = record + kRecordHeaderWords;
+        entry.words = entry.patch_offsets + entry.patch_count;
+        entries_.emplace(key.hash, std::make_pair(key, entry));
+        pos += record_words;
+    }
+}
+
+bool GpuAssistedShaderCache::Find(const uint32_t *code, size_t word_count, uint32_t shader_id,
+                                  std::vector<uint32_t> *instrumented) const {
+    const Key key = MakeKey(code, word_count);
+    auto range = entries_.equal_range(key.hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        const Key &candidate = it->second.first;
+        if (candidate.check != key.check || candidate.word_count != key.word_count) continue;
+        const Entry &entry = it->second.second;
+        instrumented->assign(entry.words, entry.words + entry.word_count);
+        for (uint32_t i = 0; i < entry.patch_count; ++i) {
+            if (entry.patch_offsets[i] < entry.word_count) (*instrumented)[entry.patch_offsets[i]] = shader_id;
+        }
+        return true;
+    }
+    return false;
+}
+
+void GpuAssistedShaderCache::Add(const uint32_t *code, size_t word_count, const std::vector<uint32_t> &instrumented,
+                                 const std::vector<uint32_t> &patch_offsets) {
+    if (!IsOpen()) return;
+    const Key key = MakeKey(code, word_count);
+    std::vector<uint32_t> record;
+    record.reserve(kRecordHeaderWords + patch_offsets.size() + instrumented.size());
+    record.push_back(static_cast<uint32_t>(key.hash));
+    record.push_back(static_cast<uint32_t>(key.hash >> 32));
+    record.push_back(static_cast<uint32_t>(key.check));
+    record.push_back(static_cast<uint32_t>(key.check >> 32));
+    record.push_back(key.word_count);
+    record.push_back(static_cast<uint32_t>(patch_offsets.size()));
+    record.push_back(static_cast<uint32_t>(instrumented.size()));
+    record.insert(record.end(), patch_offsets.begin(), patch_offsets.end());
+    record.insert(record.end(), instrumented.begin(), instrumented.end());
+
+    // Unbuffered, so the record goes out in a single append and records from concurrent processes do not interleave
+    FILE *out = fopen(path_.c_str(), "ab");
+    if (out) {
+        setvbuf(out, nullptr, _IONBF, 0);
+        fwrite(record.data(), record.size() * sizeof(uint32_t), 1, out);
+        fclose(out);
+    }
+
+    added_.emplace_back(std::move(record));
+    Index(reinterpret_cast<const uint8_t *>(added_.back().data()), added_.back().size() * sizeof(uint32_t));
+}
+
+std::vector<uint32_t> GpuAssistedShaderCache::FindPlaceholderConstants(const uint32_t *code, size_t word_count) {
+    std::vector<uint32_t> offsets;
+    const size_t kSpirvHeaderWords = 5;
+    size_t pos = kSpirvHeaderWords;
+    while (pos < word_count) {
+        const uint32_t length = code[pos] >> spv::WordCountShift;
+        const uint32_t opcode = code[pos] & spv::OpCodeMask;
+        if (length == 0 || pos + length > word_count) break;
+        // OpConstant | result type | result id | value, for 32-bit constants
+        if (opcode == spv::OpConstant && length == 4 && code[pos + 3] == kPlaceholderShaderId) {
+            offsets.push_back(static_cast<uint32_t>(pos + 3));
+        }
+        pos += length;
+    }
+    return offsets;
+}
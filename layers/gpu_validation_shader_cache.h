@@ -0,0 +1,89 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Persistent cache of instrumented shaders, so that GPU-AV only runs the SPIR-V optimizer once per shader and configuration.
+//
+// The file is a header followed by records that are only ever appended. At Open() the existing file is memory-mapped and
+// indexed; shaders instrumented during this run are appended to the file and kept in memory. A truncated trailing record, as
+// left by a process that died mid-write, ends the index and is otherwise ignored.
+//
+// Shaders are instrumented with a placeholder shader ID, and each record lists the word offsets where it appears, so a cached
+// shader can be given the ID of the module being created.
+class GpuAssistedShaderCache {
+  public:
+    GpuAssistedShaderCache() = default;
+    ~GpuAssistedShaderCache();
+
+    GpuAssistedShaderCache(const GpuAssistedShaderCache &) = delete;
+    GpuAssistedShaderCache &operator=(const GpuAssistedShaderCache &) = delete;
+
+    // configuration identifies everything besides the original SPIR-V that affects the instrumented result. Returns false
+    // if the file cannot be opened or created, in which case the cache stays disabled.
+    bool Open(const std::string &path, const std::string &configuration);
+    bool IsOpen() const { return !path_.empty(); }
+
+    // On a hit, fills instrumented with the cached result, with shader_id written at each patch offset
+    bool Find(const uint32_t *code, size_t word_count, uint32_t shader_id, std::vector<uint32_t> *instrumented) const;
+
+    // Records a shader instrumented with kPlaceholderShaderId at patch_offsets
+    void Add(const uint32_t *code, size_t word_count, const std::vector<uint32_t> &instrumented,
+             const std::vector<uint32_t> &patch_offsets);
+
+    // Returns the word offsets of the OpConstant instructions whose value is kPlaceholderShaderId
+    static std::vector<uint32_t> FindPlaceholderConstants(const uint32_t *code, size_t word_count);
+
+    // Shader ID passed to the instrumentation passes when the result is to be cached. Shaders that already contain a
+    // constant with this value are instrumented directly and not cached.
+    static const uint32_t kPlaceholderShaderId = 0xFFFFFFF0;
+
+  private:
+    struct Entry {
+        const uint32_t *patch_offsets;
+        uint32_t patch_count;
+        const uint32_t *words;
+        uint32_t word_count;
+    };
+
+    struct Key {
+        uint64_t hash;
+        uint64_t check;  // Second, independently seeded hash, compared on lookup to rule out collisions
+        uint32_t word_count;
+    };
+
+    Key MakeKey(const uint32_t *code, size_t word_count) const;
+    void Index(const uint8_t *data, size_t size);
+
+    std::string path_;
+    uint64_t seed_ = 0;
+    const uint8_t *mapping_ = nullptr;
+    size_t mapping_size_ = 0;
+#ifdef _WIN32
+    void *file_handle_ = nullptr;
+    void *mapping_handle_ = nullptr;
+#endif
+    std::unordered_multimap<uint64_t, std::pair<Key, Entry>> entries_;
+    std::deque<std::vector<uint32_t>> added_;  // Storage for records added during this run
+};
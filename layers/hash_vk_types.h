@@ -99,4 +99,52 @@ struct hash<VkImageSubresourceRange> {
 };
 }  // namespace std
 
+// VkVertexInputBindingDescription
+static inline bool operator==(const VkVertexInputBindingDescription &lhs, const VkVertexInputBindingDescription &rhs) {
+    return (lhs.binding == rhs.binding) && (lhs.stride == rhs.stride) && (lhs.inputRate == rhs.inputRate);
+}
+namespace std {
+template <>
+struct hash<VkVertexInputBindingDescription> {
+    size_t operator()(const VkVertexInputBindingDescription &value) const {
+        hash_util::HashCombiner hc;
+        return (hc << value.binding << value.stride << value.inputRate).Value();
+    }
+};
+}  // namespace std
+
+// VkVertexInputAttributeDescription
+static inline bool operator==(const VkVertexInputAttributeDescription &lhs, const VkVertexInputAttributeDescription &rhs) {
+    return (lhs.location == rhs.location) && (lhs.binding == rhs.binding) && (lhs.format == rhs.format) &&
+           (lhs.offset == rhs.offset);
+}
+namespace std {
+template <>
+struct hash<VkVertexInputAttributeDescription> {
+    size_t operator()(const VkVertexInputAttributeDescription &value) const {
+        hash_util::HashCombiner hc;
+        return (hc << value.location << value.binding << value.format << value.offset).Value();
+    }
+};
+}  // namespace std
+
+// VkPipelineColorBlendAttachmentState
+static inline bool operator==(const VkPipelineColorBlendAttachmentState &lhs, const VkPipelineColorBlendAttachmentState &rhs) {
+    return (lhs.blendEnable == rhs.blendEnable) && (lhs.srcColorBlendFactor == rhs.srcColorBlendFactor) &&
+           (lhs.dstColorBlendFactor == rhs.dstColorBlendFactor) && (lhs.colorBlendOp == rhs.colorBlendOp) &&
+           (lhs.srcAlphaBlendFactor == rhs.srcAlphaBlendFactor) && (lhs.dstAlphaBlendFactor == rhs.dstAlphaBlendFactor) &&
+           (lhs.alphaBlendOp == rhs.alphaBlendOp) && (lhs.colorWriteMask == rhs.colorWriteMask);
+}
+namespace std {
+template <>
+struct hash<VkPipelineColorBlendAttachmentState> {
+    size_t operator()(const VkPipelineColorBlendAttachmentState &value) const {
+        hash_util::HashCombiner hc;
+        hc << value.blendEnable << value.srcColorBlendFactor << value.dstColorBlendFactor << value.colorBlendOp
+           << value.srcAlphaBlendFactor << value.dstAlphaBlendFactor << value.alphaBlendOp << value.colorWriteMask;
+        return hc.Value();
+    }
+};
+}  // namespace std
+
 #endif  // HASH_VK_TYPES_H_
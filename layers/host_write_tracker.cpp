@@ -0,0 +1,306 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "host_write_tracker.h"
+
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <signal.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// Tracked regions, found by the fault handler without locking. Slots are claimed and released under registry_mutex, which the
+// handler never takes.
+static const size_t kMaxTrackedRegions = 4096;
+static std::atomic<HostWriteTracker *> tracked_regions[kMaxTrackedRegions];
+static std::atomic<size_t> tracked_region_limit(0);  // Slots at and above this are all empty
+static std::mutex registry_mutex;
+static size_t tracked_region_count = 0;
+
+// A tracker may only be freed once no fault handler can still be using it. Each handler counts itself in for the current
+// epoch; releasing a slot moves on to the next epoch and waits for the handlers counted in the previous one, which are the
+// only ones that can have seen the tracker, to finish. Handlers starting later use the other counter, so a steady stream of
+// faults can't hold up the wait. All of this is sequentially consistent: a handler counted in after the wait finds the slot
+// already empty.
+static std::atomic<uint32_t> fault_epoch(0);
+static std::atomic<uint32_t> faults_in_epoch[2];
+
+bool HandleHostWriteFault(uintptr_t address) {
+    std::atomic<uint32_t> &faults = faults_in_epoch[fault_epoch.load() & 1];
+    faults.fetch_add(1);
+    bool handled = false;
+    const size_t limit = tracked_region_limit.load();
+    for (size_t slot = 0; slot < limit && !handled; ++slot) {
+        HostWriteTracker *tracker = tracked_regions[slot].load();
+        handled = tracker && tracker->OnWriteFault(address);
+    }
+    faults.fetch_sub(1);
+    return handled;
+}
+
+// Called with registry_mutex held, after emptying a slot
+static void WaitForFaultHandlers() {
+    const uint32_t epoch = fault_epoch.fetch_add(1);
+    while (faults_in_epoch[epoch & 1].load() != 0) std::this_thread::yield();
+}
+
+#ifdef _WIN32
+static PVOID exception_handler = nullptr;
+
+static LONG CALLBACK OnAccessViolation(PEXCEPTION_POINTERS exception) {
+    const EXCEPTION_RECORD *record = exception->ExceptionRecord;
+    // ExceptionInformation[0] is 1 for a write, [1] the address accessed
+    if (record->ExceptionCode == EXCEPTION_ACCESS_VIOLATION && record->NumberParameters >= 2 &&
+        record->ExceptionInformation[0] == 1 && HandleHostWriteFault(static_cast<uintptr_t>(record->ExceptionInformation[1]))) {
+        return EXCEPTION_CONTINUE_EXECUTION;
+    }
+    return EXCEPTION_CONTINUE_SEARCH;
+}
+
+static bool InstallFaultHandler() {
+    exception_handler = AddVectoredExceptionHandler(1, OnAccessViolation);
+    return exception_handler != nullptr;
+}
+
+static void RemoveFaultHandler() {
+    RemoveVectoredExceptionHandler(exception_handler);
+    exception_handler = nullptr;
+}
+#else
+// Write protection faults arrive as SIGBUS on Apple platforms and SIGSEGV elsewhere; both are handled everywhere
+static const int kFaultSignals[] = {SIGSEGV, SIGBUS};
+static const size_t kFaultSignalCount = sizeof(kFaultSignals) / sizeof(kFaultSignals[0]);
+static struct sigaction previous_actions[kFaultSignalCount];
+
+static void OnFaultSignal(int signal_number, siginfo_t *info, void *context) {
+    if (HandleHostWriteFault(reinterpret_cast<uintptr_t>(info->si_addr))) return;
+
+    // Not a tracked page: pass the fault on to whoever handled it before the layer
+    size_t index = 0;
+    while (index + 1 < kFaultSignalCount && kFaultSignals[index] != signal_number) ++index;
+    const struct sigaction &previous = previous_actions[index];
+    if (previous.sa_flags & SA_SIGINFO) {
+        previous.sa_sigaction(signal_number, info, context);
+    } else if (previous.sa_handler == SIG_DFL || previous.sa_handler == SIG_IGN) {
+        // Returning repeats the faulting access, which now gets the default action
+        signal(signal_number, SIG_DFL);
+    } else {
+        previous.sa_handler(signal_number);
+    }
+}
+
+static bool InstallFaultHandler() {
+    struct sigaction action = {};
+    action.sa_sigaction = OnFaultSignal;
+    action.sa_flags = SA_SIGINFO | SA_ONSTACK;
+    sigemptyset(&action.sa_mask);
+    for (size_t i = 0; i < kFaultSignalCount; ++i) {
+        if (sigaction(kFaultSignals[i], &action, &previous_actions[i]) != 0) {
+            while (i-- > 0) sigaction(kFaultSignals[i], &previous_actions[i], nullptr);
+            return false;
+        }
+    }
+    return true;
+}
+
+static void RemoveFaultHandler() {
+    for (size_t i = 0; i < kFaultSignalCount; ++i) {
+        // Leave alone anything installed on top of the layer's handler since
+        struct sigaction current = {};
+        if (sigaction(kFaultSignals[i], nullptr, &current) == 0 && (current.sa_flags & SA_SIGINFO) &&
+            current.sa_sigaction == OnFaultSignal) {
+            sigaction(kFaultSignals[i], &previous_actions[i], nullptr);
+        }
+    }
+}
+#endif
+
+size_t HostWriteTracker::PageSize() {
+#ifdef _WIN32
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+    return system_info.dwPageSize;
+#else
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+std::unique_ptr<HostWriteTracker> HostWriteTracker::Create(char *base, size_t size) {
+    const size_t page_size = PageSize();
+    if (!size || (reinterpret_cast<uintptr_t>(base) & (page_size - 1))) return nullptr;
+    std::unique_ptr<HostWriteTracker> tracker(new HostWriteTracker(base, size, page_size));
+
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex);
+        size_t slot = 0;
+        while (slot < kMaxTrackedRegions && tracked_regions[slot].load(std::memory_order_relaxed)) ++slot;
+        if (slot == kMaxTrackedRegions) return nullptr;
+        if (tracked_region_count == 0 && !InstallFaultHandler()) return nullptr;
+        ++tracked_region_count;
+        tracker->slot_ = slot;
+        tracked_regions[slot].store(tracker.get());
+        if (slot >= tracked_region_limit.load()) tracked_region_limit.store(slot + 1);
+    }
+
+    if (!tracker->SetAccess(0, tracker->page_count_, false)) return nullptr;
+    return tracker;
+}
+
+HostWriteTracker::HostWriteTracker(char *base, size_t size, size_t page_size)
+    : base_(base),
+      page_size_(page_size),
+      page_count_((size + page_size - 1) / page_size),
+      written_(new std::atomic<Word>[(page_count_ + kBitsPerWord - 1) / kBitsPerWord]),
+      dirty_(new std::atomic<Word>[(page_count_ + kBitsPerWord - 1) / kBitsPerWord]),
+      reported_(false),
+      slot_(kMaxTrackedRegions) {
+    for (size_t i = 0; i < (page_count_ + kBitsPerWord - 1) / kBitsPerWord; ++i) {
+        written_[i].store(0, std::memory_order_relaxed);
+        dirty_[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+HostWriteTracker::~HostWriteTracker() {
+    if (slot_ == kMaxTrackedRegions) return;
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex);
+        tracked_regions[slot_].store(nullptr);
+        WaitForFaultHandlers();
+        if (--tracked_region_count == 0) RemoveFaultHandler();
+    }
+    // The owner may go on to use or free the region as ordinary memory
+    SetAccess(0, page_count_, true);
+}
+
+bool HostWriteTracker::SetAccess(size_t first_page, size_t page_count, bool writable) {
+    char *address = base_ + first_page * page_size_;
+    const size_t size = page_count * page_size_;
+#ifdef _WIN32
+    DWORD previous_protection;
+    return VirtualProtect(address, size, writable ? PAGE_READWRITE : PAGE_READONLY, &previous_protection) != 0;
+#else
+    return mprotect(address, size, writable ? (PROT_READ | PROT_WRITE) : PROT_READ) == 0;
+#endif
+}
+
+bool HostWriteTracker::OnWriteFault(uintptr_t address) {
+    const uintptr_t base = reinterpret_cast<uintptr_t>(base_);
+    if (address < base || address - base >= page_count_ * page_size_) return false;
+    return RecordWrite(static_cast<size_t>(address - base) / page_size_);
+}
+
+bool HostWriteTracker::RecordWrite(size_t page) {
+    const Word mask = Word(1) << (page % kBitsPerWord);
+    written_[page / kBitsPerWord].fetch_or(mask, std::memory_order_acq_rel);
+    dirty_[page / kBitsPerWord].fetch_or(mask, std::memory_order_acq_rel);
+    return SetAccess(page, 1, true);
+}
+
+// Bits are cleared before their pages are protected: a write in between lands unrecorded but the page is protected straight
+// after, so at worst that one write is missed by the next hazard check. Clearing after protecting could instead lose a bit set
+// by a fault in between and leave the page writable with nothing recorded.
+void HostWriteTracker::Protect() {
+    const size_t word_count = (page_count_ + kBitsPerWord - 1) / kBitsPerWord;
+    for (size_t word = 0; word < word_count; ++word) {
+        Word bits = written_[word].exchange(0, std::memory_order_acq_rel);
+        while (bits) {
+            // Protect each run of set bits with one call
+            size_t bit = 0;
+            while (!((bits >> bit) & 1)) ++bit;
+            size_t run_end = bit;
+            while (run_end < kBitsPerWord && ((bits >> run_end) & 1)) ++run_end;
+            SetAccess(word * kBitsPerWord + bit, run_end - bit, false);
+            bits &= (run_end < kBitsPerWord) ? ~((Word(1) << run_end) - 1) : Word(0);
+        }
+    }
+    reported_.store(false, std::memory_order_release);
+}
+
+// Dirty bits are cleared before their pages are protected and copied, so a write racing with Sync() is either copied now or
+// faults afterwards and makes the page dirty again.
+void HostWriteTracker::Sync(const char *begin, size_t size, char *destination) {
+    if (!size) return;
+    const char *end = begin + size;
+    const size_t last = PageIndex(end - 1);
+    size_t page = PageIndex(begin);
+    while (page <= last) {
+        if (!IsSet(dirty_.get(), page)) {
+            ++page;
+            continue;
+        }
+        const size_t run_begin = page;
+        while (page <= last && IsSet(dirty_.get(), page)) ++page;
+
+        const char *run_start = std::max<const char *>(begin, base_ + run_begin * page_size_);
+        const char *run_end = std::min<const char *>(end, base_ + page * page_size_);
+        // Only pages the range covers completely become clean
+        const size_t clean_begin = (run_start == base_ + run_begin * page_size_) ? run_begin : run_begin + 1;
+        const size_t clean_end = (run_end == base_ + page * page_size_) ? page : page - 1;
+        if (clean_begin < clean_end) {
+            for (size_t clean = clean_begin; clean < clean_end; ++clean) Clear(dirty_.get(), clean);
+            SetAccess(clean_begin, clean_end - clean_begin, false);
+        }
+        memcpy(destination + (run_start - begin), run_start, static_cast<size_t>(run_end - run_start));
+    }
+}
+
+// The pages have to be made writable for the copy, and the application's writes to them meanwhile raise no fault. They are
+// found afterwards by comparing each page with what it should hold: the copied data inside the range, and for the pages the
+// range only partly covers, what was there before outside it. Only a write that leaves a byte's value unchanged goes unseen.
+void HostWriteTracker::CopyIn(char *begin, const char *source, size_t size) {
+    if (!size) return;
+    char *const end = begin + size;
+    const size_t first = PageIndex(begin);
+    const size_t last = PageIndex(end - 1);
+    char *const first_page = base_ + first * page_size_;
+    char *const last_page_end = base_ + (last + 1) * page_size_;
+    const size_t head = static_cast<size_t>(begin - first_page);
+    const size_t tail = static_cast<size_t>(last_page_end - end);
+    std::vector<char> outside(head + tail);
+    memcpy(outside.data(), first_page, head);
+    memcpy(outside.data() + head, end, tail);
+
+    SetAccess(first, last - first + 1, true);
+    memcpy(begin, source, size);
+    // Pages the application had made writable are protected again too; their bits are still set, so nothing is lost, the next
+    // write just faults once more
+    SetAccess(first, last - first + 1, false);
+
+    for (size_t page = first; page <= last; ++page) {
+        char *const page_begin = std::max<char *>(begin, base_ + page * page_size_);
+        char *const page_end = std::min<char *>(end, base_ + (page + 1) * page_size_);
+        bool written = memcmp(page_begin, source + (page_begin - begin), static_cast<size_t>(page_end - page_begin)) != 0;
+        if (page == first && head) written |= memcmp(first_page, outside.data(), head) != 0;
+        if (page == last && tail) written |= memcmp(end, outside.data() + head, tail) != 0;
+        if (written) RecordWrite(page);
+    }
+}
+
+bool HostWriteTracker::HasWrites() const {
+    const size_t word_count = (page_count_ + kBitsPerWord - 1) / kBitsPerWord;
+    for (size_t word = 0; word < word_count; ++word) {
+        if (written_[word].load(std::memory_order_acquire)) return true;
+    }
+    return false;
+}
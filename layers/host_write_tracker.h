@@ -0,0 +1,117 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// Finds the pages of a layer-owned region (the shadow copy of a mapping) that the application writes, by keeping them write
+// protected. The first write to a protected page faults; a process-wide fault handler marks the page and makes it writable, and
+// the write then goes ahead. Each page therefore costs one fault per Protect() or Sync() rather than anything per write.
+//
+// Every page carries two bits:
+//  written  set by a fault, cleared by Protect(): the application wrote the page since the last Protect()
+//  dirty    set by a fault, cleared by Sync(): the page holds data not yet copied out
+// A page with neither bit set is write protected, so no write can go unrecorded.
+//
+// Only supported where pages can be protected and faults intercepted (POSIX signals, Windows vectored exception handlers);
+// elsewhere Create() returns null. Writes the kernel makes on the application's behalf, e.g. read() into a tracked page, raise
+// no fault: they fail with EFAULT on protected pages instead.
+class HostWriteTracker {
+  public:
+    // Tracks [base, base + size), which must be page aligned, writable, and outlive the tracker. Write protects the region.
+    // Returns null if the region can't be protected or too many regions are already tracked.
+    static std::unique_ptr<HostWriteTracker> Create(char *base, size_t size);
+    ~HostWriteTracker();
+
+    HostWriteTracker(const HostWriteTracker &) = delete;
+    HostWriteTracker &operator=(const HostWriteTracker &) = delete;
+
+    static size_t PageSize();
+
+    // Write protects every page written since the last call, so that the next write to any of them is seen again
+    void Protect();
+
+    // Copies the dirty parts of [begin, begin + size) to destination, which stands for begin. Dirty pages wholly inside the
+    // range become clean (and write protected); dirty pages straddling its ends stay dirty, as they hold data outside it.
+    void Sync(const char *begin, size_t size, char *destination);
+
+    // Copies size bytes from source to begin without marking anything written or dirty, other than pages the application
+    // writes meanwhile
+    void CopyIn(char *begin, const char *source, size_t size);
+
+    bool HasWrites() const;
+
+    // Calls fn(offset, size) for each run of consecutive written pages overlapping [begin, begin + size), clipped to that range,
+    // with offset relative to begin
+    template <typename Fn>
+    void ForEachWrittenRange(const char *begin, size_t size, Fn &&fn) const {
+        if (!size) return;
+        const size_t first = PageIndex(begin);
+        const size_t last = PageIndex(begin + size - 1);
+        size_t page = first;
+        while (page <= last) {
+            if (!IsSet(written_.get(), page)) {
+                ++page;
+                continue;
+            }
+            const size_t run_begin = page;
+            while (page <= last && IsSet(written_.get(), page)) ++page;
+            const char *run_start = std::max<const char *>(begin, base_ + run_begin * page_size_);
+            const char *run_end = std::min<const char *>(begin + size, base_ + page * page_size_);
+            fn(static_cast<size_t>(run_start - begin), static_cast<size_t>(run_end - run_start));
+        }
+    }
+
+    // Whether a hazard has been reported since the last Protect(), so that it is reported once per submission
+    bool Reported() const { return reported_.load(std::memory_order_acquire); }
+    void SetReported() { reported_.store(true, std::memory_order_release); }
+
+  private:
+    using Word = uint32_t;
+    static const size_t kBitsPerWord = 32;
+
+    HostWriteTracker(char *base, size_t size, size_t page_size);
+
+    // Called from the fault handler: if address is in this region, records the write, unprotects the page and returns true
+    bool OnWriteFault(uintptr_t address);
+    friend bool HandleHostWriteFault(uintptr_t address);
+    // Marks the page written and dirty, and makes it writable
+    bool RecordWrite(size_t page);
+
+    size_t PageIndex(const char *address) const { return static_cast<size_t>(address - base_) / page_size_; }
+    static bool IsSet(const std::atomic<Word> *bits, size_t page) {
+        return (bits[page / kBitsPerWord].load(std::memory_order_acquire) >> (page % kBitsPerWord)) & 1;
+    }
+    static bool Clear(std::atomic<Word> *bits, size_t page) {
+        const Word mask = Word(1) << (page % kBitsPerWord);
+        return (bits[page / kBitsPerWord].fetch_and(~mask, std::memory_order_acq_rel) & mask) != 0;
+    }
+    bool SetAccess(size_t first_page, size_t page_count, bool writable);
+
+    char *const base_;
+    const size_t page_size_;
+    const size_t page_count_;
+    std::unique_ptr<std::atomic<Word>[]> written_;
+    std::unique_ptr<std::atomic<Word>[]> dirty_;
+    std::atomic<bool> reported_;
+    size_t slot_;
+};
@@ -177,6 +177,89 @@ bool ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const CMD_BUFFE
     }
 }
 
+// Writes value into the parts of the sorted, disjoint ranges that have no value yet, walking a single cached lower bound
+// forward across the batch. Each range written is appended to filled, if given.
+template <typename Map, typename Value>
+static bool FillSortedRanges(Map* map, const std::vector<IndexRange>& ranges, const Value& value,
+                             std::vector<IndexRange>* filled) {
+    using Range = typename Map::key_type;
+    using CachedLowerBound = sparse_container::cached_lower_bound_impl<Map>;
+    if (ranges.empty()) return false;
+
+    bool updated = false;
+    CachedLowerBound pos(*map, ranges.front().begin);
+    for (const auto& range : ranges) {
+        pos.seek(range.begin);
+        while (range.includes(pos->index)) {
+            if (pos->valid) {
+                // Write once, so skip past the existing entry
+                pos.seek(pos->lower_bound->first.end);
+            } else {
+                const auto start = pos->index;
+                auto it = pos->lower_bound;
+                const auto limit = (it != map->end()) ? std::min(it->first.begin, range.end) : range.end;
+                map->insert(it, std::make_pair(Range(start, limit), value));
+                if (filled) filled->emplace_back(start, limit);
+                // As in update_range_value, pos->lower_bound is still valid after the insert, and seek fixes up the index
+                pos.seek(limit);
+                updated = true;
+            }
+        }
+    }
+    return updated;
+}
+
+template <typename LayoutMap, typename InitialStateMap>
+static bool SetSortedRangesInitialLayoutImpl(LayoutMap* initial_layouts, InitialStateMap* initial_state_map,
+                                             InitialLayoutStates* initial_layout_states, const std::vector<IndexRange>& ranges,
+                                             const CMD_BUFFER_STATE& cb_state, VkImageLayout layout) {
+    std::vector<IndexRange> filled;
+    if (!FillSortedRanges(initial_layouts, ranges, layout, &filled)) return false;
+
+    // The initial layouts and their states are always written together, so the state map has gaps exactly where the
+    // layouts did
+    InitialLayoutState* initial_state = new InitialLayoutState(cb_state, nullptr);
+    initial_layout_states->emplace_back(initial_state);
+    FillSortedRanges(initial_state_map, filled, initial_state, nullptr);
+    return true;
+}
+
+bool ImageSubresourceLayoutMap::SetSubresourceRangesInitialLayout(const CMD_BUFFER_STATE& cb_state,
+                                                                  const std::vector<VkImageSubresourceRange>& ranges,
+                                                                  VkImageLayout layout) {
+    std::vector<IndexRange> encoded;
+    encoded.reserve(ranges.size());
+    for (const auto& range : ranges) {
+        if (!InRange(range)) continue;  // Don't even try to track bogus subreources
+        for (RangeGenerator range_gen(encoder_, range); range_gen->non_empty(); ++range_gen) {
+            encoded.emplace_back(*range_gen);
+        }
+    }
+    if (encoded.empty()) return false;
+
+    // Every range gets the same layout, so overlapping and adjacent ranges can be merged without changing the result
+    std::sort(encoded.begin(), encoded.end());
+    size_t last = 0;
+    for (size_t i = 1; i < encoded.size(); ++i) {
+        if (encoded[i].begin <= encoded[last].end) {
+            encoded[last].end = std::max(encoded[last].end, encoded[i].end);
+        } else {
+            encoded[++last] = encoded[i];
+        }
+    }
+    encoded.resize(last + 1);
+
+    assert(layouts_.initial.GetMode() == initial_layout_state_map_.GetMode());
+    if (layouts_.initial.SmallMode()) {
+        return SetSortedRangesInitialLayoutImpl(&layouts_.initial.GetSmallMap(), &initial_layout_state_map_.GetSmallMap(),
+                                                &initial_layout_states_, encoded, cb_state, layout);
+    } else {
+        assert(!layouts_.initial.Tristate());
+        return SetSortedRangesInitialLayoutImpl(&layouts_.initial.GetBigMap(), &initial_layout_state_map_.GetBigMap(),
+                                                &initial_layout_states_, encoded, cb_state, layout);
+    }
+}
+
 static VkImageLayout FindInMap(IndexType index, const ImageSubresourceLayoutMap::RangeMap& map) {
     auto found = map.find(index);
     VkImageLayout value = kInvalidLayout;
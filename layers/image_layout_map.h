@@ -153,6 +153,10 @@ class ImageSubresourceLayoutMap {
                                           VkImageLayout layout, const IMAGE_VIEW_STATE* view_state = nullptr);
     bool SetSubresourceRangeInitialLayout(const CMD_BUFFER_STATE& cb_state, VkImageLayout layout,
                                           const IMAGE_VIEW_STATE& view_state);
+    // Same result as calling SetSubresourceRangeInitialLayout for each range in turn, but the encoded ranges are sorted and
+    // merged first and applied in a single forward pass over the map
+    bool SetSubresourceRangesInitialLayout(const CMD_BUFFER_STATE& cb_state, const std::vector<VkImageSubresourceRange>& ranges,
+                                           VkImageLayout layout);
     bool ForRange(const VkImageSubresourceRange& range, const Callback& callback, bool skip_invalid = true,
                   bool always_get_initial = false) const;
     VkImageLayout GetSubresourceLayout(const VkImageSubresource& subresource) const;
@@ -0,0 +1,284 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "layer_profiler.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace layer_profiler {
+
+std::atomic<bool> profiling_enabled(false);
+
+namespace {
+
+static const char *const kPhaseNames[kProfilePhaseCount] = {"PreCallValidate", "PreCallRecord", "PostCallRecord"};
+
+// Written only by the owning thread; atomics so that readers collecting results see whole values
+struct Counter {
+    std::atomic<uint64_t> calls{0};
+    std::atomic<uint64_t> ticks{0};
+};
+
+// Slots are written by the owning thread while WriteChromeTrace may be copying them, so every field is a relaxed atomic and
+// the reader checks events_started afterwards to discard slots that may have been overwritten mid-copy
+struct TraceEvent {
+    std::atomic<uint64_t> start{0};
+    std::atomic<uint64_t> duration{0};
+    std::atomic<uint32_t> entry_point{0};
+    std::atomic<uint16_t> object_type{0};
+    std::atomic<uint16_t> phase{0};
+};
+
+struct ThreadProfile {
+    uint32_t thread_index = 0;
+    std::unique_ptr<Counter[]> counters;
+    std::unique_ptr<TraceEvent[]> events;  // Ring buffer, sized once when the thread first records
+    uint64_t event_capacity = 0;
+    std::atomic<uint64_t> events_started{0};  // Events whose slot the writer has begun to fill
+    std::atomic<uint64_t> event_count{0};     // Events whose slot is complete
+};
+
+struct ProfileResult {
+    uint32_t entry_point;
+    uint32_t object_type;
+    uint32_t phase;
+    uint64_t calls;
+    uint64_t ns;
+};
+
+std::mutex profile_mutex;
+ProfileSettings profile_settings = {};
+std::string output_path;
+std::vector<std::unique_ptr<ThreadProfile>> thread_profiles;  // Never shrinks; profiles outlive their threads
+uint64_t calibration_ticks = 0;
+std::chrono::steady_clock::time_point calibration_time;
+
+thread_local ThreadProfile *this_thread_profile = nullptr;
+
+size_t CounterCount() {
+    return static_cast<size_t>(profile_settings.entry_point_count) * kMaxProfiledObjectTypes * kProfilePhaseCount;
+}
+
+size_t CounterIndex(uint32_t entry_point, uint32_t object_type, uint32_t phase) {
+    return (static_cast<size_t>(entry_point) * kMaxProfiledObjectTypes + object_type) * kProfilePhaseCount + phase;
+}
+
+ThreadProfile *CreateThreadProfile() {
+    std::unique_ptr<ThreadProfile> profile(new ThreadProfile);
+    profile->counters.reset(new Counter[CounterCount()]);
+    if (profile_settings.format == kProfileOutputChromeTrace && profile_settings.trace_events_per_thread) {
+        profile->event_capacity = profile_settings.trace_events_per_thread;
+        profile->events.reset(new TraceEvent[profile->event_capacity]);
+    }
+    std::lock_guard<std::mutex> lock(profile_mutex);
+    profile->thread_index = static_cast<uint32_t>(thread_profiles.size());
+    thread_profiles.emplace_back(std::move(profile));
+    return thread_profiles.back().get();
+}
+
+// Nanoseconds per tick, measured over the whole profiling run so far
+double NanosecondsPerTick() {
+#ifdef LAYER_PROFILER_USE_RDTSC
+    const uint64_t ticks = Now() - calibration_ticks;
+    const auto elapsed = std::chrono::steady_clock::now() - calibration_time;
+    const double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    return ticks ? ns / static_cast<double>(ticks) : 1.0;
+#else
+    return 1.0;
+#endif
+}
+
+// Sums all threads' counters. Results are sorted by decreasing total time.
+std::vector<ProfileResult> CollectResults() {
+    std::vector<ProfileResult> results;
+    const double ns_per_tick = NanosecondsPerTick();
+    std::vector<uint64_t> calls(CounterCount(), 0);
+    std::vector<uint64_t> ticks(CounterCount(), 0);
+    {
+        std::lock_guard<std::mutex> lock(profile_mutex);
+        for (const auto &profile : thread_profiles) {
+            for (size_t i = 0; i < calls.size(); ++i) {
+                calls[i] += profile->counters[i].calls.load(std::memory_order_relaxed);
+                ticks[i] += profile->counters[i].ticks.load(std::memory_order_relaxed);
+            }
+        }
+    }
+    for (uint32_t entry_point = 0; entry_point < profile_settings.entry_point_count; ++entry_point) {
+        for (uint32_t object_type = 0; object_type < kMaxProfiledObjectTypes; ++object_type) {
+            for (uint32_t phase = 0; phase < kProfilePhaseCount; ++phase) {
+                const size_t index = CounterIndex(entry_point, object_type, phase);
+                if (calls[index] == 0) continue;
+                results.push_back({entry_point, object_type, phase, calls[index],
+                                   static_cast<uint64_t>(static_cast<double>(ticks[index]) * ns_per_tick)});
+            }
+        }
+    }
+    std::sort(results.begin(), results.end(), [](const ProfileResult &a, const ProfileResult &b) { return a.ns > b.ns; });
+    return results;
+}
+
+const char *ObjectTypeName(uint32_t object_type) {
+    return object_type < profile_settings.object_type_count ? profile_settings.object_type_names[object_type] : "Unknown";
+}
+
+void WriteReport(FILE *out) {
+    const auto results = CollectResults();
+    fprintf(out, "%14s %12s %12s  %-16s %-24s %s\n", "total_us", "calls", "ns/call", "phase", "object", "entry_point");
+    for (const auto &result : results) {
+        fprintf(out, "%14.1f %12" PRIu64 " %12.1f  %-16s %-24s %s\n", result.ns / 1000.0, result.calls,
+                static_cast<double>(result.ns) / static_cast<double>(result.calls), kPhaseNames[result.phase],
+                ObjectTypeName(result.object_type), profile_settings.entry_point_names[result.entry_point]);
+    }
+}
+
+void WriteChromeTrace(FILE *out) {
+    const double ns_per_tick = NanosecondsPerTick();
+    std::lock_guard<std::mutex> lock(profile_mutex);
+    fprintf(out, "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [\n");
+    bool first = true;
+    for (const auto &profile : thread_profiles) {
+        const uint64_t capacity = profile->event_capacity;
+        if (!capacity) continue;
+        const uint64_t count = profile->event_count.load(std::memory_order_acquire);
+        const uint64_t begin = count > capacity ? count - capacity : 0;
+        struct EventCopy {
+            uint64_t start;
+            uint64_t duration;
+            uint32_t entry_point;
+            uint32_t object_type;
+            uint32_t phase;
+        };
+        std::vector<EventCopy> events;
+        events.reserve(static_cast<size_t>(count - begin));
+        for (uint64_t i = begin; i < count; ++i) {
+            const TraceEvent &event = profile->events[i % capacity];
+            events.push_back({event.start.load(std::memory_order_relaxed), event.duration.load(std::memory_order_relaxed),
+                              event.entry_point.load(std::memory_order_relaxed), event.object_type.load(std::memory_order_relaxed),
+                              event.phase.load(std::memory_order_relaxed)});
+        }
+        // Pairs with the fence in Record: any slot whose copy saw a newer write is covered by the events_started read here.
+        // Event i shares its slot with event i + capacity, so events before started - capacity may be torn.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const uint64_t started = profile->events_started.load(std::memory_order_relaxed);
+        const uint64_t valid_begin = started > capacity ? std::max(begin, started - capacity) : begin;
+        for (uint64_t i = valid_begin; i < count; ++i) {
+            const EventCopy &event = events[static_cast<size_t>(i - begin)];
+            // Timestamps are relative to when profiling was enabled, in microseconds
+            const double ts = static_cast<double>(event.start - calibration_ticks) * ns_per_tick / 1000.0;
+            const double dur = static_cast<double>(event.duration) * ns_per_tick / 1000.0;
+            fprintf(out, "%s{\"name\": \"%s\", \"cat\": \"%s\", \"ph\": \"X\", \"pid\": 1, \"tid\": %u, \"ts\": %.3f, "
+                    "\"dur\": %.3f, \"args\": {\"phase\": \"%s\"}}",
+                    first ? "" : ",\n", profile_settings.entry_point_names[event.entry_point], ObjectTypeName(event.object_type),
+                    profile->thread_index, ts, dur, kPhaseNames[event.phase]);
+            first = false;
+        }
+    }
+    fprintf(out, "\n]}\n");
+}
+
+}  // namespace
+
+void Enable(const ProfileSettings &settings) {
+    std::lock_guard<std::mutex> lock(profile_mutex);
+    if (profiling_enabled.load()) return;
+    profile_settings = settings;
+    output_path = settings.output_path ? settings.output_path : "";
+    profile_settings.output_path = output_path.c_str();
+    calibration_time = std::chrono::steady_clock::now();
+    calibration_ticks = Now();
+    profiling_enabled.store(true);
+}
+
+void Record(uint32_t entry_point, uint32_t object_type, ProfilePhase phase, uint64_t start, uint64_t end) {
+    ThreadProfile *profile = this_thread_profile;
+    if (!profile) {
+        profile = CreateThreadProfile();
+        this_thread_profile = profile;
+    }
+    // Single writer per counter: a plain load/store pair, not a locked read-modify-write
+    Counter &counter = profile->counters[CounterIndex(entry_point, object_type, phase)];
+    counter.calls.store(counter.calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    counter.ticks.store(counter.ticks.load(std::memory_order_relaxed) + (end - start), std::memory_order_relaxed);
+
+    if (profile->event_capacity) {
+        // Announce the overwrite before touching the slot, so that a concurrent WriteChromeTrace can tell the copy it took of
+        // this slot may be torn
+        const uint64_t count = profile->event_count.load(std::memory_order_relaxed);
+        profile->events_started.store(count + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        TraceEvent &event = profile->events[count % profile->event_capacity];
+        event.start.store(start, std::memory_order_relaxed);
+        event.duration.store(end - start, std::memory_order_relaxed);
+        event.entry_point.store(entry_point, std::memory_order_relaxed);
+        event.object_type.store(static_cast<uint16_t>(object_type), std::memory_order_relaxed);
+        event.phase.store(static_cast<uint16_t>(phase), std::memory_order_relaxed);
+        profile->event_count.store(count + 1, std::memory_order_release);
+    }
+}
+
+void WriteResults() {
+    if (!profiling_enabled.load()) return;
+    FILE *out = stdout;
+    if (!output_path.empty()) {
+        out = fopen(output_path.c_str(), "w");
+        if (!out) {
+            fprintf(stderr, "Validation layer profiling: unable to open %s, writing to stdout\n", output_path.c_str());
+            out = stdout;
+        }
+    }
+    if (profile_settings.format == kProfileOutputChromeTrace) {
+        WriteChromeTrace(out);
+    } else {
+        WriteReport(out);
+    }
+    if (out != stdout) {
+        fclose(out);
+    } else {
+        fflush(out);
+    }
+}
+
+}  // namespace layer_profiler
+
+VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetLayerProfileResults(uint32_t *pResultCount, VkLayerProfileResult *pResults) {
+    using namespace layer_profiler;
+    if (!profiling_enabled.load()) {
+        *pResultCount = 0;
+        return VK_ERROR_FEATURE_NOT_PRESENT;
+    }
+    const auto results = CollectResults();
+    if (!pResults) {
+        *pResultCount = static_cast<uint32_t>(results.size());
+        return VK_SUCCESS;
+    }
+    const uint32_t count = std::min(*pResultCount, static_cast<uint32_t>(results.size()));
+    for (uint32_t i = 0; i < count; ++i) {
+        pResults[i].pEntryPointName = profile_settings.entry_point_names[results[i].entry_point];
+        pResults[i].pValidationObjectName = ObjectTypeName(results[i].object_type);
+        pResults[i].pPhaseName = kPhaseNames[results[i].phase];
+        pResults[i].callCount = results[i].calls;
+        pResults[i].totalNanoseconds = results[i].ns;
+    }
+    *pResultCount = count;
+    return count < results.size() ? VK_INCOMPLETE : VK_SUCCESS;
+}
@@ -0,0 +1,133 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "vulkan/vulkan.h"
+#include "vk_layer_config.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define LAYER_PROFILER_USE_RDTSC
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define LAYER_PROFILER_USE_RDTSC
+#endif
+
+// Opt-in per-entry-point profiling of the validation objects, enabled with VALIDATION_CHECK_ENABLE_PROFILING.
+//
+// The chassis wraps each PreCallValidate, PreCallRecord and PostCallRecord call in a ProfileScope. Time and call counts go
+// into counters owned by the calling thread, so the only cross-thread traffic is when a thread first records and when
+// results are collected. Results are written at device destruction and can be read at any time through
+// vkGetLayerProfileResults.
+namespace layer_profiler {
+
+enum ProfilePhase {
+    kProfilePreCallValidate,
+    kProfilePreCallRecord,
+    kProfilePostCallRecord,
+    kProfilePhaseCount,
+};
+
+// Upper bound on LayerObjectTypeId values; checked by the chassis when profiling is enabled
+static const uint32_t kMaxProfiledObjectTypes = 16;
+
+enum ProfileOutputFormat {
+    kProfileOutputReport,       // Text table sorted by total time
+    kProfileOutputChromeTrace,  // Chrome trace event JSON (chrome://tracing, Perfetto)
+};
+
+struct ProfileSettings {
+    const char *const *entry_point_names;  // Indexed by ProfiledEntryPoint
+    uint32_t entry_point_count;
+    const char *const *object_type_names;  // Indexed by LayerObjectTypeId
+    uint32_t object_type_count;
+    ProfileOutputFormat format;
+    const char *output_path;
+    uint32_t trace_events_per_thread;  // Most recent events kept for the Chrome trace
+};
+
+extern std::atomic<bool> profiling_enabled;
+
+// Starts profiling. Only the first call has an effect; the names passed in must outlive the layer.
+void Enable(const ProfileSettings &settings);
+
+// Writes everything recorded so far, in the configured format, to the configured output
+void WriteResults();
+
+// Clock in ticks: the TSC where available, steady_clock nanoseconds elsewhere
+static inline uint64_t Now() {
+#ifdef LAYER_PROFILER_USE_RDTSC
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+void Record(uint32_t entry_point, uint32_t object_type, ProfilePhase phase, uint64_t start, uint64_t end);
+
+// Times the enclosing scope when profiling is enabled; a single relaxed load otherwise
+class ProfileScope {
+  public:
+    ProfileScope(uint32_t entry_point, uint32_t object_type, ProfilePhase phase)
+        : start_(profiling_enabled.load(std::memory_order_relaxed) ? Now() : 0),
+          entry_point_(entry_point),
+          object_type_(object_type),
+          phase_(phase) {}
+    ~ProfileScope() {
+        if (start_) Record(entry_point_, object_type_, phase_, start_, Now());
+    }
+
+    ProfileScope(const ProfileScope &) = delete;
+    ProfileScope &operator=(const ProfileScope &) = delete;
+
+  private:
+    uint64_t start_;
+    uint32_t entry_point_;
+    uint32_t object_type_;
+    ProfilePhase phase_;
+};
+
+}  // namespace layer_profiler
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// One row of profiling results: a (entry point, validation object, phase) triple summed over all threads
+typedef struct VkLayerProfileResult {
+    const char *pEntryPointName;
+    const char *pValidationObjectName;
+    const char *pPhaseName;
+    uint64_t callCount;
+    uint64_t totalNanoseconds;
+} VkLayerProfileResult;
+
+typedef VkResult(VKAPI_PTR *PFN_vkGetLayerProfileResults)(uint32_t *pResultCount, VkLayerProfileResult *pResults);
+
+// Exported by the layer library (look it up with dlsym/GetProcAddress). Follows the usual two-call idiom: with pResults
+// NULL, returns the number of rows with a non-zero call count; otherwise fills up to *pResultCount rows, ordered by
+// decreasing total time, and returns VK_INCOMPLETE if there were more. Returns VK_ERROR_FEATURE_NOT_PRESENT when
+// profiling is not enabled.
+VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetLayerProfileResults(uint32_t *pResultCount, VkLayerProfileResult *pResults);
+
+#ifdef __cplusplus
+}
+#endif
@@ -48,13 +48,141 @@ enum ObjectStatusFlagBits {
 
 // Object and state information structure
 struct ObjTrackState {
-    uint64_t handle;                                               // Object handle (new)
-    VulkanObjectType object_type;                                  // Object type identifier
-    ObjectStatusFlags status;                                      // Object state
-    uint64_t parent_object;                                        // Parent object
-    std::unique_ptr<std::unordered_set<uint64_t> > child_objects;  // Child objects (used for VkDescriptorPool only)
+    uint64_t handle;               // Object handle (new)
+    VulkanObjectType object_type;  // Object type identifier
+    ObjectStatusFlags status;      // Object state
+    uint64_t parent_object;        // Parent object
+
+    // Intrusive parent/child links, used for VkCommandPool, VkDescriptorPool and VkSwapchainKHR parents so that pool
+    // destroy/reset visits only the pool's own children. Pool links are guarded by the external synchronization the API
+    // requires on the pool handle. vkGetSwapchainImagesKHR does not externally synchronize its swapchain, so swapchain links
+    // are only touched with object_lifetime_mutex held for writing. A child is unlinked before its map entry is released,
+    // and a parent orphans any remaining children when it is destroyed, so these raw pointers never dangle.
+    ObjTrackState *parent_node = nullptr;
+    ObjTrackState *first_child = nullptr;
+    ObjTrackState *prev_sibling = nullptr;
+    ObjTrackState *next_sibling = nullptr;
+
+    void LinkChild(ObjTrackState *child) {
+        assert(child->parent_node == nullptr);
+        child->parent_node = this;
+        child->prev_sibling = nullptr;
+        child->next_sibling = first_child;
+        if (first_child) first_child->prev_sibling = child;
+        first_child = child;
+    }
+
+    void UnlinkFromParent() {
+        if (!parent_node) return;
+        if (prev_sibling) {
+            prev_sibling->next_sibling = next_sibling;
+        } else {
+            assert(parent_node->first_child == this);
+            parent_node->first_child = next_sibling;
+        }
+        if (next_sibling) next_sibling->prev_sibling = prev_sibling;
+        parent_node = prev_sibling = next_sibling = nullptr;
+    }
+
+    void OrphanChildren() {
+        ObjTrackState *child = first_child;
+        while (child) {
+            ObjTrackState *next = child->next_sibling;
+            child->parent_node = child->prev_sibling = child->next_sibling = nullptr;
+            child = next;
+        }
+        first_child = nullptr;
+    }
+
+    // Visit each child. The callback may destroy the child it is handed, but no other child of this parent.
+    template <typename Fn>
+    void ForEachChild(Fn &&fn) const {
+        ObjTrackState *child = first_child;
+        while (child) {
+            ObjTrackState *next = child->next_sibling;
+            fn(child);
+            child = next;
+        }
+    }
+};
+
+// Slab storage for the ObjTrackState nodes of one object type. Blocks are carved out of fixed-size chunks and recycled
+// through a free list, so create/destroy churn does not reach the heap. Nodes are still shared_ptrs, created through
+// ObjTrackStateAllocator, so a node found in a map stays valid after the map's bucket lock is released even if another
+// thread destroys the object; its block returns to the slab when the last reference goes away.
+class ObjTrackStateSlab {
+  public:
+    void *Allocate(size_t size) {
+        std::lock_guard<std::mutex> lock(slab_mutex);
+        if (!block_size) block_size = RoundUp(size);
+        assert(RoundUp(size) == block_size);
+        if (!free_list) {
+            chunks.emplace_back(new char[block_size * kChunkSize]);
+            char *chunk = chunks.back().get();
+            for (uint32_t i = 0; i < kChunkSize; ++i) {
+                FreeBlock *block = reinterpret_cast<FreeBlock *>(chunk + i * block_size);
+                block->next = free_list;
+                free_list = block;
+            }
+        }
+        FreeBlock *block = free_list;
+        free_list = block->next;
+        return block;
+    }
+    void Free(void *ptr) {
+        std::lock_guard<std::mutex> lock(slab_mutex);
+        FreeBlock *block = static_cast<FreeBlock *>(ptr);
+        block->next = free_list;
+        free_list = block;
+    }
+
+  private:
+    static const uint32_t kChunkSize = 256;
+
+    struct FreeBlock {
+        FreeBlock *next;
+    };
+    // Keep every block in a chunk aligned as operator new[] aligns the chunk itself
+    static size_t RoundUp(size_t size) {
+        const size_t alignment = alignof(std::max_align_t);
+        size = std::max(size, sizeof(FreeBlock));
+        return (size + alignment - 1) & ~(alignment - 1);
+    }
+
+    std::mutex slab_mutex;
+    size_t block_size = 0;
+    FreeBlock *free_list = nullptr;
+    std::vector<std::unique_ptr<char[]>> chunks;
 };
 
+// Allocator handing std::allocate_shared single blocks from an ObjTrackStateSlab. The slab sizes its blocks on first use, to
+// hold a node together with its shared_ptr control block.
+template <typename T>
+struct ObjTrackStateAllocator {
+    typedef T value_type;
+
+    explicit ObjTrackStateAllocator(ObjTrackStateSlab *slab) : slab(slab) {}
+    template <typename U>
+    ObjTrackStateAllocator(const ObjTrackStateAllocator<U> &other) : slab(other.slab) {}
+
+    T *allocate(size_t count) {
+        assert(count == 1);
+        return static_cast<T *>(slab->Allocate(sizeof(T)));
+    }
+    void deallocate(T *ptr, size_t) { slab->Free(ptr); }
+
+    ObjTrackStateSlab *slab;
+};
+
+template <typename T, typename U>
+bool operator==(const ObjTrackStateAllocator<T> &a, const ObjTrackStateAllocator<U> &b) {
+    return a.slab == b.slab;
+}
+template <typename T, typename U>
+bool operator!=(const ObjTrackStateAllocator<T> &a, const ObjTrackStateAllocator<U> &b) {
+    return a.slab != b.slab;
+}
+
 typedef vl_concurrent_unordered_map<uint64_t, std::shared_ptr<ObjTrackState>, 6> object_map_type;
 
 class ObjectLifetimes : public ValidationObject {
@@ -71,6 +199,9 @@ class ObjectLifetimes : public ValidationObject {
 
     std::atomic<uint64_t> num_objects[kVulkanObjectTypeMax + 1];
     std::atomic<uint64_t> num_total_objects;
+    // Per-type storage for the nodes held by object_map (swapchain image nodes come from the image slab). Declared before
+    // the maps so that it outlives the nodes they hold.
+    ObjTrackStateSlab object_slab[kVulkanObjectTypeMax + 1];
     // Vector of unordered_maps per object type to hold ObjTrackState info
     object_map_type object_map[kVulkanObjectTypeMax + 1];
     // Special-case map for swapchain images
@@ -79,19 +210,29 @@ class ObjectLifetimes : public ValidationObject {
     // Constructor for object lifetime tracking
     ObjectLifetimes() : num_objects{}, num_total_objects(0) {}
 
-    void InsertObject(object_map_type &map, uint64_t object_handle, VulkanObjectType object_type,
+    std::shared_ptr<ObjTrackState> NewObjTrackState(VulkanObjectType object_type) {
+        return std::allocate_shared<ObjTrackState>(ObjTrackStateAllocator<ObjTrackState>(&object_slab[object_type]));
+    }
+
+    // Returns false if the handle was already tracked.
+    bool InsertObject(object_map_type &map, uint64_t object_handle, VulkanObjectType object_type,
                       std::shared_ptr<ObjTrackState> pNode) {
         bool inserted = map.insert(object_handle, pNode);
         if (!inserted) {
-            // The object should not already exist. If we couldn't add it to the map, there was probably
-            // a race condition in the app. Report an error and move on.
-            VkDebugReportObjectTypeEXT debug_object_type = get_debug_report_enum[object_type];
-            log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, debug_object_type, object_handle, kVUID_ObjectTracker_Info,
-                    "Couldn't insert %s Object 0x%" PRIxLEAST64
-                    ", already existed. This should not happen and may indicate a "
-                    "race condition in the application.",
-                    object_string[object_type], object_handle);
+            ReportInsertRace(object_handle, object_type);
         }
+        return inserted;
+    }
+
+    void ReportInsertRace(uint64_t object_handle, VulkanObjectType object_type) {
+        // The object should not already exist. If we couldn't add it to the map, there was probably
+        // a race condition in the app. Report an error and move on.
+        VkDebugReportObjectTypeEXT debug_object_type = get_debug_report_enum[object_type];
+        log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, debug_object_type, object_handle, kVUID_ObjectTracker_Info,
+                "Couldn't insert %s Object 0x%" PRIxLEAST64
+                ", already existed. This should not happen and may indicate a "
+                "race condition in the application.",
+                object_string[object_type], object_handle);
     }
 
     bool ReportUndestroyedInstanceObjects(VkInstance instance, const std::string &error_code) const;
@@ -104,8 +245,10 @@ class ObjectLifetimes : public ValidationObject {
 
     void CreateQueue(VkQueue vkObj);
     void AllocateCommandBuffer(const VkCommandPool command_pool, const VkCommandBuffer command_buffer, VkCommandBufferLevel level);
-    void AllocateDescriptorSet(VkDescriptorPool descriptor_pool, VkDescriptorSet descriptor_set);
+    void AllocateDescriptorSets(VkDescriptorPool descriptor_pool, uint32_t count, const VkDescriptorSet *descriptor_sets);
+    void FreeDescriptorSets(uint32_t count, const uint64_t *descriptor_sets);
     void CreateSwapchainImageObject(VkImage swapchain_image, VkSwapchainKHR swapchain);
+    void LinkToParent(VulkanObjectType parent_type, uint64_t parent_handle, ObjTrackState *child);
     void DestroyLeakedInstanceObjects();
     void DestroyLeakedDeviceObjects();
     bool ValidateDeviceObject(const VulkanTypedHandle &device_typed, const char *invalid_handle_code,
@@ -189,17 +332,14 @@ class ObjectLifetimes : public ValidationObject {
         uint64_t object_handle = HandleToUint64(object);
         bool custom_allocator = (pAllocator != nullptr);
         if (!object_map[object_type].contains(object_handle)) {
-            auto pNewObjNode = std::make_shared<ObjTrackState>();
+            auto pNewObjNode = NewObjTrackState(object_type);
             pNewObjNode->object_type = object_type;
             pNewObjNode->status = custom_allocator ? OBJSTATUS_CUSTOM_ALLOCATOR : OBJSTATUS_NONE;
             pNewObjNode->handle = object_handle;
 
-            InsertObject(object_map[object_type], object_handle, object_type, pNewObjNode);
-            num_objects[object_type]++;
-            num_total_objects++;
-
-            if (object_type == kVulkanObjectTypeDescriptorPool) {
-                pNewObjNode->child_objects.reset(new std::unordered_set<uint64_t>);
+            if (InsertObject(object_map[object_type], object_handle, object_type, pNewObjNode)) {
+                num_objects[object_type]++;
+                num_total_objects++;
             }
         }
     }
@@ -221,12 +361,19 @@ class ObjectLifetimes : public ValidationObject {
                     object_string[object_type], object_handle);
             return;
         }
-        assert(num_total_objects > 0);
+        ReleaseObject(item->second.get());
+    }
 
+    // Drop the counts and links of a node that has been removed from object_map. Its block goes back to the slab once the
+    // last reference to it is released.
+    void ReleaseObject(ObjTrackState *node) {
+        assert(num_total_objects > 0);
         num_total_objects--;
-        assert(num_objects[item->second->object_type] > 0);
+        assert(num_objects[node->object_type] > 0);
+        num_objects[node->object_type]--;
 
-        num_objects[item->second->object_type]--;
+        node->UnlinkFromParent();
+        node->OrphanChildren();
     }
 
     template <typename T1>
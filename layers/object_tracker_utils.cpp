@@ -39,12 +39,10 @@ void ObjectLifetimes::DestroyQueueDataStructures() {
     // Destroy the items in the queue map
     auto snapshot = object_map[kVulkanObjectTypeQueue].snapshot();
     for (const auto &queue : snapshot) {
-        uint32_t obj_index = queue.second->object_type;
-        assert(num_total_objects > 0);
-        num_total_objects--;
-        assert(num_objects[obj_index] > 0);
-        num_objects[obj_index]--;
-        object_map[kVulkanObjectTypeQueue].erase(queue.first);
+        auto item = object_map[kVulkanObjectTypeQueue].pop(queue.first);
+        if (item != object_map[kVulkanObjectTypeQueue].end()) {
+            ReleaseObject(item->second.get());
+        }
     }
 }
 
@@ -82,9 +80,18 @@ bool ObjectLifetimes::ValidateAnonymousObject(uint64_t object_handle, VkObjectTy
     return CheckObjectValidity(object_handle, object_type, null_allowed, invalid_handle_code, wrong_device_code);
 }
 
+// Link a newly tracked child into its parent's child list. The parent handle has already been validated, but it may still be
+// missing from the map if the application ignored the resulting error.
+void ObjectLifetimes::LinkToParent(VulkanObjectType parent_type, uint64_t parent_handle, ObjTrackState *child) {
+    auto itr = object_map[parent_type].find(parent_handle);
+    if (itr != object_map[parent_type].end()) {
+        itr->second->LinkChild(child);
+    }
+}
+
 void ObjectLifetimes::AllocateCommandBuffer(const VkCommandPool command_pool, const VkCommandBuffer command_buffer,
                                             VkCommandBufferLevel level) {
-    auto pNewObjNode = std::make_shared<ObjTrackState>();
+    auto pNewObjNode = NewObjTrackState(kVulkanObjectTypeCommandBuffer);
     pNewObjNode->object_type = kVulkanObjectTypeCommandBuffer;
     pNewObjNode->handle = HandleToUint64(command_buffer);
     pNewObjNode->parent_object = HandleToUint64(command_pool);
@@ -93,10 +100,12 @@ void ObjectLifetimes::AllocateCommandBuffer(const VkCommandPool command_pool, co
     } else {
         pNewObjNode->status = OBJSTATUS_NONE;
     }
-    InsertObject(object_map[kVulkanObjectTypeCommandBuffer], HandleToUint64(command_buffer), kVulkanObjectTypeCommandBuffer,
-                 pNewObjNode);
-    num_objects[kVulkanObjectTypeCommandBuffer]++;
-    num_total_objects++;
+    if (InsertObject(object_map[kVulkanObjectTypeCommandBuffer], HandleToUint64(command_buffer), kVulkanObjectTypeCommandBuffer,
+                     pNewObjNode)) {
+        num_objects[kVulkanObjectTypeCommandBuffer]++;
+        num_total_objects++;
+        LinkToParent(kVulkanObjectTypeCommandPool, HandleToUint64(command_pool), pNewObjNode.get());
+    }
 }
 
 bool ObjectLifetimes::ValidateCommandBuffer(VkCommandPool command_pool, VkCommandBuffer command_buffer) const {
@@ -123,20 +132,58 @@ bool ObjectLifetimes::ValidateCommandBuffer(VkCommandPool command_pool, VkComman
     return skip;
 }
 
-void ObjectLifetimes::AllocateDescriptorSet(VkDescriptorPool descriptor_pool, VkDescriptorSet descriptor_set) {
-    auto pNewObjNode = std::make_shared<ObjTrackState>();
-    pNewObjNode->object_type = kVulkanObjectTypeDescriptorSet;
-    pNewObjNode->status = OBJSTATUS_NONE;
-    pNewObjNode->handle = HandleToUint64(descriptor_set);
-    pNewObjNode->parent_object = HandleToUint64(descriptor_pool);
-    InsertObject(object_map[kVulkanObjectTypeDescriptorSet], HandleToUint64(descriptor_set), kVulkanObjectTypeDescriptorSet,
-                 pNewObjNode);
-    num_objects[kVulkanObjectTypeDescriptorSet]++;
-    num_total_objects++;
+// Descriptor sets are allocated and freed in bulk, so their nodes go into the map as one batch, taking each map bucket's lock
+// once per call rather than once per set.
+void ObjectLifetimes::AllocateDescriptorSets(VkDescriptorPool descriptor_pool, uint32_t count,
+                                             const VkDescriptorSet *descriptor_sets) {
+    std::vector<std::pair<uint64_t, std::shared_ptr<ObjTrackState>>> elements(count);
+    for (uint32_t i = 0; i < count; i++) {
+        auto pNewObjNode = NewObjTrackState(kVulkanObjectTypeDescriptorSet);
+        pNewObjNode->object_type = kVulkanObjectTypeDescriptorSet;
+        pNewObjNode->status = OBJSTATUS_NONE;
+        pNewObjNode->handle = HandleToUint64(descriptor_sets[i]);
+        pNewObjNode->parent_object = HandleToUint64(descriptor_pool);
+        elements[i] = std::make_pair(pNewObjNode->handle, std::move(pNewObjNode));
+    }
+
+    std::vector<const ObjTrackState *> rejected;
+    object_map[kVulkanObjectTypeDescriptorSet].insert_batch(
+        elements.data(), elements.size(),
+        [&rejected](const std::pair<uint64_t, std::shared_ptr<ObjTrackState>> &element) {
+            rejected.push_back(element.second.get());
+        });
+    for (auto node : rejected) {
+        ReportInsertRace(node->handle, kVulkanObjectTypeDescriptorSet);
+    }
+
+    const uint64_t inserted = count - rejected.size();
+    num_objects[kVulkanObjectTypeDescriptorSet] += inserted;
+    num_total_objects += inserted;
 
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptor_pool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        itr->second->child_objects->insert(HandleToUint64(descriptor_set));
+        for (const auto &element : elements) {
+            if (std::find(rejected.begin(), rejected.end(), element.second.get()) == rejected.end()) {
+                itr->second->LinkChild(element.second.get());
+            }
+        }
+    }
+}
+
+void ObjectLifetimes::FreeDescriptorSets(uint32_t count, const uint64_t *descriptor_sets) {
+    std::vector<std::shared_ptr<ObjTrackState>> nodes;
+    nodes.reserve(count);
+    object_map[kVulkanObjectTypeDescriptorSet].pop_batch(
+        descriptor_sets, count,
+        [&nodes](std::pair<uint64_t, std::shared_ptr<ObjTrackState>> &element) { nodes.push_back(std::move(element.second)); });
+
+    assert(num_total_objects >= nodes.size());
+    num_total_objects -= nodes.size();
+    assert(num_objects[kVulkanObjectTypeDescriptorSet] >= nodes.size());
+    num_objects[kVulkanObjectTypeDescriptorSet] -= nodes.size();
+
+    for (const auto &node : nodes) {
+        node->UnlinkFromParent();
     }
 }
 
@@ -220,29 +267,30 @@ bool ObjectLifetimes::PreCallValidateCmdPushDescriptorSetKHR(VkCommandBuffer com
 }
 
 void ObjectLifetimes::CreateQueue(VkQueue vkObj) {
-    std::shared_ptr<ObjTrackState> p_obj_node = NULL;
     auto queue_item = object_map[kVulkanObjectTypeQueue].find(HandleToUint64(vkObj));
     if (queue_item == object_map[kVulkanObjectTypeQueue].end()) {
-        p_obj_node = std::make_shared<ObjTrackState>();
-        InsertObject(object_map[kVulkanObjectTypeQueue], HandleToUint64(vkObj), kVulkanObjectTypeQueue, p_obj_node);
-        num_objects[kVulkanObjectTypeQueue]++;
-        num_total_objects++;
-    } else {
-        p_obj_node = queue_item->second;
+        auto p_obj_node = NewObjTrackState(kVulkanObjectTypeQueue);
+        p_obj_node->object_type = kVulkanObjectTypeQueue;
+        p_obj_node->status = OBJSTATUS_NONE;
+        p_obj_node->handle = HandleToUint64(vkObj);
+        if (InsertObject(object_map[kVulkanObjectTypeQueue], HandleToUint64(vkObj), kVulkanObjectTypeQueue, p_obj_node)) {
+            num_objects[kVulkanObjectTypeQueue]++;
+            num_total_objects++;
+        }
     }
-    p_obj_node->object_type = kVulkanObjectTypeQueue;
-    p_obj_node->status = OBJSTATUS_NONE;
-    p_obj_node->handle = HandleToUint64(vkObj);
 }
 
+// Links the image into the swapchain's child list, so the caller must hold object_lifetime_mutex for writing
 void ObjectLifetimes::CreateSwapchainImageObject(VkImage swapchain_image, VkSwapchainKHR swapchain) {
     if (!swapchainImageMap.contains(HandleToUint64(swapchain_image))) {
-        auto pNewObjNode = std::make_shared<ObjTrackState>();
+        auto pNewObjNode = NewObjTrackState(kVulkanObjectTypeImage);
         pNewObjNode->object_type = kVulkanObjectTypeImage;
         pNewObjNode->status = OBJSTATUS_NONE;
         pNewObjNode->handle = HandleToUint64(swapchain_image);
         pNewObjNode->parent_object = HandleToUint64(swapchain);
-        InsertObject(swapchainImageMap, HandleToUint64(swapchain_image), kVulkanObjectTypeImage, pNewObjNode);
+        if (InsertObject(swapchainImageMap, HandleToUint64(swapchain_image), kVulkanObjectTypeImage, pNewObjNode)) {
+            LinkToParent(kVulkanObjectTypeSwapchainKHR, HandleToUint64(swapchain), pNewObjNode.get());
+        }
     }
 }
 
@@ -436,11 +484,10 @@ bool ObjectLifetimes::PreCallValidateResetDescriptorPool(VkDevice device, VkDesc
 
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pPoolNode = itr->second;
-        for (auto set : *pPoolNode->child_objects) {
-            skip |= ValidateDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet, nullptr, kVUIDUndefined,
-                                          kVUIDUndefined);
-        }
+        itr->second->ForEachChild([this, &skip](const ObjTrackState *set) {
+            skip |= ValidateDestroyObject(CastFromUint64<VkDescriptorSet>(set->handle), kVulkanObjectTypeDescriptorSet, nullptr,
+                                          kVUIDUndefined, kVUIDUndefined);
+        });
     }
     return skip;
 }
@@ -452,11 +499,10 @@ void ObjectLifetimes::PreCallRecordResetDescriptorPool(VkDevice device, VkDescri
     // our descriptorSet map.
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pPoolNode = itr->second;
-        for (auto set : *pPoolNode->child_objects) {
-            RecordDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet);
-        }
-        pPoolNode->child_objects->clear();
+        std::vector<uint64_t> sets;
+        itr->second->ForEachChild([&sets](const ObjTrackState *set) { sets.push_back(set->handle); });
+        FreeDescriptorSets(static_cast<uint32_t>(sets.size()), sets.data());
+        assert(itr->second->first_child == nullptr);
     }
 }
 
@@ -628,9 +674,7 @@ void ObjectLifetimes::PostCallRecordAllocateDescriptorSets(VkDevice device, cons
                                                            VkDescriptorSet *pDescriptorSets, VkResult result) {
     if (result != VK_SUCCESS) return;
     auto lock = write_shared_lock();
-    for (uint32_t i = 0; i < pAllocateInfo->descriptorSetCount; i++) {
-        AllocateDescriptorSet(pAllocateInfo->descriptorPool, pDescriptorSets[i]);
-    }
+    AllocateDescriptorSets(pAllocateInfo->descriptorPool, pAllocateInfo->descriptorSetCount, pDescriptorSets);
 }
 
 bool ObjectLifetimes::PreCallValidateFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
@@ -664,13 +708,19 @@ bool ObjectLifetimes::PreCallValidateDestroySwapchainKHR(VkDevice device, VkSwap
 
 void ObjectLifetimes::PreCallRecordDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain,
                                                        const VkAllocationCallbacks *pAllocator) {
-    RecordDestroyObject(swapchain, kVulkanObjectTypeSwapchainKHR);
-
-    auto snapshot = swapchainImageMap.snapshot(
-        [swapchain](std::shared_ptr<ObjTrackState> pNode) { return pNode->parent_object == HandleToUint64(swapchain); });
-    for (const auto &itr : snapshot) {
-        swapchainImageMap.erase(itr.first);
+    // vkGetSwapchainImagesKHR may be linking images into this swapchain on another thread
+    auto lock = write_shared_lock();
+    auto itr = object_map[kVulkanObjectTypeSwapchainKHR].find(HandleToUint64(swapchain));
+    if (itr != object_map[kVulkanObjectTypeSwapchainKHR].end()) {
+        itr->second->ForEachChild([this](ObjTrackState *image) {
+            // Swapchain images are not counted in num_objects, so they are dropped from their map directly. The erase may
+            // release the node, so its handle is copied first.
+            const uint64_t image_handle = image->handle;
+            image->UnlinkFromParent();
+            swapchainImageMap.erase(image_handle);
+        });
     }
+    RecordDestroyObject(swapchain, kVulkanObjectTypeSwapchainKHR);
 }
 
 bool ObjectLifetimes::PreCallValidateFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool,
@@ -692,17 +742,12 @@ bool ObjectLifetimes::PreCallValidateFreeDescriptorSets(VkDevice device, VkDescr
 void ObjectLifetimes::PreCallRecordFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount,
                                                       const VkDescriptorSet *pDescriptorSets) {
     auto lock = write_shared_lock();
-    std::shared_ptr<ObjTrackState> pPoolNode = nullptr;
-    auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
-    if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        pPoolNode = itr->second;
-    }
+    std::vector<uint64_t> sets;
+    sets.reserve(descriptorSetCount);
     for (uint32_t i = 0; i < descriptorSetCount; i++) {
-        RecordDestroyObject(pDescriptorSets[i], kVulkanObjectTypeDescriptorSet);
-        if (pPoolNode) {
-            pPoolNode->child_objects->erase(HandleToUint64(pDescriptorSets[i]));
-        }
+        if (pDescriptorSets[i] != VK_NULL_HANDLE) sets.push_back(HandleToUint64(pDescriptorSets[i]));
     }
+    FreeDescriptorSets(static_cast<uint32_t>(sets.size()), sets.data());
 }
 
 bool ObjectLifetimes::PreCallValidateDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
@@ -716,11 +761,10 @@ bool ObjectLifetimes::PreCallValidateDestroyDescriptorPool(VkDevice device, VkDe
 
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pPoolNode = itr->second;
-        for (auto set : *pPoolNode->child_objects) {
-            skip |= ValidateDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet, nullptr, kVUIDUndefined,
-                                          kVUIDUndefined);
-        }
+        itr->second->ForEachChild([this, &skip](const ObjTrackState *set) {
+            skip |= ValidateDestroyObject(CastFromUint64<VkDescriptorSet>(set->handle), kVulkanObjectTypeDescriptorSet, nullptr,
+                                          kVUIDUndefined, kVUIDUndefined);
+        });
     }
     skip |= ValidateDestroyObject(descriptorPool, kVulkanObjectTypeDescriptorPool, pAllocator,
                                   "VUID-vkDestroyDescriptorPool-descriptorPool-00304",
@@ -732,11 +776,9 @@ void ObjectLifetimes::PreCallRecordDestroyDescriptorPool(VkDevice device, VkDesc
     auto lock = write_shared_lock();
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pPoolNode = itr->second;
-        for (auto set : *pPoolNode->child_objects) {
-            RecordDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet);
-        }
-        pPoolNode->child_objects->clear();
+        std::vector<uint64_t> sets;
+        itr->second->ForEachChild([&sets](const ObjTrackState *set) { sets.push_back(set->handle); });
+        FreeDescriptorSets(static_cast<uint32_t>(sets.size()), sets.data());
     }
     RecordDestroyObject(descriptorPool, kVulkanObjectTypeDescriptorPool);
 }
@@ -748,13 +790,15 @@ bool ObjectLifetimes::PreCallValidateDestroyCommandPool(VkDevice device, VkComma
     skip |= ValidateObject(commandPool, kVulkanObjectTypeCommandPool, true, "VUID-vkDestroyCommandPool-commandPool-parameter",
                            "VUID-vkDestroyCommandPool-commandPool-parent");
 
-    auto snapshot = object_map[kVulkanObjectTypeCommandBuffer].snapshot(
-        [commandPool](std::shared_ptr<ObjTrackState> pNode) { return pNode->parent_object == HandleToUint64(commandPool); });
-    for (const auto &itr : snapshot) {
-        auto pNode = itr.second;
-        skip |= ValidateCommandBuffer(commandPool, reinterpret_cast<VkCommandBuffer>(itr.first));
-        skip |= ValidateDestroyObject(reinterpret_cast<VkCommandBuffer>(itr.first), kVulkanObjectTypeCommandBuffer, nullptr,
-                                      kVUIDUndefined, kVUIDUndefined);
+    auto itr = object_map[kVulkanObjectTypeCommandPool].find(HandleToUint64(commandPool));
+    if (itr != object_map[kVulkanObjectTypeCommandPool].end()) {
+        const ObjTrackState *pool_node = itr->second.get();
+        // Children are linked from the pool itself, so parentage is a pointer comparison rather than a map lookup
+        pool_node->ForEachChild([this, &skip, pool_node](const ObjTrackState *cb_node) {
+            assert(cb_node->parent_node == pool_node);
+            skip |= ValidateDestroyObject(reinterpret_cast<VkCommandBuffer>(cb_node->handle), kVulkanObjectTypeCommandBuffer,
+                                          nullptr, kVUIDUndefined, kVUIDUndefined);
+        });
     }
     skip |= ValidateDestroyObject(commandPool, kVulkanObjectTypeCommandPool, pAllocator,
                                   "VUID-vkDestroyCommandPool-commandPool-00042", "VUID-vkDestroyCommandPool-commandPool-00043");
@@ -763,11 +807,12 @@ bool ObjectLifetimes::PreCallValidateDestroyCommandPool(VkDevice device, VkComma
 
 void ObjectLifetimes::PreCallRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
                                                       const VkAllocationCallbacks *pAllocator) {
-    auto snapshot = object_map[kVulkanObjectTypeCommandBuffer].snapshot(
-        [commandPool](std::shared_ptr<ObjTrackState> pNode) { return pNode->parent_object == HandleToUint64(commandPool); });
     // A CommandPool's cmd buffers are implicitly deleted when pool is deleted. Remove this pool's cmdBuffers from cmd buffer map.
-    for (const auto &itr : snapshot) {
-        RecordDestroyObject(reinterpret_cast<VkCommandBuffer>(itr.first), kVulkanObjectTypeCommandBuffer);
+    auto itr = object_map[kVulkanObjectTypeCommandPool].find(HandleToUint64(commandPool));
+    if (itr != object_map[kVulkanObjectTypeCommandPool].end()) {
+        itr->second->ForEachChild([this](ObjTrackState *cb_node) {
+            DestroyObjectSilently(reinterpret_cast<VkCommandBuffer>(cb_node->handle), kVulkanObjectTypeCommandBuffer);
+        });
     }
     RecordDestroyObject(commandPool, kVulkanObjectTypeCommandPool);
 }
@@ -24,9 +24,12 @@
 #define RANGE_VECTOR_H_
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstdint>
 #include <limits>
 #include <map>
+#include <memory>
 #include <utility>
 
 #define RANGE_ASSERT(b) assert(b)
@@ -141,6 +144,233 @@ struct split_op_keep_upper {
 
 enum class value_precedence { prefer_source, prefer_dest };
 
+// An ordered map on a sorted, contiguous array, for use as the range map "ImplMap" as an alternate to std::map
+//
+// Supports the subset of the std::map interface range_map uses. Lookups are binary searches over contiguous memory, but insert
+// and erase move every later entry, so it suits maps that are searched far more often than they are reshaped.
+//
+// Unlike std::map, insert and erase move entries rather than leaving them in place. Iterators hold an index instead of a
+// pointer, so they stay usable across reallocation, but:
+//     an iterator at the position of an insert refers to the inserted entry (the former entry is the one after it)
+//     an iterator at or past the position of an erase refers to the entry that moved into its place
+//     end() iterators stay at end(), however the map changes
+template <typename Key, typename T>
+class sorted_vector_map {
+  public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const key_type, mapped_type>;
+    using size_type = size_t;
+
+    template <typename Map_, typename Value_>
+    struct IteratorImpl {
+      public:
+        using Map = Map_;
+        using Value = Value_;
+        friend sorted_vector_map;
+        Value *operator->() const { return map_->data() + pos_; }
+        Value &operator*() const { return map_->data()[pos_]; }
+        IteratorImpl &operator++() {
+            ++pos_;
+            if (pos_ >= map_->size_) pos_ = kEnd;  // Keep end sticky, so that later inserts can't move it
+            return *this;
+        }
+        IteratorImpl &operator--() {
+            pos_ = at_end() ? map_->size_ - 1 : pos_ - 1;
+            return *this;
+        }
+        bool operator==(const IteratorImpl &other) const {
+            if (at_end() && other.at_end()) {
+                return true;  // all ends are equal
+            }
+            return (map_ == other.map_) && (pos_ == other.pos_);
+        }
+        bool operator!=(const IteratorImpl &other) const { return !(*this == other); }
+
+        // At end()
+        IteratorImpl() : map_(nullptr), pos_(kEnd) {}
+
+        // Raw getters to allow for const_iterator conversion below
+        Map *get_map() const { return map_; }
+        size_type get_pos() const { return pos_; }
+
+        bool at_end() const { return (map_ == nullptr) || (pos_ >= map_->size_); }
+
+      protected:
+        IteratorImpl(Map *map, size_type pos) : map_(map), pos_(pos) {}
+
+      private:
+        Map *map_;
+        size_type pos_;
+    };
+    using iterator = IteratorImpl<sorted_vector_map, value_type>;
+
+    // The const iterator must be derived to allow the conversion from iterator, which iterator doesn't support
+    class const_iterator : public IteratorImpl<const sorted_vector_map, const value_type> {
+        using Base = IteratorImpl<const sorted_vector_map, const value_type>;
+        friend sorted_vector_map;
+
+      public:
+        const_iterator(const iterator &it) : Base(it.get_map(), it.get_pos()) {}
+        const_iterator() : Base() {}
+
+      private:
+        const_iterator(const sorted_vector_map *map, size_type pos) : Base(map, pos) {}
+    };
+
+    iterator begin() { return make_iterator(0); }
+    const_iterator cbegin() const { return make_iterator(0); }
+    const_iterator begin() const { return cbegin(); }
+    iterator end() { return iterator(this, kEnd); }
+    const_iterator cend() const { return const_iterator(this, kEnd); }
+    const_iterator end() const { return cend(); }
+
+    size_type size() const { return size_; }
+    bool empty() const { return 0 == size_; }
+
+    void clear() {
+        for (size_type i = 0; i < size_; ++i) {
+            data()[i].~value_type();
+        }
+        size_ = 0;
+    }
+
+    iterator lower_bound(const key_type &key) { return make_iterator(lower_bound_index(key)); }
+    const_iterator lower_bound(const key_type &key) const { return make_iterator(lower_bound_index(key)); }
+    iterator upper_bound(const key_type &key) { return make_iterator(upper_bound_index(key)); }
+    const_iterator upper_bound(const key_type &key) const { return make_iterator(upper_bound_index(key)); }
+
+    // Find entry with an exact key match
+    iterator find(const key_type &key) { return make_iterator(find_index(key)); }
+    const_iterator find(const key_type &key) const { return make_iterator(find_index(key)); }
+
+    iterator erase(const const_iterator &pos) {
+        RANGE_ASSERT(!pos.at_end());
+        return erase_impl(pos.get_pos());
+    }
+    iterator erase(const iterator &pos) {
+        RANGE_ASSERT(!pos.at_end());
+        return erase_impl(pos.get_pos());
+    }
+
+    // The hint is used when it is the correct insertion point, which is the common case in range_map, else we search
+    template <typename Value>
+    iterator emplace_hint(const const_iterator &hint, Value &&value) {
+        value_type entry(std::forward<Value>(value));  // before moving anything, value could refer to an entry
+        return emplace_impl(insert_index(hint.get_pos(), entry.first), std::move(entry));
+    }
+    template <typename Value>
+    iterator emplace_hint(const iterator &hint, Value &&value) {
+        return emplace_hint(const_iterator(hint), std::forward<Value>(value));
+    }
+    iterator insert(const const_iterator &hint, const value_type &value) { return emplace_hint(hint, value); }
+    iterator insert(const iterator &hint, const value_type &value) { return emplace_hint(const_iterator(hint), value); }
+
+    sorted_vector_map() : size_(0), capacity_(0) {}
+    sorted_vector_map(const sorted_vector_map &other) : size_(0), capacity_(0) {
+        reserve(other.size_);
+        for (size_type i = 0; i < other.size_; ++i) {
+            new (data() + i) value_type(other.data()[i]);
+            ++size_;
+        }
+    }
+    sorted_vector_map(sorted_vector_map &&other) : store_(std::move(other.store_)), size_(other.size_), capacity_(other.capacity_) {
+        other.size_ = 0;
+        other.capacity_ = 0;
+    }
+    sorted_vector_map &operator=(sorted_vector_map other) {
+        clear();
+        store_ = std::move(other.store_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+        return *this;
+    }
+    ~sorted_vector_map() { clear(); }
+
+  private:
+    static const size_type kEnd = std::numeric_limits<size_type>::max();
+    static const size_type kInitialCapacity = 16;
+
+    // Used for placement new of value_type, which having a const key can't be assigned
+    struct alignas(alignof(value_type)) BackingStore {
+        uint8_t data[sizeof(value_type)];
+    };
+
+    value_type *data() { return reinterpret_cast<value_type *>(store_.get()); }
+    const value_type *data() const { return reinterpret_cast<const value_type *>(store_.get()); }
+
+    iterator make_iterator(size_type pos) { return iterator(this, pos < size_ ? pos : kEnd); }
+    const_iterator make_iterator(size_type pos) const { return const_iterator(this, pos < size_ ? pos : kEnd); }
+
+    size_type lower_bound_index(const key_type &key) const {
+        const auto *found = std::lower_bound(data(), data() + size_, key,
+                                             [](const value_type &entry, const key_type &k) { return entry.first < k; });
+        return static_cast<size_type>(found - data());
+    }
+    size_type upper_bound_index(const key_type &key) const {
+        const auto *found = std::upper_bound(data(), data() + size_, key,
+                                             [](const key_type &k, const value_type &entry) { return k < entry.first; });
+        return static_cast<size_type>(found - data());
+    }
+    size_type find_index(const key_type &key) const {
+        const size_type pos = lower_bound_index(key);
+        return ((pos < size_) && !(key < data()[pos].first)) ? pos : kEnd;
+    }
+    size_type insert_index(size_type hint, const key_type &key) const {
+        if (hint > size_) hint = size_;
+        const bool after_prev = (hint == 0) || (data()[hint - 1].first < key);
+        const bool before_next = (hint == size_) || (key < data()[hint].first);
+        return (after_prev && before_next) ? hint : lower_bound_index(key);
+    }
+
+    void reserve(size_type capacity) {
+        if (capacity <= capacity_) return;
+        std::unique_ptr<BackingStore[]> store(new BackingStore[capacity]);
+        value_type *moved = reinterpret_cast<value_type *>(store.get());
+        for (size_type i = 0; i < size_; ++i) {
+            new (moved + i) value_type(std::move(data()[i]));
+            data()[i].~value_type();
+        }
+        store_ = std::move(store);
+        capacity_ = capacity;
+    }
+
+    iterator emplace_impl(size_type pos, value_type &&entry) {
+        if (size_ == capacity_) reserve(capacity_ ? 2 * capacity_ : kInitialCapacity);
+        value_type *values = data();
+        // Open a slot at pos by moving each later entry up one, from the back
+        for (size_type i = size_; i > pos; --i) {
+            new (values + i) value_type(std::move(values[i - 1]));
+            values[i - 1].~value_type();
+        }
+        new (values + pos) value_type(std::move(entry));
+        ++size_;
+        return iterator(this, pos);
+    }
+
+    iterator erase_impl(size_type pos) {
+        RANGE_ASSERT(pos < size_);
+        value_type *values = data();
+        values[pos].~value_type();
+        // Close the slot at pos by moving each later entry down one
+        for (size_type i = pos + 1; i < size_; ++i) {
+            new (values + i - 1) value_type(std::move(values[i]));
+            values[i].~value_type();
+        }
+        --size_;
+        return make_iterator(pos);
+    }
+
+    std::unique_ptr<BackingStore[]> store_;
+    size_type size_;
+    size_type capacity_;
+};
+
+template <typename Key, typename T>
+const typename sorted_vector_map<Key, T>::size_type sorted_vector_map<Key, T>::kEnd;
+template <typename Key, typename T>
+const typename sorted_vector_map<Key, T>::size_type sorted_vector_map<Key, T>::kInitialCapacity;
+
 // The range based sparse map implemented on the ImplMap
 template <typename Key, typename T, typename RangeKey = range<Key>, typename ImplMap = std::map<RangeKey, T>>
 class range_map {
@@ -367,8 +597,13 @@ class range_map {
         auto current = lower;
         const auto first_begin = current->first.begin;
         if (bounds.begin > first_begin) {
-            // Preserve the portion of lower bound excluded from bounds
-            current = split_impl(current, bounds.begin, split_op_keep_lower());
+            // Preserve the portion of lower bound excluded from bounds. When lower bound also extends past the end of bounds,
+            // keep the upper portion too, for the snip below to preserve the part past the end.
+            if (current->first.end > bounds.end) {
+                current = split_impl(current, bounds.begin, split_op_keep_both());
+            } else {
+                current = split_impl(current, bounds.begin, split_op_keep_lower());
+            }
             // Exclude the preserved portion
             ++current;
             RANGE_ASSERT(current == lower_bound_impl(bounds));
@@ -631,6 +866,10 @@ class range_map {
     const ImplMap &get_implementation_map() const { return impl_map_; }
 };
 
+// range_map on the sorted_vector_map, for range maps that are searched more often than they are changed
+template <typename Key, typename T, typename RangeKey = range<Key>>
+using flat_range_map = range_map<Key, T, RangeKey, sorted_vector_map<RangeKey, T>>;
+
 template <typename Container>
 using const_correct_iterator = decltype(std::declval<Container>().begin());
 
@@ -1659,7 +1898,9 @@ bool update_range_value(Map &map, const Range &range, MapValue &&value, value_pr
     while (range.includes(pos->index)) {
         if (!pos->valid) {
             if (precedence == value_precedence::prefer_source) {
-                // We can convert this into and overwrite...
+                // We can convert this into and overwrite... which needs the lower bound of the whole range, and we may have
+                // skipped past entries already holding value
+                pos.seek(range.begin);
                 map.overwrite_range(pos->lower_bound, std::make_pair(range, std::forward<MapValue>(value)));
                 return true;
             }
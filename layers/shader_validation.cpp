@@ -21,6 +21,7 @@
 
 #include "shader_validation.h"
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <cinttypes>
@@ -93,8 +94,6 @@ enum FORMAT_TYPE {
     FORMAT_TYPE_UINT = 4,
 };
 
-typedef std::pair<unsigned, unsigned> location_t;
-
 struct shader_stage_attributes {
     char const *const name;
     bool arrayed_input;
@@ -112,8 +111,35 @@ static shader_stage_attributes shader_stage_attribs[] = {
 
 unsigned ExecutionModelToShaderStageFlagBits(unsigned mode);
 
+// SPIR-V's universal limit on the id bound; a larger bound in the header is not trusted for sizing the id tables
+static const uint32_t kMaxIdBound = 0x3FFFFF;
+
 // SPIRV utility functions
 void SHADER_MODULE_STATE::BuildDefIndex() {
+    // Start with room for every id the header declares, clamped to what a module of this size can define, and grow up to the
+    // declared bound if the ids turn out to be sparse. Ids outside the bound are invalid SPIR-V and left undefined.
+    const uint32_t bound = std::min(words.size() > 3 ? words[3] : 0u, kMaxIdBound);
+    def_index.assign(std::min<size_t>(bound, words.size()), 0);
+    decoration_index.assign(def_index.size(), 0);
+    auto in_bound = [this, bound](uint32_t id) {
+        if (id >= bound) return false;
+        if (id >= def_index.size()) {
+            def_index.resize(id + 1, 0);
+            decoration_index.resize(id + 1, 0);
+        }
+        return true;
+    };
+    auto add_def = [this, &in_bound](uint32_t id, uint32_t offset) {
+        if (in_bound(id)) def_index[id] = offset;
+    };
+    auto decorations_of = [this](uint32_t id) -> decoration_set & {
+        if (decoration_index[id] == 0) {
+            decoration_index[id] = static_cast<uint32_t>(decoration_sets.size());
+            decoration_sets.emplace_back();
+        }
+        return decoration_sets[decoration_index[id]];
+    };
+
     for (auto insn : *this) {
         switch (insn.opcode()) {
             // Types
@@ -139,7 +165,7 @@ void SHADER_MODULE_STATE::BuildDefIndex() {
             case spv::OpTypePipe:
             case spv::OpTypeAccelerationStructureNV:
             case spv::OpTypeCooperativeMatrixNV:
-                def_index[insn.word(1)] = insn.offset();
+                add_def(insn.word(1), insn.offset());
                 break;
 
                 // Fixed constants
@@ -149,7 +175,7 @@ void SHADER_MODULE_STATE::BuildDefIndex() {
             case spv::OpConstantComposite:
             case spv::OpConstantSampler:
             case spv::OpConstantNull:
-                def_index[insn.word(2)] = insn.offset();
+                add_def(insn.word(2), insn.offset());
                 break;
 
                 // Specialization constants
@@ -158,27 +184,30 @@ void SHADER_MODULE_STATE::BuildDefIndex() {
             case spv::OpSpecConstant:
             case spv::OpSpecConstantComposite:
             case spv::OpSpecConstantOp:
-                def_index[insn.word(2)] = insn.offset();
+                add_def(insn.word(2), insn.offset());
                 break;
 
                 // Variables
             case spv::OpVariable:
-                def_index[insn.word(2)] = insn.offset();
+                add_def(insn.word(2), insn.offset());
                 break;
 
                 // Functions
             case spv::OpFunction:
-                def_index[insn.word(2)] = insn.offset();
+                add_def(insn.word(2), insn.offset());
                 break;
 
                 // Decorations
             case spv::OpDecorate: {
                 auto targetId = insn.word(1);
-                decorations[targetId].add(insn.word(2), insn.len() > 3u ? insn.word(3) : 0u);
+                if (in_bound(targetId)) decorations_of(targetId).add(insn.word(2), insn.len() > 3u ? insn.word(3) : 0u);
             } break;
             case spv::OpGroupDecorate: {
-                auto const &src = decorations[insn.word(1)];
-                for (auto i = 2u; i < insn.len(); i++) decorations[insn.word(i)].merge(src);
+                // Copied, as adding decorations for the targets may reallocate decoration_sets
+                auto const src = get_decorations(insn.word(1));
+                for (auto i = 2u; i < insn.len(); i++) {
+                    if (in_bound(insn.word(i))) decorations_of(insn.word(i)).merge(src);
+                }
             } break;
 
                 // Entry points ... add to the entrypoint table
@@ -187,7 +216,7 @@ void SHADER_MODULE_STATE::BuildDefIndex() {
                 auto entrypoint_name = (char const *)&insn.word(3);
                 auto execution_model = insn.word(1);
                 auto entrypoint_stage = ExecutionModelToShaderStageFlagBits(execution_model);
-                entry_points.emplace(entrypoint_name, EntryPoint{insn.offset(), entrypoint_stage});
+                entry_points.emplace(entrypoint_name, EntryPoint{insn.offset(), entrypoint_stage, {}});
                 break;
             }
 
@@ -196,6 +225,11 @@ void SHADER_MODULE_STATE::BuildDefIndex() {
                 break;
         }
     }
+
+    // Every pipeline using an entrypoint needs its reachable ids, so walk each static call tree once, here
+    for (auto &entry_point : entry_points) {
+        entry_point.second.accessible_ids = MarkAccessibleIds(this, at(entry_point.second.offset));
+    }
 }
 
 unsigned ExecutionModelToShaderStageFlagBits(unsigned mode) {
@@ -233,14 +267,19 @@ unsigned ExecutionModelToShaderStageFlagBits(unsigned mode) {
     }
 }
 
-spirv_inst_iter FindEntrypoint(SHADER_MODULE_STATE const *src, char const *name, VkShaderStageFlagBits stageBits) {
-    auto range = src->entry_points.equal_range(name);
+SHADER_MODULE_STATE::EntryPoint const *SHADER_MODULE_STATE::GetEntryPoint(char const *name, VkShaderStageFlagBits stageBits) const {
+    auto range = entry_points.equal_range(name);
     for (auto it = range.first; it != range.second; ++it) {
         if (it->second.stage == stageBits) {
-            return src->at(it->second.offset);
+            return &it->second;
         }
     }
-    return src->end();
+    return nullptr;
+}
+
+spirv_inst_iter FindEntrypoint(SHADER_MODULE_STATE const *src, char const *name, VkShaderStageFlagBits stageBits) {
+    auto entry_point = src->GetEntryPoint(name, stageBits);
+    return entry_point ? src->at(entry_point->offset) : src->end();
 }
 
 static char const *StorageClassName(unsigned sc) {
@@ -700,8 +739,8 @@ static std::map<location_t, interface_var> CollectInterfaceByLocation(SHADER_MOD
 
     for (uint32_t iid : FindEntrypointInterfaces(entrypoint)) {
         auto insn = src->get_def(iid);
-        assert(insn != src->end());
-        assert(insn.opcode() == spv::OpVariable);
+        // Interface ids must be variables; skip anything else rather than trust invalid SPIR-V
+        if (insn == src->end() || insn.opcode() != spv::OpVariable) continue;
 
         if (insn.word(3) == static_cast<uint32_t>(sinterface)) {
             auto d = src->get_decorations(iid);
@@ -779,8 +818,7 @@ static std::vector<uint32_t> CollectBuiltinBlockMembers(SHADER_MODULE_STATE cons
     // Find all interface variables belonging to the entrypoint and matching the storage class
     for (uint32_t id : FindEntrypointInterfaces(entrypoint)) {
         auto def = src->get_def(id);
-        assert(def != src->end());
-        assert(def.opcode() == spv::OpVariable);
+        if (def == src->end() || def.opcode() != spv::OpVariable) continue;
 
         if (def.word(3) == storageClass) variables.push_back(def.word(1));
     }
@@ -817,7 +855,7 @@ static std::vector<uint32_t> CollectBuiltinBlockMembers(SHADER_MODULE_STATE cons
 }
 
 static std::vector<std::pair<uint32_t, interface_var>> CollectInterfaceByInputAttachmentIndex(
-    SHADER_MODULE_STATE const *src, std::unordered_set<uint32_t> const &accessible_ids) {
+    SHADER_MODULE_STATE const *src, std::vector<uint32_t> const &accessible_ids) {
     std::vector<std::pair<uint32_t, interface_var>> out;
 
     for (auto insn : *src) {
@@ -826,7 +864,7 @@ static std::vector<std::pair<uint32_t, interface_var>> CollectInterfaceByInputAt
                 auto attachment_index = insn.word(3);
                 auto id = insn.word(1);
 
-                if (accessible_ids.count(id)) {
+                if (std::binary_search(accessible_ids.begin(), accessible_ids.end(), id)) {
                     auto def = src->get_def(id);
                     assert(def != src->end());
 
@@ -887,8 +925,7 @@ static bool IsWritableDescriptorType(SHADER_MODULE_STATE const *module, uint32_t
 }
 
 std::vector<std::pair<descriptor_slot_t, interface_var>> CollectInterfaceByDescriptorSlot(
-    debug_report_data const *report_data, SHADER_MODULE_STATE const *src, std::unordered_set<uint32_t> const &accessible_ids,
-    bool *has_writable_descriptor) {
+    SHADER_MODULE_STATE const *src, std::vector<uint32_t> const &accessible_ids, bool *has_writable_descriptor) {
     std::vector<std::pair<descriptor_slot_t, interface_var>> out;
 
     for (auto id : accessible_ids) {
@@ -940,10 +977,10 @@ static bool ValidateViConsistency(debug_report_data const *report_data, VkPipeli
 }
 
 static bool ValidateViAgainstVsInputs(debug_report_data const *report_data, VkPipelineVertexInputStateCreateInfo const *vi,
-                                      SHADER_MODULE_STATE const *vs, spirv_inst_iter entrypoint) {
+                                      SHADER_MODULE_STATE const *vs, entrypoint_analysis const &analysis) {
     bool skip = false;
 
-    const auto inputs = CollectInterfaceByLocation(vs, entrypoint, spv::StorageClassInput, false);
+    const auto &inputs = analysis.inputs;
 
     // Build index by location
     std::map<uint32_t, const VkVertexInputAttributeDescription *> attribs;
@@ -997,7 +1034,8 @@ static bool ValidateViAgainstVsInputs(debug_report_data const *report_data, VkPi
 }
 
 static bool ValidateFsOutputsAgainstRenderPass(debug_report_data const *report_data, SHADER_MODULE_STATE const *fs,
-                                               spirv_inst_iter entrypoint, PIPELINE_STATE const *pipeline, uint32_t subpass_index) {
+                                               entrypoint_analysis const &analysis, PIPELINE_STATE const *pipeline,
+                                               uint32_t subpass_index) {
     bool skip = false;
 
     const auto rpci = pipeline->rp_state->createInfo.ptr();
@@ -1021,8 +1059,7 @@ static bool ValidateFsOutputsAgainstRenderPass(debug_report_data const *report_d
 
     // TODO: dual source blend index (spv::DecIndex, zero if not provided)
 
-    const auto outputs = CollectInterfaceByLocation(fs, entrypoint, spv::StorageClassOutput, false);
-    for (const auto &output_it : outputs) {
+    for (const auto &output_it : analysis.outputs) {
         auto const location = output_it.first.first;
         location_map[location].output = &output_it.second;
     }
@@ -1040,7 +1077,7 @@ static bool ValidateFsOutputsAgainstRenderPass(debug_report_data const *report_d
         const auto attachment = location_it.second.attachment;
         const auto output = location_it.second.output;
         if (attachment && !output) {
-            if (pipeline->attachments[location].colorWriteMask != 0) {
+            if (pipeline->color_blend->attachments[location].colorWriteMask != 0) {
                 skip |=
                     log_msg(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_SHADER_MODULE_EXT,
                             HandleToUint64(fs->vk_shader_module), kVUID_Core_Shader_InputNotProduced,
@@ -1165,15 +1202,15 @@ static bool IsPointSizeWritten(SHADER_MODULE_STATE const *src, spirv_inst_iter b
 //
 // TODO: The set of interesting opcodes here was determined by eyeballing the SPIRV spec. It might be worth
 // converting parts of this to be generated from the machine-readable spec instead.
-std::unordered_set<uint32_t> MarkAccessibleIds(SHADER_MODULE_STATE const *src, spirv_inst_iter entrypoint) {
-    std::unordered_set<uint32_t> ids;
-    std::unordered_set<uint32_t> worklist;
-    worklist.insert(entrypoint.word(2));
+std::vector<uint32_t> MarkAccessibleIds(SHADER_MODULE_STATE const *src, spirv_inst_iter entrypoint) {
+    std::vector<uint32_t> ids;
+    std::vector<bool> seen(src->def_index.size());
+    std::vector<uint32_t> worklist;
+    worklist.push_back(entrypoint.word(2));
 
     while (!worklist.empty()) {
-        auto id_iter = worklist.begin();
-        auto id = *id_iter;
-        worklist.erase(id_iter);
+        auto id = worklist.back();
+        worklist.pop_back();
 
         auto insn = src->get_def(id);
         if (insn == src->end()) {
@@ -1182,15 +1219,17 @@ std::unordered_set<uint32_t> MarkAccessibleIds(SHADER_MODULE_STATE const *src, s
             continue;
         }
 
-        // Try to add to the output set
-        if (!ids.insert(id).second) {
+        // Try to add to the output set; get_def() found it, so id is within def_index
+        if (seen[id]) {
             continue;  // If we already saw this id, we don't want to walk it again.
         }
+        seen[id] = true;
+        ids.push_back(id);
 
         switch (insn.opcode()) {
             case spv::OpFunction:
                 // Scan whole body of the function, enlisting anything interesting
-                while (++insn, insn.opcode() != spv::OpFunctionEnd) {
+                while (++insn, insn != src->end() && insn.opcode() != spv::OpFunctionEnd) {
                     switch (insn.opcode()) {
                         case spv::OpLoad:
                         case spv::OpAtomicLoad:
@@ -1208,15 +1247,15 @@ std::unordered_set<uint32_t> MarkAccessibleIds(SHADER_MODULE_STATE const *src, s
                         case spv::OpAtomicAnd:
                         case spv::OpAtomicOr:
                         case spv::OpAtomicXor:
-                            worklist.insert(insn.word(3));  // ptr
+                            worklist.push_back(insn.word(3));  // ptr
                             break;
                         case spv::OpStore:
                         case spv::OpAtomicStore:
-                            worklist.insert(insn.word(1));  // ptr
+                            worklist.push_back(insn.word(1));  // ptr
                             break;
                         case spv::OpAccessChain:
                         case spv::OpInBoundsAccessChain:
-                            worklist.insert(insn.word(3));  // base ptr
+                            worklist.push_back(insn.word(3));  // base ptr
                             break;
                         case spv::OpSampledImage:
                         case spv::OpImageSampleImplicitLod:
@@ -1251,20 +1290,20 @@ std::unordered_set<uint32_t> MarkAccessibleIds(SHADER_MODULE_STATE const *src, s
                         case spv::OpImageSparseGather:
                         case spv::OpImageSparseDrefGather:
                         case spv::OpImageTexelPointer:
-                            worklist.insert(insn.word(3));  // Image or sampled image
+                            worklist.push_back(insn.word(3));  // Image or sampled image
                             break;
                         case spv::OpImageWrite:
-                            worklist.insert(insn.word(1));  // Image -- different operand order to above
+                            worklist.push_back(insn.word(1));  // Image -- different operand order to above
                             break;
                         case spv::OpFunctionCall:
                             for (uint32_t i = 3; i < insn.len(); i++) {
-                                worklist.insert(insn.word(i));  // fn itself, and all args
+                                worklist.push_back(insn.word(i));  // fn itself, and all args
                             }
                             break;
 
                         case spv::OpExtInst:
                             for (uint32_t i = 5; i < insn.len(); i++) {
-                                worklist.insert(insn.word(i));  // Operands to ext inst
+                                worklist.push_back(insn.word(i));  // Operands to ext inst
                             }
                             break;
                     }
@@ -1273,59 +1312,33 @@ std::unordered_set<uint32_t> MarkAccessibleIds(SHADER_MODULE_STATE const *src, s
         }
     }
 
+    std::sort(ids.begin(), ids.end());
     return ids;
 }
 
-static bool ValidatePushConstantBlockAgainstPipeline(debug_report_data const *report_data,
-                                                     std::vector<VkPushConstantRange> const *push_constant_ranges,
-                                                     SHADER_MODULE_STATE const *src, spirv_inst_iter type,
-                                                     VkShaderStageFlagBits stage) {
+// Validate directly off the offsets. this isn't quite correct for arrays and matrices, but is a good first step.
+// TODO: arrays, matrices, weird sizes
+static bool ValidatePushConstantUsage(debug_report_data const *report_data,
+                                      std::vector<VkPushConstantRange> const *push_constant_ranges,
+                                      entrypoint_analysis const &analysis, VkShaderStageFlagBits stage) {
     bool skip = false;
 
-    // Strip off ptrs etc
-    type = GetStructType(src, type, false);
-    assert(type != src->end());
-
-    // Validate directly off the offsets. this isn't quite correct for arrays and matrices, but is a good first step.
-    // TODO: arrays, matrices, weird sizes
-    for (auto insn : *src) {
-        if (insn.opcode() == spv::OpMemberDecorate && insn.word(1) == type.word(1)) {
-            if (insn.word(3) == spv::DecorationOffset) {
-                unsigned offset = insn.word(4);
-                auto size = 4;  // Bytes; TODO: calculate this based on the type
-
-                bool found_range = false;
-                for (auto const &range : *push_constant_ranges) {
-                    if ((range.offset <= offset) && ((range.offset + range.size) >= (offset + size)) &&
-                        (range.stageFlags & stage)) {
-                        found_range = true;
+    for (auto offset : analysis.push_constant_offsets) {
+        auto size = 4;  // Bytes; TODO: calculate this based on the type
 
-                        break;
-                    }
-                }
+        bool found_range = false;
+        for (auto const &range : *push_constant_ranges) {
+            if ((range.offset <= offset) && ((range.offset + range.size) >= (offset + size)) && (range.stageFlags & stage)) {
+                found_range = true;
 
-                if (!found_range) {
-                    skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                                    kVUID_Core_Shader_PushConstantOutOfRange,
-                                    "Push constant range covering variable starting at offset %u not declared in layout", offset);
-                }
+                break;
             }
         }
-    }
-
-    return skip;
-}
-
-static bool ValidatePushConstantUsage(debug_report_data const *report_data,
-                                      std::vector<VkPushConstantRange> const *push_constant_ranges, SHADER_MODULE_STATE const *src,
-                                      std::unordered_set<uint32_t> accessible_ids, VkShaderStageFlagBits stage) {
-    bool skip = false;
 
-    for (auto id : accessible_ids) {
-        auto def_insn = src->get_def(id);
-        if (def_insn.opcode() == spv::OpVariable && def_insn.word(3) == spv::StorageClassPushConstant) {
-            skip |= ValidatePushConstantBlockAgainstPipeline(report_data, push_constant_ranges, src, src->get_def(def_insn.word(1)),
-                                                             stage);
+        if (!found_range) {
+            skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
+                            kVUID_Core_Shader_PushConstantOutOfRange,
+                            "Push constant range covering variable starting at offset %u not declared in layout", offset);
         }
     }
 
@@ -1513,7 +1526,7 @@ static bool RequireExtension(debug_report_data const *report_data, bool extensio
     return false;
 }
 
-bool CoreChecks::ValidateShaderCapabilities(SHADER_MODULE_STATE const *src, VkShaderStageFlagBits stage) const {
+bool CoreChecks::ValidateShaderCapabilities(entrypoint_analysis const &analysis, VkShaderStageFlagBits stage) const {
     bool skip = false;
 
     struct FeaturePointer {
@@ -1658,120 +1671,115 @@ bool CoreChecks::ValidateShaderCapabilities(SHADER_MODULE_STATE const *src, VkSh
     };
     // clang-format on
 
-    for (auto insn : *src) {
-        if (insn.opcode() == spv::OpCapability) {
-            size_t n = capabilities.count(insn.word(1));
-            if (1 == n) {  // key occurs exactly once
-                auto it = capabilities.find(insn.word(1));
-                if (it != capabilities.end()) {
-                    if (it->second.feature) {
-                        skip |= RequireFeature(report_data, it->second.feature.IsEnabled(enabled_features), it->second.name);
-                    }
-                    if (it->second.extension) {
-                        skip |= RequireExtension(report_data, IsExtEnabled((device_extensions.*(it->second.extension))),
-                                                 it->second.name);
-                    }
+    for (auto capability : analysis.capabilities) {
+        size_t n = capabilities.count(capability);
+        if (1 == n) {  // key occurs exactly once
+            auto it = capabilities.find(capability);
+            if (it != capabilities.end()) {
+                if (it->second.feature) {
+                    skip |= RequireFeature(report_data, it->second.feature.IsEnabled(enabled_features), it->second.name);
                 }
-            } else if (1 < n) {  // key occurs multiple times, at least one must be enabled
-                bool needs_feature = false, has_feature = false;
-                bool needs_ext = false, has_ext = false;
-                std::string feature_names = "(one of) [ ";
-                std::string extension_names = feature_names;
-                auto caps = capabilities.equal_range(insn.word(1));
-                for (auto it = caps.first; it != caps.second; ++it) {
-                    if (it->second.feature) {
-                        needs_feature = true;
-                        has_feature = has_feature || it->second.feature.IsEnabled(enabled_features);
-                        feature_names += it->second.name;
-                        feature_names += " ";
-                    }
-                    if (it->second.extension) {
-                        needs_ext = true;
-                        has_ext = has_ext || device_extensions.*(it->second.extension);
-                        extension_names += it->second.name;
-                        extension_names += " ";
-                    }
+                if (it->second.extension) {
+                    skip |= RequireExtension(report_data, IsExtEnabled((device_extensions.*(it->second.extension))),
+                                             it->second.name);
                 }
-                if (needs_feature) {
-                    feature_names += "]";
-                    skip |= RequireFeature(report_data, has_feature, feature_names.c_str());
+            }
+        } else if (1 < n) {  // key occurs multiple times, at least one must be enabled
+            bool needs_feature = false, has_feature = false;
+            bool needs_ext = false, has_ext = false;
+            std::string feature_names = "(one of) [ ";
+            std::string extension_names = feature_names;
+            auto caps = capabilities.equal_range(capability);
+            for (auto it = caps.first; it != caps.second; ++it) {
+                if (it->second.feature) {
+                    needs_feature = true;
+                    has_feature = has_feature || it->second.feature.IsEnabled(enabled_features);
+                    feature_names += it->second.name;
+                    feature_names += " ";
                 }
-                if (needs_ext) {
-                    extension_names += "]";
-                    skip |= RequireExtension(report_data, has_ext, extension_names.c_str());
+                if (it->second.extension) {
+                    needs_ext = true;
+                    has_ext = has_ext || device_extensions.*(it->second.extension);
+                    extension_names += it->second.name;
+                    extension_names += " ";
                 }
             }
+            if (needs_feature) {
+                feature_names += "]";
+                skip |= RequireFeature(report_data, has_feature, feature_names.c_str());
+            }
+            if (needs_ext) {
+                extension_names += "]";
+                skip |= RequireExtension(report_data, has_ext, extension_names.c_str());
+            }
+        }
 
-            {  // Do group non-uniform checks
-                const VkSubgroupFeatureFlags supportedOperations = phys_dev_props_core11.subgroupSupportedOperations;
-                const VkSubgroupFeatureFlags supportedStages = phys_dev_props_core11.subgroupSupportedStages;
+        {  // Do group non-uniform checks
+            const VkSubgroupFeatureFlags supportedOperations = phys_dev_props_core11.subgroupSupportedOperations;
+            const VkSubgroupFeatureFlags supportedStages = phys_dev_props_core11.subgroupSupportedStages;
 
-                switch (insn.word(1)) {
-                    default:
-                        break;
-                    case spv::CapabilityGroupNonUniform:
-                    case spv::CapabilityGroupNonUniformVote:
-                    case spv::CapabilityGroupNonUniformArithmetic:
-                    case spv::CapabilityGroupNonUniformBallot:
-                    case spv::CapabilityGroupNonUniformShuffle:
-                    case spv::CapabilityGroupNonUniformShuffleRelative:
-                    case spv::CapabilityGroupNonUniformClustered:
-                    case spv::CapabilityGroupNonUniformQuad:
-                    case spv::CapabilityGroupNonUniformPartitionedNV:
-                        RequirePropertyFlag(report_data, supportedStages & stage, string_VkShaderStageFlagBits(stage),
-                                            "VkPhysicalDeviceSubgroupProperties::supportedStages");
-                        break;
-                }
+            switch (capability) {
+                default:
+                    break;
+                case spv::CapabilityGroupNonUniform:
+                case spv::CapabilityGroupNonUniformVote:
+                case spv::CapabilityGroupNonUniformArithmetic:
+                case spv::CapabilityGroupNonUniformBallot:
+                case spv::CapabilityGroupNonUniformShuffle:
+                case spv::CapabilityGroupNonUniformShuffleRelative:
+                case spv::CapabilityGroupNonUniformClustered:
+                case spv::CapabilityGroupNonUniformQuad:
+                case spv::CapabilityGroupNonUniformPartitionedNV:
+                    RequirePropertyFlag(report_data, supportedStages & stage, string_VkShaderStageFlagBits(stage),
+                                        "VkPhysicalDeviceSubgroupProperties::supportedStages");
+                    break;
+            }
 
-                switch (insn.word(1)) {
-                    default:
-                        break;
-                    case spv::CapabilityGroupNonUniform:
-                        RequirePropertyFlag(report_data, supportedOperations & VK_SUBGROUP_FEATURE_BASIC_BIT,
-                                            "VK_SUBGROUP_FEATURE_BASIC_BIT",
-                                            "VkPhysicalDeviceSubgroupProperties::supportedOperations");
-                        break;
-                    case spv::CapabilityGroupNonUniformVote:
-                        RequirePropertyFlag(report_data, supportedOperations & VK_SUBGROUP_FEATURE_VOTE_BIT,
-                                            "VK_SUBGROUP_FEATURE_VOTE_BIT",
-                                            "VkPhysicalDeviceSubgroupProperties::supportedOperations");
-                        break;
-                    case spv::CapabilityGroupNonUniformArithmetic:
-                        RequirePropertyFlag(report_data, supportedOperations & VK_SUBGROUP_FEATURE_ARITHMETIC_BIT,
-                                            "VK_SUBGROUP_FEATURE_ARITHMETIC_BIT",
-                                            "VkPhysicalDeviceSubgroupProperties::supportedOperations");
-                        break;
-                    case spv::CapabilityGroupNonUniformBallot:
-                        RequirePropertyFlag(report_data, supportedOperations & VK_SUBGROUP_FEATURE_BALLOT_BIT,
-                                            "VK_SUBGROUP_FEATURE_BALLOT_BIT",
-                                            "VkPhysicalDeviceSubgroupProperties::supportedOperations");
-                        break;
-                    case spv::CapabilityGroupNonUniformShuffle:
-                        RequirePropertyFlag(report_data, supportedOperations & VK_SUBGROUP_FEATURE_SHUFFLE_BIT,
-                                            "VK_SUBGROUP_FEATURE_SHUFFLE_BIT",
-                                            "VkPhysicalDeviceSubgroupProperties::supportedOperations");
-                        break;
-                    case spv::CapabilityGroupNonUniformShuffleRelative:
-                        RequirePropertyFlag(report_data, supportedOperations & VK_SUBGROUP_FEATURE_SHUFFLE_RELATIVE_BIT,
-                                            "VK_SUBGROUP_FEATURE_SHUFFLE_RELATIVE_BIT",
-                                            "VkPhysicalDeviceSubgroupProperties::supportedOperations");
-                        break;
-                    case spv::CapabilityGroupNonUniformClustered:
-                        RequirePropertyFlag(report_data, supportedOperations & VK_SUBGROUP_FEATURE_CLUSTERED_BIT,
-                                            "VK_SUBGROUP_FEATURE_CLUSTERED_BIT",
-                                            "VkPhysicalDeviceSubgroupProperties::supportedOperations");
-                        break;
-                    case spv::CapabilityGroupNonUniformQuad:
-                        RequirePropertyFlag(report_data, supportedOperations & VK_SUBGROUP_FEATURE_QUAD_BIT,
-                                            "VK_SUBGROUP_FEATURE_QUAD_BIT",
-                                            "VkPhysicalDeviceSubgroupProperties::supportedOperations");
-                        break;
-                    case spv::CapabilityGroupNonUniformPartitionedNV:
-                        RequirePropertyFlag(report_data, supportedOperations & VK_SUBGROUP_FEATURE_PARTITIONED_BIT_NV,
-                                            "VK_SUBGROUP_FEATURE_PARTITIONED_BIT_NV",
-                                            "VkPhysicalDeviceSubgroupProperties::supportedOperations");
-                        break;
-                }
+            switch (capability) {
+                default:
+                    break;
+                case spv::CapabilityGroupNonUniform:
+                    RequirePropertyFlag(report_data, supportedOperations & VK_SUBGROUP_FEATURE_BASIC_BIT,
+                                        "VK_SUBGROUP_FEATURE_BASIC_BIT", "VkPhysicalDeviceSubgroupProperties::supportedOperations");
+                    break;
+                case spv::CapabilityGroupNonUniformVote:
+                    RequirePropertyFlag(report_data, supportedOperations & VK_SUBGROUP_FEATURE_VOTE_BIT,
+                                        "VK_SUBGROUP_FEATURE_VOTE_BIT", "VkPhysicalDeviceSubgroupProperties::supportedOperations");
+                    break;
+                case spv::CapabilityGroupNonUniformArithmetic:
+                    RequirePropertyFlag(report_data, supportedOperations & VK_SUBGROUP_FEATURE_ARITHMETIC_BIT,
+                                        "VK_SUBGROUP_FEATURE_ARITHMETIC_BIT",
+                                        "VkPhysicalDeviceSubgroupProperties::supportedOperations");
+                    break;
+                case spv::CapabilityGroupNonUniformBallot:
+                    RequirePropertyFlag(report_data, supportedOperations & VK_SUBGROUP_FEATURE_BALLOT_BIT,
+                                        "VK_SUBGROUP_FEATURE_BALLOT_BIT",
+                                        "VkPhysicalDeviceSubgroupProperties::supportedOperations");
+                    break;
+                case spv::CapabilityGroupNonUniformShuffle:
+                    RequirePropertyFlag(report_data, supportedOperations & VK_SUBGROUP_FEATURE_SHUFFLE_BIT,
+                                        "VK_SUBGROUP_FEATURE_SHUFFLE_BIT",
+                                        "VkPhysicalDeviceSubgroupProperties::supportedOperations");
+                    break;
+                case spv::CapabilityGroupNonUniformShuffleRelative:
+                    RequirePropertyFlag(report_data, supportedOperations & VK_SUBGROUP_FEATURE_SHUFFLE_RELATIVE_BIT,
+                                        "VK_SUBGROUP_FEATURE_SHUFFLE_RELATIVE_BIT",
+                                        "VkPhysicalDeviceSubgroupProperties::supportedOperations");
+                    break;
+                case spv::CapabilityGroupNonUniformClustered:
+                    RequirePropertyFlag(report_data, supportedOperations & VK_SUBGROUP_FEATURE_CLUSTERED_BIT,
+                                        "VK_SUBGROUP_FEATURE_CLUSTERED_BIT",
+                                        "VkPhysicalDeviceSubgroupProperties::supportedOperations");
+                    break;
+                case spv::CapabilityGroupNonUniformQuad:
+                    RequirePropertyFlag(report_data, supportedOperations & VK_SUBGROUP_FEATURE_QUAD_BIT,
+                                        "VK_SUBGROUP_FEATURE_QUAD_BIT", "VkPhysicalDeviceSubgroupProperties::supportedOperations");
+                    break;
+                case spv::CapabilityGroupNonUniformPartitionedNV:
+                    RequirePropertyFlag(report_data, supportedOperations & VK_SUBGROUP_FEATURE_PARTITIONED_BIT_NV,
+                                        "VK_SUBGROUP_FEATURE_PARTITIONED_BIT_NV",
+                                        "VkPhysicalDeviceSubgroupProperties::supportedOperations");
+                    break;
             }
         }
     }
@@ -1809,76 +1817,23 @@ bool CoreChecks::ValidateShaderStageWritableDescriptor(VkShaderStageFlagBits sta
     return skip;
 }
 
-bool CoreChecks::ValidateShaderStageGroupNonUniform(SHADER_MODULE_STATE const *module, VkShaderStageFlagBits stage) const {
+bool CoreChecks::ValidateShaderStageGroupNonUniform(entrypoint_analysis const &analysis, VkShaderStageFlagBits stage) const {
     bool skip = false;
 
     auto const subgroup_props = phys_dev_props_core11;
 
-    for (auto inst : *module) {
-        // Check the quad operations.
-        switch (inst.opcode()) {
-            default:
-                break;
-            case spv::OpGroupNonUniformQuadBroadcast:
-            case spv::OpGroupNonUniformQuadSwap:
-                if ((stage != VK_SHADER_STAGE_FRAGMENT_BIT) && (stage != VK_SHADER_STAGE_COMPUTE_BIT)) {
-                    skip |= RequireFeature(report_data, subgroup_props.subgroupQuadOperationsInAllStages,
-                                           "VkPhysicalDeviceSubgroupProperties::quadOperationsInAllStages");
-                }
-                break;
+    // One report per offending instruction
+    if ((stage != VK_SHADER_STAGE_FRAGMENT_BIT) && (stage != VK_SHADER_STAGE_COMPUTE_BIT)) {
+        for (uint32_t i = 0; i < analysis.quad_operation_count; ++i) {
+            skip |= RequireFeature(report_data, subgroup_props.subgroupQuadOperationsInAllStages,
+                                   "VkPhysicalDeviceSubgroupProperties::quadOperationsInAllStages");
         }
+    }
 
-        if (!enabled_features.core12.shaderSubgroupExtendedTypes) {
-            switch (inst.opcode()) {
-                default:
-                    break;
-                case spv::OpGroupNonUniformAllEqual:
-                case spv::OpGroupNonUniformBroadcast:
-                case spv::OpGroupNonUniformBroadcastFirst:
-                case spv::OpGroupNonUniformShuffle:
-                case spv::OpGroupNonUniformShuffleXor:
-                case spv::OpGroupNonUniformShuffleUp:
-                case spv::OpGroupNonUniformShuffleDown:
-                case spv::OpGroupNonUniformIAdd:
-                case spv::OpGroupNonUniformFAdd:
-                case spv::OpGroupNonUniformIMul:
-                case spv::OpGroupNonUniformFMul:
-                case spv::OpGroupNonUniformSMin:
-                case spv::OpGroupNonUniformUMin:
-                case spv::OpGroupNonUniformFMin:
-                case spv::OpGroupNonUniformSMax:
-                case spv::OpGroupNonUniformUMax:
-                case spv::OpGroupNonUniformFMax:
-                case spv::OpGroupNonUniformBitwiseAnd:
-                case spv::OpGroupNonUniformBitwiseOr:
-                case spv::OpGroupNonUniformBitwiseXor:
-                case spv::OpGroupNonUniformLogicalAnd:
-                case spv::OpGroupNonUniformLogicalOr:
-                case spv::OpGroupNonUniformLogicalXor:
-                case spv::OpGroupNonUniformQuadBroadcast:
-                case spv::OpGroupNonUniformQuadSwap: {
-                    auto type = module->get_def(inst.word(1));
-
-                    if (type.opcode() == spv::OpTypeVector) {
-                        // Get the element type
-                        type = module->get_def(type.word(2));
-                    }
-
-                    if (type.opcode() == spv::OpTypeBool) {
-                        break;
-                    }
-
-                    // Both OpTypeInt and OpTypeFloat the width is in the 2nd word.
-                    const uint32_t width = type.word(2);
-
-                    if ((type.opcode() == spv::OpTypeFloat && width == 16) ||
-                        (type.opcode() == spv::OpTypeInt && (width == 8 || width == 16 || width == 64))) {
-                        skip |= RequireFeature(report_data, enabled_features.core12.shaderSubgroupExtendedTypes,
-                                               "VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures::shaderSubgroupExtendedTypes");
-                    }
-                    break;
-                }
-            }
+    if (!enabled_features.core12.shaderSubgroupExtendedTypes) {
+        for (uint32_t i = 0; i < analysis.extended_type_operation_count; ++i) {
+            skip |= RequireFeature(report_data, enabled_features.core12.shaderSubgroupExtendedTypes,
+                                   "VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures::shaderSubgroupExtendedTypes");
         }
     }
 
@@ -2880,6 +2835,207 @@ bool CoreChecks::ValidatePointListShaderState(const PIPELINE_STATE *pipeline, SH
     return skip;
 }
 
+static void AnalyzeModuleOperations(SHADER_MODULE_STATE const *module, entrypoint_analysis *analysis) {
+    for (auto inst : *module) {
+        switch (inst.opcode()) {
+            default:
+                break;
+            case spv::OpCapability:
+                analysis->capabilities.push_back(inst.word(1));
+                break;
+        }
+
+        // Check the quad operations.
+        switch (inst.opcode()) {
+            default:
+                break;
+            case spv::OpGroupNonUniformQuadBroadcast:
+            case spv::OpGroupNonUniformQuadSwap:
+                ++analysis->quad_operation_count;
+                break;
+        }
+
+        switch (inst.opcode()) {
+            default:
+                break;
+            case spv::OpGroupNonUniformAllEqual:
+            case spv::OpGroupNonUniformBroadcast:
+            case spv::OpGroupNonUniformBroadcastFirst:
+            case spv::OpGroupNonUniformShuffle:
+            case spv::OpGroupNonUniformShuffleXor:
+            case spv::OpGroupNonUniformShuffleUp:
+            case spv::OpGroupNonUniformShuffleDown:
+            case spv::OpGroupNonUniformIAdd:
+            case spv::OpGroupNonUniformFAdd:
+            case spv::OpGroupNonUniformIMul:
+            case spv::OpGroupNonUniformFMul:
+            case spv::OpGroupNonUniformSMin:
+            case spv::OpGroupNonUniformUMin:
+            case spv::OpGroupNonUniformFMin:
+            case spv::OpGroupNonUniformSMax:
+            case spv::OpGroupNonUniformUMax:
+            case spv::OpGroupNonUniformFMax:
+            case spv::OpGroupNonUniformBitwiseAnd:
+            case spv::OpGroupNonUniformBitwiseOr:
+            case spv::OpGroupNonUniformBitwiseXor:
+            case spv::OpGroupNonUniformLogicalAnd:
+            case spv::OpGroupNonUniformLogicalOr:
+            case spv::OpGroupNonUniformLogicalXor:
+            case spv::OpGroupNonUniformQuadBroadcast:
+            case spv::OpGroupNonUniformQuadSwap: {
+                auto type = module->get_def(inst.word(1));
+
+                if (type.opcode() == spv::OpTypeVector) {
+                    // Get the element type
+                    type = module->get_def(type.word(2));
+                }
+
+                if (type.opcode() == spv::OpTypeBool) {
+                    break;
+                }
+
+                // Both OpTypeInt and OpTypeFloat the width is in the 2nd word.
+                const uint32_t width = type.word(2);
+
+                if ((type.opcode() == spv::OpTypeFloat && width == 16) ||
+                    (type.opcode() == spv::OpTypeInt && (width == 8 || width == 16 || width == 64))) {
+                    ++analysis->extended_type_operation_count;
+                }
+                break;
+            }
+        }
+    }
+}
+
+static void CollectPushConstantOffsets(SHADER_MODULE_STATE const *src, std::vector<uint32_t> const &accessible_ids,
+                                       std::vector<uint32_t> *offsets) {
+    for (auto id : accessible_ids) {
+        auto def_insn = src->get_def(id);
+        if (def_insn.opcode() != spv::OpVariable || def_insn.word(3) != spv::StorageClassPushConstant) continue;
+
+        // Strip off ptrs etc
+        auto type = GetStructType(src, src->get_def(def_insn.word(1)), false);
+        if (type == src->end()) continue;
+
+        for (auto insn : *src) {
+            if (insn.opcode() == spv::OpMemberDecorate && insn.word(1) == type.word(1) && insn.word(3) == spv::DecorationOffset) {
+                offsets->push_back(insn.word(4));
+            }
+        }
+    }
+}
+
+std::shared_ptr<const entrypoint_analysis> GetEntrypointAnalysis(SHADER_MODULE_STATE const *src,
+                                                                 SHADER_MODULE_STATE::EntryPoint const &entry_point) {
+    std::lock_guard<std::mutex> lock(src->analysis_lock);
+    auto &cached = src->entrypoint_analyses[entry_point.offset];
+    if (cached) return cached;
+
+    auto analysis = std::make_shared<entrypoint_analysis>();
+    const auto entrypoint = src->at(entry_point.offset);
+    const auto &accessible_ids = entry_point.accessible_ids;
+
+    for (const auto &use : CollectInterfaceByDescriptorSlot(src, accessible_ids, &analysis->has_writable_descriptor)) {
+        entrypoint_analysis::descriptor_use descriptor_use;
+        descriptor_use.slot = use.first;
+        descriptor_use.var = use.second;
+        descriptor_use.descriptor_types =
+            TypeToDescriptorTypeSet(src, use.second.type_id, descriptor_use.required_descriptor_count);
+        descriptor_use.reqs = DescriptorTypeToReqs(src, use.second.type_id);
+        analysis->descriptor_uses.emplace_back(std::move(descriptor_use));
+    }
+
+    for (const auto &attribs : shader_stage_attribs) {
+        if (attribs.stage != entry_point.stage) continue;
+        analysis->inputs = CollectInterfaceByLocation(src, entrypoint, spv::StorageClassInput, attribs.arrayed_input);
+        analysis->outputs = CollectInterfaceByLocation(src, entrypoint, spv::StorageClassOutput, attribs.arrayed_output);
+        // Builtin blocks are only matched between stages ahead of the fragment shader
+        if (attribs.stage != VK_SHADER_STAGE_FRAGMENT_BIT) {
+            analysis->builtin_block_inputs = CollectBuiltinBlockMembers(src, entrypoint, spv::StorageClassInput);
+        }
+        analysis->builtin_block_outputs = CollectBuiltinBlockMembers(src, entrypoint, spv::StorageClassOutput);
+    }
+    if (entry_point.stage == VK_SHADER_STAGE_FRAGMENT_BIT) {
+        analysis->input_attachment_uses = CollectInterfaceByInputAttachmentIndex(src, accessible_ids);
+    }
+
+    CollectPushConstantOffsets(src, accessible_ids, &analysis->push_constant_offsets);
+    AnalyzeModuleOperations(src, analysis.get());
+
+    cached = std::move(analysis);
+    return cached;
+}
+
+// Copies and hashes everything in a VkSpecializationInfo that affects the specialized module
+static SHADER_MODULE_STATE::SpecializationKey MakeSpecializationKey(VkSpecializationInfo const *info) {
+    SHADER_MODULE_STATE::SpecializationKey key;
+    key.map_entries.assign(info->pMapEntries, info->pMapEntries + info->mapEntryCount);
+    if (info->pData) {
+        const auto data = static_cast<const uint8_t *>(info->pData);
+        key.data.assign(data, data + info->dataSize);
+    }
+    key.hash = XXH64(key.map_entries.data(), key.map_entries.size() * sizeof(VkSpecializationMapEntry), key.map_entries.size());
+    key.hash = XXH64(key.data.data(), key.data.size(), key.hash);
+    return key;
+}
+
+// Applies the specialization-constant values in specialization_info to module and revalidates the result
+SHADER_MODULE_STATE::SpecializationResult CoreChecks::SpecializeShaderModule(
+    const SHADER_MODULE_STATE *module, VkSpecializationInfo const *specialization_info) const {
+    SHADER_MODULE_STATE::SpecializationResult result = {{}, true};
+
+    // Gather the specialization-constant values.
+    auto const &specialization_data = reinterpret_cast<uint8_t const *>(specialization_info->pData);
+    std::unordered_map<uint32_t, std::vector<uint32_t>> id_value_map;
+    id_value_map.reserve(specialization_info->mapEntryCount);
+    for (auto i = 0u; i < specialization_info->mapEntryCount; ++i) {
+        auto const &map_entry = specialization_info->pMapEntries[i];
+
+        // Expect only scalar types.
+        assert(map_entry.size == 1 || map_entry.size == 2 || map_entry.size == 4 || map_entry.size == 8);
+        auto entry = id_value_map.emplace(map_entry.constantID, std::vector<uint32_t>(map_entry.size > 4 ? 2 : 1));
+        memcpy(entry.first->second.data(), specialization_data + map_entry.offset, map_entry.size);
+    }
+
+    // Apply the specialization-constant values and revalidate the shader module.
+    spv_target_env const spirv_environment = ((api_version >= VK_API_VERSION_1_1) ? SPV_ENV_VULKAN_1_1 : SPV_ENV_VULKAN_1_0);
+    spvtools::Optimizer optimizer(spirv_environment);
+    spvtools::MessageConsumer consumer = [&result](spv_message_level_t level, const char *source, const spv_position_t &position,
+                                                   const char *message) { result.messages.emplace_back(message); };
+    optimizer.SetMessageConsumer(consumer);
+    optimizer.RegisterPass(spvtools::CreateSetSpecConstantDefaultValuePass(id_value_map));
+    optimizer.RegisterPass(spvtools::CreateFreezeSpecConstantValuePass());
+    std::vector<uint32_t> specialized_spirv;
+    auto const optimized =
+        optimizer.Run(module->words.data(), module->words.size(), &specialized_spirv, spvtools::ValidatorOptions(), true);
+    assert(optimized == true);
+
+    if (optimized) {
+        spv_context ctx = spvContextCreate(spirv_environment);
+        spv_const_binary_t binary{specialized_spirv.data(), specialized_spirv.size()};
+        spv_diagnostic diag = nullptr;
+        spv_validator_options options = spvValidatorOptionsCreate();
+        if (device_extensions.vk_khr_relaxed_block_layout) {
+            spvValidatorOptionsSetRelaxBlockLayout(options, true);
+        }
+        if (device_extensions.vk_khr_uniform_buffer_standard_layout &&
+            enabled_features.core12.uniformBufferStandardLayout == VK_TRUE) {
+            spvValidatorOptionsSetUniformBufferStandardLayout(options, true);
+        }
+        if (device_extensions.vk_ext_scalar_block_layout && enabled_features.core12.scalarBlockLayout == VK_TRUE) {
+            spvValidatorOptionsSetScalarBlockLayout(options, true);
+        }
+        auto const spv_valid = spvValidateWithOptions(ctx, options, &binary, &diag);
+        result.valid = (spv_valid == SPV_SUCCESS);
+
+        spvValidatorOptionsDestroy(options);
+        spvDiagnosticDestroy(diag);
+        spvContextDestroy(ctx);
+    }
+
+    return result;
+}
+
 bool CoreChecks::ValidatePipelineShaderStage(VkPipelineShaderStageCreateInfo const *pStage, const PIPELINE_STATE *pipeline,
                                              const PIPELINE_STATE::StageState &stage_state, const SHADER_MODULE_STATE *module,
                                              const spirv_inst_iter &entrypoint, bool check_point_size) const {
@@ -2896,65 +3052,33 @@ bool CoreChecks::ValidatePipelineShaderStage(VkPipelineShaderStageCreateInfo con
     // specializations should be applied and validated.
     if (pStage->pSpecializationInfo != nullptr && pStage->pSpecializationInfo->mapEntryCount > 0 &&
         pStage->pSpecializationInfo->pMapEntries != nullptr && module->has_specialization_constants) {
-        // Gather the specialization-constant values.
-        auto const &specialization_info = pStage->pSpecializationInfo;
-        auto const &specialization_data = reinterpret_cast<uint8_t const *>(specialization_info->pData);
-        std::unordered_map<uint32_t, std::vector<uint32_t>> id_value_map;
-        id_value_map.reserve(specialization_info->mapEntryCount);
-        for (auto i = 0u; i < specialization_info->mapEntryCount; ++i) {
-            auto const &map_entry = specialization_info->pMapEntries[i];
-
-            // Expect only scalar types.
-            assert(map_entry.size == 1 || map_entry.size == 2 || map_entry.size == 4 || map_entry.size == 8);
-            auto entry = id_value_map.emplace(map_entry.constantID, std::vector<uint32_t>(map_entry.size > 4 ? 2 : 1));
-            memcpy(entry.first->second.data(), specialization_data + map_entry.offset, map_entry.size);
-        }
-
-        // Apply the specialization-constant values and revalidate the shader module.
-        spv_target_env const spirv_environment = ((api_version >= VK_API_VERSION_1_1) ? SPV_ENV_VULKAN_1_1 : SPV_ENV_VULKAN_1_0);
-        spvtools::Optimizer optimizer(spirv_environment);
-        spvtools::MessageConsumer consumer = [&skip, &module, &pStage, this](spv_message_level_t level, const char *source,
-                                                                             const spv_position_t &position, const char *message) {
-            skip |= log_msg(
-                report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                "VUID-VkPipelineShaderStageCreateInfo-module-parameter", "%s does not contain valid spirv for stage %s. %s",
-                report_data->FormatHandle(module->vk_shader_module).c_str(), string_VkShaderStageFlagBits(pStage->stage), message);
-        };
-        optimizer.SetMessageConsumer(consumer);
-        optimizer.RegisterPass(spvtools::CreateSetSpecConstantDefaultValuePass(id_value_map));
-        optimizer.RegisterPass(spvtools::CreateFreezeSpecConstantValuePass());
-        std::vector<uint32_t> specialized_spirv;
-        auto const optimized =
-            optimizer.Run(module->words.data(), module->words.size(), &specialized_spirv, spvtools::ValidatorOptions(), true);
-        assert(optimized == true);
-
-        if (optimized) {
-            spv_context ctx = spvContextCreate(spirv_environment);
-            spv_const_binary_t binary{specialized_spirv.data(), specialized_spirv.size()};
-            spv_diagnostic diag = nullptr;
-            spv_validator_options options = spvValidatorOptionsCreate();
-            if (device_extensions.vk_khr_relaxed_block_layout) {
-                spvValidatorOptionsSetRelaxBlockLayout(options, true);
-            }
-            if (device_extensions.vk_khr_uniform_buffer_standard_layout &&
-                enabled_features.core12.uniformBufferStandardLayout == VK_TRUE) {
-                spvValidatorOptionsSetUniformBufferStandardLayout(options, true);
-            }
-            if (device_extensions.vk_ext_scalar_block_layout && enabled_features.core12.scalarBlockLayout == VK_TRUE) {
-                spvValidatorOptionsSetScalarBlockLayout(options, true);
-            }
-            auto const spv_valid = spvValidateWithOptions(ctx, options, &binary, &diag);
-            if (spv_valid != SPV_SUCCESS) {
-                skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                                "VUID-VkPipelineShaderStageCreateInfo-module-parameter",
-                                "After specialization was applied, %s does not contain valid spirv for stage %s.",
-                                report_data->FormatHandle(module->vk_shader_module).c_str(),
-                                string_VkShaderStageFlagBits(pStage->stage));
+        // Pipelines specializing the module the same way share one optimizer and validator run; its outcome is copied out
+        // and reported again for each of them, after analysis_lock is released
+        auto specialization_key = MakeSpecializationKey(pStage->pSpecializationInfo);
+        SHADER_MODULE_STATE::SpecializationResult result;
+        {
+            std::lock_guard<std::mutex> lock(module->analysis_lock);
+            auto result_it = module->specialization_results.find(specialization_key);
+            if (result_it == module->specialization_results.end()) {
+                auto specialized = SpecializeShaderModule(module, pStage->pSpecializationInfo);
+                result_it = module->specialization_results.emplace(std::move(specialization_key), std::move(specialized)).first;
             }
+            result = result_it->second;
+        }
 
-            spvValidatorOptionsDestroy(options);
-            spvDiagnosticDestroy(diag);
-            spvContextDestroy(ctx);
+        for (auto const &message : result.messages) {
+            skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
+                            "VUID-VkPipelineShaderStageCreateInfo-module-parameter",
+                            "%s does not contain valid spirv for stage %s. %s",
+                            report_data->FormatHandle(module->vk_shader_module).c_str(),
+                            string_VkShaderStageFlagBits(pStage->stage), message.c_str());
+        }
+        if (!result.valid) {
+            skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
+                            "VUID-VkPipelineShaderStageCreateInfo-module-parameter",
+                            "After specialization was applied, %s does not contain valid spirv for stage %s.",
+                            report_data->FormatHandle(module->vk_shader_module).c_str(),
+                            string_VkShaderStageFlagBits(pStage->stage));
         }
     }
 
@@ -2965,67 +3089,63 @@ bool CoreChecks::ValidatePipelineShaderStage(VkPipelineShaderStageCreateInfo con
                         pStage->pName, string_VkShaderStageFlagBits(pStage->stage));
     }
     if (skip) return true;  // no point continuing beyond here, any analysis is just going to be garbage.
+    if (!stage_state.analysis) return false;
 
-    // Mark accessible ids
-    auto &accessible_ids = stage_state.accessible_ids;
-
-    // Validate descriptor set layout against what the entrypoint actually uses
-    bool has_writable_descriptor = stage_state.has_writable_descriptor;
-    auto &descriptor_uses = stage_state.descriptor_uses;
+    // The module's analysis of the entrypoint, shared with other pipelines
+    auto const &analysis = *stage_state.analysis;
 
     // Validate shader capabilities against enabled device features
-    skip |= ValidateShaderCapabilities(module, pStage->stage);
-    skip |= ValidateShaderStageWritableDescriptor(pStage->stage, has_writable_descriptor);
+    skip |= ValidateShaderCapabilities(analysis, pStage->stage);
+    skip |= ValidateShaderStageWritableDescriptor(pStage->stage, analysis.has_writable_descriptor);
     skip |= ValidateShaderStageInputOutputLimits(module, pStage, pipeline, entrypoint);
-    skip |= ValidateShaderStageGroupNonUniform(module, pStage->stage);
+    skip |= ValidateShaderStageGroupNonUniform(analysis, pStage->stage);
     skip |= ValidateExecutionModes(module, entrypoint);
     skip |= ValidateSpecializationOffsets(report_data, pStage);
-    skip |= ValidatePushConstantUsage(report_data, pipeline->pipeline_layout->push_constant_ranges.get(), module, accessible_ids,
-                                      pStage->stage);
+    skip |= ValidatePushConstantUsage(report_data, pipeline->pipeline_layout->push_constant_ranges.get(), analysis, pStage->stage);
     if (check_point_size && !pipeline->graphicsPipelineCI.pRasterizationState->rasterizerDiscardEnable) {
         skip |= ValidatePointListShaderState(pipeline, module, entrypoint, pStage->stage);
     }
     skip |= ValidateCooperativeMatrix(module, pStage, pipeline);
 
-    // Validate descriptor use
-    for (auto use : descriptor_uses) {
+    // Validate descriptor set layout against what the entrypoint actually uses
+    for (auto const &use : analysis.descriptor_uses) {
         // Verify given pipelineLayout has requested setLayout with requested binding
-        const auto &binding = GetDescriptorBinding(pipeline->pipeline_layout.get(), use.first);
-        unsigned required_descriptor_count;
-        std::set<uint32_t> descriptor_types = TypeToDescriptorTypeSet(module, use.second.type_id, required_descriptor_count);
+        const auto &binding = GetDescriptorBinding(pipeline->pipeline_layout.get(), use.slot);
+        const unsigned required_descriptor_count = use.required_descriptor_count;
+        const std::set<uint32_t> &descriptor_types = use.descriptor_types;
 
         if (!binding) {
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
                             kVUID_Core_Shader_MissingDescriptor,
                             "Shader uses descriptor slot %u.%u (expected `%s`) but not declared in pipeline layout",
-                            use.first.first, use.first.second, string_descriptorTypes(descriptor_types).c_str());
+                            use.slot.first, use.slot.second, string_descriptorTypes(descriptor_types).c_str());
         } else if (~binding->stageFlags & pStage->stage) {
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT, 0,
                             kVUID_Core_Shader_DescriptorNotAccessibleFromStage,
-                            "Shader uses descriptor slot %u.%u but descriptor not accessible from stage %s", use.first.first,
-                            use.first.second, string_VkShaderStageFlagBits(pStage->stage));
+                            "Shader uses descriptor slot %u.%u but descriptor not accessible from stage %s", use.slot.first,
+                            use.slot.second, string_VkShaderStageFlagBits(pStage->stage));
         } else if (descriptor_types.find(binding->descriptorType) == descriptor_types.end()) {
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
                             kVUID_Core_Shader_DescriptorTypeMismatch,
-                            "Type mismatch on descriptor slot %u.%u (expected `%s`) but descriptor of type %s", use.first.first,
-                            use.first.second, string_descriptorTypes(descriptor_types).c_str(),
+                            "Type mismatch on descriptor slot %u.%u (expected `%s`) but descriptor of type %s", use.slot.first,
+                            use.slot.second, string_descriptorTypes(descriptor_types).c_str(),
                             string_VkDescriptorType(binding->descriptorType));
         } else if (binding->descriptorCount < required_descriptor_count) {
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
                             kVUID_Core_Shader_DescriptorTypeMismatch,
                             "Shader expects at least %u descriptors for binding %u.%u but only %u provided",
-                            required_descriptor_count, use.first.first, use.first.second, binding->descriptorCount);
+                            required_descriptor_count, use.slot.first, use.slot.second, binding->descriptorCount);
         }
     }
 
     // Validate use of input attachments against subpass structure
     if (pStage->stage == VK_SHADER_STAGE_FRAGMENT_BIT) {
-        auto input_attachment_uses = CollectInterfaceByInputAttachmentIndex(module, accessible_ids);
+        auto const &input_attachment_uses = analysis.input_attachment_uses;
 
         auto rpci = pipeline->rp_state->createInfo.ptr();
         auto subpass = pipeline->graphicsPipelineCI.subpass;
 
-        for (auto use : input_attachment_uses) {
+        for (auto const &use : input_attachment_uses) {
             auto input_attachments = rpci->pSubpasses[subpass].pInputAttachments;
             auto index = (input_attachments && use.first < rpci->pSubpasses[subpass].inputAttachmentCount)
                              ? input_attachments[use.first].attachment
@@ -3051,14 +3171,14 @@ bool CoreChecks::ValidatePipelineShaderStage(VkPipelineShaderStageCreateInfo con
 }
 
 static bool ValidateInterfaceBetweenStages(debug_report_data const *report_data, SHADER_MODULE_STATE const *producer,
-                                           spirv_inst_iter producer_entrypoint, shader_stage_attributes const *producer_stage,
-                                           SHADER_MODULE_STATE const *consumer, spirv_inst_iter consumer_entrypoint,
+                                           entrypoint_analysis const &producer_analysis,
+                                           shader_stage_attributes const *producer_stage, SHADER_MODULE_STATE const *consumer,
+                                           entrypoint_analysis const &consumer_analysis,
                                            shader_stage_attributes const *consumer_stage) {
     bool skip = false;
 
-    auto outputs =
-        CollectInterfaceByLocation(producer, producer_entrypoint, spv::StorageClassOutput, producer_stage->arrayed_output);
-    auto inputs = CollectInterfaceByLocation(consumer, consumer_entrypoint, spv::StorageClassInput, consumer_stage->arrayed_input);
+    auto const &outputs = producer_analysis.outputs;
+    auto const &inputs = consumer_analysis.inputs;
 
     auto a_it = outputs.begin();
     auto b_it = inputs.begin();
@@ -3115,8 +3235,8 @@ static bool ValidateInterfaceBetweenStages(debug_report_data const *report_data,
     }
 
     if (consumer_stage->stage != VK_SHADER_STAGE_FRAGMENT_BIT) {
-        auto builtins_producer = CollectBuiltinBlockMembers(producer, producer_entrypoint, spv::StorageClassOutput);
-        auto builtins_consumer = CollectBuiltinBlockMembers(consumer, consumer_entrypoint, spv::StorageClassInput);
+        auto const &builtins_producer = producer_analysis.builtin_block_outputs;
+        auto const &builtins_consumer = consumer_analysis.builtin_block_inputs;
 
         if (!builtins_producer.empty() && !builtins_consumer.empty()) {
             if (builtins_producer.size() != builtins_consumer.size()) {
@@ -3177,6 +3297,7 @@ bool CoreChecks::ValidateGraphicsPipelineShaderState(const PIPELINE_STATE *pipel
     memset(shaders, 0, sizeof(shaders));
     spirv_inst_iter entrypoints[32];
     memset(entrypoints, 0, sizeof(entrypoints));
+    const entrypoint_analysis *analyses[32] = {};
     bool skip = false;
 
     uint32_t pointlist_stage_mask = DetermineFinalGeomStage(pipeline, pCreateInfo);
@@ -3186,6 +3307,7 @@ bool CoreChecks::ValidateGraphicsPipelineShaderState(const PIPELINE_STATE *pipel
         auto stage_id = GetShaderStageId(pStage->stage);
         shaders[stage_id] = GetShaderModuleState(pStage->module);
         entrypoints[stage_id] = FindEntrypoint(shaders[stage_id], pStage->pName, pStage->stage);
+        analyses[stage_id] = pipeline->stage_state[i].analysis.get();
         skip |= ValidatePipelineShaderStage(pStage, pipeline, pipeline->stage_state[i], shaders[stage_id], entrypoints[stage_id],
                                             (pointlist_stage_mask == pStage->stage));
     }
@@ -3199,8 +3321,8 @@ bool CoreChecks::ValidateGraphicsPipelineShaderState(const PIPELINE_STATE *pipel
         skip |= ValidateViConsistency(report_data, vi);
     }
 
-    if (shaders[vertex_stage] && shaders[vertex_stage]->has_valid_spirv) {
-        skip |= ValidateViAgainstVsInputs(report_data, vi, shaders[vertex_stage], entrypoints[vertex_stage]);
+    if (shaders[vertex_stage] && analyses[vertex_stage]) {
+        skip |= ValidateViAgainstVsInputs(report_data, vi, shaders[vertex_stage], *analyses[vertex_stage]);
     }
 
     int producer = GetShaderStageId(VK_SHADER_STAGE_VERTEX_BIT);
@@ -3214,9 +3336,9 @@ bool CoreChecks::ValidateGraphicsPipelineShaderState(const PIPELINE_STATE *pipel
     for (; producer != fragment_stage && consumer <= fragment_stage; consumer++) {
         assert(shaders[producer]);
         if (shaders[consumer]) {
-            if (shaders[consumer]->has_valid_spirv && shaders[producer]->has_valid_spirv) {
-                skip |= ValidateInterfaceBetweenStages(report_data, shaders[producer], entrypoints[producer],
-                                                       &shader_stage_attribs[producer], shaders[consumer], entrypoints[consumer],
+            if (analyses[consumer] && analyses[producer]) {
+                skip |= ValidateInterfaceBetweenStages(report_data, shaders[producer], *analyses[producer],
+                                                       &shader_stage_attribs[producer], shaders[consumer], *analyses[consumer],
                                                        &shader_stage_attribs[consumer]);
             }
 
@@ -3224,8 +3346,8 @@ bool CoreChecks::ValidateGraphicsPipelineShaderState(const PIPELINE_STATE *pipel
         }
     }
 
-    if (shaders[fragment_stage] && shaders[fragment_stage]->has_valid_spirv) {
-        skip |= ValidateFsOutputsAgainstRenderPass(report_data, shaders[fragment_stage], entrypoints[fragment_stage], pipeline,
+    if (shaders[fragment_stage] && analyses[fragment_stage]) {
+        skip |= ValidateFsOutputsAgainstRenderPass(report_data, shaders[fragment_stage], *analyses[fragment_stage], pipeline,
                                                    pCreateInfo->subpass);
     }
 
@@ -20,9 +20,15 @@
 #ifndef VULKAN_SHADER_VALIDATION_H
 #define VULKAN_SHADER_VALIDATION_H
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -113,16 +119,57 @@ struct decoration_set {
     void add(uint32_t decoration, uint32_t value);
 };
 
+typedef std::pair<unsigned, unsigned> location_t;
+
+// What pipeline validation needs to know about one entrypoint of a module, independent of the rest of the pipeline. Built the
+// first time a pipeline uses the entrypoint and shared by every later one, so checks against layouts, render passes and
+// device features read this rather than walking the SPIR-V again.
+struct entrypoint_analysis {
+    struct descriptor_use {
+        descriptor_slot_t slot;
+        interface_var var;
+        std::set<uint32_t> descriptor_types;  // Descriptor types the variable can be backed by
+        unsigned required_descriptor_count;
+        uint32_t reqs;  // descriptor_req bits, see DescriptorTypeToReqs()
+    };
+    std::vector<descriptor_use> descriptor_uses;
+    bool has_writable_descriptor = false;
+
+    // User-defined interface variables by location, for the graphics stages that have them. Arrayed as the stage's
+    // inputs and outputs are, see shader_stage_attribs.
+    std::map<location_t, interface_var> inputs;
+    std::map<location_t, interface_var> outputs;
+    // Builtins of the gl_PerVertex style blocks, see CollectBuiltinBlockMembers()
+    std::vector<uint32_t> builtin_block_inputs;
+    std::vector<uint32_t> builtin_block_outputs;
+    // Fragment entrypoints only, by input attachment index
+    std::vector<std::pair<uint32_t, interface_var>> input_attachment_uses;
+
+    // Offset of each member of the push constant blocks the entrypoint accesses
+    std::vector<uint32_t> push_constant_offsets;
+
+    // Module-wide, in module order
+    std::vector<uint32_t> capabilities;
+    uint32_t quad_operation_count = 0;           // Group non-uniform quad operations
+    uint32_t extended_type_operation_count = 0;  // Group non-uniform operations on 8, 16 or 64 bit types
+};
+
 struct SHADER_MODULE_STATE : public BASE_NODE {
     // The spirv image itself
     std::vector<uint32_t> words;
     // A mapping of <id> to the first word of its def. this is useful because walking type
     // trees, constant expressions, etc requires jumping all over the instruction stream.
-    std::unordered_map<unsigned, unsigned> def_index;
-    std::unordered_map<unsigned, decoration_set> decorations;
+    // SPIR-V ids are dense in [0, bound), so this is indexed directly by id; 0 means no def, as word 0 is the header.
+    std::vector<uint32_t> def_index;
+    // Indexed by id, giving the slot of its decorations in decoration_sets; slot 0 is the empty set shared by undecorated ids
+    std::vector<uint32_t> decoration_index;
+    std::vector<decoration_set> decoration_sets;
     struct EntryPoint {
         uint32_t offset;
         VkShaderStageFlags stage;
+        // Sorted ids referenced by the entrypoint's static call tree, see MarkAccessibleIds(). Computed once with the module
+        // and shared by every pipeline that uses this entrypoint.
+        std::vector<uint32_t> accessible_ids;
     };
     std::unordered_multimap<std::string, EntryPoint> entry_points;
     bool has_valid_spirv;
@@ -130,6 +177,37 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
     VkShaderModule vk_shader_module;
     uint32_t gpu_validation_shader_id;
 
+    // Outcome of applying one VkSpecializationInfo and revalidating the module, so that pipelines specializing the module
+    // the same way run the optimizer and validator once between them
+    struct SpecializationResult {
+        std::vector<std::string> messages;  // Reported by the optimizer while applying the values
+        bool valid;                         // Whether the specialized module passed validation
+    };
+
+    // Copy of everything in a VkSpecializationInfo that affects the specialized module, with its hash. Keys are compared in
+    // full, so specializations whose hashes collide get results of their own.
+    struct SpecializationKey {
+        uint64_t hash;
+        std::vector<VkSpecializationMapEntry> map_entries;
+        std::vector<uint8_t> data;
+
+        bool operator==(const SpecializationKey &other) const {
+            return (hash == other.hash) && (data == other.data) && (map_entries.size() == other.map_entries.size()) &&
+                   std::equal(map_entries.cbegin(), map_entries.cend(), other.map_entries.cbegin(),
+                              [](const VkSpecializationMapEntry &lhs, const VkSpecializationMapEntry &rhs) {
+                                  return (lhs.constantID == rhs.constantID) && (lhs.offset == rhs.offset) && (lhs.size == rhs.size);
+                              });
+        }
+    };
+    struct SpecializationKeyHash {
+        size_t operator()(const SpecializationKey &key) const { return static_cast<size_t>(key.hash); }
+    };
+
+    // Memoized analyses, filled in as pipelines are created. Guarded by analysis_lock.
+    mutable std::mutex analysis_lock;
+    mutable std::unordered_map<uint32_t, std::shared_ptr<const entrypoint_analysis>> entrypoint_analyses;  // By entrypoint offset
+    mutable std::unordered_map<SpecializationKey, SpecializationResult, SpecializationKeyHash> specialization_results;
+
     std::vector<uint32_t> PreprocessShaderBinary(uint32_t *src_binary, size_t binary_size, spv_target_env env) {
         std::vector<uint32_t> src(src_binary, src_binary + binary_size / sizeof(uint32_t));
 
@@ -184,20 +262,20 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
     SHADER_MODULE_STATE(VkShaderModuleCreateInfo const *pCreateInfo, VkShaderModule shaderModule, spv_target_env env,
                         uint32_t unique_shader_id)
         : words(PreprocessShaderBinary((uint32_t *)pCreateInfo->pCode, pCreateInfo->codeSize, env)),
-          def_index(),
+          decoration_sets(1),
           has_valid_spirv(true),
           vk_shader_module(shaderModule),
           gpu_validation_shader_id(unique_shader_id) {
         BuildDefIndex();
     }
 
-    SHADER_MODULE_STATE() : has_valid_spirv(false), vk_shader_module(VK_NULL_HANDLE), gpu_validation_shader_id(UINT32_MAX) {}
+    SHADER_MODULE_STATE()
+        : decoration_sets(1), has_valid_spirv(false), vk_shader_module(VK_NULL_HANDLE), gpu_validation_shader_id(UINT32_MAX) {}
 
-    decoration_set get_decorations(unsigned id) const {
+    decoration_set const &get_decorations(unsigned id) const {
         // return the actual decorations for this id, or a default set.
-        auto it = decorations.find(id);
-        if (it != decorations.end()) return it->second;
-        return decoration_set();
+        if (id < decoration_index.size()) return decoration_sets[decoration_index[id]];
+        return decoration_sets[0];
     }
 
     // Expose begin() / end() to enable range-based for
@@ -208,13 +286,15 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
 
     // Gets an iterator to the definition of an id
     spirv_inst_iter get_def(unsigned id) const {
-        auto it = def_index.find(id);
-        if (it == def_index.end()) {
+        if (id >= def_index.size() || def_index[id] == 0) {
             return end();
         }
-        return at(it->second);
+        return at(def_index[id]);
     }
 
+    // Gets the entrypoint named name for the given stage, or nullptr if there is none
+    EntryPoint const *GetEntryPoint(char const *name, VkShaderStageFlagBits stageBits) const;
+
     void BuildDefIndex();
 };
 
@@ -316,13 +396,18 @@ spirv_inst_iter FindEntrypoint(SHADER_MODULE_STATE const *src, char const *name,
 //
 // TODO: The set of interesting opcodes here was determined by eyeballing the SPIRV spec. It might be worth
 // converting parts of this to be generated from the machine-readable spec instead.
-std::unordered_set<uint32_t> MarkAccessibleIds(SHADER_MODULE_STATE const *src, spirv_inst_iter entrypoint);
+//
+// The result is sorted. Pipeline creation uses the copy cached in SHADER_MODULE_STATE::EntryPoint rather than calling this.
+std::vector<uint32_t> MarkAccessibleIds(SHADER_MODULE_STATE const *src, spirv_inst_iter entrypoint);
 
 void ProcessExecutionModes(SHADER_MODULE_STATE const *src, const spirv_inst_iter &entrypoint, PIPELINE_STATE *pipeline);
 
 std::vector<std::pair<descriptor_slot_t, interface_var>> CollectInterfaceByDescriptorSlot(
-    debug_report_data const *report_data, SHADER_MODULE_STATE const *src, std::unordered_set<uint32_t> const &accessible_ids,
-    bool *has_writable_descriptor);
+    SHADER_MODULE_STATE const *src, std::vector<uint32_t> const &accessible_ids, bool *has_writable_descriptor);
+
+// Returns the module's analysis of entry_point, building it on first use
+std::shared_ptr<const entrypoint_analysis> GetEntrypointAnalysis(SHADER_MODULE_STATE const *src,
+                                                                 SHADER_MODULE_STATE::EntryPoint const &entry_point);
 
 uint32_t DescriptorTypeToReqs(SHADER_MODULE_STATE const *module, uint32_t type_id);
 
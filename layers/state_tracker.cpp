@@ -20,6 +20,7 @@
  * Shannon McPherson <shannon@lunarg.com>
  */
 
+#include <chrono>
 #include <cmath>
 #include <set>
 #include <sstream>
@@ -106,21 +107,16 @@ void ValidationStateTracker::PostCallRecordCreateImage(VkDevice device, const Vk
     if (pre_fetch_memory_reqs) {
         DispatchGetImageMemoryRequirements(device, *pImage, &is_node->requirements);
     }
-    imageMap.insert(std::make_pair(*pImage, std::move(is_node)));
+    imageMap.insert(*pImage, std::move(is_node));
 }
 
 void ValidationStateTracker::PreCallRecordDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks *pAllocator) {
     if (!image) return;
     IMAGE_STATE *image_state = GetImageState(image);
     const VulkanTypedHandle obj_struct(image, kVulkanObjectTypeImage);
-    InvalidateCommandBuffers(image_state->cb_bindings, obj_struct);
+    InvalidateCommandBuffers(image_state);
     // Clean up memory mapping, bindings and range references for image
-    for (auto mem_binding : image_state->GetBoundMemory()) {
-        auto mem_info = GetDevMemState(mem_binding);
-        if (mem_info) {
-            RemoveImageMemoryRange(image, mem_info);
-        }
-    }
+    RemoveMemoryRanges(obj_struct, image_state);
     if (image_state->bind_swapchain) {
         auto swapchain = GetSwapchainState(image_state->bind_swapchain);
         if (swapchain) {
@@ -202,7 +198,7 @@ void ValidationStateTracker::PostCallRecordCreateBuffer(VkDevice device, const V
     // Get a set of requirements in the case the app does not
     DispatchGetBufferMemoryRequirements(device, *pBuffer, &buffer_state->requirements);
 
-    bufferMap.insert(std::make_pair(*pBuffer, std::move(buffer_state)));
+    bufferMap.insert(*pBuffer, std::move(buffer_state));
 }
 
 void ValidationStateTracker::PostCallRecordCreateBufferView(VkDevice device, const VkBufferViewCreateInfo *pCreateInfo,
@@ -210,7 +206,7 @@ void ValidationStateTracker::PostCallRecordCreateBufferView(VkDevice device, con
                                                             VkResult result) {
     if (result != VK_SUCCESS) return;
     auto buffer_state = GetBufferShared(pCreateInfo->buffer);
-    bufferViewMap[*pView] = std::make_shared<BUFFER_VIEW_STATE>(buffer_state, *pView, pCreateInfo);
+    bufferViewMap.insert_or_assign(*pView, std::make_shared<BUFFER_VIEW_STATE>(buffer_state, *pView, pCreateInfo));
 }
 
 void ValidationStateTracker::PostCallRecordCreateImageView(VkDevice device, const VkImageViewCreateInfo *pCreateInfo,
@@ -218,7 +214,7 @@ void ValidationStateTracker::PostCallRecordCreateImageView(VkDevice device, cons
                                                            VkResult result) {
     if (result != VK_SUCCESS) return;
     auto image_state = GetImageShared(pCreateInfo->image);
-    imageViewMap[*pView] = std::make_shared<IMAGE_VIEW_STATE>(image_state, *pView, pCreateInfo);
+    imageViewMap.insert_or_assign(*pView, std::make_shared<IMAGE_VIEW_STATE>(image_state, *pView, pCreateInfo));
 }
 
 void ValidationStateTracker::PreCallRecordCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
@@ -236,10 +232,9 @@ void ValidationStateTracker::PreCallRecordDestroyImageView(VkDevice device, VkIm
                                                            const VkAllocationCallbacks *pAllocator) {
     IMAGE_VIEW_STATE *image_view_state = GetImageViewState(imageView);
     if (!image_view_state) return;
-    const VulkanTypedHandle obj_struct(imageView, kVulkanObjectTypeImageView);
 
     // Any bound cmd buffers are now invalid
-    InvalidateCommandBuffers(image_view_state->cb_bindings, obj_struct);
+    InvalidateCommandBuffers(image_view_state);
     image_view_state->destroyed = true;
     imageViewMap.erase(imageView);
 }
@@ -249,13 +244,8 @@ void ValidationStateTracker::PreCallRecordDestroyBuffer(VkDevice device, VkBuffe
     auto buffer_state = GetBufferState(buffer);
     const VulkanTypedHandle obj_struct(buffer, kVulkanObjectTypeBuffer);
 
-    InvalidateCommandBuffers(buffer_state->cb_bindings, obj_struct);
-    for (auto mem_binding : buffer_state->GetBoundMemory()) {
-        auto mem_info = GetDevMemState(mem_binding);
-        if (mem_info) {
-            RemoveBufferMemoryRange(buffer, mem_info);
-        }
-    }
+    InvalidateCommandBuffers(buffer_state);
+    RemoveMemoryRanges(obj_struct, buffer_state);
     ClearMemoryObjectBindings(obj_struct);
     buffer_state->destroyed = true;
     bufferMap.erase(buffer_state->buffer);
@@ -265,10 +255,9 @@ void ValidationStateTracker::PreCallRecordDestroyBufferView(VkDevice device, VkB
                                                             const VkAllocationCallbacks *pAllocator) {
     if (!bufferView) return;
     auto buffer_view_state = GetBufferViewState(bufferView);
-    const VulkanTypedHandle obj_struct(bufferView, kVulkanObjectTypeBufferView);
 
     // Any bound cmd buffers are now invalid
-    InvalidateCommandBuffers(buffer_view_state->cb_bindings, obj_struct);
+    InvalidateCommandBuffers(buffer_view_state);
     buffer_view_state->destroyed = true;
     bufferViewMap.erase(bufferView);
 }
@@ -323,31 +312,36 @@ const IMAGE_VIEW_STATE *ValidationStateTracker::GetAttachmentImageViewState(cons
 
 void ValidationStateTracker::AddAliasingImage(IMAGE_STATE *image_state) {
     if (!(image_state->createInfo.flags & VK_IMAGE_CREATE_ALIAS_BIT)) return;
-    std::unordered_set<VkImage> *bound_images = nullptr;
+
+    auto add_aliasing_image = [this, image_state](VkImage handle) {
+        if (handle != image_state->image) {
+            auto is = GetImageState(handle);
+            if (is && is->IsCompatibleAliasing(image_state)) {
+                auto inserted = is->aliasing_images.emplace(image_state->image);
+                if (inserted.second) {
+                    image_state->aliasing_images.emplace(handle);
+                }
+            }
+        }
+    };
 
     if (image_state->bind_swapchain) {
         auto swapchain_state = GetSwapchainState(image_state->bind_swapchain);
         if (swapchain_state) {
-            bound_images = &swapchain_state->images[image_state->bind_swapchain_imageIndex].bound_images;
+            for (const auto &handle : swapchain_state->images[image_state->bind_swapchain_imageIndex].bound_images) {
+                add_aliasing_image(handle);
+            }
         }
     } else {
         auto mem_state = GetDevMemState(image_state->binding.mem);
         if (mem_state) {
-            bound_images = &mem_state->bound_images;
-        }
-    }
-
-    if (bound_images) {
-        for (const auto &handle : *bound_images) {
-            if (handle != image_state->image) {
-                auto is = GetImageState(handle);
-                if (is && is->IsCompatibleAliasing(image_state)) {
-                    auto inserted = is->aliasing_images.emplace(image_state->image);
-                    if (inserted.second) {
-                        image_state->aliasing_images.emplace(handle);
-                    }
-                }
-            }
+            // Compatible images are bound at the same offset, so only those covering its first byte need checking
+            mem_state->bound_ranges.ForEachOverlapping(image_state->binding.offset, 1,
+                                                       [&add_aliasing_image](const VulkanTypedHandle &handle) {
+                                                           if (handle.type == kVulkanObjectTypeImage) {
+                                                               add_aliasing_image(handle.Cast<VkImage>());
+                                                           }
+                                                       });
         }
     }
 }
@@ -373,22 +367,6 @@ void ValidationStateTracker::RemoveAliasingImages(const std::unordered_set<VkIma
     }
 }
 
-const EVENT_STATE *ValidationStateTracker::GetEventState(VkEvent event) const {
-    auto it = eventMap.find(event);
-    if (it == eventMap.end()) {
-        return nullptr;
-    }
-    return &it->second;
-}
-
-EVENT_STATE *ValidationStateTracker::GetEventState(VkEvent event) {
-    auto it = eventMap.find(event);
-    if (it == eventMap.end()) {
-        return nullptr;
-    }
-    return &it->second;
-}
-
 const QUEUE_STATE *ValidationStateTracker::GetQueueState(VkQueue queue) const {
     auto it = queueMap.find(queue);
     if (it == queueMap.cend()) {
@@ -453,8 +431,9 @@ BINDABLE *ValidationStateTracker::GetObjectMemBinding(const VulkanTypedHandle &t
 void ValidationStateTracker::AddMemObjInfo(void *object, const VkDeviceMemory mem, const VkMemoryAllocateInfo *pAllocateInfo) {
     assert(object != NULL);
 
-    memObjMap[mem] = std::make_shared<DEVICE_MEMORY_STATE>(object, mem, pAllocateInfo);
-    auto mem_info = memObjMap[mem].get();
+    auto mem_state = std::make_shared<DEVICE_MEMORY_STATE>(object, mem, pAllocateInfo);
+    auto mem_info = mem_state.get();
+    memObjMap.insert_or_assign(mem, std::move(mem_state));
 
     auto dedicated = lvl_find_in_chain<VkMemoryDedicatedAllocateInfoKHR>(pAllocateInfo->pNext);
     if (dedicated) {
@@ -474,8 +453,7 @@ void ValidationStateTracker::AddCommandBufferBindingSampler(CMD_BUFFER_STATE *cb
     if (disabled.command_buffer_state) {
         return;
     }
-    AddCommandBufferBinding(sampler_state->cb_bindings,
-                            VulkanTypedHandle(sampler_state->sampler, kVulkanObjectTypeSampler, sampler_state), cb_node);
+    AddCommandBufferBinding(VulkanTypedHandle(sampler_state->sampler, kVulkanObjectTypeSampler, sampler_state), cb_node);
 }
 
 // Create binding link between given image node and command buffer node
@@ -486,15 +464,13 @@ void ValidationStateTracker::AddCommandBufferBindingImage(CMD_BUFFER_STATE *cb_n
     // Skip validation if this image was created through WSI
     if (image_state->create_from_swapchain == VK_NULL_HANDLE) {
         // First update cb binding for image
-        if (AddCommandBufferBinding(image_state->cb_bindings,
-                                    VulkanTypedHandle(image_state->image, kVulkanObjectTypeImage, image_state), cb_node)) {
+        if (AddCommandBufferBinding(VulkanTypedHandle(image_state->image, kVulkanObjectTypeImage, image_state), cb_node)) {
             // Now update CB binding in MemObj mini CB list
             for (auto mem_binding : image_state->GetBoundMemory()) {
                 DEVICE_MEMORY_STATE *pMemInfo = GetDevMemState(mem_binding);
                 if (pMemInfo) {
                     // Now update CBInfo's Mem reference list
-                    AddCommandBufferBinding(pMemInfo->cb_bindings,
-                                            VulkanTypedHandle(mem_binding, kVulkanObjectTypeDeviceMemory, pMemInfo), cb_node);
+                    AddCommandBufferBinding(VulkanTypedHandle(mem_binding, kVulkanObjectTypeDeviceMemory, pMemInfo), cb_node);
                 }
             }
         }
@@ -507,8 +483,7 @@ void ValidationStateTracker::AddCommandBufferBindingImageView(CMD_BUFFER_STATE *
         return;
     }
     // First add bindings for imageView
-    if (AddCommandBufferBinding(view_state->cb_bindings,
-                                VulkanTypedHandle(view_state->image_view, kVulkanObjectTypeImageView, view_state), cb_node)) {
+    if (AddCommandBufferBinding(VulkanTypedHandle(view_state->image_view, kVulkanObjectTypeImageView, view_state), cb_node)) {
         // Only need to continue if this is a new item
         auto image_state = view_state->image_state.get();
         // Add bindings for image within imageView
@@ -524,15 +499,13 @@ void ValidationStateTracker::AddCommandBufferBindingBuffer(CMD_BUFFER_STATE *cb_
         return;
     }
     // First update cb binding for buffer
-    if (AddCommandBufferBinding(buffer_state->cb_bindings,
-                                VulkanTypedHandle(buffer_state->buffer, kVulkanObjectTypeBuffer, buffer_state), cb_node)) {
+    if (AddCommandBufferBinding(VulkanTypedHandle(buffer_state->buffer, kVulkanObjectTypeBuffer, buffer_state), cb_node)) {
         // Now update CB binding in MemObj mini CB list
         for (auto mem_binding : buffer_state->GetBoundMemory()) {
             DEVICE_MEMORY_STATE *pMemInfo = GetDevMemState(mem_binding);
             if (pMemInfo) {
                 // Now update CBInfo's Mem reference list
-                AddCommandBufferBinding(pMemInfo->cb_bindings,
-                                        VulkanTypedHandle(mem_binding, kVulkanObjectTypeDeviceMemory, pMemInfo), cb_node);
+                AddCommandBufferBinding(VulkanTypedHandle(mem_binding, kVulkanObjectTypeDeviceMemory, pMemInfo), cb_node);
             }
         }
     }
@@ -544,8 +517,7 @@ void ValidationStateTracker::AddCommandBufferBindingBufferView(CMD_BUFFER_STATE
         return;
     }
     // First add bindings for bufferView
-    if (AddCommandBufferBinding(view_state->cb_bindings,
-                                VulkanTypedHandle(view_state->buffer_view, kVulkanObjectTypeBufferView, view_state), cb_node)) {
+    if (AddCommandBufferBinding(VulkanTypedHandle(view_state->buffer_view, kVulkanObjectTypeBufferView, view_state), cb_node)) {
         auto buffer_state = view_state->buffer_state.get();
         // Add bindings for buffer within bufferView
         if (buffer_state) {
@@ -561,15 +533,13 @@ void ValidationStateTracker::AddCommandBufferBindingAccelerationStructure(CMD_BU
         return;
     }
     if (AddCommandBufferBinding(
-            as_state->cb_bindings,
             VulkanTypedHandle(as_state->acceleration_structure, kVulkanObjectTypeAccelerationStructureNV, as_state), cb_node)) {
         // Now update CB binding in MemObj mini CB list
         for (auto mem_binding : as_state->GetBoundMemory()) {
             DEVICE_MEMORY_STATE *pMemInfo = GetDevMemState(mem_binding);
             if (pMemInfo) {
                 // Now update CBInfo's Mem reference list
-                AddCommandBufferBinding(pMemInfo->cb_bindings,
-                                        VulkanTypedHandle(mem_binding, kVulkanObjectTypeDeviceMemory, pMemInfo), cb_node);
+                AddCommandBufferBinding(VulkanTypedHandle(mem_binding, kVulkanObjectTypeDeviceMemory, pMemInfo), cb_node);
             }
         }
     }
@@ -723,7 +693,7 @@ void ValidationStateTracker::UpdateDrawState(CMD_BUFFER_STATE *cb_state, const V
             }
         }
     }
-    if (!pPipe->vertex_binding_descriptions_.empty()) {
+    if (!pPipe->vertex_input->bindings.empty()) {
         cb_state->vertex_buffer_used = true;
     }
 }
@@ -731,9 +701,8 @@ void ValidationStateTracker::UpdateDrawState(CMD_BUFFER_STATE *cb_state, const V
 // Remove set from setMap and delete the set
 void ValidationStateTracker::FreeDescriptorSet(cvdescriptorset::DescriptorSet *descriptor_set) {
     descriptor_set->destroyed = true;
-    const VulkanTypedHandle obj_struct(descriptor_set->GetSet(), kVulkanObjectTypeDescriptorSet);
     // Any bound cmd buffers are now invalid
-    InvalidateCommandBuffers(descriptor_set->cb_bindings, obj_struct);
+    InvalidateCommandBuffers(descriptor_set);
 
     setMap.erase(descriptor_set->GetSet());
 }
@@ -741,14 +710,14 @@ void ValidationStateTracker::FreeDescriptorSet(cvdescriptorset::DescriptorSet *d
 // Free all DS Pools including their Sets & related sub-structs
 // NOTE : Calls to this function should be wrapped in mutex
 void ValidationStateTracker::DeleteDescriptorSetPools() {
-    for (auto ii = descriptorPoolMap.begin(); ii != descriptorPoolMap.end();) {
+    for (const auto &pool : descriptorPoolMap.snapshot()) {
         // Remove this pools' sets from setMap and delete them
-        for (auto ds : ii->second->sets) {
+        for (auto ds : pool.second->sets) {
             FreeDescriptorSet(ds);
         }
-        ii->second->sets.clear();
-        ii = descriptorPoolMap.erase(ii);
+        pool.second->sets.clear();
     }
+    descriptorPoolMap.clear();
 }
 
 // For given object struct return a ptr of BASE_NODE type for its wrapping struct
@@ -836,29 +805,89 @@ BASE_NODE *ValidationStateTracker::GetStateStructPtrFromObject(const VulkanTyped
     return base_ptr;
 }
 
-// Tie the VulkanTypedHandle to the cmd buffer which includes:
-//  Add object_binding to cmd buffer
-//  Add cb_binding to object
-bool ValidationStateTracker::AddCommandBufferBinding(small_unordered_map<CMD_BUFFER_STATE *, int, 8> &cb_bindings,
-                                                     const VulkanTypedHandle &obj, CMD_BUFFER_STATE *cb_node) {
+// Tie the VulkanTypedHandle to the cmd buffer, stamped with the object's current uid and generation. Only the command buffer is
+// updated; obj.node must be set. Returns true if the object was not already bound.
+bool ValidationStateTracker::AddCommandBufferBinding(const VulkanTypedHandle &obj, CMD_BUFFER_STATE *cb_node) {
     if (disabled.command_buffer_state) {
         return false;
     }
-    // Insert the cb_binding with a default 'index' of -1. Then push the obj into the object_bindings
-    // vector, and update cb_bindings[cb_node] with the index of that element of the vector.
-    auto inserted = cb_bindings.insert({cb_node, -1});
-    if (inserted.second) {
-        cb_node->object_bindings.push_back(obj);
-        inserted.first->second = (int)cb_node->object_bindings.size() - 1;
+    assert(obj.node);
+    if (cb_node->bound_objects.insert(obj).second) {
+        cb_node->object_bindings.push_back({obj, obj.node->uid, obj.node->generation});
         return true;
     }
     return false;
 }
 
-// For a given object, if cb_node is in that objects cb_bindings, remove cb_node
-void ValidationStateTracker::RemoveCommandBufferBinding(VulkanTypedHandle const &object, CMD_BUFFER_STATE *cb_node) {
-    BASE_NODE *base_obj = GetStateStructPtrFromObject(object);
-    if (base_obj) base_obj->cb_bindings.erase(cb_node);
+// Returns the state of a bound object, or nullptr if the object has been destroyed since it was bound
+const BASE_NODE *ValidationStateTracker::GetBoundObjectState(const CMD_BUFFER_STATE *cb_node,
+                                                             const CommandBufferBinding &binding) const {
+    if (binding.object.type == kVulkanObjectTypeUnknown) return nullptr;  // Cleared by ResolveStaleBindings
+    // Nothing has been destroyed since the bindings were last resolved, so the node pointer is still good
+    if (cb_node->bindings_destroy_count == node_destroy_count.load()) return binding.object.node;
+
+    // Look the handle up afresh: a destroyed object is gone, or its handle now names a different node
+    VulkanTypedHandle lookup = binding.object;
+    lookup.node = nullptr;
+    const BASE_NODE *node = GetStateStructPtrFromObject(lookup);
+    if (node != binding.object.node || node->uid != binding.uid) return nullptr;
+    return node;
+}
+
+// Collect the objects bound to cb_node (and, for a primary, to its secondaries) that have been destroyed or modified
+// since they were bound, but which have not been resolved into broken_bindings yet. Nothing is modified, so this can be
+// used at validation time.
+void ValidationStateTracker::GetStaleBindings(const CMD_BUFFER_STATE *cb_node,
+                                              std::vector<VulkanTypedHandle> *stale_objects) const {
+    if (cb_node->createInfo.level == VK_COMMAND_BUFFER_LEVEL_PRIMARY) {
+        for (const auto *sub_cb_node : cb_node->linkedCommandBuffers) {
+            GetStaleBindings(sub_cb_node, stale_objects);
+        }
+    }
+    if (cb_node->bindings_destroy_count == node_destroy_count.load() &&
+        cb_node->bindings_modify_count == node_modify_count.load()) {
+        return;
+    }
+    for (const auto &binding : cb_node->object_bindings) {
+        if (binding.object.type == kVulkanObjectTypeUnknown) continue;
+        const BASE_NODE *node = GetBoundObjectState(cb_node, binding);
+        if (!node || node->generation != binding.generation) {
+            VulkanTypedHandle stale_object = binding.object;
+            stale_object.node = nullptr;
+            stale_objects->push_back(stale_object);
+        }
+    }
+}
+
+// Move cb_node to an invalid state for every bound object that has been destroyed or modified since it was bound, recording
+// the cause in broken_bindings. Bindings to destroyed objects are cleared so that nothing dereferences them afterwards.
+// Must run before anything uses the node pointers in object_bindings, i.e. at submit and at retire.
+void ValidationStateTracker::ResolveStaleBindings(CMD_BUFFER_STATE *cb_node) {
+    if (cb_node->createInfo.level == VK_COMMAND_BUFFER_LEVEL_PRIMARY) {
+        // Secondaries propagate their own invalidation to the primaries linked to them
+        for (auto *sub_cb_node : cb_node->linkedCommandBuffers) {
+            ResolveStaleBindings(sub_cb_node);
+        }
+    }
+    const uint64_t destroy_count = node_destroy_count.load();
+    const uint64_t modify_count = node_modify_count.load();
+    if (cb_node->bindings_destroy_count == destroy_count && cb_node->bindings_modify_count == modify_count) {
+        return;
+    }
+    for (auto &binding : cb_node->object_bindings) {
+        if (binding.object.type == kVulkanObjectTypeUnknown) continue;
+        const BASE_NODE *node = GetBoundObjectState(cb_node, binding);
+        if (!node) {
+            InvalidateCommandBuffer(cb_node, binding.object);
+            binding.object = VulkanTypedHandle();
+        } else if (node->generation != binding.generation) {
+            InvalidateCommandBuffer(cb_node, binding.object);
+            // Report each modification once; the object is still bound and still counts as in use
+            binding.generation = node->generation;
+        }
+    }
+    cb_node->bindings_destroy_count = destroy_count;
+    cb_node->bindings_modify_count = modify_count;
 }
 
 // Reset the command buffer state
@@ -867,6 +896,7 @@ void ValidationStateTracker::ResetCommandBufferState(const VkCommandBuffer cb) {
     CMD_BUFFER_STATE *pCB = GetCBState(cb);
     if (pCB) {
         pCB->in_use.store(0);
+        pCB->submission_stamps.clear();
         // Reset CB state (note that createInfo is not cleared)
         pCB->commandBuffer = cb;
         memset(&pCB->beginInfo, 0, sizeof(VkCommandBufferBeginInfo));
@@ -893,6 +923,8 @@ void ValidationStateTracker::ResetCommandBufferState(const VkCommandBuffer cb) {
         pCB->activeSubpassContents = VK_SUBPASS_CONTENTS_INLINE;
         pCB->activeSubpass = 0;
         pCB->broken_bindings.clear();
+        pCB->bindings_destroy_count = node_destroy_count.load();
+        pCB->bindings_modify_count = node_modify_count.load();
         pCB->waitedEvents.clear();
         pCB->events.clear();
         pCB->writeEventsBeforeWait.clear();
@@ -916,17 +948,12 @@ void ValidationStateTracker::ResetCommandBufferState(const VkCommandBuffer cb) {
         pCB->cmd_execute_commands_functions.clear();
         pCB->eventUpdates.clear();
         pCB->queryUpdates.clear();
+        pCB->ended_queries.clear();
+        pCB->ended_queries_valid = false;
 
-        // Remove object bindings
-        for (const auto &obj : pCB->object_bindings) {
-            RemoveCommandBufferBinding(obj, pCB);
-        }
+        // Remove object bindings. Objects don't link back to the command buffer, so there is nothing else to unlink.
         pCB->object_bindings.clear();
-        // Remove this cmdBuffer's reference from each FrameBuffer's CB ref list
-        for (auto framebuffer : pCB->framebuffers) {
-            auto fb_state = GetFramebufferState(framebuffer);
-            if (fb_state) fb_state->cb_bindings.erase(pCB);
-        }
+        pCB->bound_objects.clear();
         pCB->framebuffers.clear();
         pCB->activeFramebuffer = VK_NULL_HANDLE;
         memset(&pCB->index_buffer_binding, 0, sizeof(pCB->index_buffer_binding));
@@ -1409,13 +1436,21 @@ void ValidationStateTracker::PostCallRecordCreateDevice(VkPhysicalDevice gpu, co
                 std::make_pair(pCreateInfo->pQueueCreateInfos[i].queueFamilyIndex, pCreateInfo->pQueueCreateInfos[i].queueCount));
         }
     }
+
+    const std::string retirement_thread = getLayerOption("khronos_validation.queue_retirement_thread");
+    if (retirement_thread == "true") {
+        state_tracker->retirement_thread.reset(new QueueRetirementThread(state_tracker, *pDevice));
+    }
 }
 
 void ValidationStateTracker::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
     if (!device) return;
 
-    // Reset all command buffers before destroying them, to unlink object_bindings.
-    for (auto &commandBuffer : commandBufferMap) {
+    // Stop retiring in the background before the queues and the objects their submissions refer to go away
+    retirement_thread.reset();
+
+    // Reset all command buffers before destroying them, to unlink them from each other.
+    for (const auto &commandBuffer : commandBufferMap.snapshot()) {
         ResetCommandBufferState(commandBuffer.first);
     }
     pipelineMap.clear();
@@ -1432,26 +1467,27 @@ void ValidationStateTracker::PreCallRecordDestroyDevice(VkDevice device, const V
     bufferViewMap.clear();
     bufferMap.clear();
     // Queues persist until device is destroyed
+    queue_states.clear();
     queueMap.clear();
 }
 
-// Loop through bound objects and increment their in_use counts.
-void ValidationStateTracker::IncrementBoundObjects(CMD_BUFFER_STATE const *cb_node) {
-    for (auto obj : cb_node->object_bindings) {
-        auto base_obj = GetStateStructPtrFromObject(obj);
-        if (base_obj) {
-            base_obj->in_use.fetch_add(1);
+// Mark the objects bound to cb_node as used by submission seq on queue. Must follow ResolveStaleBindings, so that the node
+// pointers in the bindings are current.
+void ValidationStateTracker::StampBoundObjects(CMD_BUFFER_STATE const *cb_node, const QUEUE_STATE *queue, uint64_t seq) {
+    for (const auto &binding : cb_node->object_bindings) {
+        if (binding.object.node) {
+            binding.object.node->StampSubmission(queue, seq);
         }
     }
 }
 
-// Track which resources are in-flight by atomically incrementing their "in_use" count
-void ValidationStateTracker::IncrementResources(CMD_BUFFER_STATE *cb_node) {
+// Track which resources are in-flight: the command buffer by its "in_use" count, its bound objects by submission stamp
+void ValidationStateTracker::IncrementResources(CMD_BUFFER_STATE *cb_node, const QUEUE_STATE *queue, uint64_t seq) {
     cb_node->submitCount++;
     cb_node->in_use.fetch_add(1);
 
-    // First Increment for all "generic" objects bound to cmd buffer, followed by special-case objects below
-    IncrementBoundObjects(cb_node);
+    // First stamp all "generic" objects bound to cmd buffer, followed by special-case objects below
+    StampBoundObjects(cb_node, queue, seq);
     // TODO : We should be able to remove the NULL look-up checks from the code below as long as
     //  all the corresponding cases are verified to cause CB_INVALID state and the CB_INVALID state
     //  should then be flagged prior to calling this function
@@ -1461,21 +1497,8 @@ void ValidationStateTracker::IncrementResources(CMD_BUFFER_STATE *cb_node) {
     }
 }
 
-// Decrement in-use count for objects bound to command buffer
-void ValidationStateTracker::DecrementBoundResources(CMD_BUFFER_STATE const *cb_node) {
-    BASE_NODE *base_obj = nullptr;
-    for (auto obj : cb_node->object_bindings) {
-        base_obj = GetStateStructPtrFromObject(obj);
-        if (base_obj) {
-            base_obj->in_use.fetch_sub(1);
-        }
-    }
-}
-
-void ValidationStateTracker::RetireWorkOnQueue(QUEUE_STATE *pQueue, uint64_t seq) {
-    std::unordered_map<VkQueue, uint64_t> otherQueueSeqs;
-
-    // Roll this queue forward, one submission at a time.
+// Roll this queue forward, one submission at a time, without regard to other queues
+void ValidationStateTracker::RetireQueueSubmissions(QUEUE_STATE *pQueue, uint64_t seq) {
     while (pQueue->seq < seq) {
         auto &submission = pQueue->submissions.front();
 
@@ -1484,8 +1507,6 @@ void ValidationStateTracker::RetireWorkOnQueue(QUEUE_STATE *pQueue, uint64_t seq
             if (pSemaphore) {
                 pSemaphore->in_use.fetch_sub(1);
             }
-            auto &lastSeq = otherQueueSeqs[wait.queue];
-            lastSeq = std::max(lastSeq, wait.seq);
         }
 
         for (auto &semaphore : submission.signalSemaphores) {
@@ -1507,27 +1528,31 @@ void ValidationStateTracker::RetireWorkOnQueue(QUEUE_STATE *pQueue, uint64_t seq
             if (!cb_node) {
                 continue;
             }
-            // First perform decrement on general case bound objects
-            DecrementBoundResources(cb_node);
+            // Bound objects need no update: advancing pQueue->seq past their submission stamps retires them
             for (auto event : cb_node->writeEventsBeforeWait) {
-                auto eventNode = eventMap.find(event);
-                if (eventNode != eventMap.end()) {
-                    eventNode->second.write_in_use--;
+                auto event_state = GetEventState(event);
+                if (event_state) {
+                    event_state->write_in_use--;
                 }
             }
-            QueryMap localQueryToStateMap;
-            for (auto &function : cb_node->queryUpdates) {
-                function(nullptr, /*do_validate*/ false, &localQueryToStateMap);
+            if (!cb_node->ended_queries_valid) {
+                QueryMap localQueryToStateMap;
+                for (auto &function : cb_node->queryUpdates) {
+                    function(nullptr, /*do_validate*/ false, &localQueryToStateMap);
+                }
+                localQueryToStateMap.ForEach([cb_node](VkQueryPool pool, uint32_t query, QueryState state) {
+                    if (state == QUERYSTATE_ENDED) cb_node->ended_queries.emplace_back(pool, query);
+                });
+                cb_node->ended_queries_valid = true;
             }
 
-            for (auto queryStatePair : localQueryToStateMap) {
-                if (queryStatePair.second == QUERYSTATE_ENDED) {
-                    queryToStateMap[queryStatePair.first] = QUERYSTATE_AVAILABLE;
-
-                    const QUERY_POOL_STATE *qp_state = GetQueryPoolState(queryStatePair.first.pool);
-                    if (qp_state->createInfo.queryType == VK_QUERY_TYPE_PERFORMANCE_QUERY_KHR)
-                        queryPassToStateMap[QueryObjectPass(queryStatePair.first, submission.perf_submit_pass)] =
-                            QUERYSTATE_AVAILABLE;
+            QUERY_POOL_STATE *qp_state = nullptr;
+            for (const auto &query : cb_node->ended_queries) {
+                if (!qp_state || qp_state->pool != query.first) qp_state = GetQueryPoolState(query.first);
+                if (!qp_state) continue;
+                qp_state->SetQueryState(query.second, QUERYSTATE_AVAILABLE);
+                if (qp_state->createInfo.queryType == VK_QUERY_TYPE_PERFORMANCE_QUERY_KHR) {
+                    qp_state->SetPassState(query.second, submission.perf_submit_pass, QUERYSTATE_AVAILABLE);
                 }
             }
             cb_node->in_use.fetch_sub(1);
@@ -1541,13 +1566,166 @@ void ValidationStateTracker::RetireWorkOnQueue(QUEUE_STATE *pQueue, uint64_t seq
         pQueue->submissions.pop_front();
         pQueue->seq++;
     }
+}
 
-    // Roll other queues forward to the highest seq we saw a wait for
-    for (auto qs : otherQueueSeqs) {
-        RetireWorkOnQueue(GetQueueState(qs.first), qs.second);
+void ValidationStateTracker::RetireWorkOnQueue(QUEUE_STATE *pQueue, uint64_t seq) {
+    seq = std::min(seq, pQueue->seq + pQueue->submissions.size());
+    if (seq <= pQueue->seq) return;
+
+    // Roll other queues forward as far as submission seq depends on them. The dependencies are transitive, so none of the
+    // submissions retired here depend on anything past them. pQueue goes last, as its submission holds the dependencies.
+    const auto &dependency_seqs = pQueue->submissions[seq - pQueue->seq - 1].dependency_seqs;
+    for (size_t ordinal = 0; ordinal < dependency_seqs.size(); ++ordinal) {
+        QUEUE_STATE *other_queue = queue_states[ordinal];
+        if (other_queue != pQueue) {
+            RetireQueueSubmissions(other_queue, dependency_seqs[ordinal]);
+        }
     }
+    RetireQueueSubmissions(pQueue, seq);
 }
 
+// Fill in the dependencies of the submission just added to pQueue
+void ValidationStateTracker::RecordSubmissionDependencies(QUEUE_STATE *pQueue) {
+    const size_t count = pQueue->submissions.size();
+    auto &submission = pQueue->submissions.back();
+    auto &dependency_seqs = submission.dependency_seqs;
+    dependency_seqs.assign(queue_states.size(), 0);
+
+    auto merge = [&dependency_seqs](const std::vector<uint64_t> &other_seqs) {
+        for (size_t ordinal = 0; ordinal < other_seqs.size(); ++ordinal) {
+            dependency_seqs[ordinal] = std::max(dependency_seqs[ordinal], other_seqs[ordinal]);
+        }
+    };
+    // Everything the previous submission on this queue depends on...
+    if (count > 1) {
+        merge(pQueue->submissions[count - 2].dependency_seqs);
+    }
+    // ... and each waited-on submission, along with everything it depends on, unless it has already retired
+    for (const auto &wait : submission.waitSemaphores) {
+        const QUEUE_STATE *other_queue = GetQueueState(wait.queue);
+        if (!other_queue) continue;
+        auto &dependency_seq = dependency_seqs[other_queue->ordinal];
+        dependency_seq = std::max(dependency_seq, wait.seq);
+        if (wait.seq > other_queue->seq) {
+            merge(other_queue->submissions[wait.seq - other_queue->seq - 1].dependency_seqs);
+        }
+    }
+    dependency_seqs[pQueue->ordinal] = pQueue->seq + count;
+}
+
+// How long the retirement thread blocks in vkWaitForFences before picking up newly pushed fences
+static const uint64_t kRetirementWaitTimeoutNs = 2000000;
+// How long it waits before retrying when the application holds the tracker's lock
+static const std::chrono::microseconds kRetirementRetryInterval(500);
+
+QueueRetirementThread::QueueRetirementThread(ValidationStateTracker *tracker, VkDevice device)
+    : tracker_(tracker), device_(device), thread_(&QueueRetirementThread::Run, this) {}
+
+QueueRetirementThread::~QueueRetirementThread() {
+    {
+        std::unique_lock<std::mutex> lock(lock_);
+        stopping_ = true;
+    }
+    wake_.notify_one();
+    thread_.join();
+
+    // The device is idle by the time it is destroyed, so none of these are still in use
+    for (const auto &pending : pushed_) DispatchDestroyFence(device_, pending.fence, nullptr);
+    for (const auto &pending : waiting_) DispatchDestroyFence(device_, pending.fence, nullptr);
+    for (const auto &pending : completed_) DispatchDestroyFence(device_, pending.fence, nullptr);
+    for (auto fence : free_fences_) DispatchDestroyFence(device_, fence, nullptr);
+}
+
+void QueueRetirementThread::Push(VkQueue queue, QUEUE_STATE *queue_state, uint64_t seq) {
+    std::unique_lock<std::mutex> lock(lock_);
+    if (failed_) return;
+    VkFence fence = VK_NULL_HANDLE;
+    if (!free_fences_.empty()) {
+        fence = free_fences_.back();
+        free_fences_.pop_back();
+    } else {
+        VkFenceCreateInfo fence_info = {VK_STRUCTURE_TYPE_FENCE_CREATE_INFO, nullptr, 0};
+        if (DispatchCreateFence(device_, &fence_info, nullptr, &fence) != VK_SUCCESS) fence = VK_NULL_HANDLE;
+    }
+    // An empty batch: the fence signals once everything already submitted to the queue has completed
+    if ((fence == VK_NULL_HANDLE) || (DispatchQueueSubmit(queue, 0, nullptr, fence) != VK_SUCCESS)) {
+        if (fence != VK_NULL_HANDLE) free_fences_.push_back(fence);
+        failed_ = true;
+    } else {
+        pushed_.push_back({queue_state, seq, fence});
+    }
+    lock.unlock();
+    wake_.notify_one();
+}
+
+void QueueRetirementThread::Run() {
+    std::vector<VkFence> fences;
+    std::unique_lock<std::mutex> lock(lock_);
+    // Every fence the thread holds stays in pushed_, waiting_, completed_ or free_fences_ when it stops, for the destructor to
+    // destroy
+    while (!stopping_ && !failed_) {
+        if (waiting_.empty() && completed_.empty()) {
+            wake_.wait(lock, [this] { return stopping_ || failed_ || !pushed_.empty(); });
+        } else if (!completed_.empty()) {
+            wake_.wait_for(lock, kRetirementRetryInterval, [this] { return stopping_ || failed_; });
+        }
+        if (stopping_ || failed_) break;
+        waiting_.insert(waiting_.end(), pushed_.begin(), pushed_.end());
+        pushed_.clear();
+        lock.unlock();
+
+        if (!waiting_.empty()) {
+            fences.clear();
+            for (const auto &pending : waiting_) fences.push_back(pending.fence);
+            const VkResult wait_result = DispatchWaitForFences(device_, static_cast<uint32_t>(fences.size()), fences.data(),
+                                                               VK_FALSE, kRetirementWaitTimeoutNs);
+            bool failed = (wait_result != VK_SUCCESS) && (wait_result != VK_TIMEOUT);
+            auto still_waiting = waiting_.begin();
+            for (const auto &pending : waiting_) {
+                const VkResult status = failed ? VK_NOT_READY : DispatchGetFenceStatus(device_, pending.fence);
+                if (status == VK_SUCCESS) {
+                    completed_.push_back(pending);
+                } else {
+                    failed |= (status != VK_NOT_READY);
+                    *still_waiting++ = pending;
+                }
+            }
+            waiting_.erase(still_waiting, waiting_.end());
+            if (failed) {
+                // e.g. VK_ERROR_DEVICE_LOST: the fences may never signal, so leave retirement to the application's waits
+                lock.lock();
+                failed_ = true;
+                break;
+            }
+        }
+
+        if (!completed_.empty()) {
+            // Never block on the tracker: destruction joins this thread while holding the lock. RetireWorkOnQueue ignores
+            // work the application's own waits have already retired.
+            write_lock_guard_t tracker_lock(tracker_->validation_object_mutex, std::try_to_lock);
+            if (tracker_lock.owns_lock()) {
+                for (const auto &pending : completed_) {
+                    tracker_->RetireWorkOnQueue(pending.queue_state, pending.seq);
+                }
+                tracker_lock.unlock();
+                fences.clear();
+                for (const auto &pending : completed_) fences.push_back(pending.fence);
+                const VkResult reset_result = DispatchResetFences(device_, static_cast<uint32_t>(fences.size()), fences.data());
+                lock.lock();
+                if (reset_result != VK_SUCCESS) {
+                    failed_ = true;
+                    break;
+                }
+                free_fences_.insert(free_fences_.end(), fences.begin(), fences.end());
+                completed_.clear();
+                continue;
+            }
+        }
+        lock.lock();
+    }
+}
+
+
 // Submit a fence to a queue, delimiting previous fences and previous untracked
 // work by it.
 static void SubmitFence(QUEUE_STATE *pQueue, FENCE_STATE *pFence, uint64_t submitCount) {
@@ -1572,6 +1750,7 @@ void ValidationStateTracker::PostCallRecordQueueSubmit(VkQueue queue, uint32_t s
                 // its completion.
                 pQueue->submissions.emplace_back(std::vector<VkCommandBuffer>(), std::vector<SEMAPHORE_WAIT>(),
                                                  std::vector<VkSemaphore>(), std::vector<VkSemaphore>(), fence, 0);
+                RecordSubmissionDependencies(pQueue);
             }
         } else {
             // Retire work up until this fence early, we will not see the wait that corresponds to this signal
@@ -1583,6 +1762,7 @@ void ValidationStateTracker::PostCallRecordQueueSubmit(VkQueue queue, uint32_t s
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
         std::vector<VkCommandBuffer> cbs;
         const VkSubmitInfo *submit = &pSubmits[submit_idx];
+        const uint64_t submit_seq = pQueue->seq + pQueue->submissions.size() + 1;
         vector<SEMAPHORE_WAIT> semaphore_waits;
         vector<VkSemaphore> semaphore_signals;
         vector<VkSemaphore> semaphore_externals;
@@ -1614,7 +1794,7 @@ void ValidationStateTracker::PostCallRecordQueueSubmit(VkQueue queue, uint32_t s
                 if (pSemaphore->scope == kSyncScopeInternal) {
                     if (pSemaphore->type == VK_SEMAPHORE_TYPE_BINARY_KHR) {
                         pSemaphore->signaler.first = queue;
-                        pSemaphore->signaler.second = pQueue->seq + pQueue->submissions.size() + 1;
+                        pSemaphore->signaler.second = submit_seq;
                         pSemaphore->signaled = true;
                     } else {
                         pSemaphore->payload = timeline_semaphore_submit->pSignalSemaphoreValues[i];
@@ -1623,7 +1803,7 @@ void ValidationStateTracker::PostCallRecordQueueSubmit(VkQueue queue, uint32_t s
                     semaphore_signals.push_back(semaphore);
                 } else {
                     // Retire work up until this submit early, we will not see the wait that corresponds to this signal
-                    early_retire_seq = std::max(early_retire_seq, pQueue->seq + pQueue->submissions.size() + 1);
+                    early_retire_seq = std::max(early_retire_seq, submit_seq);
                 }
             }
         }
@@ -1631,20 +1811,23 @@ void ValidationStateTracker::PostCallRecordQueueSubmit(VkQueue queue, uint32_t s
             auto cb_node = GetCBState(submit->pCommandBuffers[i]);
             if (cb_node) {
                 cbs.push_back(submit->pCommandBuffers[i]);
+                ResolveStaleBindings(cb_node);
                 for (auto secondaryCmdBuffer : cb_node->linkedCommandBuffers) {
                     cbs.push_back(secondaryCmdBuffer->commandBuffer);
-                    IncrementResources(secondaryCmdBuffer);
+                    IncrementResources(secondaryCmdBuffer, pQueue, submit_seq);
                 }
-                IncrementResources(cb_node);
+                IncrementResources(cb_node, pQueue, submit_seq);
 
                 QueryMap localQueryToStateMap;
                 for (auto &function : cb_node->queryUpdates) {
                     function(nullptr, /*do_validate*/ false, &localQueryToStateMap);
                 }
 
-                for (auto queryStatePair : localQueryToStateMap) {
-                    queryToStateMap[queryStatePair.first] = queryStatePair.second;
-                }
+                QUERY_POOL_STATE *qp_state = nullptr;
+                localQueryToStateMap.ForEach([&](VkQueryPool pool, uint32_t query, QueryState state) {
+                    if (!qp_state || qp_state->pool != pool) qp_state = GetQueryPoolState(pool);
+                    if (qp_state) qp_state->SetQueryState(query, state);
+                });
 
                 EventToStageMap localEventToStageMap;
                 for (auto &function : cb_node->eventUpdates) {
@@ -1652,7 +1835,8 @@ void ValidationStateTracker::PostCallRecordQueueSubmit(VkQueue queue, uint32_t s
                 }
 
                 for (auto eventStagePair : localEventToStageMap) {
-                    eventMap[eventStagePair.first].stageMask = eventStagePair.second;
+                    auto event_state = GetEventState(eventStagePair.first);
+                    if (event_state) event_state->stageMask = eventStagePair.second;
                 }
             }
         }
@@ -1662,11 +1846,15 @@ void ValidationStateTracker::PostCallRecordQueueSubmit(VkQueue queue, uint32_t s
         pQueue->submissions.emplace_back(cbs, semaphore_waits, semaphore_signals, semaphore_externals,
                                          submit_idx == submitCount - 1 ? fence : (VkFence)VK_NULL_HANDLE,
                                          perf_submit ? perf_submit->counterPassIndex : 0);
+        RecordSubmissionDependencies(pQueue);
     }
 
     if (early_retire_seq) {
         RetireWorkOnQueue(pQueue, early_retire_seq);
     }
+    if (retirement_thread && VK_SUCCESS == result && !pQueue->submissions.empty()) {
+        retirement_thread->Push(queue, pQueue, pQueue->seq + pQueue->submissions.size());
+    }
 }
 
 void ValidationStateTracker::PostCallRecordAllocateMemory(VkDevice device, const VkMemoryAllocateInfo *pAllocateInfo,
@@ -1681,7 +1869,6 @@ void ValidationStateTracker::PostCallRecordAllocateMemory(VkDevice device, const
 void ValidationStateTracker::PreCallRecordFreeMemory(VkDevice device, VkDeviceMemory mem, const VkAllocationCallbacks *pAllocator) {
     if (!mem) return;
     DEVICE_MEMORY_STATE *mem_info = GetDevMemState(mem);
-    const VulkanTypedHandle obj_struct(mem, kVulkanObjectTypeDeviceMemory);
 
     // Clear mem binding for any bound objects
     for (const auto &obj : mem_info->obj_bindings) {
@@ -1705,10 +1892,14 @@ void ValidationStateTracker::PreCallRecordFreeMemory(VkDevice device, VkDeviceMe
         if (bindable_state) {
             bindable_state->binding.mem = MEMORY_UNBOUND;
             bindable_state->UpdateBoundMemorySet();
+            // The ranges indexed in this memory go with it
+            auto &ranges = bindable_state->indexed_ranges;
+            ranges.erase(std::remove_if(ranges.begin(), ranges.end(), [mem](const MEM_BINDING &range) { return range.mem == mem; }),
+                         ranges.end());
         }
     }
     // Any bound cmd buffers are now invalid
-    InvalidateCommandBuffers(mem_info->cb_bindings, obj_struct);
+    InvalidateCommandBuffers(mem_info);
     RemoveAliasingImages(mem_info->bound_images);
     mem_info->destroyed = true;
     memObjMap.erase(mem);
@@ -1728,6 +1919,7 @@ void ValidationStateTracker::PostCallRecordQueueBindSparse(VkQueue queue, uint32
                 // No work to do, just dropping a fence in the queue by itself.
                 pQueue->submissions.emplace_back(std::vector<VkCommandBuffer>(), std::vector<SEMAPHORE_WAIT>(),
                                                  std::vector<VkSemaphore>(), std::vector<VkSemaphore>(), fence, 0);
+                RecordSubmissionDependencies(pQueue);
             }
         } else {
             // Retire work up until this fence early, we will not see the wait that corresponds to this signal
@@ -1804,11 +1996,15 @@ void ValidationStateTracker::PostCallRecordQueueBindSparse(VkQueue queue, uint32
 
         pQueue->submissions.emplace_back(std::vector<VkCommandBuffer>(), semaphore_waits, semaphore_signals, semaphore_externals,
                                          bindIdx == bindInfoCount - 1 ? fence : (VkFence)VK_NULL_HANDLE, 0);
+        RecordSubmissionDependencies(pQueue);
     }
 
     if (early_retire_seq) {
         RetireWorkOnQueue(pQueue, early_retire_seq);
     }
+    if (retirement_thread && !pQueue->submissions.empty()) {
+        retirement_thread->Push(queue, pQueue, pQueue->seq + pQueue->submissions.size());
+    }
 }
 
 void ValidationStateTracker::PostCallRecordCreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo *pCreateInfo,
@@ -1827,7 +2023,7 @@ void ValidationStateTracker::PostCallRecordCreateSemaphore(VkDevice device, cons
         semaphore_state->type = semaphore_type_create_info->semaphoreType;
         semaphore_state->payload = semaphore_type_create_info->initialValue;
     }
-    semaphoreMap[*pSemaphore] = std::move(semaphore_state);
+    semaphoreMap.insert_or_assign(*pSemaphore, std::move(semaphore_state));
 }
 
 void ValidationStateTracker::RecordImportSemaphoreState(VkSemaphore semaphore, VkExternalSemaphoreHandleTypeFlagBitsKHR handle_type,
@@ -1899,7 +2095,9 @@ void ValidationStateTracker::RecordGetDeviceQueueState(uint32_t queue_family_ind
         QUEUE_STATE *queue_state = &queueMap[queue];
         queue_state->queue = queue;
         queue_state->queueFamilyIndex = queue_family_index;
+        queue_state->ordinal = static_cast<uint32_t>(queue_states.size());
         queue_state->seq = 0;
+        queue_states.push_back(queue_state);
     }
 }
 
@@ -1943,8 +2141,7 @@ void ValidationStateTracker::PreCallRecordDestroySemaphore(VkDevice device, VkSe
 void ValidationStateTracker::PreCallRecordDestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks *pAllocator) {
     if (!event) return;
     EVENT_STATE *event_state = GetEventState(event);
-    const VulkanTypedHandle obj_struct(event, kVulkanObjectTypeEvent);
-    InvalidateCommandBuffers(event_state->cb_bindings, obj_struct);
+    InvalidateCommandBuffers(event_state);
     eventMap.erase(event);
 }
 
@@ -1952,72 +2149,146 @@ void ValidationStateTracker::PreCallRecordDestroyQueryPool(VkDevice device, VkQu
                                                            const VkAllocationCallbacks *pAllocator) {
     if (!queryPool) return;
     QUERY_POOL_STATE *qp_state = GetQueryPoolState(queryPool);
-    const VulkanTypedHandle obj_struct(queryPool, kVulkanObjectTypeQueryPool);
-    InvalidateCommandBuffers(qp_state->cb_bindings, obj_struct);
+    InvalidateCommandBuffers(qp_state);
     qp_state->destroyed = true;
     queryPoolMap.erase(queryPool);
 }
 
+void MemoryBindingIndex::Insert(const VulkanTypedHandle &handle, VkDeviceSize offset, VkDeviceSize size) {
+    const Range range = MakeRange(offset, size);
+    auto pos = segments_.lower_bound(range);
+    VkDeviceSize current = range.begin;
+    while (current < range.end) {
+        if (pos == segments_.end() || pos->first.begin >= range.end) {
+            // Nothing else is bound over the rest of range
+            segments_.insert(pos, std::make_pair(Range(current, range.end), Handles(1, handle)));
+            break;
+        }
+        if (current < pos->first.begin) {
+            // Nothing else is bound up to the next segment
+            segments_.insert(pos, std::make_pair(Range(current, pos->first.begin), Handles(1, handle)));
+            current = pos->first.begin;
+            continue;
+        }
+        if (pos->first.begin < current) {
+            // The first segment starts before range, keep the part before it as is
+            pos = segments_.split(pos, current, sparse_container::split_op_keep_both());
+            ++pos;
+        }
+        if (range.end < pos->first.end) {
+            pos = segments_.split(pos, range.end, sparse_container::split_op_keep_both());
+        }
+        pos->second.push_back(handle);
+        current = pos->first.end;
+        ++pos;
+    }
+}
+
+void MemoryBindingIndex::Remove(const VulkanTypedHandle &handle, VkDeviceSize offset, VkDeviceSize size) {
+    const Range range = MakeRange(offset, size);
+    auto pos = segments_.lower_bound(range);
+    while (pos != segments_.end() && pos->first.begin < range.end) {
+        auto &handles = pos->second;
+        auto found = std::find(handles.begin(), handles.end(), handle);
+        if (found != handles.end()) {
+            *found = handles.back();
+            handles.pop_back();
+        }
+        if (handles.empty()) {
+            pos = segments_.erase(pos);
+        } else {
+            ++pos;
+        }
+    }
+    Coalesce(range);
+}
+
+void MemoryBindingIndex::Coalesce(const Range &range) {
+    auto pos = segments_.lower_bound(range);
+    if (pos != segments_.begin()) --pos;
+    if (pos == segments_.end()) return;
+    auto next = pos;
+    ++next;
+    while (next != segments_.end() && next->first.begin <= range.end) {
+        if (pos->first.end == next->first.begin && pos->second.size() == next->second.size() &&
+            std::is_permutation(pos->second.begin(), pos->second.end(), next->second.begin())) {
+            auto joined = std::make_pair(Range(pos->first.begin, next->first.end), std::move(pos->second));
+            segments_.erase(pos);
+            next = segments_.erase(next);
+            pos = segments_.insert(next, std::move(joined));
+        } else {
+            pos = next;
+            ++next;
+        }
+    }
+}
+
 // Object with given handle is being bound to memory w/ given mem_info struct.
 //  Track the newly bound memory range with given memoryOffset
-//  Also scan any previous ranges, track aliased ranges with new range, and flag an error if a linear
-//  and non-linear range incorrectly overlap.
-// Return true if an error is flagged and the user callback returns "true", otherwise false
-// is_image indicates an image object, otherwise handle is for a buffer
 // is_linear indicates a buffer or linear image
-void ValidationStateTracker::InsertMemoryRange(const VulkanTypedHandle &typed_handle, DEVICE_MEMORY_STATE *mem_info,
-                                               VkDeviceSize memoryOffset, VkMemoryRequirements memRequirements, bool is_linear) {
+void ValidationStateTracker::InsertMemoryRange(const VulkanTypedHandle &typed_handle, BINDABLE *bindable,
+                                               DEVICE_MEMORY_STATE *mem_info, VkDeviceSize memoryOffset,
+                                               VkMemoryRequirements memRequirements, bool is_linear) {
     if (typed_handle.type == kVulkanObjectTypeImage) {
         mem_info->bound_images.insert(typed_handle.Cast<VkImage>());
-    } else if (typed_handle.type == kVulkanObjectTypeBuffer) {
-        mem_info->bound_buffers.insert(typed_handle.handle);
-    } else if (typed_handle.type == kVulkanObjectTypeAccelerationStructureNV) {
-        mem_info->bound_acceleration_structures.insert(typed_handle.handle);
-    } else {
+    } else if (typed_handle.type != kVulkanObjectTypeBuffer && typed_handle.type != kVulkanObjectTypeAccelerationStructureNV) {
         // Unsupported object type
         assert(false);
     }
+    mem_info->bound_ranges.Insert(typed_handle, memoryOffset, memRequirements.size);
+    bindable->indexed_ranges.push_back({mem_info->mem, memoryOffset, memRequirements.size});
 }
 
 void ValidationStateTracker::InsertImageMemoryRange(VkImage image, DEVICE_MEMORY_STATE *mem_info, VkDeviceSize mem_offset,
                                                     VkMemoryRequirements mem_reqs, bool is_linear) {
-    InsertMemoryRange(VulkanTypedHandle(image, kVulkanObjectTypeImage), mem_info, mem_offset, mem_reqs, is_linear);
+    InsertMemoryRange(VulkanTypedHandle(image, kVulkanObjectTypeImage), GetImageState(image), mem_info, mem_offset, mem_reqs,
+                      is_linear);
 }
 
 void ValidationStateTracker::InsertBufferMemoryRange(VkBuffer buffer, DEVICE_MEMORY_STATE *mem_info, VkDeviceSize mem_offset,
                                                      const VkMemoryRequirements &mem_reqs) {
-    InsertMemoryRange(VulkanTypedHandle(buffer, kVulkanObjectTypeBuffer), mem_info, mem_offset, mem_reqs, true);
+    InsertMemoryRange(VulkanTypedHandle(buffer, kVulkanObjectTypeBuffer), GetBufferState(buffer), mem_info, mem_offset, mem_reqs,
+                      true);
 }
 
 void ValidationStateTracker::InsertAccelerationStructureMemoryRange(VkAccelerationStructureNV as, DEVICE_MEMORY_STATE *mem_info,
                                                                     VkDeviceSize mem_offset, const VkMemoryRequirements &mem_reqs) {
-    InsertMemoryRange(VulkanTypedHandle(as, kVulkanObjectTypeAccelerationStructureNV), mem_info, mem_offset, mem_reqs, true);
+    InsertMemoryRange(VulkanTypedHandle(as, kVulkanObjectTypeAccelerationStructureNV), GetAccelerationStructureState(as), mem_info,
+                      mem_offset, mem_reqs, true);
 }
 
-// This function will remove the handle-to-index mapping from the appropriate map.
-static void RemoveMemoryRange(const VulkanTypedHandle &typed_handle, DEVICE_MEMORY_STATE *mem_info) {
+// Undoes InsertMemoryRange for every range bindable was inserted into mem_info with. Sparse bindings are never inserted, so
+// there's nothing to remove for them.
+static void RemoveMemoryRange(const VulkanTypedHandle &typed_handle, BINDABLE *bindable, DEVICE_MEMORY_STATE *mem_info) {
     if (typed_handle.type == kVulkanObjectTypeImage) {
         mem_info->bound_images.erase(typed_handle.Cast<VkImage>());
-    } else if (typed_handle.type == kVulkanObjectTypeBuffer) {
-        mem_info->bound_buffers.erase(typed_handle.handle);
-    } else if (typed_handle.type == kVulkanObjectTypeAccelerationStructureNV) {
-        mem_info->bound_acceleration_structures.erase(typed_handle.handle);
-    } else {
+    } else if (typed_handle.type != kVulkanObjectTypeBuffer && typed_handle.type != kVulkanObjectTypeAccelerationStructureNV) {
         // Unsupported object type
         assert(false);
     }
+    auto &ranges = bindable->indexed_ranges;
+    for (size_t i = 0; i < ranges.size();) {
+        if (ranges[i].mem == mem_info->mem) {
+            mem_info->bound_ranges.Remove(typed_handle, ranges[i].offset, ranges[i].size);
+            ranges[i] = ranges.back();
+            ranges.pop_back();
+        } else {
+            ++i;
+        }
+    }
 }
 
-void ValidationStateTracker::RemoveBufferMemoryRange(VkBuffer buffer, DEVICE_MEMORY_STATE *mem_info) {
-    RemoveMemoryRange(VulkanTypedHandle(buffer, kVulkanObjectTypeBuffer), mem_info);
-}
-
-void ValidationStateTracker::RemoveImageMemoryRange(VkImage image, DEVICE_MEMORY_STATE *mem_info) {
-    RemoveMemoryRange(VulkanTypedHandle(image, kVulkanObjectTypeImage), mem_info);
-}
-
-void ValidationStateTracker::RemoveAccelerationStructureMemoryRange(VkAccelerationStructureNV as, DEVICE_MEMORY_STATE *mem_info) {
-    RemoveMemoryRange(VulkanTypedHandle(as, kVulkanObjectTypeAccelerationStructureNV), mem_info);
+// Undoes InsertMemoryRange for every memory the object is bound to
+void ValidationStateTracker::RemoveMemoryRanges(const VulkanTypedHandle &typed_handle, BINDABLE *bindable) {
+    auto &ranges = bindable->indexed_ranges;
+    while (!ranges.empty()) {
+        auto mem_info = GetDevMemState(ranges.back().mem);
+        if (mem_info) {
+            RemoveMemoryRange(typed_handle, bindable, mem_info);
+        } else {
+            ranges.pop_back();
+        }
+    }
 }
 
 void ValidationStateTracker::UpdateBindBufferMemoryState(VkBuffer buffer, VkDeviceMemory mem, VkDeviceSize memoryOffset) {
@@ -2157,9 +2428,8 @@ void ValidationStateTracker::PreCallRecordDestroyPipeline(VkDevice device, VkPip
                                                           const VkAllocationCallbacks *pAllocator) {
     if (!pipeline) return;
     PIPELINE_STATE *pipeline_state = GetPipelineState(pipeline);
-    const VulkanTypedHandle obj_struct(pipeline, kVulkanObjectTypePipeline);
     // Any bound cmd buffers are now invalid
-    InvalidateCommandBuffers(pipeline_state->cb_bindings, obj_struct);
+    InvalidateCommandBuffers(pipeline_state);
     pipeline_state->destroyed = true;
     pipelineMap.erase(pipeline);
 }
@@ -2176,10 +2446,9 @@ void ValidationStateTracker::PreCallRecordDestroySampler(VkDevice device, VkSamp
                                                          const VkAllocationCallbacks *pAllocator) {
     if (!sampler) return;
     SAMPLER_STATE *sampler_state = GetSamplerState(sampler);
-    const VulkanTypedHandle obj_struct(sampler, kVulkanObjectTypeSampler);
     // Any bound cmd buffers are now invalid
     if (sampler_state) {
-        InvalidateCommandBuffers(sampler_state->cb_bindings, obj_struct);
+        InvalidateCommandBuffers(sampler_state);
     }
     sampler_state->destroyed = true;
     samplerMap.erase(sampler);
@@ -2188,10 +2457,9 @@ void ValidationStateTracker::PreCallRecordDestroySampler(VkDevice device, VkSamp
 void ValidationStateTracker::PreCallRecordDestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout,
                                                                      const VkAllocationCallbacks *pAllocator) {
     if (!descriptorSetLayout) return;
-    auto layout_it = descriptorSetLayoutMap.find(descriptorSetLayout);
+    auto layout_it = descriptorSetLayoutMap.pop(descriptorSetLayout);
     if (layout_it != descriptorSetLayoutMap.end()) {
         layout_it->second.get()->destroyed = true;
-        descriptorSetLayoutMap.erase(layout_it);
     }
 }
 
@@ -2199,10 +2467,9 @@ void ValidationStateTracker::PreCallRecordDestroyDescriptorPool(VkDevice device,
                                                                 const VkAllocationCallbacks *pAllocator) {
     if (!descriptorPool) return;
     DESCRIPTOR_POOL_STATE *desc_pool_state = GetDescriptorPoolState(descriptorPool);
-    const VulkanTypedHandle obj_struct(descriptorPool, kVulkanObjectTypeDescriptorPool);
     if (desc_pool_state) {
         // Any bound cmd buffers are now invalid
-        InvalidateCommandBuffers(desc_pool_state->cb_bindings, obj_struct);
+        InvalidateCommandBuffers(desc_pool_state);
         // Free sets that were in this pool
         for (auto ds : desc_pool_state->sets) {
             FreeDescriptorSet(ds);
@@ -2246,7 +2513,7 @@ void ValidationStateTracker::PostCallRecordCreateCommandPool(VkDevice device, co
     auto cmd_pool_state = std::make_shared<COMMAND_POOL_STATE>();
     cmd_pool_state->createFlags = pCreateInfo->flags;
     cmd_pool_state->queueFamilyIndex = pCreateInfo->queueFamilyIndex;
-    commandPoolMap[*pCommandPool] = std::move(cmd_pool_state);
+    commandPoolMap.insert_or_assign(*pCommandPool, std::move(cmd_pool_state));
 }
 
 void ValidationStateTracker::PostCallRecordCreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo *pCreateInfo,
@@ -2278,13 +2545,13 @@ void ValidationStateTracker::PostCallRecordCreateQueryPool(VkDevice device, cons
                                                                       &query_pool_state->n_performance_passes);
     }
 
-    queryPoolMap[*pQueryPool] = std::move(query_pool_state);
-
-    QueryObject query_obj{*pQueryPool, 0u};
-    for (uint32_t i = 0; i < pCreateInfo->queryCount; ++i) {
-        query_obj.query = i;
-        queryToStateMap[query_obj] = QUERYSTATE_UNKNOWN;
+    query_pool_state->query_states.assign(pCreateInfo->queryCount, QUERYSTATE_UNKNOWN);
+    if (pCreateInfo->queryType == VK_QUERY_TYPE_PERFORMANCE_QUERY_KHR) {
+        query_pool_state->pass_states.assign(
+            static_cast<size_t>(pCreateInfo->queryCount) * query_pool_state->n_performance_passes, QUERYSTATE_UNKNOWN);
     }
+
+    queryPoolMap.insert_or_assign(*pQueryPool, std::move(query_pool_state));
 }
 
 void ValidationStateTracker::PreCallRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
@@ -2326,33 +2593,32 @@ void ValidationStateTracker::PostCallRecordResetFences(VkDevice device, uint32_t
     }
 }
 
-// For given cb_nodes, invalidate them and track object causing invalidation.
-// InvalidateCommandBuffers and InvalidateLinkedCommandBuffers are essentially
-// the same, except one takes a map and one takes a set, and InvalidateCommandBuffers
-// can also unlink objects from command buffers.
-void ValidationStateTracker::InvalidateCommandBuffers(small_unordered_map<CMD_BUFFER_STATE *, int, 8> &cb_nodes,
-                                                      const VulkanTypedHandle &obj, bool unlink) {
-    for (const auto &cb_node_pair : cb_nodes) {
-        auto &cb_node = cb_node_pair.first;
-        if (cb_node->state == CB_RECORDING) {
-            cb_node->state = CB_INVALID_INCOMPLETE;
-        } else if (cb_node->state == CB_RECORDED) {
-            cb_node->state = CB_INVALID_COMPLETE;
-        }
-        cb_node->broken_bindings.push_back(obj);
+// Invalidate cb_node, tracking the object causing invalidation. If secondary, the primaries that will call it are invalidated too.
+void ValidationStateTracker::InvalidateCommandBuffer(CMD_BUFFER_STATE *cb_node, const VulkanTypedHandle &obj) {
+    if (cb_node->state == CB_RECORDING) {
+        cb_node->state = CB_INVALID_INCOMPLETE;
+    } else if (cb_node->state == CB_RECORDED) {
+        cb_node->state = CB_INVALID_COMPLETE;
+    }
+    VulkanTypedHandle broken_object = obj;
+    broken_object.node = nullptr;  // The node may already be gone
+    cb_node->broken_bindings.push_back(broken_object);
 
-        // if secondary, then propagate the invalidation to the primaries that will call us.
-        if (cb_node->createInfo.level == VK_COMMAND_BUFFER_LEVEL_SECONDARY) {
-            InvalidateLinkedCommandBuffers(cb_node->linkedCommandBuffers, obj);
-        }
-        if (unlink) {
-            int index = cb_node_pair.second;
-            assert(cb_node->object_bindings[index] == obj);
-            cb_node->object_bindings[index] = VulkanTypedHandle();
-        }
+    // if secondary, then propagate the invalidation to the primaries that will call us.
+    if (cb_node->createInfo.level == VK_COMMAND_BUFFER_LEVEL_SECONDARY) {
+        InvalidateLinkedCommandBuffers(cb_node->linkedCommandBuffers, broken_object);
     }
-    if (unlink) {
-        cb_nodes.clear();
+}
+
+// Invalidate all command buffers bound to node, because node is being destroyed or modified. This only bumps the
+// generation counts; each bound command buffer notices in ResolveStaleBindings (or GetStaleBindings) the next time it is
+// validated, so the cost doesn't depend on how many command buffers node is bound to.
+void ValidationStateTracker::InvalidateCommandBuffers(BASE_NODE *node, bool destroyed) {
+    node->generation = BASE_NODE::NextGeneration();
+    if (destroyed) {
+        node_destroy_count++;
+    } else {
+        node_modify_count++;
     }
 }
 
@@ -2377,8 +2643,7 @@ void ValidationStateTracker::PreCallRecordDestroyFramebuffer(VkDevice device, Vk
                                                              const VkAllocationCallbacks *pAllocator) {
     if (!framebuffer) return;
     FRAMEBUFFER_STATE *framebuffer_state = GetFramebufferState(framebuffer);
-    const VulkanTypedHandle obj_struct(framebuffer, kVulkanObjectTypeFramebuffer);
-    InvalidateCommandBuffers(framebuffer_state->cb_bindings, obj_struct);
+    InvalidateCommandBuffers(framebuffer_state);
     framebuffer_state->destroyed = true;
     frameBufferMap.erase(framebuffer);
 }
@@ -2387,8 +2652,7 @@ void ValidationStateTracker::PreCallRecordDestroyRenderPass(VkDevice device, VkR
                                                             const VkAllocationCallbacks *pAllocator) {
     if (!renderPass) return;
     RENDER_PASS_STATE *rp_state = GetRenderPassState(renderPass);
-    const VulkanTypedHandle obj_struct(renderPass, kVulkanObjectTypeRenderPass);
-    InvalidateCommandBuffers(rp_state->cb_bindings, obj_struct);
+    InvalidateCommandBuffers(rp_state);
     rp_state->destroyed = true;
     renderPassMap.erase(renderPass);
 }
@@ -2400,7 +2664,7 @@ void ValidationStateTracker::PostCallRecordCreateFence(VkDevice device, const Vk
     fence_state->fence = *pFence;
     fence_state->createInfo = *pCreateInfo;
     fence_state->state = (pCreateInfo->flags & VK_FENCE_CREATE_SIGNALED_BIT) ? FENCE_RETIRED : FENCE_UNSIGNALED;
-    fenceMap[*pFence] = std::move(fence_state);
+    fenceMap.insert_or_assign(*pFence, std::move(fence_state));
 }
 
 bool ValidationStateTracker::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
@@ -2428,7 +2692,8 @@ void ValidationStateTracker::PostCallRecordCreateGraphicsPipelines(VkDevice devi
     for (uint32_t i = 0; i < count; i++) {
         if (pPipelines[i] != VK_NULL_HANDLE) {
             (cgpl_state->pipe_state)[i]->pipeline = pPipelines[i];
-            pipelineMap[pPipelines[i]] = std::move((cgpl_state->pipe_state)[i]);
+            (cgpl_state->pipe_state)[i]->ReleaseCreateTimeState();
+            pipelineMap.insert_or_assign(pPipelines[i], std::move((cgpl_state->pipe_state)[i]));
         }
     }
     cgpl_state->pipe_state.clear();
@@ -2460,7 +2725,8 @@ void ValidationStateTracker::PostCallRecordCreateComputePipelines(VkDevice devic
     for (uint32_t i = 0; i < count; i++) {
         if (pPipelines[i] != VK_NULL_HANDLE) {
             (ccpl_state->pipe_state)[i]->pipeline = pPipelines[i];
-            pipelineMap[pPipelines[i]] = std::move((ccpl_state->pipe_state)[i]);
+            (ccpl_state->pipe_state)[i]->ReleaseCreateTimeState();
+            pipelineMap.insert_or_assign(pPipelines[i], std::move((ccpl_state->pipe_state)[i]));
         }
     }
     ccpl_state->pipe_state.clear();
@@ -2490,7 +2756,8 @@ void ValidationStateTracker::PostCallRecordCreateRayTracingPipelinesNV(
     for (uint32_t i = 0; i < count; i++) {
         if (pPipelines[i] != VK_NULL_HANDLE) {
             (crtpl_state->pipe_state)[i]->pipeline = pPipelines[i];
-            pipelineMap[pPipelines[i]] = std::move((crtpl_state->pipe_state)[i]);
+            (crtpl_state->pipe_state)[i]->ReleaseCreateTimeState();
+            pipelineMap.insert_or_assign(pPipelines[i], std::move((crtpl_state->pipe_state)[i]));
         }
     }
     crtpl_state->pipe_state.clear();
@@ -2499,7 +2766,7 @@ void ValidationStateTracker::PostCallRecordCreateRayTracingPipelinesNV(
 void ValidationStateTracker::PostCallRecordCreateSampler(VkDevice device, const VkSamplerCreateInfo *pCreateInfo,
                                                          const VkAllocationCallbacks *pAllocator, VkSampler *pSampler,
                                                          VkResult result) {
-    samplerMap[*pSampler] = std::make_shared<SAMPLER_STATE>(pSampler, pCreateInfo);
+    samplerMap.insert_or_assign(*pSampler, std::make_shared<SAMPLER_STATE>(pSampler, pCreateInfo));
 }
 
 void ValidationStateTracker::PostCallRecordCreateDescriptorSetLayout(VkDevice device,
@@ -2507,7 +2774,7 @@ void ValidationStateTracker::PostCallRecordCreateDescriptorSetLayout(VkDevice de
                                                                      const VkAllocationCallbacks *pAllocator,
                                                                      VkDescriptorSetLayout *pSetLayout, VkResult result) {
     if (VK_SUCCESS != result) return;
-    descriptorSetLayoutMap[*pSetLayout] = std::make_shared<cvdescriptorset::DescriptorSetLayout>(pCreateInfo, *pSetLayout);
+    descriptorSetLayoutMap.insert_or_assign(*pSetLayout, std::make_shared<cvdescriptorset::DescriptorSetLayout>(pCreateInfo, *pSetLayout));
 }
 
 // For repeatable sorting, not very useful for "memory in range" search
@@ -2582,14 +2849,14 @@ void ValidationStateTracker::PostCallRecordCreatePipelineLayout(VkDevice device,
         pipeline_layout_state->compat_for_set.emplace_back(
             GetCanonicalId(i, pipeline_layout_state->push_constant_ranges, set_layouts_id));
     }
-    pipelineLayoutMap[*pPipelineLayout] = std::move(pipeline_layout_state);
+    pipelineLayoutMap.insert_or_assign(*pPipelineLayout, std::move(pipeline_layout_state));
 }
 
 void ValidationStateTracker::PostCallRecordCreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo *pCreateInfo,
                                                                 const VkAllocationCallbacks *pAllocator,
                                                                 VkDescriptorPool *pDescriptorPool, VkResult result) {
     if (VK_SUCCESS != result) return;
-    descriptorPoolMap[*pDescriptorPool] = std::make_shared<DESCRIPTOR_POOL_STATE>(*pDescriptorPool, pCreateInfo);
+    descriptorPoolMap.insert_or_assign(*pDescriptorPool, std::make_shared<DESCRIPTOR_POOL_STATE>(*pDescriptorPool, pCreateInfo));
 }
 
 void ValidationStateTracker::PostCallRecordResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
@@ -2640,7 +2907,7 @@ void ValidationStateTracker::PreCallRecordFreeDescriptorSets(VkDevice device, Vk
     // For each freed descriptor add its resources back into the pool as available and remove from pool and setMap
     for (uint32_t i = 0; i < count; ++i) {
         if (pDescriptorSets[i] != VK_NULL_HANDLE) {
-            auto descriptor_set = setMap[pDescriptorSets[i]].get();
+            auto descriptor_set = GetSetNode(pDescriptorSets[i]);
             uint32_t type_index = 0, descriptor_count = 0;
             for (uint32_t j = 0; j < descriptor_set->GetBindingCount(); ++j) {
                 type_index = static_cast<uint32_t>(descriptor_set->GetTypeFromIndex(j));
@@ -2674,7 +2941,7 @@ void ValidationStateTracker::PostCallRecordAllocateCommandBuffers(VkDevice devic
             pCB->device = device;
             pCB->command_pool = pPool;
             // Add command buffer to map
-            commandBufferMap[pCommandBuffer[i]] = std::move(pCB);
+            commandBufferMap.insert_or_assign(pCommandBuffer[i], std::move(pCB));
             ResetCommandBufferState(pCommandBuffer[i]);
         }
     }
@@ -2682,8 +2949,7 @@ void ValidationStateTracker::PostCallRecordAllocateCommandBuffers(VkDevice devic
 
 // Add bindings between the given cmd buffer & framebuffer and the framebuffer's children
 void ValidationStateTracker::AddFramebufferBinding(CMD_BUFFER_STATE *cb_state, FRAMEBUFFER_STATE *fb_state) {
-    AddCommandBufferBinding(fb_state->cb_bindings, VulkanTypedHandle(fb_state->framebuffer, kVulkanObjectTypeFramebuffer, fb_state),
-                            cb_state);
+    AddCommandBufferBinding(VulkanTypedHandle(fb_state->framebuffer, kVulkanObjectTypeFramebuffer, fb_state), cb_state);
     // If imageless fb, skip fb binding
     if (fb_state->createInfo.flags & VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT_KHR) return;
     const uint32_t attachmentCount = fb_state->createInfo.attachmentCount;
@@ -2819,27 +3085,6 @@ CBStatusFlags MakeStaticStateMask(VkPipelineDynamicStateCreateInfo const *ds) {
 
 // Validation cache:
 // CV is the bottommost implementor of this extension. Don't pass calls down.
-// utility function to set collective state for pipeline
-void SetPipelineState(PIPELINE_STATE *pPipe) {
-    // If any attachment used by this pipeline has blendEnable, set top-level blendEnable
-    if (pPipe->graphicsPipelineCI.pColorBlendState) {
-        for (size_t i = 0; i < pPipe->attachments.size(); ++i) {
-            if (VK_TRUE == pPipe->attachments[i].blendEnable) {
-                if (((pPipe->attachments[i].dstAlphaBlendFactor >= VK_BLEND_FACTOR_CONSTANT_COLOR) &&
-                     (pPipe->attachments[i].dstAlphaBlendFactor <= VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_ALPHA)) ||
-                    ((pPipe->attachments[i].dstColorBlendFactor >= VK_BLEND_FACTOR_CONSTANT_COLOR) &&
-                     (pPipe->attachments[i].dstColorBlendFactor <= VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_ALPHA)) ||
-                    ((pPipe->attachments[i].srcAlphaBlendFactor >= VK_BLEND_FACTOR_CONSTANT_COLOR) &&
-                     (pPipe->attachments[i].srcAlphaBlendFactor <= VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_ALPHA)) ||
-                    ((pPipe->attachments[i].srcColorBlendFactor >= VK_BLEND_FACTOR_CONSTANT_COLOR) &&
-                     (pPipe->attachments[i].srcColorBlendFactor <= VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_ALPHA))) {
-                    pPipe->blendConstantsEnabled = true;
-                }
-            }
-        }
-    }
-}
-
 void ValidationStateTracker::PreCallRecordCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
                                                           VkPipeline pipeline) {
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
@@ -2848,13 +3093,12 @@ void ValidationStateTracker::PreCallRecordCmdBindPipeline(VkCommandBuffer comman
     auto pipe_state = GetPipelineState(pipeline);
     if (VK_PIPELINE_BIND_POINT_GRAPHICS == pipelineBindPoint) {
         cb_state->status &= ~cb_state->static_status;
-        cb_state->static_status = MakeStaticStateMask(pipe_state->graphicsPipelineCI.ptr()->pDynamicState);
+        cb_state->static_status = pipe_state->static_state_mask;
         cb_state->status |= cb_state->static_status;
     }
     ResetCommandBufferPushConstantDataIfIncompatible(cb_state, pipe_state->pipeline_layout->layout);
     cb_state->lastBound[pipelineBindPoint].pipeline_state = pipe_state;
-    SetPipelineState(pipe_state);
-    AddCommandBufferBinding(pipe_state->cb_bindings, VulkanTypedHandle(pipeline, kVulkanObjectTypePipeline), cb_state);
+    AddCommandBufferBinding(VulkanTypedHandle(pipeline, kVulkanObjectTypePipeline, pipe_state), cb_state);
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport,
@@ -2921,7 +3165,7 @@ void ValidationStateTracker::PostCallRecordCreateAccelerationStructureNV(VkDevic
     DispatchGetAccelerationStructureMemoryRequirementsNV(device, &update_memory_req_info,
                                                          &as_state->update_scratch_memory_requirements);
 
-    accelerationStructureMap[*pAccelerationStructure] = std::move(as_state);
+    accelerationStructureMap.insert_or_assign(*pAccelerationStructure, std::move(as_state));
 }
 
 void ValidationStateTracker::PostCallRecordGetAccelerationStructureMemoryRequirementsNV(
@@ -2960,7 +3204,7 @@ void ValidationStateTracker::PostCallRecordBindAccelerationStructureMemoryNV(
                           VulkanTypedHandle(info.accelerationStructure, kVulkanObjectTypeAccelerationStructureNV));
 
             // GPU validation of top level acceleration structure building needs acceleration structure handles.
-            if (enabled.gpu_validation) {
+            if (VVL_ENABLE_GPU_ASSISTED && enabled.gpu_validation) {
                 DispatchGetAccelerationStructureHandleNV(device, info.accelerationStructure, 8, &as_state->opaque_handle);
             }
         }
@@ -3012,13 +3256,8 @@ void ValidationStateTracker::PreCallRecordDestroyAccelerationStructureNV(VkDevic
     auto *as_state = GetAccelerationStructureState(accelerationStructure);
     if (as_state) {
         const VulkanTypedHandle obj_struct(accelerationStructure, kVulkanObjectTypeAccelerationStructureNV);
-        InvalidateCommandBuffers(as_state->cb_bindings, obj_struct);
-        for (auto mem_binding : as_state->GetBoundMemory()) {
-            auto mem_info = GetDevMemState(mem_binding);
-            if (mem_info) {
-                RemoveAccelerationStructureMemoryRange(accelerationStructure, mem_info);
-            }
-        }
+        InvalidateCommandBuffers(as_state);
+        RemoveMemoryRanges(obj_struct, as_state);
         ClearMemoryObjectBindings(obj_struct);
         as_state->destroyed = true;
         accelerationStructureMap.erase(accelerationStructure);
@@ -3300,7 +3539,7 @@ void ValidationStateTracker::PreCallRecordCmdSetEvent(VkCommandBuffer commandBuf
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     auto event_state = GetEventState(event);
     if (event_state) {
-        AddCommandBufferBinding(event_state->cb_bindings, VulkanTypedHandle(event, kVulkanObjectTypeEvent, event_state), cb_state);
+        AddCommandBufferBinding(VulkanTypedHandle(event, kVulkanObjectTypeEvent, event_state), cb_state);
     }
     cb_state->events.push_back(event);
     if (!cb_state->waitedEvents.count(event)) {
@@ -3317,7 +3556,7 @@ void ValidationStateTracker::PreCallRecordCmdResetEvent(VkCommandBuffer commandB
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     auto event_state = GetEventState(event);
     if (event_state) {
-        AddCommandBufferBinding(event_state->cb_bindings, VulkanTypedHandle(event, kVulkanObjectTypeEvent, event_state), cb_state);
+        AddCommandBufferBinding(VulkanTypedHandle(event, kVulkanObjectTypeEvent, event_state), cb_state);
     }
     cb_state->events.push_back(event);
     if (!cb_state->waitedEvents.count(event)) {
@@ -3341,55 +3580,47 @@ void ValidationStateTracker::PreCallRecordCmdWaitEvents(VkCommandBuffer commandB
     for (uint32_t i = 0; i < eventCount; ++i) {
         auto event_state = GetEventState(pEvents[i]);
         if (event_state) {
-            AddCommandBufferBinding(event_state->cb_bindings, VulkanTypedHandle(pEvents[i], kVulkanObjectTypeEvent, event_state),
-                                    cb_state);
+            AddCommandBufferBinding(VulkanTypedHandle(pEvents[i], kVulkanObjectTypeEvent, event_state), cb_state);
         }
         cb_state->waitedEvents.insert(pEvents[i]);
         cb_state->events.push_back(pEvents[i]);
     }
 }
 
-bool ValidationStateTracker::SetQueryState(QueryObject object, QueryState value, QueryMap *localQueryToStateMap) {
-    (*localQueryToStateMap)[object] = value;
+bool ValidationStateTracker::SetQueryState(QueryObject object, uint32_t pool_query_count, QueryState value,
+                                           QueryMap *localQueryToStateMap) {
+    localQueryToStateMap->Set(object.pool, pool_query_count, object.query, value);
     return false;
 }
 
-bool ValidationStateTracker::SetQueryStateMulti(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, QueryState value,
-                                                QueryMap *localQueryToStateMap) {
-    for (uint32_t i = 0; i < queryCount; i++) {
-        QueryObject object = {queryPool, firstQuery + i};
-        (*localQueryToStateMap)[object] = value;
-    }
+bool ValidationStateTracker::SetQueryStateMulti(VkQueryPool queryPool, uint32_t pool_query_count, uint32_t firstQuery,
+                                                uint32_t queryCount, QueryState value, QueryMap *localQueryToStateMap) {
+    localQueryToStateMap->SetRange(queryPool, pool_query_count, firstQuery, queryCount, value);
     return false;
 }
 
 QueryState ValidationStateTracker::GetQueryState(const QueryMap *localQueryToStateMap, VkQueryPool queryPool,
                                                  uint32_t queryIndex) const {
-    QueryObject query = {queryPool, queryIndex};
-
-    const std::array<const decltype(queryToStateMap) *, 2> map_list = {localQueryToStateMap, &queryToStateMap};
-
-    for (const auto map : map_list) {
-        auto query_data = map->find(query);
-        if (query_data != map->end()) {
-            return query_data->second;
-        }
+    QueryState state;
+    if (localQueryToStateMap->Find(queryPool, queryIndex, &state)) {
+        return state;
     }
-    return QUERYSTATE_UNKNOWN;
+    const QUERY_POOL_STATE *query_pool_state = GetQueryPoolState(queryPool);
+    return query_pool_state ? query_pool_state->GetQueryState(queryIndex) : QUERYSTATE_UNKNOWN;
 }
 
 void ValidationStateTracker::RecordCmdBeginQuery(CMD_BUFFER_STATE *cb_state, const QueryObject &query_obj) {
     if (disabled.query_validation) return;
     cb_state->activeQueries.insert(query_obj);
     cb_state->startedQueries.insert(query_obj);
-    cb_state->queryUpdates.emplace_back(
-        [query_obj](const ValidationStateTracker *device_data, bool do_validate, QueryMap *localQueryToStateMap) {
-            SetQueryState(query_obj, QUERYSTATE_RUNNING, localQueryToStateMap);
-            return false;
-        });
     auto pool_state = GetQueryPoolState(query_obj.pool);
-    AddCommandBufferBinding(pool_state->cb_bindings, VulkanTypedHandle(query_obj.pool, kVulkanObjectTypeQueryPool, pool_state),
-                            cb_state);
+    const uint32_t pool_query_count = pool_state ? pool_state->createInfo.queryCount : 0;
+    cb_state->queryUpdates.emplace_back([query_obj, pool_query_count](const ValidationStateTracker *device_data, bool do_validate,
+                                                                      QueryMap *localQueryToStateMap) {
+        SetQueryState(query_obj, pool_query_count, QUERYSTATE_RUNNING, localQueryToStateMap);
+        return false;
+    });
+    AddCommandBufferBinding(VulkanTypedHandle(query_obj.pool, kVulkanObjectTypeQueryPool, pool_state), cb_state);
 }
 
 void ValidationStateTracker::PostCallRecordCmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t slot,
@@ -3403,13 +3634,13 @@ void ValidationStateTracker::PostCallRecordCmdBeginQuery(VkCommandBuffer command
 void ValidationStateTracker::RecordCmdEndQuery(CMD_BUFFER_STATE *cb_state, const QueryObject &query_obj) {
     if (disabled.query_validation) return;
     cb_state->activeQueries.erase(query_obj);
-    cb_state->queryUpdates.emplace_back(
-        [query_obj](const ValidationStateTracker *device_data, bool do_validate, QueryMap *localQueryToStateMap) {
-            return SetQueryState(query_obj, QUERYSTATE_ENDED, localQueryToStateMap);
-        });
     auto pool_state = GetQueryPoolState(query_obj.pool);
-    AddCommandBufferBinding(pool_state->cb_bindings, VulkanTypedHandle(query_obj.pool, kVulkanObjectTypeQueryPool, pool_state),
-                            cb_state);
+    const uint32_t pool_query_count = pool_state ? pool_state->createInfo.queryCount : 0;
+    cb_state->queryUpdates.emplace_back([query_obj, pool_query_count](const ValidationStateTracker *device_data, bool do_validate,
+                                                                      QueryMap *localQueryToStateMap) {
+        return SetQueryState(query_obj, pool_query_count, QUERYSTATE_ENDED, localQueryToStateMap);
+    });
+    AddCommandBufferBinding(VulkanTypedHandle(query_obj.pool, kVulkanObjectTypeQueryPool, pool_state), cb_state);
 }
 
 void ValidationStateTracker::PostCallRecordCmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t slot) {
@@ -3423,14 +3654,15 @@ void ValidationStateTracker::PostCallRecordCmdResetQueryPool(VkCommandBuffer com
                                                              uint32_t firstQuery, uint32_t queryCount) {
     if (disabled.query_validation) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
+    auto pool_state = GetQueryPoolState(queryPool);
+    const uint32_t pool_query_count = pool_state ? pool_state->createInfo.queryCount : 0;
 
-    cb_state->queryUpdates.emplace_back([queryPool, firstQuery, queryCount](const ValidationStateTracker *device_data,
-                                                                            bool do_validate, QueryMap *localQueryToStateMap) {
-        return SetQueryStateMulti(queryPool, firstQuery, queryCount, QUERYSTATE_RESET, localQueryToStateMap);
+    cb_state->queryUpdates.emplace_back([queryPool, pool_query_count, firstQuery, queryCount](
+                                            const ValidationStateTracker *device_data, bool do_validate,
+                                            QueryMap *localQueryToStateMap) {
+        return SetQueryStateMulti(queryPool, pool_query_count, firstQuery, queryCount, QUERYSTATE_RESET, localQueryToStateMap);
     });
-    auto pool_state = GetQueryPoolState(queryPool);
-    AddCommandBufferBinding(pool_state->cb_bindings, VulkanTypedHandle(queryPool, kVulkanObjectTypeQueryPool, pool_state),
-                            cb_state);
+    AddCommandBufferBinding(VulkanTypedHandle(queryPool, kVulkanObjectTypeQueryPool, pool_state), cb_state);
 }
 
 void ValidationStateTracker::PostCallRecordCmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool,
@@ -3442,8 +3674,7 @@ void ValidationStateTracker::PostCallRecordCmdCopyQueryPoolResults(VkCommandBuff
     auto dst_buff_state = GetBufferState(dstBuffer);
     AddCommandBufferBindingBuffer(cb_state, dst_buff_state);
     auto pool_state = GetQueryPoolState(queryPool);
-    AddCommandBufferBinding(pool_state->cb_bindings, VulkanTypedHandle(queryPool, kVulkanObjectTypeQueryPool, pool_state),
-                            cb_state);
+    AddCommandBufferBinding(VulkanTypedHandle(queryPool, kVulkanObjectTypeQueryPool, pool_state), cb_state);
 }
 
 void ValidationStateTracker::PostCallRecordCmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage,
@@ -3451,13 +3682,13 @@ void ValidationStateTracker::PostCallRecordCmdWriteTimestamp(VkCommandBuffer com
     if (disabled.query_validation) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     auto pool_state = GetQueryPoolState(queryPool);
-    AddCommandBufferBinding(pool_state->cb_bindings, VulkanTypedHandle(queryPool, kVulkanObjectTypeQueryPool, pool_state),
-                            cb_state);
+    AddCommandBufferBinding(VulkanTypedHandle(queryPool, kVulkanObjectTypeQueryPool, pool_state), cb_state);
     QueryObject query = {queryPool, slot};
-    cb_state->queryUpdates.emplace_back(
-        [query](const ValidationStateTracker *device_data, bool do_validate, QueryMap *localQueryToStateMap) {
-            return SetQueryState(query, QUERYSTATE_ENDED, localQueryToStateMap);
-        });
+    const uint32_t pool_query_count = pool_state ? pool_state->createInfo.queryCount : 0;
+    cb_state->queryUpdates.emplace_back([query, pool_query_count](const ValidationStateTracker *device_data, bool do_validate,
+                                                                  QueryMap *localQueryToStateMap) {
+        return SetQueryState(query, pool_query_count, QUERYSTATE_ENDED, localQueryToStateMap);
+    });
 }
 
 void ValidationStateTracker::PostCallRecordCreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo *pCreateInfo,
@@ -3476,7 +3707,7 @@ void ValidationStateTracker::PostCallRecordCreateFramebuffer(VkDevice device, co
             }
         }
     }
-    frameBufferMap[*pFramebuffer] = std::move(fb_state);
+    frameBufferMap.insert_or_assign(*pFramebuffer, std::move(fb_state));
 }
 
 void ValidationStateTracker::RecordRenderPassDAG(RenderPassCreateVersion rp_version, const VkRenderPassCreateInfo2KHR *pCreateInfo,
@@ -3536,7 +3767,7 @@ void ValidationStateTracker::RecordCreateRenderPassState(RenderPassCreateVersion
     }
 
     // Even though render_pass is an rvalue-ref parameter, still must move s.t. move assignment is invoked.
-    renderPassMap[*pRenderPass] = std::move(render_pass);
+    renderPassMap.insert_or_assign(*pRenderPass, std::move(render_pass));
 }
 
 // Style note:
@@ -3589,8 +3820,7 @@ void ValidationStateTracker::RecordCmdBeginRenderPassState(VkCommandBuffer comma
         // Connect this framebuffer and its children to this cmdBuffer
         AddFramebufferBinding(cb_state, framebuffer);
         // Connect this RP to cmdBuffer
-        AddCommandBufferBinding(render_pass_state->cb_bindings,
-                                VulkanTypedHandle(render_pass_state->renderPass, kVulkanObjectTypeRenderPass, render_pass_state),
+        AddCommandBufferBinding(VulkanTypedHandle(render_pass_state->renderPass, kVulkanObjectTypeRenderPass, render_pass_state),
                                 cb_state);
 
         auto chained_device_group_struct = lvl_find_in_chain<VkDeviceGroupRenderPassBeginInfo>(pRenderPassBegin->pNext);
@@ -3876,8 +4106,10 @@ void ValidationStateTracker::PostCallRecordGetFenceFdKHR(VkDevice device, const
 void ValidationStateTracker::PostCallRecordCreateEvent(VkDevice device, const VkEventCreateInfo *pCreateInfo,
                                                        const VkAllocationCallbacks *pAllocator, VkEvent *pEvent, VkResult result) {
     if (VK_SUCCESS != result) return;
-    eventMap[*pEvent].write_in_use = 0;
-    eventMap[*pEvent].stageMask = VkPipelineStageFlags(0);
+    auto event_state = std::make_shared<EVENT_STATE>();
+    event_state->write_in_use = 0;
+    event_state->stageMask = VkPipelineStageFlags(0);
+    eventMap.insert_or_assign(*pEvent, std::move(event_state));
 }
 
 void ValidationStateTracker::RecordCreateSwapchainState(VkResult result, const VkSwapchainCreateInfoKHR *pCreateInfo,
@@ -3890,7 +4122,7 @@ void ValidationStateTracker::RecordCreateSwapchainState(VkResult result, const V
             swapchain_state->shared_presentable = true;
         }
         surface_state->swapchain = swapchain_state.get();
-        swapchainMap[*pSwapchain] = std::move(swapchain_state);
+        swapchainMap.insert_or_assign(*pSwapchain, std::move(swapchain_state));
     } else {
         surface_state->swapchain = nullptr;
     }
@@ -4091,7 +4323,7 @@ void ValidationStateTracker::PreCallRecordDestroySurfaceKHR(VkInstance instance,
 }
 
 void ValidationStateTracker::RecordVulkanSurface(VkSurfaceKHR *pSurface) {
-    surface_map[*pSurface] = std::make_shared<SURFACE_STATE>(*pSurface);
+    surface_map.insert_or_assign(*pSurface, std::make_shared<SURFACE_STATE>(*pSurface));
 }
 
 void ValidationStateTracker::PostCallRecordCreateDisplayPlaneSurfaceKHR(VkInstance instance,
@@ -4411,7 +4643,7 @@ bool ValidationStateTracker::PreCallValidateReleaseProfilingLockKHR(VkDevice dev
 
 void ValidationStateTracker::PostCallRecordReleaseProfilingLockKHR(VkDevice device) {
     performance_lock_acquired = false;
-    for (auto &cmd_buffer : commandBufferMap) {
+    for (const auto &cmd_buffer : commandBufferMap.snapshot()) {
         cmd_buffer.second->performance_lock_released = true;
     }
 }
@@ -4438,7 +4670,7 @@ void ValidationStateTracker::RecordCreateDescriptorUpdateTemplateState(const VkD
                                                                        VkDescriptorUpdateTemplateKHR *pDescriptorUpdateTemplate) {
     safe_VkDescriptorUpdateTemplateCreateInfo local_create_info(pCreateInfo);
     auto template_state = std::make_shared<TEMPLATE_STATE>(*pDescriptorUpdateTemplate, &local_create_info);
-    desc_template_map[*pDescriptorUpdateTemplate] = std::move(template_state);
+    desc_template_map.insert_or_assign(*pDescriptorUpdateTemplate, std::move(template_state));
 }
 
 void ValidationStateTracker::PostCallRecordCreateDescriptorUpdateTemplate(
@@ -4603,21 +4835,7 @@ void ValidationStateTracker::RecordResetQueryPool(VkDevice device, VkQueryPool q
     if (!query_pool_state) return;
 
     // Reset the state of existing entries.
-    QueryObject query_obj{queryPool, 0};
-    QueryObjectPass query_pass_obj{query_obj, 0};
-    const uint32_t max_query_count = std::min(queryCount, query_pool_state->createInfo.queryCount - firstQuery);
-    for (uint32_t i = 0; i < max_query_count; ++i) {
-        query_obj.query = firstQuery + i;
-        auto query_it = queryToStateMap.find(query_obj);
-        if (query_it != queryToStateMap.end()) query_it->second = QUERYSTATE_RESET;
-        if (query_pool_state->createInfo.queryType == VK_QUERY_TYPE_PERFORMANCE_QUERY_KHR) {
-            for (uint32_t passIndex = 0; passIndex < query_pool_state->n_performance_passes; passIndex++) {
-                query_pass_obj.perf_pass = passIndex;
-                auto query_perf_it = queryPassToStateMap.find(query_pass_obj);
-                if (query_perf_it != queryPassToStateMap.end()) query_perf_it->second = QUERYSTATE_RESET;
-            }
-        }
-    }
+    query_pool_state->SetQueryStates(firstQuery, queryCount, QUERYSTATE_RESET);
 }
 
 void ValidationStateTracker::PostCallRecordResetQueryPoolEXT(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery,
@@ -4660,7 +4878,7 @@ void ValidationStateTracker::UpdateAllocateDescriptorSetsData(const VkDescriptor
 void ValidationStateTracker::PerformAllocateDescriptorSets(const VkDescriptorSetAllocateInfo *p_alloc_info,
                                                            const VkDescriptorSet *descriptor_sets,
                                                            const cvdescriptorset::AllocateDescriptorSetsData *ds_data) {
-    auto pool_state = descriptorPoolMap[p_alloc_info->descriptorPool].get();
+    auto pool_state = GetDescriptorPoolState(p_alloc_info->descriptorPool);
     // Account for sets and individual descriptors allocated from pool
     pool_state->availableSets -= p_alloc_info->descriptorSetCount;
     for (auto it = ds_data->required_descriptors_by_type.begin(); it != ds_data->required_descriptors_by_type.end(); ++it) {
@@ -4678,7 +4896,7 @@ void ValidationStateTracker::PerformAllocateDescriptorSets(const VkDescriptorSet
                                                                        variable_count, this);
         pool_state->sets.insert(new_ds.get());
         new_ds->in_use.store(0);
-        setMap[descriptor_sets[i]] = std::move(new_ds);
+        setMap.insert_or_assign(descriptor_sets[i], std::move(new_ds));
     }
 }
 
@@ -4829,7 +5047,7 @@ void ValidationStateTracker::PostCallRecordCreateShaderModule(VkDevice device, c
     auto new_shader_module = is_spirv ? std::make_shared<SHADER_MODULE_STATE>(pCreateInfo, *pShaderModule, spirv_environment,
                                                                               csm_state->unique_shader_id)
                                       : std::make_shared<SHADER_MODULE_STATE>();
-    shaderModuleMap[*pShaderModule] = std::move(new_shader_module);
+    shaderModuleMap.insert_or_assign(*pShaderModule, std::move(new_shader_module));
 }
 
 void ValidationStateTracker::RecordPipelineShaderStage(VkPipelineShaderStageCreateInfo const *pStage, PIPELINE_STATE *pipeline,
@@ -4839,21 +5057,19 @@ void ValidationStateTracker::RecordPipelineShaderStage(VkPipelineShaderStageCrea
     if (!module->has_valid_spirv) return;
 
     // Validation shouldn't rely on anything in stage state being valid if the entrypoint isn't present
-    auto entrypoint = FindEntrypoint(module, pStage->pName, pStage->stage);
-    if (entrypoint == module->end()) return;
+    auto entry_point = module->GetEntryPoint(pStage->pName, pStage->stage);
+    if (!entry_point) return;
 
-    // Mark accessible ids
-    stage_state->accessible_ids = MarkAccessibleIds(module, entrypoint);
-    ProcessExecutionModes(module, entrypoint, pipeline);
+    // Built by the first pipeline to use the entrypoint, and shared from then on
+    stage_state->analysis = GetEntrypointAnalysis(module, *entry_point);
+    ProcessExecutionModes(module, module->at(entry_point->offset), pipeline);
 
-    stage_state->descriptor_uses =
-        CollectInterfaceByDescriptorSlot(report_data, module, stage_state->accessible_ids, &stage_state->has_writable_descriptor);
     // Capture descriptor uses for the pipeline
-    for (auto use : stage_state->descriptor_uses) {
+    for (auto const &use : stage_state->analysis->descriptor_uses) {
         // While validating shaders capture which slots are used by the pipeline
-        const uint32_t slot = use.first.first;
-        auto &reqs = pipeline->active_slots[slot][use.first.second];
-        reqs = descriptor_req(reqs | DescriptorTypeToReqs(module, use.second.type_id));
+        const uint32_t slot = use.slot.first;
+        auto &reqs = pipeline->GetOrAddActiveSlot(slot)[use.slot.second];
+        reqs = descriptor_req(reqs | use.reqs);
         pipeline->max_active_slot = std::max(pipeline->max_active_slot, slot);
     }
 }
@@ -4923,8 +5139,8 @@ void ValidationStateTracker::PostCallRecordGetSwapchainImagesKHR(VkDevice device
             if (swapchain_state->createInfo.flags & VK_SWAPCHAIN_CREATE_MUTABLE_FORMAT_BIT_KHR)
                 image_ci.flags |= (VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT | VK_IMAGE_CREATE_EXTENDED_USAGE_BIT_KHR);
 
-            imageMap[pSwapchainImages[i]] = std::make_shared<IMAGE_STATE>(pSwapchainImages[i], &image_ci);
-            auto &image_state = imageMap[pSwapchainImages[i]];
+            auto image_state = std::make_shared<IMAGE_STATE>(pSwapchainImages[i], &image_ci);
+            imageMap.insert_or_assign(pSwapchainImages[i], image_state);
             image_state->valid = false;
             image_state->create_from_swapchain = swapchain;
             image_state->bind_swapchain = swapchain;
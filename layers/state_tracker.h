@@ -31,8 +31,11 @@
 #include "vk_typemap_helper.h"
 #include "vk_layer_data.h"
 #include <atomic>
+#include <condition_variable>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -80,10 +83,22 @@ class QUEUE_STATE {
     VkQueue queue;
     uint32_t queueFamilyIndex;
 
-    uint64_t seq;
+    uint32_t ordinal;  // Index into ValidationStateTracker::queue_states
+    // Number of submissions retired; the next submission made will be seq + submissions.size() + 1. Only advanced with the
+    // object lock held exclusively, but atomic so InUse() reads it safely from threads that hold the lock shared.
+    std::atomic<uint64_t> seq;
     std::deque<CB_SUBMISSION> submissions;
 };
 
+// Needs the object lock, at least shared: submission_stamps is modified with it held exclusively
+inline bool BASE_NODE::InUse() const {
+    if (in_use.load()) return true;
+    for (const auto &stamp : submission_stamps) {
+        if (stamp.seq > stamp.queue->seq.load()) return true;
+    }
+    return false;
+}
+
 class QUERY_POOL_STATE : public BASE_NODE {
   public:
     VkQueryPoolCreateInfo createInfo;
@@ -92,6 +107,37 @@ class QUERY_POOL_STATE : public BASE_NODE {
     bool has_perf_scope_command_buffer = false;
     bool has_perf_scope_render_pass = false;
     uint32_t n_performance_passes = 0;
+
+    // State of each query as of the last submission, indexed by query
+    std::vector<QueryState> query_states;
+    // Performance query pools only: whether each query has been submitted for each pass, indexed by
+    // query * n_performance_passes + pass
+    std::vector<QueryState> pass_states;
+
+    QueryState GetQueryState(uint32_t query) const {
+        return (query < query_states.size()) ? query_states[query] : QUERYSTATE_UNKNOWN;
+    }
+    QueryState GetPassState(uint32_t query, uint32_t pass) const {
+        const size_t index = static_cast<size_t>(query) * n_performance_passes + pass;
+        return ((pass < n_performance_passes) && (index < pass_states.size())) ? pass_states[index] : QUERYSTATE_UNKNOWN;
+    }
+    void SetQueryState(uint32_t query, QueryState state) {
+        if (query < query_states.size()) query_states[query] = state;
+    }
+    void SetPassState(uint32_t query, uint32_t pass, QueryState state) {
+        const size_t index = static_cast<size_t>(query) * n_performance_passes + pass;
+        if ((pass < n_performance_passes) && (index < pass_states.size())) pass_states[index] = state;
+    }
+    // Sets queries [first_query, first_query + query_count) and all their passes, clamped to the pool
+    void SetQueryStates(uint32_t first_query, uint32_t query_count, QueryState state) {
+        if (first_query >= query_states.size()) return;
+        query_count = std::min(query_count, static_cast<uint32_t>(query_states.size()) - first_query);
+        std::fill_n(query_states.begin() + first_query, query_count, state);
+        if (!pass_states.empty()) {
+            std::fill_n(pass_states.begin() + static_cast<size_t>(first_query) * n_performance_passes,
+                        static_cast<size_t>(query_count) * n_performance_passes, state);
+        }
+    }
 };
 
 class QUEUE_FAMILY_PERF_COUNTERS {
@@ -232,17 +278,59 @@ static std::shared_ptr<cvdescriptorset::DescriptorSetLayout const> GetDslFromPip
 }
 
 struct SHADER_MODULE_STATE;
+class ValidationStateTracker;
+
+// Retires queue work off the application's threads. Each submission is followed by an internal fence on its queue; this thread
+// waits for those fences and retires the work they delimit into the tracker, so that vkWaitForFences, vkGetFenceStatus and
+// vkQueueWaitIdle usually find nothing left to retire. On any error other than a timeout, such as VK_ERROR_DEVICE_LOST, the
+// thread stops and retirement is left to the application's waits, as it is without the thread.
+class QueueRetirementThread {
+  public:
+    QueueRetirementThread(ValidationStateTracker* tracker, VkDevice device);
+    // Work whose fence has not been seen to signal is left for the application's waits to retire
+    ~QueueRetirementThread();
+
+    // Puts a fence on queue behind all work submitted so far, and retires queue_state up to seq once it signals. Called from
+    // vkQueueSubmit and vkQueueBindSparse, which hold both the queue and the tracker's write lock.
+    void Push(VkQueue queue, QUEUE_STATE* queue_state, uint64_t seq);
+
+  private:
+    struct PendingRetirement {
+        QUEUE_STATE* queue_state;
+        uint64_t seq;
+        VkFence fence;
+    };
+
+    void Run();
+
+    ValidationStateTracker* tracker_;
+    VkDevice device_;
+
+    std::mutex lock_;
+    std::condition_variable wake_;
+    std::vector<PendingRetirement> pushed_;  // Guarded by lock_
+    std::vector<VkFence> free_fences_;       // Unsignaled, guarded by lock_
+    bool stopping_ = false;                  // Guarded by lock_
+    bool failed_ = false;                    // Guarded by lock_; set on an error, after which nothing more is pushed
+
+    std::vector<PendingRetirement> waiting_;    // Owned by the thread
+    std::vector<PendingRetirement> completed_;  // Owned by the thread; fences signaled, not yet retired
+    std::thread thread_;
+};
 
 class ValidationStateTracker : public ValidationObject {
   public:
     //  TODO -- move to private
     //  TODO -- make consistent with traits approach below.
     unordered_map<VkQueue, QUEUE_STATE> queueMap;
-    unordered_map<VkEvent, EVENT_STATE> eventMap;
 
-    std::unordered_set<VkQueue> queues;  // All queues under given device
-    QueryMap queryToStateMap;
-    QueryPassMap queryPassToStateMap;
+    std::unordered_set<VkQueue> queues;      // All queues under given device
+    std::vector<QUEUE_STATE*> queue_states;  // The queueMap entries, indexed by QUEUE_STATE::ordinal
+    std::unique_ptr<QueueRetirementThread> retirement_thread;  // Only when khronos_validation.queue_retirement_thread is set
+    // Bumped whenever an object that command buffers may be bound to is destroyed or modified, see
+    // CMD_BUFFER_STATE::bindings_destroy_count
+    std::atomic<uint64_t> node_destroy_count{0};
+    std::atomic<uint64_t> node_modify_count{0};
     unordered_map<VkSamplerYcbcrConversion, uint64_t> ycbcr_conversion_ahb_fmt_map;
 
     // Traits for State function resolution.  Specializations defined in the macro.
@@ -261,7 +349,9 @@ class ValidationStateTracker : public ValidationObject {
         using SharedType = std::shared_ptr<StateType>;
         using ConstSharedType = std::shared_ptr<const StateType>;
         using MappedType = std::shared_ptr<StateType>;
-        using MapType = unordered_map<HandleType, MappedType>;
+        // Internally synchronized, as commands recorded into different command buffers look up objects concurrently (see
+        // CoreChecks::cmd_write_lock). Lookups take no lock.
+        using MapType = vl_concurrent_read_map<HandleType, MappedType, 4>;
     };
 
     VALSTATETRACK_MAP_AND_TRAITS(VkRenderPass, RENDER_PASS_STATE, renderPassMap)
@@ -286,6 +376,7 @@ class ValidationStateTracker : public ValidationObject {
     VALSTATETRACK_MAP_AND_TRAITS(VkQueryPool, QUERY_POOL_STATE, queryPoolMap)
     VALSTATETRACK_MAP_AND_TRAITS(VkSemaphore, SEMAPHORE_STATE, semaphoreMap)
     VALSTATETRACK_MAP_AND_TRAITS(VkAccelerationStructureNV, ACCELERATION_STRUCTURE_STATE, accelerationStructureMap)
+    VALSTATETRACK_MAP_AND_TRAITS(VkEvent, EVENT_STATE, eventMap)
     VALSTATETRACK_MAP_AND_TRAITS_INSTANCE_SCOPE(VkSurfaceKHR, SURFACE_STATE, surface_map)
 
     void AddAliasingImage(IMAGE_STATE* image_state);
@@ -315,7 +406,7 @@ class ValidationStateTracker : public ValidationObject {
             (Traits::kInstanceScope && (this->*map_member).size() == 0) ? instance_state->*map_member : this->*map_member;
 
         const auto found_it = map.find(handle);
-        if (found_it == map.cend()) {
+        if (found_it == map.end()) {
             return nullptr;
         }
         return found_it->second.get();
@@ -343,7 +434,7 @@ class ValidationStateTracker : public ValidationObject {
             (Traits::kInstanceScope && (this->*map_member).size() == 0) ? instance_state->*map_member : this->*map_member;
 
         const auto found_it = map.find(handle);
-        if (found_it == map.cend()) {
+        if (found_it == map.end()) {
             return nullptr;
         }
         return found_it->second;
@@ -359,7 +450,7 @@ class ValidationStateTracker : public ValidationObject {
             (Traits::kInstanceScope && (this->*map_member).size() == 0) ? instance_state->*map_member : this->*map_member;
 
         const auto found_it = map.find(handle);
-        if (found_it == map.cend()) {
+        if (found_it == map.end()) {
             return nullptr;
         }
         return found_it->second;
@@ -473,8 +564,8 @@ class ValidationStateTracker : public ValidationObject {
     // Class Declarations for helper functions
     IMAGE_VIEW_STATE* GetAttachmentImageViewState(FRAMEBUFFER_STATE* framebuffer, uint32_t index);
     const IMAGE_VIEW_STATE* GetAttachmentImageViewState(const FRAMEBUFFER_STATE* framebuffer, uint32_t index) const;
-    const EVENT_STATE* GetEventState(VkEvent event) const;
-    EVENT_STATE* GetEventState(VkEvent event);
+    const EVENT_STATE* GetEventState(VkEvent event) const { return Get<EVENT_STATE>(event); }
+    EVENT_STATE* GetEventState(VkEvent event) { return Get<EVENT_STATE>(event); }
     const QUEUE_STATE* GetQueueState(VkQueue queue) const;
     QUEUE_STATE* GetQueueState(VkQueue queue);
     const BINDABLE* GetObjectMemBinding(const VulkanTypedHandle& typed_handle) const;
@@ -988,10 +1079,7 @@ class ValidationStateTracker : public ValidationObject {
 #endif  // VK_USE_PLATFORM_XLIB_KHR
 
     // State Utilty functions
-    bool AddCommandBufferMem(small_unordered_map<CMD_BUFFER_STATE*, int, 8>& cb_bindings, VkDeviceMemory obj,
-                             CMD_BUFFER_STATE* cb_node);
-    bool AddCommandBufferBinding(small_unordered_map<CMD_BUFFER_STATE*, int, 8>& cb_bindings, const VulkanTypedHandle& obj,
-                                 CMD_BUFFER_STATE* cb_node);
+    bool AddCommandBufferBinding(const VulkanTypedHandle& obj, CMD_BUFFER_STATE* cb_node);
     void AddCommandBufferBindingAccelerationStructure(CMD_BUFFER_STATE*, ACCELERATION_STRUCTURE_STATE*);
     void AddCommandBufferBindingBuffer(CMD_BUFFER_STATE*, BUFFER_STATE*);
     void AddCommandBufferBindingBufferView(CMD_BUFFER_STATE*, BUFFER_VIEW_STATE*);
@@ -1002,24 +1090,28 @@ class ValidationStateTracker : public ValidationObject {
     void AddFramebufferBinding(CMD_BUFFER_STATE* cb_state, FRAMEBUFFER_STATE* fb_state);
     void ClearMemoryObjectBindings(const VulkanTypedHandle& typed_handle);
     void ClearMemoryObjectBinding(const VulkanTypedHandle& typed_handle, VkDeviceMemory mem);
-    void DecrementBoundResources(CMD_BUFFER_STATE const* cb_node);
     void DeleteDescriptorSetPools();
     void FreeCommandBufferStates(COMMAND_POOL_STATE* pool_state, const uint32_t command_buffer_count,
                                  const VkCommandBuffer* command_buffers);
     void FreeDescriptorSet(cvdescriptorset::DescriptorSet* descriptor_set);
     BASE_NODE* GetStateStructPtrFromObject(const VulkanTypedHandle& object_struct);
-    void IncrementBoundObjects(CMD_BUFFER_STATE const* cb_node);
-    void IncrementResources(CMD_BUFFER_STATE* cb_node);
+    const BASE_NODE* GetStateStructPtrFromObject(const VulkanTypedHandle& object_struct) const {
+        // Lookup only, nothing is modified
+        return const_cast<ValidationStateTracker*>(this)->GetStateStructPtrFromObject(object_struct);
+    }
+    const BASE_NODE* GetBoundObjectState(const CMD_BUFFER_STATE* cb_node, const CommandBufferBinding& binding) const;
+    void GetStaleBindings(const CMD_BUFFER_STATE* cb_node, std::vector<VulkanTypedHandle>* stale_objects) const;
+    void IncrementResources(CMD_BUFFER_STATE* cb_node, const QUEUE_STATE* queue, uint64_t seq);
     void InsertAccelerationStructureMemoryRange(VkAccelerationStructureNV as, DEVICE_MEMORY_STATE* mem_info,
                                                 VkDeviceSize mem_offset, const VkMemoryRequirements& mem_reqs);
     void InsertBufferMemoryRange(VkBuffer buffer, DEVICE_MEMORY_STATE* mem_info, VkDeviceSize mem_offset,
                                  const VkMemoryRequirements& mem_reqs);
     void InsertImageMemoryRange(VkImage image, DEVICE_MEMORY_STATE* mem_info, VkDeviceSize mem_offset,
                                 VkMemoryRequirements mem_reqs, bool is_linear);
-    void InsertMemoryRange(const VulkanTypedHandle& typed_handle, DEVICE_MEMORY_STATE* mem_info, VkDeviceSize memoryOffset,
-                           VkMemoryRequirements memRequirements, bool is_linear);
-    void InvalidateCommandBuffers(small_unordered_map<CMD_BUFFER_STATE*, int, 8>& cb_nodes, const VulkanTypedHandle& obj,
-                                  bool unlink = true);
+    void InsertMemoryRange(const VulkanTypedHandle& typed_handle, BINDABLE* bindable, DEVICE_MEMORY_STATE* mem_info,
+                           VkDeviceSize memoryOffset, VkMemoryRequirements memRequirements, bool is_linear);
+    void InvalidateCommandBuffer(CMD_BUFFER_STATE* cb_node, const VulkanTypedHandle& obj);
+    void InvalidateCommandBuffers(BASE_NODE* node, bool destroyed = true);
     void InvalidateLinkedCommandBuffers(std::unordered_set<CMD_BUFFER_STATE*>& cb_nodes, const VulkanTypedHandle& obj);
     void PerformAllocateDescriptorSets(const VkDescriptorSetAllocateInfo*, const VkDescriptorSet*,
                                        const cvdescriptorset::AllocateDescriptorSetsData*);
@@ -1071,20 +1163,21 @@ class ValidationStateTracker : public ValidationObject {
     void RecordRenderPassDAG(RenderPassCreateVersion rp_version, const VkRenderPassCreateInfo2KHR* pCreateInfo,
                              RENDER_PASS_STATE* render_pass);
     void RecordVulkanSurface(VkSurfaceKHR* pSurface);
-    void RemoveAccelerationStructureMemoryRange(VkAccelerationStructureNV as, DEVICE_MEMORY_STATE* mem_info);
-    void RemoveCommandBufferBinding(const VulkanTypedHandle& object, CMD_BUFFER_STATE* cb_node);
-    void RemoveBufferMemoryRange(VkBuffer buffer, DEVICE_MEMORY_STATE* mem_info);
-    void RemoveImageMemoryRange(VkImage image, DEVICE_MEMORY_STATE* mem_info);
+    void RemoveMemoryRanges(const VulkanTypedHandle& typed_handle, BINDABLE* bindable);
     void ResetCommandBufferState(const VkCommandBuffer cb);
+    void ResolveStaleBindings(CMD_BUFFER_STATE* cb_node);
     void RetireFence(VkFence fence);
     void RetireWorkOnQueue(QUEUE_STATE* pQueue, uint64_t seq);
+    void RetireQueueSubmissions(QUEUE_STATE* pQueue, uint64_t seq);
+    void RecordSubmissionDependencies(QUEUE_STATE* pQueue);
     static bool SetEventStageMask(VkEvent event, VkPipelineStageFlags stageMask, EventToStageMap* localEventToStageMap);
     void ResetCommandBufferPushConstantDataIfIncompatible(CMD_BUFFER_STATE* cb_state, VkPipelineLayout layout);
     void SetMemBinding(VkDeviceMemory mem, BINDABLE* mem_binding, VkDeviceSize memory_offset,
                        const VulkanTypedHandle& typed_handle);
-    static bool SetQueryState(QueryObject object, QueryState value, QueryMap* localQueryToStateMap);
-    static bool SetQueryStateMulti(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, QueryState value,
-                                   QueryMap* localQueryToStateMap);
+    static bool SetQueryState(QueryObject object, uint32_t pool_query_count, QueryState value, QueryMap* localQueryToStateMap);
+    static bool SetQueryStateMulti(VkQueryPool queryPool, uint32_t pool_query_count, uint32_t firstQuery, uint32_t queryCount,
+                                   QueryState value, QueryMap* localQueryToStateMap);
+    void StampBoundObjects(CMD_BUFFER_STATE const* cb_node, const QUEUE_STATE* queue, uint64_t seq);
     QueryState GetQueryState(const QueryMap* localQueryToStateMap, VkQueryPool queryPool, uint32_t queryIndex) const;
     bool SetSparseMemBinding(MEM_BINDING binding, const VulkanTypedHandle& typed_handle);
     void UpdateBindBufferMemoryState(VkBuffer buffer, VkDeviceMemory mem, VkDeviceSize memoryOffset);
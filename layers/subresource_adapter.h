@@ -462,10 +462,11 @@ class ConstMapView {
 // double wrapped map variants.. to avoid needing to templatize on the range map type.  The underlying maps are available for
 // use in performance sensitive places that are *already* templatized (for example update_range_value).
 // In STL style.  Note that N must be < uint8_t max
+// BigMap_ can be sparse_container::flat_range_map<IndexType, T> for maps that are looked up far more often than changed.
 enum BothRangeMapMode { kTristate, kSmall, kBig };
-template <typename T, size_t N>
+template <typename T, size_t N, typename BigMap_ = sparse_container::range_map<IndexType, T>>
 class BothRangeMap {
-    using BigMap = sparse_container::range_map<IndexType, T>;
+    using BigMap = BigMap_;
     using RangeType = sparse_container::range<IndexType>;
     using SmallMap = sparse_container::small_range_map<IndexType, T, RangeType, N>;
     using SmallMapIterator = typename SmallMap::iterator;
@@ -21,11 +21,17 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <stdbool.h>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 #include <set>
 #include "cast_utils.h"
@@ -235,6 +241,12 @@ typedef std::unique_lock<ReadWriteLock> write_lock_guard_t;
 //
 // snapshot: Return an array of elements (key, value pairs) that satisfy an optional
 // predicate. This can be used as a substitute for iterators in exceptional cases.
+//
+// size/empty/clear: Whole-map operations, taking each bucket's lock in turn. size and empty
+// are only exact when no other thread is modifying the map.
+//
+// insert_batch/pop_batch: Batched insert and pop that take each bucket's lock at most
+// once per call, for API entry points that create or destroy many objects at a time.
 template <typename Key, typename T, int BUCKETSLOG2 = 2, typename Hash = std::hash<Key>>
 class vl_concurrent_unordered_map {
   public:
@@ -251,11 +263,17 @@ class vl_concurrent_unordered_map {
         return ret.second;
     }
 
-    // returns size_type
+    // returns size_type. The erased value is destroyed after the bucket lock is released, so its destructor may use the map.
     size_t erase(const Key &key) {
         uint32_t h = ConcurrentMapHashObject(key);
+        T erased;
         write_lock_guard_t lock(locks[h].lock);
-        return maps[h].erase(key);
+        auto itr = maps[h].find(key);
+        if (itr == maps[h].end()) return 0;
+        erased = std::move(itr->second);
+        maps[h].erase(itr);
+        lock.unlock();
+        return 1;
     }
 
     bool contains(const Key &key) const {
@@ -321,6 +339,29 @@ class vl_concurrent_unordered_map {
         }
     }
 
+    // Insert count elements. rejected (if non-null) is called with each element whose key was already present.
+    template <typename Rejected>
+    void insert_batch(const std::pair<Key, T> *elements, size_t count, Rejected &&rejected) {
+        ForEachBucketGroup(elements, count, [](const std::pair<Key, T> &element) { return element.first; },
+                           [this, &rejected](uint32_t h, const std::pair<Key, T> &element) {
+                               if (!maps[h].insert(element).second) rejected(element);
+                           });
+    }
+
+    // Erase count keys, calling popped with each (key, value) pair that was found. Missing keys are skipped.
+    template <typename Popped>
+    void pop_batch(const Key *keys, size_t count, Popped &&popped) {
+        ForEachBucketGroup(keys, count, [](const Key &key) { return key; },
+                           [this, &popped](uint32_t h, const Key &key) {
+                               auto itr = maps[h].find(key);
+                               if (itr != maps[h].end()) {
+                                   std::pair<Key, T> element(itr->first, std::move(itr->second));
+                                   maps[h].erase(itr);
+                                   popped(element);
+                               }
+                           });
+    }
+
     std::vector<std::pair<const Key, T>> snapshot(std::function<bool(T)> f = nullptr) const {
         std::vector<std::pair<const Key, T>> ret;
         for (int h = 0; h < BUCKETS; ++h) {
@@ -334,14 +375,40 @@ class vl_concurrent_unordered_map {
         return ret;
     }
 
+    size_t size() const {
+        size_t result = 0;
+        for (int h = 0; h < BUCKETS; ++h) {
+            read_lock_guard_t lock(locks[h].lock);
+            result += maps[h].size();
+        }
+        return result;
+    }
+
+    bool empty() const {
+        for (int h = 0; h < BUCKETS; ++h) {
+            read_lock_guard_t lock(locks[h].lock);
+            if (!maps[h].empty()) return false;
+        }
+        return true;
+    }
+
+    // As with erase, the values are destroyed outside of the bucket locks
+    void clear() {
+        for (int h = 0; h < BUCKETS; ++h) {
+            std::unordered_map<Key, T, Hash> erased;
+            write_lock_guard_t lock(locks[h].lock);
+            erased.swap(maps[h]);
+            lock.unlock();
+        }
+    }
+
   private:
     static const int BUCKETS = (1 << BUCKETSLOG2);
 
     std::unordered_map<Key, T, Hash> maps[BUCKETS];
-    struct {
+    // Put each lock on its own cache line to avoid false cache line sharing.
+    struct alignas(64) {
         mutable ReadWriteLock lock;
-        // Put each lock on its own cache line to avoid false cache line sharing.
-        char padding[(-int(sizeof(ReadWriteLock))) & 63];
     } locks[BUCKETS];
 
     uint32_t ConcurrentMapHashObject(const Key &object) const {
@@ -351,4 +418,434 @@ class vl_concurrent_unordered_map {
         hash &= (BUCKETS - 1);
         return hash;
     }
+
+    // Bucket the items (a counting sort on the bucket index, preserving order within a bucket) and apply op to each under
+    // a single acquisition of its bucket's lock.
+    template <typename Item, typename GetKey, typename Op>
+    void ForEachBucketGroup(const Item *items, size_t count, GetKey &&get_key, Op &&op) {
+        if (count == 0) return;
+        std::vector<uint32_t> bucket_of(count);
+        uint32_t bucket_start[BUCKETS + 1] = {};
+        for (size_t i = 0; i < count; ++i) {
+            bucket_of[i] = ConcurrentMapHashObject(get_key(items[i]));
+            ++bucket_start[bucket_of[i] + 1];
+        }
+        for (int h = 0; h < BUCKETS; ++h) {
+            bucket_start[h + 1] += bucket_start[h];
+        }
+        std::vector<uint32_t> order(count);
+        uint32_t fill[BUCKETS];
+        std::copy(bucket_start, bucket_start + BUCKETS, fill);
+        for (size_t i = 0; i < count; ++i) {
+            order[fill[bucket_of[i]]++] = static_cast<uint32_t>(i);
+        }
+        for (int h = 0; h < BUCKETS; ++h) {
+            if (bucket_start[h] == bucket_start[h + 1]) continue;
+            write_lock_guard_t lock(locks[h].lock);
+            for (uint32_t i = bucket_start[h]; i < bucket_start[h + 1]; ++i) {
+                op(h, items[order[i]]);
+            }
+        }
+    }
+};
+
+// Concurrent map with the interface of vl_concurrent_unordered_map, for maps that are looked up far more often than they are
+// modified. find and contains take no lock: each bucket is an open-addressed table of atomic node pointers, probed inside an
+// epoch-counted read section. Modifications are serialized per bucket and are linearizable.
+//
+// Nodes and tables that a modification unlinks are retired rather than freed, as a reader may still be looking at them. To free
+// them, a thread advances the bucket's epoch, waits for every reader that entered under the previous epoch to leave and frees
+// the batch. The writer does so once its bucket has retired enough; any smaller batch is freed by the next read section to end,
+// in whichever bucket, whose thread can take the retiring bucket's lock. Erased values are therefore destroyed shortly after
+// erase returns, by the writer or by a later reader, and outside of the bucket lock.
+//
+// Readers retry their entry only when a reclamation of the same bucket starts at that moment; they are lock-free rather than
+// wait-free.
+template <typename Key, typename T, int BUCKETSLOG2 = 2, typename Hash = std::hash<Key>>
+class vl_concurrent_read_map {
+  public:
+    using FindResult = typename vl_concurrent_unordered_map<Key, T, BUCKETSLOG2, Hash>::FindResult;
+
+    vl_concurrent_read_map() = default;
+    vl_concurrent_read_map(const vl_concurrent_read_map &) = delete;
+    vl_concurrent_read_map &operator=(const vl_concurrent_read_map &) = delete;
+    ~vl_concurrent_read_map() {
+        for (int h = 0; h < BUCKETS; ++h) {
+            BucketState &bucket = buckets[h];
+            Table *table = bucket.table.load(std::memory_order_relaxed);
+            if (table) RetireTable(bucket, table);
+            for (Node *node : bucket.retired) delete node;
+            for (Table *retired_table : bucket.retired_tables) delete retired_table;
+        }
+    }
+
+    void insert_or_assign(const Key &key, const T &value) {
+        BucketState &bucket = buckets[BucketOf(key)];
+        std::unique_lock<std::mutex> lock(bucket.write_lock);
+        Node *replaced = nullptr;
+        LinkNode(bucket, key, value, &replaced);
+        if (replaced) bucket.retired.push_back(replaced);
+        Reclaim(bucket, lock, false);
+    }
+
+    bool insert(const Key &key, const T &value) {
+        BucketState &bucket = buckets[BucketOf(key)];
+        std::unique_lock<std::mutex> lock(bucket.write_lock);
+        const bool inserted = LinkNode(bucket, key, value, nullptr);
+        Reclaim(bucket, lock, false);
+        return inserted;
+    }
+
+    // returns size_type
+    size_t erase(const Key &key) {
+        BucketState &bucket = buckets[BucketOf(key)];
+        std::unique_lock<std::mutex> lock(bucket.write_lock);
+        Node *erased = UnlinkNode(bucket, key);
+        if (!erased) return 0;
+        bucket.retired.push_back(erased);
+        Reclaim(bucket, lock, false);
+        return 1;
+    }
+
+    bool contains(const Key &key) const {
+        BucketState &bucket = buckets[BucketOf(key)];
+        ReadSection section(*this, bucket);
+        return FindNode(bucket.table.load(std::memory_order_acquire), key) != nullptr;
+    }
+
+    FindResult end() const { return FindResult(false, T()); }
+
+    FindResult find(const Key &key) const {
+        BucketState &bucket = buckets[BucketOf(key)];
+        ReadSection section(*this, bucket);
+        const Node *node = FindNode(bucket.table.load(std::memory_order_acquire), key);
+        return node ? FindResult(true, node->value) : end();
+    }
+
+    FindResult pop(const Key &key) {
+        BucketState &bucket = buckets[BucketOf(key)];
+        std::unique_lock<std::mutex> lock(bucket.write_lock);
+        Node *popped = UnlinkNode(bucket, key);
+        if (!popped) return end();
+        FindResult result(true, popped->value);
+        bucket.retired.push_back(popped);
+        Reclaim(bucket, lock, false);
+        return result;
+    }
+
+    // Insert count elements. rejected (if non-null) is called with each element whose key was already present, with the bucket
+    // lock held, so it must not use the map.
+    template <typename Rejected>
+    void insert_batch(const std::pair<Key, T> *elements, size_t count, Rejected &&rejected) {
+        ForEachBucketGroup(elements, count, [](const std::pair<Key, T> &element) { return element.first; },
+                           [this, &rejected](BucketState &bucket, const std::vector<const std::pair<Key, T> *> &group) {
+                               std::unique_lock<std::mutex> lock(bucket.write_lock);
+                               for (const auto *element : group) {
+                                   if (!LinkNode(bucket, element->first, element->second, nullptr)) rejected(*element);
+                               }
+                               Reclaim(bucket, lock, false);
+                           });
+    }
+
+    // Erase count keys, calling popped with each (key, value) pair that was found, outside of the bucket locks. Missing keys
+    // are skipped.
+    template <typename Popped>
+    void pop_batch(const Key *keys, size_t count, Popped &&popped) {
+        ForEachBucketGroup(keys, count, [](const Key &key) { return key; },
+                           [this, &popped](BucketState &bucket, const std::vector<const Key *> &group) {
+                               std::vector<std::pair<Key, T>> elements;
+                               std::unique_lock<std::mutex> lock(bucket.write_lock);
+                               for (const Key *key : group) {
+                                   Node *node = UnlinkNode(bucket, *key);
+                                   if (!node) continue;
+                                   elements.emplace_back(node->key, node->value);
+                                   bucket.retired.push_back(node);
+                               }
+                               Reclaim(bucket, lock, false);
+                               if (lock.owns_lock()) lock.unlock();
+                               for (auto &element : elements) {
+                                   popped(element);
+                               }
+                           });
+    }
+
+    // f is called with bucket locks held, and so must not use the map
+    std::vector<std::pair<const Key, T>> snapshot(std::function<bool(T)> f = nullptr) const {
+        std::vector<std::pair<const Key, T>> ret;
+        for (int h = 0; h < BUCKETS; ++h) {
+            std::lock_guard<std::mutex> lock(buckets[h].write_lock);
+            const Table *table = buckets[h].table.load(std::memory_order_relaxed);
+            if (!table) continue;
+            for (size_t i = 0; i <= table->mask; ++i) {
+                const Node *node = table->slots[i].load(std::memory_order_relaxed);
+                if (node && node != Tombstone() && (!f || f(node->value))) {
+                    ret.emplace_back(node->key, node->value);
+                }
+            }
+        }
+        return ret;
+    }
+
+    // size and empty take no lock, and are only exact when no other thread is modifying the map
+    size_t size() const {
+        size_t result = 0;
+        for (int h = 0; h < BUCKETS; ++h) {
+            result += buckets[h].live.load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    bool empty() const { return size() == 0; }
+
+    // Unlike erase, the values are destroyed before clear returns, though still outside of the bucket locks
+    void clear() {
+        for (int h = 0; h < BUCKETS; ++h) {
+            BucketState &bucket = buckets[h];
+            std::unique_lock<std::mutex> lock(bucket.write_lock);
+            Table *table = bucket.table.load(std::memory_order_relaxed);
+            if (table) {
+                bucket.table.store(nullptr, std::memory_order_release);
+                bucket.live.store(0, std::memory_order_relaxed);
+                bucket.used = 0;
+                RetireTable(bucket, table);
+            }
+            Reclaim(bucket, lock, true);
+        }
+    }
+
+  private:
+    static const int BUCKETS = (1 << BUCKETSLOG2);
+    static const uint32_t kMinLog2Capacity = 4;
+    static const size_t kReclaimBatch = 64;
+    static_assert(BUCKETSLOG2 <= 6, "pending_buckets needs a bit per bucket");
+
+    struct Node {
+        Node(const Key &key, const T &value) : key(key), value(value) {}
+        const Key key;
+        const T value;
+    };
+
+    // Open-addressed with linear probing. At least a quarter of the slots are always null, so every probe terminates.
+    struct Table {
+        explicit Table(uint32_t log2_capacity)
+            : shift(64 - log2_capacity), mask((size_t(1) << log2_capacity) - 1), slots(new std::atomic<Node *>[mask + 1]) {
+            for (size_t i = 0; i <= mask; ++i) {
+                slots[i].store(nullptr, std::memory_order_relaxed);
+            }
+        }
+        const uint32_t shift;
+        const size_t mask;
+        std::unique_ptr<std::atomic<Node *>[]> slots;
+    };
+
+    struct BucketState {
+        BucketState() : table(nullptr), epoch(0), live(0), used(0) {
+            readers[0].store(0);
+            readers[1].store(0);
+        }
+        std::mutex write_lock;  // Serializes modifications; readers never take it
+        std::atomic<Table *> table;
+        std::atomic<uint32_t> epoch;
+        std::atomic<uint32_t> readers[2];  // Readers inside a read section, by the parity of the epoch they entered under
+        std::atomic<size_t> live;          // Only written under write_lock
+        // Guarded by write_lock
+        size_t used;  // Slots that are not null, tombstones included
+        std::vector<Node *> retired;
+        std::vector<Table *> retired_tables;
+    };
+    // Every reader writes its bucket's reader count, so keep each bucket on its own cache line
+    struct alignas(64) Bucket : BucketState {};
+
+    // Bit h is set while bucket h has retired nodes or tables that it has not freed
+    mutable std::atomic<uint64_t> pending_buckets{0};
+    mutable Bucket buckets[BUCKETS];
+
+    class ReadSection {
+      public:
+        ReadSection(const vl_concurrent_read_map &map, BucketState &bucket) : map_(map) {
+            for (;;) {
+                const uint32_t epoch = bucket.epoch.load();
+                readers_ = &bucket.readers[epoch & 1];
+                readers_->fetch_add(1);
+                // A writer that advanced the epoch before the count was raised may already have stopped waiting for it
+                if (bucket.epoch.load() == epoch) break;
+                readers_->fetch_sub(1);
+            }
+        }
+        ~ReadSection() {
+            readers_->fetch_sub(1);
+            if (map_.pending_buckets.load(std::memory_order_relaxed)) map_.ReclaimPending();
+        }
+
+      private:
+        const vl_concurrent_read_map &map_;
+        std::atomic<uint32_t> *readers_;
+    };
+
+    // With write_lock held by lock: if forced or enough has been retired, waits until no reader can still reach what was
+    // retired, then releases lock and frees it. Otherwise leaves it for ReclaimPending.
+    void Reclaim(BucketState &bucket, std::unique_lock<std::mutex> &lock, bool force) const {
+        const uint64_t bucket_bit = uint64_t(1) << (static_cast<Bucket *>(&bucket) - buckets);
+        const size_t retired_count = bucket.retired.size() + bucket.retired_tables.size();
+        if (retired_count == 0) return;
+        if (!force && retired_count < kReclaimBatch) {
+            pending_buckets.fetch_or(bucket_bit);
+            return;
+        }
+        const uint32_t epoch = bucket.epoch.fetch_add(1);
+        while (bucket.readers[epoch & 1].load() != 0) {
+            std::this_thread::yield();
+        }
+        std::vector<Node *> nodes;
+        std::vector<Table *> tables;
+        nodes.swap(bucket.retired);
+        tables.swap(bucket.retired_tables);
+        pending_buckets.fetch_and(~bucket_bit);
+        lock.unlock();
+        for (Node *node : nodes) delete node;
+        for (Table *table : tables) delete table;
+    }
+
+    // Frees what every bucket has retired, so that a bucket nobody writes to again doesn't keep erased values alive. Buckets
+    // whose lock is taken are skipped; their writer, or the next read section to end, frees them.
+    void ReclaimPending() const {
+        const uint64_t pending = pending_buckets.load(std::memory_order_relaxed);
+        for (int h = 0; h < BUCKETS; ++h) {
+            if (!(pending & (uint64_t(1) << h))) continue;
+            std::unique_lock<std::mutex> lock(buckets[h].write_lock, std::try_to_lock);
+            if (lock.owns_lock()) Reclaim(buckets[h], lock, true);
+        }
+    }
+
+    static Node *Tombstone() { return reinterpret_cast<Node *>(static_cast<uintptr_t>(1)); }
+
+    uint32_t BucketOf(const Key &object) const {
+        uint64_t u64 = (uint64_t)(uintptr_t)object;
+        uint32_t hash = (uint32_t)(u64 >> 32) + (uint32_t)u64;
+        hash ^= (hash >> BUCKETSLOG2) ^ (hash >> (2 * BUCKETSLOG2));
+        hash &= (BUCKETS - 1);
+        return hash;
+    }
+
+    static size_t HomeSlot(const Table &table, const Key &key) {
+        return static_cast<size_t>((static_cast<uint64_t>(Hash()(key)) * 0x9E3779B97F4A7C15ull) >> table.shift);
+    }
+
+    // Safe both inside a read section and with write_lock held
+    static Node *FindNode(const Table *table, const Key &key) {
+        if (!table) return nullptr;
+        for (size_t i = HomeSlot(*table, key);; i = (i + 1) & table->mask) {
+            Node *node = table->slots[i].load(std::memory_order_acquire);
+            if (!node) return nullptr;
+            if (node != Tombstone() && node->key == key) return node;
+        }
+    }
+
+    // With write_lock held: returns the slot holding key, or if key is absent (*found is null), the slot to insert it at
+    static size_t FindSlot(const Table &table, const Key &key, Node **found) {
+        size_t first_free = table.mask + 1;
+        for (size_t i = HomeSlot(table, key);; i = (i + 1) & table.mask) {
+            Node *node = table.slots[i].load(std::memory_order_relaxed);
+            if (!node) {
+                *found = nullptr;
+                return first_free <= table.mask ? first_free : i;
+            }
+            if (node == Tombstone()) {
+                if (first_free > table.mask) first_free = i;
+            } else if (node->key == key) {
+                *found = node;
+                return i;
+            }
+        }
+    }
+
+    // With write_lock held: moves the live nodes into a new table sized for them, publishes it and retires the old one
+    static Table *Rehash(BucketState &bucket) {
+        Table *old_table = bucket.table.load(std::memory_order_relaxed);
+        const size_t live = bucket.live.load(std::memory_order_relaxed);
+        uint32_t log2_capacity = kMinLog2Capacity;
+        while ((size_t(1) << log2_capacity) < (live + 1) * 3) ++log2_capacity;
+        Table *table = new Table(log2_capacity);
+        if (old_table) {
+            for (size_t i = 0; i <= old_table->mask; ++i) {
+                Node *node = old_table->slots[i].load(std::memory_order_relaxed);
+                if (!node || node == Tombstone()) continue;
+                size_t j = HomeSlot(*table, node->key);
+                while (table->slots[j].load(std::memory_order_relaxed)) j = (j + 1) & table->mask;
+                table->slots[j].store(node, std::memory_order_relaxed);
+            }
+            bucket.retired_tables.push_back(old_table);
+        }
+        bucket.table.store(table, std::memory_order_release);
+        bucket.used = live;
+        return table;
+    }
+
+    // With write_lock held: links a node for (key, value) and returns true, unless key is present. A present node is then
+    // replaced and returned through replaced if that is non-null, or left alone (returning false) if it is null.
+    static bool LinkNode(BucketState &bucket, const Key &key, const T &value, Node **replaced) {
+        Table *table = bucket.table.load(std::memory_order_relaxed);
+        if (!table || (bucket.used + 1) * 4 > (table->mask + 1) * 3) table = Rehash(bucket);
+        Node *present;
+        const size_t slot = FindSlot(*table, key, &present);
+        if (present && !replaced) return false;
+        const bool was_null = table->slots[slot].load(std::memory_order_relaxed) == nullptr;
+        table->slots[slot].store(new Node(key, value), std::memory_order_release);
+        if (present) {
+            *replaced = present;
+        } else {
+            if (was_null) ++bucket.used;
+            bucket.live.store(bucket.live.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    // With write_lock held: replaces key's node with a tombstone and returns it, or returns null if key is absent
+    static Node *UnlinkNode(BucketState &bucket, const Key &key) {
+        Table *table = bucket.table.load(std::memory_order_relaxed);
+        if (!table) return nullptr;
+        Node *node;
+        const size_t slot = FindSlot(*table, key, &node);
+        if (!node) return nullptr;
+        table->slots[slot].store(Tombstone(), std::memory_order_release);
+        bucket.live.store(bucket.live.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+        return node;
+    }
+
+    // With write_lock held, after table has been unpublished: retires it and every node in it
+    static void RetireTable(BucketState &bucket, Table *table) {
+        for (size_t i = 0; i <= table->mask; ++i) {
+            Node *node = table->slots[i].load(std::memory_order_relaxed);
+            if (node && node != Tombstone()) bucket.retired.push_back(node);
+        }
+        bucket.retired_tables.push_back(table);
+    }
+
+    // Bucket the items (a counting sort on the bucket index, preserving order within a bucket) and call op once for each
+    // bucket that any of them hash to, with those items.
+    template <typename Item, typename GetKey, typename Op>
+    void ForEachBucketGroup(const Item *items, size_t count, GetKey &&get_key, Op &&op) {
+        if (count == 0) return;
+        std::vector<uint32_t> bucket_of(count);
+        uint32_t bucket_start[BUCKETS + 1] = {};
+        for (size_t i = 0; i < count; ++i) {
+            bucket_of[i] = BucketOf(get_key(items[i]));
+            ++bucket_start[bucket_of[i] + 1];
+        }
+        for (int h = 0; h < BUCKETS; ++h) {
+            bucket_start[h + 1] += bucket_start[h];
+        }
+        std::vector<const Item *> ordered(count);
+        uint32_t fill[BUCKETS];
+        std::copy(bucket_start, bucket_start + BUCKETS, fill);
+        for (size_t i = 0; i < count; ++i) {
+            ordered[fill[bucket_of[i]]++] = &items[i];
+        }
+        std::vector<const Item *> group;
+        for (int h = 0; h < BUCKETS; ++h) {
+            if (bucket_start[h] == bucket_start[h + 1]) continue;
+            group.assign(ordered.begin() + bucket_start[h], ordered.begin() + bucket_start[h + 1]);
+            op(buckets[h], group);
+        }
+    }
 };
@@ -178,6 +178,35 @@ class LayerChassisOutputGenerator(OutputGenerator):
         'vkGetPhysicalDeviceCalibrateableTimeDomainsEXT',
     ]
 
+    cross_command_buffer_functions = [
+        # vkCmd* functions that also modify the state of command buffers other than the one being recorded, and so take the
+        # object-wide locks rather than cmd_read_lock()/cmd_write_lock()
+        'vkCmdExecuteCommands',
+    ]
+
+    command_buffer_local_functions = [
+        # vkCmd* functions whose recording touches only the state of the command buffer being recorded, and so take
+        # cmd_local_write_lock() rather than cmd_write_lock() to record
+        'vkCmdSetViewport',
+        'vkCmdSetScissor',
+        'vkCmdSetLineWidth',
+        'vkCmdSetDepthBias',
+        'vkCmdSetBlendConstants',
+        'vkCmdSetDepthBounds',
+        'vkCmdSetStencilCompareMask',
+        'vkCmdSetStencilWriteMask',
+        'vkCmdSetStencilReference',
+        'vkCmdSetDeviceMask',
+        'vkCmdSetDeviceMaskKHR',
+        'vkCmdSetViewportWScalingNV',
+        'vkCmdSetDiscardRectangleEXT',
+        'vkCmdSetSampleLocationsEXT',
+        'vkCmdSetViewportShadingRatePaletteNV',
+        'vkCmdSetCoarseSampleOrderNV',
+        'vkCmdSetExclusiveScissorNV',
+        'vkCmdSetLineStippleEXT',
+    ]
+
     pre_dispatch_debug_utils_functions = {
         'vkDebugMarkerSetObjectNameEXT' : 'layer_data->report_data->DebugReportSetMarkerObjectName(pNameInfo);',
         'vkSetDebugUtilsObjectNameEXT' : 'layer_data->report_data->DebugReportSetUtilsObjectName(pNameInfo);',
@@ -225,6 +254,27 @@ class LayerChassisOutputGenerator(OutputGenerator):
 #include "vk_safe_struct.h"
 #include "vk_typemap_helper.h"
 
+// Validation objects compiled into the layer. A build may leave objects out by defining the corresponding macro to 0 (see the
+// VVL_ENABLE_* CMake options); whatever isn't defined is built in.
+#ifndef VVL_ENABLE_THREADING
+#define VVL_ENABLE_THREADING 1
+#endif
+#ifndef VVL_ENABLE_STATELESS
+#define VVL_ENABLE_STATELESS 1
+#endif
+#ifndef VVL_ENABLE_OBJECT_LIFETIMES
+#define VVL_ENABLE_OBJECT_LIFETIMES 1
+#endif
+#ifndef VVL_ENABLE_CORE
+#define VVL_ENABLE_CORE 1
+#endif
+#ifndef VVL_ENABLE_BEST_PRACTICES
+#define VVL_ENABLE_BEST_PRACTICES 1
+#endif
+#ifndef VVL_ENABLE_GPU_ASSISTED
+#define VVL_ENABLE_GPU_ASSISTED 1
+#endif
+
 
 extern std::atomic<uint64_t> global_unique_id;
 
@@ -288,6 +338,10 @@ typedef enum ValidationCheckDisables {
     VALIDATION_CHECK_DISABLE_IMAGE_LAYOUT_VALIDATION,
 } ValidationCheckDisables;
 
+typedef enum ValidationCheckEnables {
+    VALIDATION_CHECK_ENABLE_PROFILING,
+} ValidationCheckEnables;
+
 // CHECK_DISABLED struct is a container for bools that can block validation checks from being performed.
 // These bools are all "false" by default meaning that all checks are enabled. Enum values can be specified
 // via the vk_layer_setting.txt config file or at CreateInstance time via the VK_EXT_validation_features extension
@@ -313,6 +367,7 @@ struct CHECK_ENABLED {
     bool gpu_validation;
     bool gpu_validation_reserve_binding_slot;
     bool best_practices;
+    bool profiling;                                 // Time each validation object per entry point, see layer_profiler.h
 
     void SetAll(bool value) { std::fill(&gpu_validation, &gpu_validation_reserve_binding_slot + 1, value); }
 };
@@ -353,6 +408,25 @@ class ValidationObject {
         virtual write_lock_guard_t write_lock() {
             return write_lock_guard_t(validation_object_mutex);
         }
+        // Holds validation_object_mutex on either side, or not at all
+        struct cmd_lock_guard_t {
+            read_lock_guard_t shared;
+            write_lock_guard_t exclusive;
+        };
+        // Taken instead of read_lock()/write_lock() around commands recorded into a command buffer (vkCmd*): cmd_read_lock()
+        // for validation, cmd_write_lock() for recording, and cmd_local_write_lock() for recording the commands that only
+        // set state of the command buffer itself (dynamic state and the like). Objects that only write the state of the
+        // command buffer being recorded can override these so recording on distinct command buffers doesn't serialize
+        // (see CoreChecks).
+        virtual cmd_lock_guard_t cmd_read_lock() {
+            return {read_lock(), write_lock_guard_t()};
+        }
+        virtual cmd_lock_guard_t cmd_write_lock() {
+            return {read_lock_guard_t(), write_lock()};
+        }
+        virtual cmd_lock_guard_t cmd_local_write_lock() {
+            return cmd_write_lock();
+        }
 
         ValidationObject* GetValidationObject(std::vector<ValidationObject*>& object_dispatch, LayerObjectTypeId object_type) {
             for (auto validation_object : object_dispatch) {
@@ -551,13 +625,26 @@ bool wrap_handles = true;
 #define OBJECT_LAYER_DESCRIPTION "khronos_validation"
 
 // Include layer validation object definitions
+#if VVL_ENABLE_BEST_PRACTICES
 #include "best_practices.h"
+#endif
+#if VVL_ENABLE_CORE
 #include "core_validation.h"
 #include "command_counter.h"
+#endif
+#if VVL_ENABLE_GPU_ASSISTED
 #include "gpu_validation.h"
+#endif
+#if VVL_ENABLE_OBJECT_LIFETIMES
 #include "object_lifetime_validation.h"
+#endif
+#if VVL_ENABLE_STATELESS
 #include "stateless_validation.h"
+#endif
+#if VVL_ENABLE_THREADING
 #include "thread_safety.h"
+#endif
+#include "layer_profiler.h"
 
 namespace vulkan_layer_chassis {
 
@@ -581,6 +668,7 @@ typedef struct {
 } function_data;
 
 extern const std::unordered_map<std::string, function_data> name_to_funcptr_map;
+extern const char *const profiled_entry_point_names[];
 
 // Manually written functions
 
@@ -640,6 +728,10 @@ static const std::unordered_map<std::string, ValidationCheckDisables> Validation
     {"VALIDATION_CHECK_DISABLE_IMAGE_LAYOUT_VALIDATION", VALIDATION_CHECK_DISABLE_IMAGE_LAYOUT_VALIDATION},
 };
 
+static const std::unordered_map<std::string, ValidationCheckEnables> ValidationEnableLookup = {
+    {"VALIDATION_CHECK_ENABLE_PROFILING", VALIDATION_CHECK_ENABLE_PROFILING},
+};
+
 // Set the local disable flag for the appropriate VALIDATION_CHECK_DISABLE enum
 void SetValidationDisable(CHECK_DISABLED* disable_data, const ValidationCheckDisables disable_id) {
     switch (disable_id) {
@@ -666,6 +758,17 @@ void SetValidationDisable(CHECK_DISABLED* disable_data, const ValidationCheckDis
     }
 }
 
+// Set the local enable flag for the appropriate VALIDATION_CHECK_ENABLE enum
+void SetValidationEnable(CHECK_ENABLED* enable_data, const ValidationCheckEnables enable_id) {
+    switch (enable_id) {
+        case VALIDATION_CHECK_ENABLE_PROFILING:
+            enable_data->profiling = true;
+            break;
+        default:
+            assert(false);
+    }
+}
+
 // Set the local disable flag for a single VK_VALIDATION_FEATURE_DISABLE_* flag
 void SetValidationFeatureDisable(CHECK_DISABLED* disable_data, const VkValidationFeatureDisableEXT feature_disable) {
     switch (feature_disable) {
@@ -759,6 +862,12 @@ void SetLocalEnableSetting(std::string list_of_enables, std::string delimiter, C
                 SetValidationFeatureEnable(enables, result->second);
             }
         }
+        if (token.find("VALIDATION_CHECK_ENABLE_") != std::string::npos) {
+            auto result = ValidationEnableLookup.find(token);
+            if (result != ValidationEnableLookup.end()) {
+                SetValidationEnable(enables, result->second);
+            }
+        }
         list_of_enables.erase(0, pos + delimiter.length());
     }
 }
@@ -812,6 +921,33 @@ void ProcessConfigAndEnvSettings(const char* layer_description, CHECK_ENABLED* e
     SetLocalDisableSetting(list_of_env_disables, env_delimiter, disables);
 }
 
+// Names reported by the layer profiler, indexed by LayerObjectTypeId. LayerObjectTypeDevice only appears in the dispatch
+// list as the CommandCounter object.
+static const char *const layer_object_type_names[] = {
+    "Instance", "CommandCounter", "ThreadSafety", "StatelessValidation", "ObjectLifetimes", "CoreChecks", "BestPractices",
+    "GpuAssisted",
+};
+
+// Start the layer profiler using the <layer_description>.profiling_* settings from the config file
+void EnableProfiling(const char* layer_description) {
+    static_assert(LayerObjectTypeMaxEnum <= layer_profiler::kMaxProfiledObjectTypes, "Too many layer object types to profile");
+    static_assert(sizeof(layer_object_type_names) / sizeof(layer_object_type_names[0]) == LayerObjectTypeMaxEnum,
+                  "layer_object_type_names must name every LayerObjectTypeId");
+    const std::string prefix = layer_description;
+    const std::string format = getLayerOption((prefix + ".profiling_format").c_str());
+    const std::string trace_events = getLayerOption((prefix + ".profiling_trace_events").c_str());
+
+    layer_profiler::ProfileSettings settings = {};
+    settings.entry_point_names = profiled_entry_point_names;
+    settings.entry_point_count = kProfiledEntryPointCount;
+    settings.object_type_names = layer_object_type_names;
+    settings.object_type_count = LayerObjectTypeMaxEnum;
+    settings.format = (format == "chrome_trace") ? layer_profiler::kProfileOutputChromeTrace : layer_profiler::kProfileOutputReport;
+    settings.output_path = getLayerOption((prefix + ".profiling_output").c_str());
+    settings.trace_events_per_thread = trace_events.empty() ? 65536 : static_cast<uint32_t>(strtoul(trace_events.c_str(), nullptr, 10));
+    layer_profiler::Enable(settings);
+}
+
 
 // Non-code-generated chassis API functions
 
@@ -912,10 +1048,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
         SetValidationFlags(&local_disables, validation_flags_ext);
     }
     ProcessConfigAndEnvSettings(OBJECT_LAYER_DESCRIPTION, &local_enables, &local_disables);
+    if (local_enables.profiling) {
+        EnableProfiling(OBJECT_LAYER_DESCRIPTION);
+    }
 
     // Create temporary dispatch vector for pre-calls until instance is created
     std::vector<ValidationObject*> local_object_dispatch;
     // Add VOs to dispatch vector. Order here will be the validation dispatch order!
+#if VVL_ENABLE_THREADING
     auto thread_checker = new ThreadSafety(nullptr);
     if (!local_disables.thread_safety) {
         local_object_dispatch.emplace_back(thread_checker);
@@ -923,6 +1063,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     thread_checker->container_type = LayerObjectTypeThreading;
     thread_checker->api_version = api_version;
     thread_checker->report_data = report_data;
+#endif
+#if VVL_ENABLE_STATELESS
     auto parameter_validation = new StatelessValidation;
     if (!local_disables.stateless_checks) {
         local_object_dispatch.emplace_back(parameter_validation);
@@ -930,6 +1072,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     parameter_validation->container_type = LayerObjectTypeParameterValidation;
     parameter_validation->api_version = api_version;
     parameter_validation->report_data = report_data;
+#endif
+#if VVL_ENABLE_OBJECT_LIFETIMES
     auto object_tracker = new ObjectLifetimes;
     if (!local_disables.object_tracking) {
         local_object_dispatch.emplace_back(object_tracker);
@@ -937,6 +1081,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     object_tracker->container_type = LayerObjectTypeObjectTracker;
     object_tracker->api_version = api_version;
     object_tracker->report_data = report_data;
+#endif
+#if VVL_ENABLE_CORE
     auto core_checks = new CoreChecks;
     if (!local_disables.core_checks) {
         local_object_dispatch.emplace_back(core_checks);
@@ -944,6 +1090,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     core_checks->container_type = LayerObjectTypeCoreValidation;
     core_checks->api_version = api_version;
     core_checks->report_data = report_data;
+#endif
+#if VVL_ENABLE_BEST_PRACTICES
     auto best_practices = new BestPractices;
     if (local_enables.best_practices) {
         local_object_dispatch.emplace_back(best_practices);
@@ -951,6 +1099,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     best_practices->container_type = LayerObjectTypeBestPractices;
     best_practices->api_version = api_version;
     best_practices->report_data = report_data;
+#endif
+#if VVL_ENABLE_GPU_ASSISTED
     auto gpu_assisted = new GpuAssisted;
     if (local_enables.gpu_validation) {
         local_object_dispatch.emplace_back(gpu_assisted);
@@ -958,6 +1108,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     gpu_assisted->container_type = LayerObjectTypeGpuAssisted;
     gpu_assisted->api_version = api_version;
     gpu_assisted->report_data = report_data;
+#endif
 
     // If handle wrapping is disabled via the ValidationFeatures extension, override build flag
     if (local_disables.handle_wrapping) {
@@ -990,26 +1141,38 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
 
     layer_debug_messenger_actions(framework->report_data, pAllocator, OBJECT_LAYER_DESCRIPTION);
 
+#if VVL_ENABLE_OBJECT_LIFETIMES
     object_tracker->instance_dispatch_table = framework->instance_dispatch_table;
     object_tracker->enabled = framework->enabled;
     object_tracker->disabled = framework->disabled;
+#endif
+#if VVL_ENABLE_THREADING
     thread_checker->instance_dispatch_table = framework->instance_dispatch_table;
     thread_checker->enabled = framework->enabled;
     thread_checker->disabled = framework->disabled;
+#endif
+#if VVL_ENABLE_STATELESS
     parameter_validation->instance_dispatch_table = framework->instance_dispatch_table;
     parameter_validation->enabled = framework->enabled;
     parameter_validation->disabled = framework->disabled;
+#endif
+#if VVL_ENABLE_CORE
     core_checks->instance_dispatch_table = framework->instance_dispatch_table;
     core_checks->instance = *pInstance;
     core_checks->enabled = framework->enabled;
     core_checks->disabled = framework->disabled;
     core_checks->instance_state = core_checks;
+#endif
+#if VVL_ENABLE_BEST_PRACTICES
     best_practices->instance_dispatch_table = framework->instance_dispatch_table;
     best_practices->enabled = framework->enabled;
     best_practices->disabled = framework->disabled;
+#endif
+#if VVL_ENABLE_GPU_ASSISTED
     gpu_assisted->instance_dispatch_table = framework->instance_dispatch_table;
     gpu_assisted->enabled = framework->enabled;
     gpu_assisted->disabled = framework->disabled;
+#endif
 
     for (auto intercept : framework->object_dispatch) {
         intercept->PostCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance, result);
@@ -1027,10 +1190,12 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
 
     """ + precallvalidate_loop + """
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyInstance, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyInstance(instance, pAllocator);
     }
     """ + precallrecord_loop + """
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyInstance, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyInstance(instance, pAllocator);
     }
 
@@ -1038,6 +1203,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
 
     """ + postcallrecord_loop + """
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyInstance, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyInstance(instance, pAllocator);
     }
 
@@ -1084,11 +1250,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
     bool skip = false;
     for (auto intercept : instance_interceptor->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDevice, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDevice(gpu, pCreateInfo, pAllocator, pDevice);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : instance_interceptor->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDevice, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, &modified_create_info);
     }
 
@@ -1114,21 +1282,28 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
     device_interceptor->report_data = instance_interceptor->report_data;
 
     // Note that this defines the order in which the layer validation objects are called
+#if VVL_ENABLE_THREADING
     auto thread_safety = new ThreadSafety(reinterpret_cast<ThreadSafety *>(instance_interceptor->GetValidationObject(instance_interceptor->object_dispatch, LayerObjectTypeThreading)));
     thread_safety->container_type = LayerObjectTypeThreading;
     if (!instance_interceptor->disabled.thread_safety) {
         device_interceptor->object_dispatch.emplace_back(thread_safety);
     }
+#endif
+#if VVL_ENABLE_STATELESS
     auto stateless_validation = new StatelessValidation;
     stateless_validation->container_type = LayerObjectTypeParameterValidation;
     if (!instance_interceptor->disabled.stateless_checks) {
         device_interceptor->object_dispatch.emplace_back(stateless_validation);
     }
+#endif
+#if VVL_ENABLE_OBJECT_LIFETIMES
     auto object_tracker = new ObjectLifetimes;
     object_tracker->container_type = LayerObjectTypeObjectTracker;
     if (!instance_interceptor->disabled.object_tracking) {
         device_interceptor->object_dispatch.emplace_back(object_tracker);
     }
+#endif
+#if VVL_ENABLE_CORE
     auto core_checks = new CoreChecks;
     core_checks->container_type = LayerObjectTypeCoreValidation;
     core_checks->instance_state = reinterpret_cast<CoreChecks *>(
@@ -1142,6 +1317,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
         }
         device_interceptor->object_dispatch.emplace_back(core_checks);
     }
+#endif
+#if VVL_ENABLE_BEST_PRACTICES
     auto best_practices = new BestPractices;
     best_practices->container_type = LayerObjectTypeBestPractices;
     best_practices->instance_state = reinterpret_cast<BestPractices *>(
@@ -1149,6 +1326,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
     if (instance_interceptor->enabled.best_practices) {
         device_interceptor->object_dispatch.emplace_back(best_practices);
     }
+#endif
+#if VVL_ENABLE_GPU_ASSISTED
     auto gpu_assisted = new GpuAssisted;
     gpu_assisted->container_type = LayerObjectTypeGpuAssisted;
     gpu_assisted->instance_state = reinterpret_cast<GpuAssisted *>(
@@ -1156,6 +1335,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
     if (instance_interceptor->enabled.gpu_validation) {
         device_interceptor->object_dispatch.emplace_back(gpu_assisted);
     }
+#endif
 
     // Set per-intercept common data items
     for (auto dev_intercept : device_interceptor->object_dispatch) {
@@ -1174,6 +1354,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
 
     for (auto intercept : instance_interceptor->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateDevice, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, result);
     }
 
@@ -1187,10 +1368,12 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     auto layer_data = GetLayerDataPtr(key, layer_data_map);
     """ + precallvalidate_loop + """
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyDevice, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDevice(device, pAllocator);
     }
     """ + precallrecord_loop + """
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyDevice, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordDestroyDevice(device, pAllocator);
     }
 
@@ -1198,6 +1381,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
 
     """ + postcallrecord_loop + """
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledDestroyDevice, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordDestroyDevice(device, pAllocator);
     }
 
@@ -1205,6 +1389,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
         delete *item;
     }
     FreeLayerDataPtr(key, layer_data_map);
+
+    // Results accumulate across devices; each device destruction writes everything recorded so far
+    layer_profiler::WriteResults();
 }
 
 
@@ -1225,11 +1412,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
     for (auto intercept : layer_data->object_dispatch) {
         cgpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateGraphicsPipelines, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateGraphicsPipelines, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
     }
 
@@ -1239,6 +1428,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateGraphicsPipelines, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, &(cgpl_state[intercept->container_type]));
     }
     return result;
@@ -1260,11 +1450,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
     for (auto intercept : layer_data->object_dispatch) {
         ccpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateComputePipelines, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateComputePipelines, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
     }
 
@@ -1274,6 +1466,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateComputePipelines, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, &(ccpl_state[intercept->container_type]));
     }
     return result;
@@ -1294,12 +1487,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
     for (auto intercept : layer_data->object_dispatch) {
         crtpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateRayTracingPipelinesNV, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos,
                                                                       pAllocator, pPipelines, &(crtpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateRayTracingPipelinesNV, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                             pPipelines, &(crtpl_state[intercept->container_type]));
     }
@@ -1308,6 +1503,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateRayTracingPipelinesNV, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                              pPipelines, result, &(crtpl_state[intercept->container_type]));
     }
@@ -1328,16 +1524,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreatePipelineLayout, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreatePipelineLayout, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, &cpl_state);
     }
     VkResult result = DispatchCreatePipelineLayout(device, &cpl_state.modified_create_info, pAllocator, pPipelineLayout);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreatePipelineLayout, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, result);
     }
     return result;
@@ -1357,16 +1556,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateShaderModule, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateShaderModule, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
     }
     VkResult result = DispatchCreateShaderModule(device, &csm_state.instrumented_create_info, pAllocator, pShaderModule);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateShaderModule, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, result, &csm_state);
     }
     return result;
@@ -1383,16 +1585,19 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAllocateDescriptorSets, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, &ads_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAllocateDescriptorSets, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     }
     VkResult result = DispatchAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledAllocateDescriptorSets, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, result, &ads_state);
     }
     return result;
@@ -1412,16 +1617,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateBuffer, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateBuffer(device, pCreateInfo, pAllocator, pBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateBuffer, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, &cb_state);
     }
     VkResult result = DispatchCreateBuffer(device, &cb_state.modified_create_info, pAllocator, pBuffer);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledCreateBuffer, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, result);
     }
     return result;
@@ -1458,12 +1666,14 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceToolPropertiesEXT(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceToolPropertiesEXT, intercept->container_type, layer_profiler::kProfilePreCallValidate);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceToolPropertiesEXT, intercept->container_type, layer_profiler::kProfilePreCallRecord);
         intercept->PreCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties);
     }
 
@@ -1476,6 +1686,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceToolPropertiesEXT(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        layer_profiler::ProfileScope profile_scope(kProfiledGetPhysicalDeviceToolPropertiesEXT, intercept->container_type, layer_profiler::kProfilePostCallRecord);
         intercept->PostCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, result);
     }
     return result;
@@ -1684,6 +1895,7 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         # Internal state - accumulators for different inner block text
         self.sections = dict([(section, []) for section in self.ALL_SECTIONS])
         self.intercepts = []
+        self.profiled_entry_points = []             # ProfiledEntryPoint enumerants (header) or names (source)
         self.layer_factory = ''                     # String containing base layer factory class definition
 
     # Check if the parameter passed in is a pointer to an array
@@ -1729,10 +1941,20 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
             write('const std::unordered_map<std::string, function_data> name_to_funcptr_map = {', file=self.outFile)
             write('\n'.join(self.intercepts), file=self.outFile)
             write('};\n', file=self.outFile)
+            # Entry point names for the layer profiler
+            write('const char *const profiled_entry_point_names[] = {', file=self.outFile)
+            write('\n'.join(self.profiled_entry_points), file=self.outFile)
+            write('};\n', file=self.outFile)
             self.newline()
             write('} // namespace vulkan_layer_chassis', file=self.outFile)
         if self.header:
             self.newline()
+            # Output profiler indices, matching the order of profiled_entry_point_names in the source
+            write('// Index of each intercepted entry point in the layer profiler tables', file=self.outFile)
+            write('enum ProfiledEntryPoint {', file=self.outFile)
+            write('\n'.join(self.profiled_entry_points), file=self.outFile)
+            write('    kProfiledEntryPointCount', file=self.outFile)
+            write('};', file=self.outFile)
             # Output Layer Factory Class Definitions
             self.layer_factory += self.inline_custom_validation_class_definitions
             self.layer_factory += '};\n\n'
@@ -1833,6 +2055,16 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         if name in ignore_functions:
             return
 
+        # Every intercept gets a profiler index, in the same order in the header enum and the source name table
+        if (self.featureExtraProtect != None):
+            self.profiled_entry_points += [ '#ifdef %s' % self.featureExtraProtect ]
+        if self.header:
+            self.profiled_entry_points += [ '    kProfiled%s,' % name[2:] ]
+        else:
+            self.profiled_entry_points += [ '    "%s",' % name ]
+        if (self.featureExtraProtect != None):
+            self.profiled_entry_points += [ '#endif' ]
+
         if self.header: # In the header declare all intercepts
             self.appendSection('command', '')
             self.appendSection('command', self.makeCDecls(cmdinfo.elem)[0])
@@ -1887,19 +2119,29 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         if (resulttype.text != 'void'):
             assignresult = resulttype.text + ' result = '
 
-        # Set up skip and locking
+        # Set up skip and locking. Commands recorded into a command buffer take the per-command-buffer locks, except those
+        # that also modify the state of other command buffers.
+        read_lock = 'read_lock'
+        write_lock = 'write_lock'
+        if name.startswith('vkCmd') and name not in self.cross_command_buffer_functions:
+            read_lock = 'cmd_read_lock'
+            write_lock = 'cmd_write_lock'
+            if name in self.command_buffer_local_functions:
+                write_lock = 'cmd_local_write_lock'
         self.appendSection('command', '    bool skip = false;')
 
         # Generate pre-call validation source code
         self.appendSection('command', '    %s' % self.precallvalidate_loop)
-        self.appendSection('command', '        auto lock = intercept->read_lock();')
+        self.appendSection('command', '        auto lock = intercept->%s();' % read_lock)
+        self.appendSection('command', '        layer_profiler::ProfileScope profile_scope(kProfiled%s, intercept->container_type, layer_profiler::kProfilePreCallValidate);' % api_function_name[2:])
         self.appendSection('command', '        skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidate%s(%s);' % (api_function_name[2:], paramstext))
         self.appendSection('command', '        if (skip) %s' % return_map[resulttype.text])
         self.appendSection('command', '    }')
 
         # Generate pre-call state recording source code
         self.appendSection('command', '    %s' % self.precallrecord_loop)
-        self.appendSection('command', '        auto lock = intercept->write_lock();')
+        self.appendSection('command', '        auto lock = intercept->%s();' % write_lock)
+        self.appendSection('command', '        layer_profiler::ProfileScope profile_scope(kProfiled%s, intercept->container_type, layer_profiler::kProfilePreCallRecord);' % api_function_name[2:])
         self.appendSection('command', '        intercept->PreCallRecord%s(%s);' % (api_function_name[2:], paramstext))
         self.appendSection('command', '    }')
 
@@ -1919,7 +2161,8 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         returnparam = ''
         if (resulttype.text == 'VkResult' or resulttype.text == 'VkDeviceAddress'):
             returnparam = ', result'
-        self.appendSection('command', '        auto lock = intercept->write_lock();')
+        self.appendSection('command', '        auto lock = intercept->%s();' % write_lock)
+        self.appendSection('command', '        layer_profiler::ProfileScope profile_scope(kProfiled%s, intercept->container_type, layer_profiler::kProfilePostCallRecord);' % api_function_name[2:])
         self.appendSection('command', '        intercept->PostCallRecord%s(%s%s);' % (api_function_name[2:], paramstext, returnparam))
         self.appendSection('command', '    }')
         # Return result variable, if any.
@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark_framework.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <sstream>
+
+#include "spirv-tools/libspirv.h"
+#include "vk_dispatch_table_helper.h"
+#include "null_driver.h"
+
+// Count every allocation made through operator new, and the bytes still allocated. Every replaceable form is replaced:
+// single and array, throwing and nothrow, sized delete and, where the compiler supports it, aligned new/delete. The layer
+// links the C++ runtime dynamically, so allocations made inside the layer are resolved to these definitions as well.
+// Allocations made with malloc directly are not counted.
+static std::atomic<uint64_t> allocation_count{0};
+static std::atomic<int64_t> live_bytes{0};
+
+// Stored immediately before each block handed out, so that every form of operator delete can account for and free it
+struct AllocationHeader {
+    size_t size;
+    void *block;  // What malloc returned
+};
+static const size_t kAllocationHeaderSize = alignof(std::max_align_t);
+static_assert(sizeof(AllocationHeader) <= kAllocationHeaderSize, "allocation header does not fit before the block");
+
+static void *CountedAllocate(size_t size, size_t alignment) {
+    const size_t padding = alignment > kAllocationHeaderSize ? alignment - kAllocationHeaderSize : 0;
+    char *block = static_cast<char *>(malloc(kAllocationHeaderSize + padding + size));
+    if (!block) return nullptr;
+    // malloc returns max_align_t-aligned blocks, so with the default alignment the data follows the header directly
+    const uintptr_t data_address = reinterpret_cast<uintptr_t>(block) + kAllocationHeaderSize;
+    char *data = block + (kAllocationHeaderSize + ((alignment - data_address % alignment) % alignment));
+    auto header = reinterpret_cast<AllocationHeader *>(data - sizeof(AllocationHeader));
+    header->size = size;
+    header->block = block;
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    live_bytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed);
+    return data;
+}
+
+static void CountedFree(void *ptr) {
+    if (!ptr) return;
+    auto header = reinterpret_cast<AllocationHeader *>(static_cast<char *>(ptr) - sizeof(AllocationHeader));
+    live_bytes.fetch_sub(static_cast<int64_t>(header->size), std::memory_order_relaxed);
+    free(header->block);
+}
+
+static void *CountedAllocateOrThrow(size_t size, size_t alignment) {
+    void *ptr = CountedAllocate(size, alignment);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void *operator new(size_t size) { return CountedAllocateOrThrow(size, alignof(std::max_align_t)); }
+void *operator new[](size_t size) { return CountedAllocateOrThrow(size, alignof(std::max_align_t)); }
+void *operator new(size_t size, const std::nothrow_t &) noexcept { return CountedAllocate(size, alignof(std::max_align_t)); }
+void *operator new[](size_t size, const std::nothrow_t &) noexcept { return CountedAllocate(size, alignof(std::max_align_t)); }
+void operator delete(void *ptr) noexcept { CountedFree(ptr); }
+void operator delete[](void *ptr) noexcept { CountedFree(ptr); }
+void operator delete(void *ptr, const std::nothrow_t &) noexcept { CountedFree(ptr); }
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept { CountedFree(ptr); }
+void operator delete(void *ptr, size_t) noexcept { CountedFree(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { CountedFree(ptr); }
+
+#ifdef __cpp_aligned_new
+void *operator new(size_t size, std::align_val_t alignment) {
+    return CountedAllocateOrThrow(size, static_cast<size_t>(alignment));
+}
+void *operator new[](size_t size, std::align_val_t alignment) {
+    return CountedAllocateOrThrow(size, static_cast<size_t>(alignment));
+}
+void *operator new(size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+    return CountedAllocate(size, static_cast<size_t>(alignment));
+}
+void *operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+    return CountedAllocate(size, static_cast<size_t>(alignment));
+}
+void operator delete(void *ptr, std::align_val_t) noexcept { CountedFree(ptr); }
+void operator delete[](void *ptr, std::align_val_t) noexcept { CountedFree(ptr); }
+void operator delete(void *ptr, std::align_val_t, const std::nothrow_t &) noexcept { CountedFree(ptr); }
+void operator delete[](void *ptr, std::align_val_t, const std::nothrow_t &) noexcept { CountedFree(ptr); }
+void operator delete(void *ptr, size_t, std::align_val_t) noexcept { CountedFree(ptr); }
+void operator delete[](void *ptr, size_t, std::align_val_t) noexcept { CountedFree(ptr); }
+#endif
+
+namespace vkbench {
+
+uint64_t AllocationCount() { return allocation_count.load(std::memory_order_relaxed); }
+
+int64_t LiveBytes() { return live_bytes.load(std::memory_order_relaxed); }
+
+// LayerDevice ----------------------------------------------------------------------------------------------------------------
+
+LayerDevice::~LayerDevice() {
+    if (device) {
+        vk.DeviceWaitIdle(device);
+        vk.DestroyDevice(device, nullptr);
+    }
+    if (instance) {
+        if (messenger_) vki.DestroyDebugUtilsMessengerEXT(instance, messenger_, nullptr);
+        vki.DestroyInstance(instance, nullptr);
+    }
+    if (layer_library_) loader_platform_close_library(layer_library_);
+}
+
+VKAPI_ATTR VkBool32 VKAPI_CALL LayerDevice::MessengerCallback(VkDebugUtilsMessageSeverityFlagBitsEXT severity,
+                                                              VkDebugUtilsMessageTypeFlagsEXT types,
+                                                              const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
+                                                              void *user_data) {
+    auto layer_device = reinterpret_cast<LayerDevice *>(user_data);
+    // Only the first message of a run is printed; a scenario that trips validation is measuring error reporting, not the
+    // fast path, and its results should be looked at.
+    if (layer_device->message_count_.fetch_add(1) == 0) {
+        std::cerr << "Validation message: " << callback_data->pMessage << std::endl;
+    }
+    return VK_FALSE;
+}
+
+bool LayerDevice::Init(const std::string &layer_path, std::string *error) {
+    layer_library_ = loader_platform_open_library(layer_path.c_str());
+    if (!layer_library_) {
+        *error = std::string("unable to load ") + layer_path + ": " + loader_platform_open_library_error(layer_path.c_str());
+        return false;
+    }
+    auto layer_gipa =
+        reinterpret_cast<PFN_vkGetInstanceProcAddr>(loader_platform_get_proc_address(layer_library_, "vkGetInstanceProcAddr"));
+    auto layer_gdpa =
+        reinterpret_cast<PFN_vkGetDeviceProcAddr>(loader_platform_get_proc_address(layer_library_, "vkGetDeviceProcAddr"));
+    if (!layer_gipa || !layer_gdpa) {
+        *error = "layer does not export vkGetInstanceProcAddr/vkGetDeviceProcAddr";
+        return false;
+    }
+
+    // Instance, with the layer as the only entry in the chain above the null driver
+    VkLayerInstanceLink instance_link = {};
+    instance_link.pfnNextGetInstanceProcAddr = null_driver::GetInstanceProcAddr;
+
+    VkDebugUtilsMessengerCreateInfoEXT messenger_info = {VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT};
+    messenger_info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    messenger_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT;
+    messenger_info.pfnUserCallback = MessengerCallback;
+    messenger_info.pUserData = this;
+
+    VkLayerInstanceCreateInfo instance_chain_info = {VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO, &messenger_info};
+    instance_chain_info.function = VK_LAYER_LINK_INFO;
+    instance_chain_info.u.pLayerInfo = &instance_link;
+
+    VkApplicationInfo app_info = {VK_STRUCTURE_TYPE_APPLICATION_INFO};
+    app_info.pApplicationName = "vk_layer_benchmarks";
+    app_info.apiVersion = VK_API_VERSION_1_1;
+
+    const char *instance_extensions[] = {VK_EXT_DEBUG_UTILS_EXTENSION_NAME};
+    VkInstanceCreateInfo instance_info = {VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO, &instance_chain_info};
+    instance_info.pApplicationInfo = &app_info;
+    instance_info.enabledExtensionCount = 1;
+    instance_info.ppEnabledExtensionNames = instance_extensions;
+
+    auto create_instance = reinterpret_cast<PFN_vkCreateInstance>(layer_gipa(VK_NULL_HANDLE, "vkCreateInstance"));
+    VkResult result = create_instance(&instance_info, nullptr, &instance);
+    if (result != VK_SUCCESS) {
+        *error = "vkCreateInstance failed";
+        return false;
+    }
+    layer_init_instance_dispatch_table(instance, &vki, layer_gipa);
+
+    messenger_info.pNext = nullptr;
+    vki.CreateDebugUtilsMessengerEXT(instance, &messenger_info, nullptr, &messenger_);
+
+    uint32_t gpu_count = 1;
+    vki.EnumeratePhysicalDevices(instance, &gpu_count, &gpu);
+
+    // Device, using every queue of the single queue family so multithreaded scenarios can submit independently
+    uint32_t queue_count = 0;
+    vki.GetPhysicalDeviceQueueFamilyProperties(gpu, &queue_count, nullptr);
+    VkQueueFamilyProperties family = {};
+    queue_count = 1;
+    vki.GetPhysicalDeviceQueueFamilyProperties(gpu, &queue_count, &family);
+    std::vector<float> priorities(family.queueCount, 1.0f);
+
+    VkDeviceQueueCreateInfo queue_info = {VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO};
+    queue_info.queueFamilyIndex = 0;
+    queue_info.queueCount = family.queueCount;
+    queue_info.pQueuePriorities = priorities.data();
+
+    VkLayerDeviceLink device_link = {};
+    device_link.pfnNextGetInstanceProcAddr = null_driver::GetInstanceProcAddr;
+    device_link.pfnNextGetDeviceProcAddr = null_driver::GetDeviceProcAddr;
+
+    VkLayerDeviceCreateInfo loader_data_info = {VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO};
+    loader_data_info.function = VK_LOADER_DATA_CALLBACK;
+    loader_data_info.u.pfnSetDeviceLoaderData = null_driver::SetDeviceLoaderData;
+
+    VkLayerDeviceCreateInfo device_chain_info = {VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO, &loader_data_info};
+    device_chain_info.function = VK_LAYER_LINK_INFO;
+    device_chain_info.u.pLayerInfo = &device_link;
+
+    VkDeviceCreateInfo device_info = {VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO, &device_chain_info};
+    device_info.queueCreateInfoCount = 1;
+    device_info.pQueueCreateInfos = &queue_info;
+
+    auto create_device = reinterpret_cast<PFN_vkCreateDevice>(layer_gipa(instance, "vkCreateDevice"));
+    result = create_device(gpu, &device_info, nullptr, &device);
+    if (result != VK_SUCCESS) {
+        *error = "vkCreateDevice failed";
+        return false;
+    }
+    layer_init_device_dispatch_table(device, &vk, layer_gdpa);
+    return true;
+}
+
+VkQueue LayerDevice::GetQueue(uint32_t index) const {
+    VkQueue queue = VK_NULL_HANDLE;
+    vk.GetDeviceQueue(device, 0, index, &queue);
+    return queue;
+}
+
+std::vector<uint32_t> AssembleSpirv(const char *spirv_asm) {
+    spv_binary binary = nullptr;
+    spv_diagnostic diagnostic = nullptr;
+    spv_context context = spvContextCreate(SPV_ENV_VULKAN_1_0);
+    spv_result_t error = spvTextToBinary(context, spirv_asm, strlen(spirv_asm), &binary, &diagnostic);
+    spvContextDestroy(context);
+    if (error) {
+        spvDiagnosticPrint(diagnostic);
+        spvDiagnosticDestroy(diagnostic);
+        return {};
+    }
+    std::vector<uint32_t> spirv(binary->code, binary->code + binary->wordCount);
+    spvBinaryDestroy(binary);
+    return spirv;
+}
+
+VkShaderModule LayerDevice::CreateShaderModule(const char *spirv_asm) { return CreateShaderModule(AssembleSpirv(spirv_asm)); }
+
+VkShaderModule LayerDevice::CreateShaderModule(const std::vector<uint32_t> &spirv) {
+    if (spirv.empty()) return VK_NULL_HANDLE;
+    VkShaderModuleCreateInfo module_info = {VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO};
+    module_info.codeSize = spirv.size() * sizeof(uint32_t);
+    module_info.pCode = spirv.data();
+    VkShaderModule shader_module = VK_NULL_HANDLE;
+    vk.CreateShaderModule(device, &module_info, nullptr, &shader_module);
+    return shader_module;
+}
+
+// Registry and driver --------------------------------------------------------------------------------------------------------
+
+struct RegisteredBenchmark {
+    const char *name;
+    BenchmarkFunction function;
+};
+
+static std::vector<RegisteredBenchmark> &Registry() {
+    static std::vector<RegisteredBenchmark> registry;
+    return registry;
+}
+
+BenchmarkRegistrar::BenchmarkRegistrar(const char *name, BenchmarkFunction function) { Registry().push_back({name, function}); }
+
+uint64_t BenchmarkState::Scaled(uint64_t count) const {
+    const double scaled = std::ceil(static_cast<double>(count) * options.scale);
+    return scaled < 1.0 ? 1 : static_cast<uint64_t>(scaled);
+}
+
+static void WriteJson(std::ostream &out, const Options &options, const std::vector<BenchmarkResult> &results) {
+    out << "{\n";
+    out << "  \"scale\": " << options.scale << ",\n";
+    out << "  \"threads\": " << options.threads << ",\n";
+    out << "  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchmarkResult &result = results[i];
+        const double calls = result.calls ? static_cast<double>(result.calls) : 1.0;
+        out << (i ? ",\n" : "\n");
+        out << "    {\"name\": \"" << result.name << "\", ";
+        out << "\"calls\": " << result.calls << ", ";
+        out << "\"total_ns\": " << result.total_ns << ", ";
+        out << "\"ns_per_call\": " << result.total_ns / calls << ", ";
+        out << "\"allocations_per_call\": " << result.allocations / calls << ", ";
+        out << "\"retained_bytes\": " << result.retained_bytes << ", ";
+        out << "\"retained_bytes_per_call\": " << result.retained_bytes / calls << ", ";
+        out << "\"validation_messages\": " << result.validation_messages << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+int RunBenchmarks(const Options &options) {
+    std::vector<BenchmarkResult> results;
+    for (const auto &benchmark : Registry()) {
+        if (!options.filter.empty() && !strstr(benchmark.name, options.filter.c_str())) continue;
+
+        // Each scenario gets a fresh instance and device so that state left by one does not skew the next
+        LayerDevice device;
+        std::string error;
+        if (!device.Init(options.layer_path, &error)) {
+            std::cerr << benchmark.name << ": " << error << std::endl;
+            return EXIT_FAILURE;
+        }
+        BenchmarkResult result;
+        result.name = benchmark.name;
+        BenchmarkState state(device, options, result);
+        benchmark.function(state);
+        std::cerr << benchmark.name << ": " << result.calls << " calls, "
+                  << (result.calls ? result.total_ns / result.calls : 0) << " ns/call" << std::endl;
+        results.push_back(result);
+    }
+
+    if (options.output.empty()) {
+        WriteJson(std::cout, options, results);
+    } else {
+        std::ofstream out(options.output);
+        if (!out) {
+            std::cerr << "unable to open " << options.output << std::endl;
+            return EXIT_FAILURE;
+        }
+        WriteJson(out, options, results);
+    }
+    return EXIT_SUCCESS;
+}
+
+}  // namespace vkbench
+
+static void PrintUsage(const char *program) {
+    std::cerr << "usage: " << program << " [--layer <path>] [--filter <substring>] [--scale <factor>] [--threads <count>]"
+              << " [--output <file.json>]" << std::endl;
+}
+
+int main(int argc, char **argv) {
+    vkbench::Options options;
+#ifdef VKBENCH_DEFAULT_LAYER_PATH
+    options.layer_path = VKBENCH_DEFAULT_LAYER_PATH;
+#endif
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        const char *value = argv[++i];
+        if (arg == "--layer") {
+            options.layer_path = value;
+        } else if (arg == "--filter") {
+            options.filter = value;
+        } else if (arg == "--scale") {
+            options.scale = atof(value);
+        } else if (arg == "--threads") {
+            options.threads = static_cast<uint32_t>(atoi(value));
+        } else if (arg == "--output") {
+            options.output = value;
+        } else {
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (options.layer_path.empty() || options.scale <= 0.0 || options.threads == 0) {
+        PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    return vkbench::RunBenchmarks(options);
+}
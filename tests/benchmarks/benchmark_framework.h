@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+#include <vulkan/vk_layer.h>
+
+#include "vk_layer_dispatch_table.h"
+#include "vk_loader_platform.h"
+
+namespace vkbench {
+
+struct Options {
+    std::string layer_path;
+    std::string filter;  // Only run benchmarks whose name contains this string
+    std::string output;  // JSON destination, stdout when empty
+    double scale = 1.0;  // Multiplier applied to every scenario's iteration count
+    uint32_t threads = 4;
+};
+
+// Number of allocations made through any form of operator new, by any thread, since process start
+uint64_t AllocationCount();
+
+// Bytes allocated with any form of operator new and not yet deleted, by all threads
+int64_t LiveBytes();
+
+// Assembles SPIR-V text, returning an empty vector (after printing the diagnostic) if it does not assemble
+std::vector<uint32_t> AssembleSpirv(const char *spirv_asm);
+
+// An instance and device created through VkLayer_khronos_validation, with the null driver at the bottom of the chain.
+// All calls made through the dispatch tables go through the full set of validation objects exactly as they would for an
+// application; validation messages are counted rather than printed.
+class LayerDevice {
+  public:
+    LayerDevice() = default;
+    ~LayerDevice();
+
+    bool Init(const std::string &layer_path, std::string *error);
+
+    VkQueue GetQueue(uint32_t index) const;
+    uint64_t MessageCount() const { return message_count_.load(); }
+
+    // Assembles SPIR-V text and creates a shader module from it
+    VkShaderModule CreateShaderModule(const char *spirv_asm);
+    VkShaderModule CreateShaderModule(const std::vector<uint32_t> &spirv);
+
+    VkInstance instance = VK_NULL_HANDLE;
+    VkPhysicalDevice gpu = VK_NULL_HANDLE;
+    VkDevice device = VK_NULL_HANDLE;
+    VkLayerInstanceDispatchTable vki = {};
+    VkLayerDispatchTable vk = {};
+
+  private:
+    static VKAPI_ATTR VkBool32 VKAPI_CALL MessengerCallback(VkDebugUtilsMessageSeverityFlagBitsEXT severity,
+                                                           VkDebugUtilsMessageTypeFlagsEXT types,
+                                                           const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
+                                                           void *user_data);
+
+    loader_platform_dl_handle layer_library_ = nullptr;
+    VkDebugUtilsMessengerEXT messenger_ = VK_NULL_HANDLE;
+    std::atomic<uint64_t> message_count_{0};
+};
+
+struct BenchmarkResult {
+    std::string name;
+    uint64_t calls = 0;
+    uint64_t total_ns = 0;
+    uint64_t allocations = 0;
+    int64_t retained_bytes = 0;  // Growth in LiveBytes() across Measure(), i.e. memory the measured calls kept
+    uint64_t validation_messages = 0;
+};
+
+// Passed to each scenario. Setup happens outside of Measure(); only the work inside Measure() is reported.
+class BenchmarkState {
+  public:
+    BenchmarkState(LayerDevice &device, const Options &options, BenchmarkResult &result)
+        : device(device), options(options), result_(result) {}
+
+    // Scales a nominal iteration count by --scale, never returning less than one
+    uint64_t Scaled(uint64_t count) const;
+
+    // Times fn and attributes its cost to `calls` API calls. May be called more than once; results accumulate.
+    template <typename Fn>
+    void Measure(uint64_t calls, Fn &&fn) {
+        const uint64_t allocations_before = AllocationCount();
+        const int64_t live_bytes_before = LiveBytes();
+        const uint64_t messages_before = device.MessageCount();
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        const auto end = std::chrono::steady_clock::now();
+        result_.total_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        result_.allocations += AllocationCount() - allocations_before;
+        result_.retained_bytes += LiveBytes() - live_bytes_before;
+        result_.validation_messages += device.MessageCount() - messages_before;
+        result_.calls += calls;
+    }
+
+    LayerDevice &device;
+    const Options &options;
+
+  private:
+    BenchmarkResult &result_;
+};
+
+typedef void (*BenchmarkFunction)(BenchmarkState &state);
+
+struct BenchmarkRegistrar {
+    BenchmarkRegistrar(const char *name, BenchmarkFunction function);
+};
+
+#define VKBENCH_REGISTER(name, function) static vkbench::BenchmarkRegistrar benchmark_registrar_##function(name, function)
+
+int RunBenchmarks(const Options &options);
+
+}  // namespace vkbench
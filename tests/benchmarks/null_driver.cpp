@@ -0,0 +1,813 @@
+/*
+ * Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "null_driver.h"
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "cast_utils.h"
+
+namespace null_driver {
+
+// Layers use the first pointer-sized word of a dispatchable object as the key for their per-object data
+struct DispatchableObject {
+    void *loader_data;
+};
+
+struct Instance {
+    void *loader_data;
+    DispatchableObject physical_device;
+};
+
+struct Device {
+    void *loader_data;
+    std::mutex lock;
+    std::unordered_map<uint64_t, std::unique_ptr<DispatchableObject>> queues;  // keyed by (family << 32 | index)
+    std::unordered_map<uint64_t, std::vector<DispatchableObject *>> pool_command_buffers;
+    std::unordered_map<uint64_t, VkDeviceSize> memory_sizes;
+    std::unordered_map<uint64_t, std::unique_ptr<uint8_t[]>> mapped_memory;
+};
+
+static std::atomic<uint64_t> next_handle{0x1000};
+
+template <typename HandleType>
+static HandleType NewHandle() {
+    return CastFromUint64<HandleType>(next_handle++);
+}
+
+static Device *GetDevice(VkDevice device) { return reinterpret_cast<Device *>(device); }
+
+static const uint32_t kQueueCountPerFamily = 16;
+static const VkDeviceSize kHeapSize = VkDeviceSize(1) << 34;
+
+// Returned for entry points without an implementation below that produce no output (see HasNoOutputs): commands are no-ops
+// and every VkResult-returning call succeeds. This relies on the platform calling convention tolerating ignored arguments, as
+// 64-bit ABIs do.
+static VKAPI_ATTR VkResult VKAPI_CALL Noop() { return VK_SUCCESS; }
+
+// Entry points that write nothing back to the caller, so that returning from Noop leaves no caller memory uninitialized.
+// Anything else (queries, enumerations, handle creation) must be implemented below; unimplemented ones resolve to NULL so
+// that reaching one fails at the call rather than feeding uninitialized output to the layer.
+static bool HasNoOutputs(const std::string &name) {
+    static const char *const kPrefixes[] = {"vkCmd",   "vkDestroy", "vkFree",  "vkReset",      "vkBind",   "vkQueue",
+                                            "vkUnmap", "vkFlush",   "vkTrim",  "vkInvalidate", "vkSignal", "vkWait",
+                                            "vkSet",   "vkUpdate",  "vkMerge", "vkSubmitDebug"};
+    static const char *const kNames[] = {"vkBeginCommandBuffer", "vkEndCommandBuffer", "vkDeviceWaitIdle", "vkGetFenceStatus",
+                                         "vkGetEventStatus",     "vkReleaseProfilingLockKHR"};
+    for (const char *prefix : kPrefixes) {
+        if (name.compare(0, strlen(prefix), prefix) == 0) return true;
+    }
+    for (const char *no_output_name : kNames) {
+        if (name == no_output_name) return true;
+    }
+    return false;
+}
+
+// Clears an output structure, keeping the sType and pNext the caller filled in
+template <typename T>
+static void ClearOutputStruct(T *output) {
+    const VkStructureType s_type = output->sType;
+    void *p_next = output->pNext;
+    memset(output, 0, sizeof(*output));
+    output->sType = s_type;
+    output->pNext = p_next;
+}
+
+// Instance and physical device -----------------------------------------------------------------------------------------------
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator,
+                                                     VkInstance *pInstance) {
+    auto instance = new Instance;
+    instance->loader_data = instance;
+    instance->physical_device.loader_data = instance;
+    *pInstance = reinterpret_cast<VkInstance>(instance);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocationCallbacks *pAllocator) {
+    delete reinterpret_cast<Instance *>(instance);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateDebugUtilsMessengerEXT(VkInstance instance,
+                                                                   const VkDebugUtilsMessengerCreateInfoEXT *pCreateInfo,
+                                                                   const VkAllocationCallbacks *pAllocator,
+                                                                   VkDebugUtilsMessengerEXT *pMessenger) {
+    *pMessenger = NewHandle<VkDebugUtilsMessengerEXT>();
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDevices(VkInstance instance, uint32_t *pPhysicalDeviceCount,
+                                                               VkPhysicalDevice *pPhysicalDevices) {
+    if (!pPhysicalDevices) {
+        *pPhysicalDeviceCount = 1;
+        return VK_SUCCESS;
+    }
+    if (*pPhysicalDeviceCount < 1) return VK_INCOMPLETE;
+    *pPhysicalDeviceCount = 1;
+    pPhysicalDevices[0] = reinterpret_cast<VkPhysicalDevice>(&reinterpret_cast<Instance *>(instance)->physical_device);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDeviceGroups(
+    VkInstance instance, uint32_t *pPhysicalDeviceGroupCount, VkPhysicalDeviceGroupProperties *pPhysicalDeviceGroupProperties) {
+    if (!pPhysicalDeviceGroupProperties) {
+        *pPhysicalDeviceGroupCount = 1;
+        return VK_SUCCESS;
+    }
+    if (*pPhysicalDeviceGroupCount < 1) return VK_INCOMPLETE;
+    *pPhysicalDeviceGroupCount = 1;
+    VkPhysicalDeviceGroupProperties &group = pPhysicalDeviceGroupProperties[0];
+    ClearOutputStruct(&group);
+    group.physicalDeviceCount = 1;
+    group.physicalDevices[0] = reinterpret_cast<VkPhysicalDevice>(&reinterpret_cast<Instance *>(instance)->physical_device);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFeatures(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures *pFeatures) {
+    // Report every core feature so that benchmark scenarios may enable whatever they need
+    VkBool32 *features = reinterpret_cast<VkBool32 *>(pFeatures);
+    for (size_t i = 0; i < sizeof(VkPhysicalDeviceFeatures) / sizeof(VkBool32); ++i) {
+        features[i] = VK_TRUE;
+    }
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFeatures2(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures2 *pFeatures) {
+    GetPhysicalDeviceFeatures(physicalDevice, &pFeatures->features);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceProperties(VkPhysicalDevice physicalDevice,
+                                                              VkPhysicalDeviceProperties *pProperties) {
+    memset(pProperties, 0, sizeof(*pProperties));
+    pProperties->apiVersion = VK_API_VERSION_1_1;
+    pProperties->driverVersion = 1;
+    pProperties->vendorID = 0x10000;
+    pProperties->deviceID = 1;
+    pProperties->deviceType = VK_PHYSICAL_DEVICE_TYPE_OTHER;
+    strncpy(pProperties->deviceName, "Null benchmark device", VK_MAX_PHYSICAL_DEVICE_NAME_SIZE - 1);
+
+    VkPhysicalDeviceLimits &limits = pProperties->limits;
+    limits.maxImageDimension1D = 16384;
+    limits.maxImageDimension2D = 16384;
+    limits.maxImageDimension3D = 2048;
+    limits.maxImageDimensionCube = 16384;
+    limits.maxImageArrayLayers = 2048;
+    limits.maxTexelBufferElements = 1u << 27;
+    limits.maxUniformBufferRange = 1u << 16;
+    limits.maxStorageBufferRange = 1u << 30;
+    limits.maxPushConstantsSize = 256;
+    limits.maxMemoryAllocationCount = 1u << 22;
+    limits.maxSamplerAllocationCount = 1u << 22;
+    limits.bufferImageGranularity = 1;
+    limits.sparseAddressSpaceSize = kHeapSize;
+    limits.maxBoundDescriptorSets = 32;
+    limits.maxPerStageDescriptorSamplers = 1u << 20;
+    limits.maxPerStageDescriptorUniformBuffers = 1u << 20;
+    limits.maxPerStageDescriptorStorageBuffers = 1u << 20;
+    limits.maxPerStageDescriptorSampledImages = 1u << 20;
+    limits.maxPerStageDescriptorStorageImages = 1u << 20;
+    limits.maxPerStageDescriptorInputAttachments = 1u << 20;
+    limits.maxPerStageResources = 1u << 22;
+    limits.maxDescriptorSetSamplers = 1u << 20;
+    limits.maxDescriptorSetUniformBuffers = 1u << 20;
+    limits.maxDescriptorSetUniformBuffersDynamic = 64;
+    limits.maxDescriptorSetStorageBuffers = 1u << 20;
+    limits.maxDescriptorSetStorageBuffersDynamic = 64;
+    limits.maxDescriptorSetSampledImages = 1u << 20;
+    limits.maxDescriptorSetStorageImages = 1u << 20;
+    limits.maxDescriptorSetInputAttachments = 1u << 20;
+    limits.maxVertexInputAttributes = 32;
+    limits.maxVertexInputBindings = 32;
+    limits.maxVertexInputAttributeOffset = 2047;
+    limits.maxVertexInputBindingStride = 2048;
+    limits.maxVertexOutputComponents = 128;
+    limits.maxTessellationGenerationLevel = 64;
+    limits.maxTessellationPatchSize = 32;
+    limits.maxTessellationControlPerVertexInputComponents = 128;
+    limits.maxTessellationControlPerVertexOutputComponents = 128;
+    limits.maxTessellationControlPerPatchOutputComponents = 120;
+    limits.maxTessellationControlTotalOutputComponents = 4096;
+    limits.maxTessellationEvaluationInputComponents = 128;
+    limits.maxTessellationEvaluationOutputComponents = 128;
+    limits.maxGeometryShaderInvocations = 32;
+    limits.maxGeometryInputComponents = 128;
+    limits.maxGeometryOutputComponents = 128;
+    limits.maxGeometryOutputVertices = 256;
+    limits.maxGeometryTotalOutputComponents = 1024;
+    limits.maxFragmentInputComponents = 128;
+    limits.maxFragmentOutputAttachments = 8;
+    limits.maxFragmentDualSrcAttachments = 1;
+    limits.maxFragmentCombinedOutputResources = 1u << 20;
+    limits.maxComputeSharedMemorySize = 1u << 15;
+    for (int i = 0; i < 3; ++i) {
+        limits.maxComputeWorkGroupCount[i] = 65535;
+        limits.maxComputeWorkGroupSize[i] = 1024;
+    }
+    limits.maxComputeWorkGroupInvocations = 1024;
+    limits.subPixelPrecisionBits = 8;
+    limits.subTexelPrecisionBits = 8;
+    limits.mipmapPrecisionBits = 8;
+    limits.maxDrawIndexedIndexValue = UINT32_MAX;
+    limits.maxDrawIndirectCount = UINT32_MAX;
+    limits.maxSamplerLodBias = 16.0f;
+    limits.maxSamplerAnisotropy = 16.0f;
+    limits.maxViewports = 16;
+    limits.maxViewportDimensions[0] = 16384;
+    limits.maxViewportDimensions[1] = 16384;
+    limits.viewportBoundsRange[0] = -32768.0f;
+    limits.viewportBoundsRange[1] = 32767.0f;
+    limits.minMemoryMapAlignment = 64;
+    limits.minTexelBufferOffsetAlignment = 16;
+    limits.minUniformBufferOffsetAlignment = 256;
+    limits.minStorageBufferOffsetAlignment = 16;
+    limits.minTexelOffset = -8;
+    limits.maxTexelOffset = 7;
+    limits.minTexelGatherOffset = -32;
+    limits.maxTexelGatherOffset = 31;
+    limits.minInterpolationOffset = -0.5f;
+    limits.maxInterpolationOffset = 0.5f;
+    limits.maxFramebufferWidth = 16384;
+    limits.maxFramebufferHeight = 16384;
+    limits.maxFramebufferLayers = 2048;
+    const VkSampleCountFlags all_samples = VK_SAMPLE_COUNT_1_BIT | VK_SAMPLE_COUNT_2_BIT | VK_SAMPLE_COUNT_4_BIT |
+                                           VK_SAMPLE_COUNT_8_BIT | VK_SAMPLE_COUNT_16_BIT;
+    limits.framebufferColorSampleCounts = all_samples;
+    limits.framebufferDepthSampleCounts = all_samples;
+    limits.framebufferStencilSampleCounts = all_samples;
+    limits.framebufferNoAttachmentsSampleCounts = all_samples;
+    limits.maxColorAttachments = 8;
+    limits.sampledImageColorSampleCounts = all_samples;
+    limits.sampledImageIntegerSampleCounts = all_samples;
+    limits.sampledImageDepthSampleCounts = all_samples;
+    limits.sampledImageStencilSampleCounts = all_samples;
+    limits.storageImageSampleCounts = all_samples;
+    limits.maxSampleMaskWords = 1;
+    limits.timestampComputeAndGraphics = VK_TRUE;
+    limits.timestampPeriod = 1.0f;
+    limits.maxClipDistances = 8;
+    limits.maxCullDistances = 8;
+    limits.maxCombinedClipAndCullDistances = 8;
+    limits.discreteQueuePriorities = 2;
+    limits.pointSizeRange[0] = 1.0f;
+    limits.pointSizeRange[1] = 64.0f;
+    limits.lineWidthRange[0] = 1.0f;
+    limits.lineWidthRange[1] = 8.0f;
+    limits.pointSizeGranularity = 1.0f;
+    limits.lineWidthGranularity = 1.0f;
+    limits.standardSampleLocations = VK_TRUE;
+    limits.optimalBufferCopyOffsetAlignment = 1;
+    limits.optimalBufferCopyRowPitchAlignment = 1;
+    limits.nonCoherentAtomSize = 64;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceProperties2(VkPhysicalDevice physicalDevice,
+                                                               VkPhysicalDeviceProperties2 *pProperties) {
+    GetPhysicalDeviceProperties(physicalDevice, &pProperties->properties);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyProperties(VkPhysicalDevice physicalDevice,
+                                                                         uint32_t *pQueueFamilyPropertyCount,
+                                                                         VkQueueFamilyProperties *pQueueFamilyProperties) {
+    if (!pQueueFamilyProperties) {
+        *pQueueFamilyPropertyCount = 1;
+        return;
+    }
+    if (*pQueueFamilyPropertyCount < 1) return;
+    *pQueueFamilyPropertyCount = 1;
+    pQueueFamilyProperties[0].queueFlags =
+        VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT | VK_QUEUE_SPARSE_BINDING_BIT;
+    pQueueFamilyProperties[0].queueCount = kQueueCountPerFamily;
+    pQueueFamilyProperties[0].timestampValidBits = 64;
+    pQueueFamilyProperties[0].minImageTransferGranularity = {1, 1, 1};
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyProperties2(VkPhysicalDevice physicalDevice,
+                                                                          uint32_t *pQueueFamilyPropertyCount,
+                                                                          VkQueueFamilyProperties2 *pQueueFamilyProperties) {
+    if (!pQueueFamilyProperties) {
+        GetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, nullptr);
+        return;
+    }
+    GetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount,
+                                           &pQueueFamilyProperties[0].queueFamilyProperties);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMemoryProperties(VkPhysicalDevice physicalDevice,
+                                                                    VkPhysicalDeviceMemoryProperties *pMemoryProperties) {
+    memset(pMemoryProperties, 0, sizeof(*pMemoryProperties));
+    pMemoryProperties->memoryHeapCount = 1;
+    pMemoryProperties->memoryHeaps[0].size = kHeapSize;
+    pMemoryProperties->memoryHeaps[0].flags = VK_MEMORY_HEAP_DEVICE_LOCAL_BIT;
+    // Type 0: device local only, type 1: host visible and coherent, type 2: host visible, non-coherent
+    pMemoryProperties->memoryTypeCount = 3;
+    pMemoryProperties->memoryTypes[0].propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    pMemoryProperties->memoryTypes[1].propertyFlags =
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    pMemoryProperties->memoryTypes[2].propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMemoryProperties2(VkPhysicalDevice physicalDevice,
+                                                                     VkPhysicalDeviceMemoryProperties2 *pMemoryProperties) {
+    GetPhysicalDeviceMemoryProperties(physicalDevice, &pMemoryProperties->memoryProperties);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format,
+                                                                    VkFormatProperties *pFormatProperties) {
+    const VkFormatFeatureFlags image_features =
+        VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT | VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT | VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT |
+        VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BLEND_BIT | VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT |
+        VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT | VK_FORMAT_FEATURE_TRANSFER_SRC_BIT | VK_FORMAT_FEATURE_TRANSFER_DST_BIT;
+    pFormatProperties->linearTilingFeatures = image_features;
+    pFormatProperties->optimalTilingFeatures = image_features | VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT;
+    pFormatProperties->bufferFeatures = VK_FORMAT_FEATURE_UNIFORM_TEXEL_BUFFER_BIT | VK_FORMAT_FEATURE_STORAGE_TEXEL_BUFFER_BIT |
+                                        VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFormatProperties2(VkPhysicalDevice physicalDevice, VkFormat format,
+                                                                     VkFormatProperties2 *pFormatProperties) {
+    GetPhysicalDeviceFormatProperties(physicalDevice, format, &pFormatProperties->formatProperties);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format,
+                                                                             VkImageType type, VkImageTiling tiling,
+                                                                             VkImageUsageFlags usage, VkImageCreateFlags flags,
+                                                                             VkImageFormatProperties *pImageFormatProperties) {
+    pImageFormatProperties->maxExtent = {16384, 16384, 2048};
+    pImageFormatProperties->maxMipLevels = 15;
+    pImageFormatProperties->maxArrayLayers = 2048;
+    pImageFormatProperties->sampleCounts = VK_SAMPLE_COUNT_1_BIT | VK_SAMPLE_COUNT_2_BIT | VK_SAMPLE_COUNT_4_BIT |
+                                           VK_SAMPLE_COUNT_8_BIT | VK_SAMPLE_COUNT_16_BIT;
+    pImageFormatProperties->maxResourceSize = kHeapSize;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceImageFormatProperties2(
+    VkPhysicalDevice physicalDevice, const VkPhysicalDeviceImageFormatInfo2 *pImageFormatInfo,
+    VkImageFormatProperties2 *pImageFormatProperties) {
+    return GetPhysicalDeviceImageFormatProperties(physicalDevice, pImageFormatInfo->format, pImageFormatInfo->type,
+                                                  pImageFormatInfo->tiling, pImageFormatInfo->usage, pImageFormatInfo->flags,
+                                                  &pImageFormatProperties->imageFormatProperties);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties(
+    VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkSampleCountFlagBits samples, VkImageUsageFlags usage,
+    VkImageTiling tiling, uint32_t *pPropertyCount, VkSparseImageFormatProperties *pProperties) {
+    *pPropertyCount = 0;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties2(
+    VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSparseImageFormatInfo2 *pFormatInfo, uint32_t *pPropertyCount,
+    VkSparseImageFormatProperties2 *pProperties) {
+    *pPropertyCount = 0;
+}
+
+// No external memory or synchronization handle types are supported
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalBufferProperties(
+    VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalBufferInfo *pExternalBufferInfo,
+    VkExternalBufferProperties *pExternalBufferProperties) {
+    ClearOutputStruct(pExternalBufferProperties);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalFenceProperties(
+    VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalFenceInfo *pExternalFenceInfo,
+    VkExternalFenceProperties *pExternalFenceProperties) {
+    ClearOutputStruct(pExternalFenceProperties);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalSemaphoreProperties(
+    VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalSemaphoreInfo *pExternalSemaphoreInfo,
+    VkExternalSemaphoreProperties *pExternalSemaphoreProperties) {
+    ClearOutputStruct(pExternalSemaphoreProperties);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(
+    VkPhysicalDevice physicalDevice, const VkQueryPoolPerformanceCreateInfoKHR *pPerformanceQueryCreateInfo, uint32_t *pNumPasses) {
+    *pNumPasses = 1;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL EnumerateDeviceExtensionProperties(VkPhysicalDevice physicalDevice, const char *pLayerName,
+                                                                         uint32_t *pPropertyCount,
+                                                                         VkExtensionProperties *pProperties) {
+    *pPropertyCount = 0;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo *pCreateInfo,
+                                                   const VkAllocationCallbacks *pAllocator, VkDevice *pDevice) {
+    auto device = new Device;
+    device->loader_data = device;
+    *pDevice = reinterpret_cast<VkDevice>(device);
+    return VK_SUCCESS;
+}
+
+// Device -----------------------------------------------------------------------------------------------------------------------
+
+static VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
+    Device *dev = GetDevice(device);
+    for (auto &pool : dev->pool_command_buffers) {
+        for (auto command_buffer : pool.second) {
+            delete command_buffer;
+        }
+    }
+    delete dev;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue *pQueue) {
+    Device *dev = GetDevice(device);
+    std::lock_guard<std::mutex> lock(dev->lock);
+    auto &queue = dev->queues[(uint64_t(queueFamilyIndex) << 32) | queueIndex];
+    if (!queue) {
+        queue.reset(new DispatchableObject{dev->loader_data});
+    }
+    *pQueue = reinterpret_cast<VkQueue>(queue.get());
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetDeviceQueue2(VkDevice device, const VkDeviceQueueInfo2 *pQueueInfo, VkQueue *pQueue) {
+    GetDeviceQueue(device, pQueueInfo->queueFamilyIndex, pQueueInfo->queueIndex, pQueue);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo *pCreateInfo,
+                                                        const VkAllocationCallbacks *pAllocator, VkCommandPool *pCommandPool) {
+    *pCommandPool = NewHandle<VkCommandPool>();
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL DestroyCommandPool(VkDevice device, VkCommandPool commandPool,
+                                                     const VkAllocationCallbacks *pAllocator) {
+    Device *dev = GetDevice(device);
+    std::lock_guard<std::mutex> lock(dev->lock);
+    auto pool = dev->pool_command_buffers.find(CastToUint64(commandPool));
+    if (pool == dev->pool_command_buffers.end()) return;
+    for (auto command_buffer : pool->second) {
+        delete command_buffer;
+    }
+    dev->pool_command_buffers.erase(pool);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL AllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo *pAllocateInfo,
+                                                             VkCommandBuffer *pCommandBuffers) {
+    Device *dev = GetDevice(device);
+    std::lock_guard<std::mutex> lock(dev->lock);
+    auto &pool = dev->pool_command_buffers[CastToUint64(pAllocateInfo->commandPool)];
+    for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; ++i) {
+        auto command_buffer = new DispatchableObject{dev->loader_data};
+        pool.push_back(command_buffer);
+        pCommandBuffers[i] = reinterpret_cast<VkCommandBuffer>(command_buffer);
+    }
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
+                                                     const VkCommandBuffer *pCommandBuffers) {
+    Device *dev = GetDevice(device);
+    std::lock_guard<std::mutex> lock(dev->lock);
+    auto &pool = dev->pool_command_buffers[CastToUint64(commandPool)];
+    for (uint32_t i = 0; i < commandBufferCount; ++i) {
+        auto command_buffer = reinterpret_cast<DispatchableObject *>(pCommandBuffers[i]);
+        for (auto &entry : pool) {
+            if (entry == command_buffer) {
+                entry = pool.back();
+                pool.pop_back();
+                delete command_buffer;
+                break;
+            }
+        }
+    }
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(VkDevice device, const VkMemoryAllocateInfo *pAllocateInfo,
+                                                     const VkAllocationCallbacks *pAllocator, VkDeviceMemory *pMemory) {
+    Device *dev = GetDevice(device);
+    *pMemory = NewHandle<VkDeviceMemory>();
+    std::lock_guard<std::mutex> lock(dev->lock);
+    dev->memory_sizes[CastToUint64(*pMemory)] = pAllocateInfo->allocationSize;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL FreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks *pAllocator) {
+    Device *dev = GetDevice(device);
+    std::lock_guard<std::mutex> lock(dev->lock);
+    dev->memory_sizes.erase(CastToUint64(memory));
+    dev->mapped_memory.erase(CastToUint64(memory));
+}
+
+// Host storage is only created for allocations that actually get mapped
+static VKAPI_ATTR VkResult VKAPI_CALL MapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size,
+                                                VkMemoryMapFlags flags, void **ppData) {
+    Device *dev = GetDevice(device);
+    std::lock_guard<std::mutex> lock(dev->lock);
+    const uint64_t key = CastToUint64(memory);
+    auto &storage = dev->mapped_memory[key];
+    if (!storage) {
+        storage.reset(new uint8_t[static_cast<size_t>(dev->memory_sizes[key])]);
+    }
+    *ppData = storage.get() + offset;
+    return VK_SUCCESS;
+}
+
+static void FillMemoryRequirements(VkDeviceSize size, VkMemoryRequirements *pMemoryRequirements) {
+    pMemoryRequirements->alignment = 256;
+    pMemoryRequirements->size = (size + 255) & ~VkDeviceSize(255);
+    pMemoryRequirements->memoryTypeBits = 0x7;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements(VkDevice device, VkBuffer buffer,
+                                                              VkMemoryRequirements *pMemoryRequirements) {
+    // Buffer sizes are not tracked, so report a size that covers any buffer the benchmarks create
+    FillMemoryRequirements(1 << 16, pMemoryRequirements);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements(VkDevice device, VkImage image,
+                                                             VkMemoryRequirements *pMemoryRequirements) {
+    FillMemoryRequirements(1 << 20, pMemoryRequirements);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements2(VkDevice device, const VkBufferMemoryRequirementsInfo2 *pInfo,
+                                                               VkMemoryRequirements2 *pMemoryRequirements) {
+    GetBufferMemoryRequirements(device, pInfo->buffer, &pMemoryRequirements->memoryRequirements);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2(VkDevice device, const VkImageMemoryRequirementsInfo2 *pInfo,
+                                                              VkMemoryRequirements2 *pMemoryRequirements) {
+    GetImageMemoryRequirements(device, pInfo->image, &pMemoryRequirements->memoryRequirements);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements(VkDevice device, VkImage image,
+                                                                   uint32_t *pSparseMemoryRequirementCount,
+                                                                   VkSparseImageMemoryRequirements *pSparseMemoryRequirements) {
+    *pSparseMemoryRequirementCount = 0;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements2(VkDevice device,
+                                                                    const VkImageSparseMemoryRequirementsInfo2 *pInfo,
+                                                                    uint32_t *pSparseMemoryRequirementCount,
+                                                                    VkSparseImageMemoryRequirements2 *pSparseMemoryRequirements) {
+    *pSparseMemoryRequirementCount = 0;
+}
+
+// Images are not laid out; every subresource reports the size GetImageMemoryRequirements gives the whole image
+static VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout(VkDevice device, VkImage image, const VkImageSubresource *pSubresource,
+                                                            VkSubresourceLayout *pLayout) {
+    memset(pLayout, 0, sizeof(*pLayout));
+    pLayout->size = 1 << 20;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetDeviceMemoryCommitment(VkDevice device, VkDeviceMemory memory,
+                                                            VkDeviceSize *pCommittedMemoryInBytes) {
+    *pCommittedMemoryInBytes = 0;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetRenderAreaGranularity(VkDevice device, VkRenderPass renderPass, VkExtent2D *pGranularity) {
+    *pGranularity = {1, 1};
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetDeviceGroupPeerMemoryFeatures(VkDevice device, uint32_t heapIndex, uint32_t localDeviceIndex,
+                                                                   uint32_t remoteDeviceIndex,
+                                                                   VkPeerMemoryFeatureFlags *pPeerMemoryFeatures) {
+    *pPeerMemoryFeatures = 0;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSupport(VkDevice device, const VkDescriptorSetLayoutCreateInfo *pCreateInfo,
+                                                                VkDescriptorSetLayoutSupport *pSupport) {
+    pSupport->supported = VK_TRUE;
+}
+
+// Nothing executes, so every query result reads as zero
+static VKAPI_ATTR VkResult VKAPI_CALL GetQueryPoolResults(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery,
+                                                          uint32_t queryCount, size_t dataSize, void *pData, VkDeviceSize stride,
+                                                          VkQueryResultFlags flags) {
+    memset(pData, 0, dataSize);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetPipelineCacheData(VkDevice device, VkPipelineCache pipelineCache, size_t *pDataSize,
+                                                           void *pData) {
+    *pDataSize = 0;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValue(VkDevice device, VkSemaphore semaphore, uint64_t *pValue) {
+    *pValue = 0;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo *pAllocateInfo,
+                                                             VkDescriptorSet *pDescriptorSets) {
+    for (uint32_t i = 0; i < pAllocateInfo->descriptorSetCount; ++i) {
+        pDescriptorSets[i] = NewHandle<VkDescriptorSet>();
+    }
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount,
+                                                              const VkGraphicsPipelineCreateInfo *pCreateInfos,
+                                                              const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines) {
+    for (uint32_t i = 0; i < createInfoCount; ++i) {
+        pPipelines[i] = NewHandle<VkPipeline>();
+    }
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount,
+                                                             const VkComputePipelineCreateInfo *pCreateInfos,
+                                                             const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines) {
+    for (uint32_t i = 0; i < createInfoCount; ++i) {
+        pPipelines[i] = NewHandle<VkPipeline>();
+    }
+    return VK_SUCCESS;
+}
+
+// vkCreate<Type> entry points that only need to hand back a fresh handle
+#define NULL_DRIVER_CREATE_HANDLE(type, create_info_type)                                                                    \
+    static VKAPI_ATTR VkResult VKAPI_CALL Create##type(VkDevice device, const create_info_type *pCreateInfo,               \
+                                                       const VkAllocationCallbacks *pAllocator, Vk##type *pHandle) {         \
+        *pHandle = NewHandle<Vk##type>();                                                                                      \
+        return VK_SUCCESS;                                                                                                     \
+    }
+
+NULL_DRIVER_CREATE_HANDLE(Buffer, VkBufferCreateInfo)
+NULL_DRIVER_CREATE_HANDLE(BufferView, VkBufferViewCreateInfo)
+NULL_DRIVER_CREATE_HANDLE(Image, VkImageCreateInfo)
+NULL_DRIVER_CREATE_HANDLE(ImageView, VkImageViewCreateInfo)
+NULL_DRIVER_CREATE_HANDLE(Sampler, VkSamplerCreateInfo)
+NULL_DRIVER_CREATE_HANDLE(ShaderModule, VkShaderModuleCreateInfo)
+NULL_DRIVER_CREATE_HANDLE(PipelineCache, VkPipelineCacheCreateInfo)
+NULL_DRIVER_CREATE_HANDLE(PipelineLayout, VkPipelineLayoutCreateInfo)
+NULL_DRIVER_CREATE_HANDLE(DescriptorSetLayout, VkDescriptorSetLayoutCreateInfo)
+NULL_DRIVER_CREATE_HANDLE(DescriptorPool, VkDescriptorPoolCreateInfo)
+NULL_DRIVER_CREATE_HANDLE(DescriptorUpdateTemplate, VkDescriptorUpdateTemplateCreateInfo)
+NULL_DRIVER_CREATE_HANDLE(RenderPass, VkRenderPassCreateInfo)
+NULL_DRIVER_CREATE_HANDLE(Framebuffer, VkFramebufferCreateInfo)
+NULL_DRIVER_CREATE_HANDLE(Fence, VkFenceCreateInfo)
+NULL_DRIVER_CREATE_HANDLE(Semaphore, VkSemaphoreCreateInfo)
+NULL_DRIVER_CREATE_HANDLE(Event, VkEventCreateInfo)
+NULL_DRIVER_CREATE_HANDLE(QueryPool, VkQueryPoolCreateInfo)
+NULL_DRIVER_CREATE_HANDLE(SamplerYcbcrConversion, VkSamplerYcbcrConversionCreateInfo)
+
+#undef NULL_DRIVER_CREATE_HANDLE
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2(VkDevice device, const VkRenderPassCreateInfo2KHR *pCreateInfo,
+                                                        const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass) {
+    *pRenderPass = NewHandle<VkRenderPass>();
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL SetDeviceLoaderData(VkDevice device, void *object) {
+    reinterpret_cast<DispatchableObject *>(object)->loader_data = GetDevice(device)->loader_data;
+    return VK_SUCCESS;
+}
+
+// Entry point tables ---------------------------------------------------------------------------------------------------------
+
+#define NULL_DRIVER_ENTRY(name) \
+    { "vk" #name, reinterpret_cast<PFN_vkVoidFunction>(name) }
+
+static const std::unordered_map<std::string, PFN_vkVoidFunction> &InstanceEntryPoints() {
+    static const std::unordered_map<std::string, PFN_vkVoidFunction> entry_points = {
+        NULL_DRIVER_ENTRY(CreateInstance),
+        NULL_DRIVER_ENTRY(DestroyInstance),
+        NULL_DRIVER_ENTRY(CreateDebugUtilsMessengerEXT),
+        NULL_DRIVER_ENTRY(EnumeratePhysicalDevices),
+        NULL_DRIVER_ENTRY(GetPhysicalDeviceFeatures),
+        NULL_DRIVER_ENTRY(GetPhysicalDeviceFeatures2),
+        {"vkGetPhysicalDeviceFeatures2KHR", reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceFeatures2)},
+        NULL_DRIVER_ENTRY(GetPhysicalDeviceProperties),
+        NULL_DRIVER_ENTRY(GetPhysicalDeviceProperties2),
+        {"vkGetPhysicalDeviceProperties2KHR", reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceProperties2)},
+        NULL_DRIVER_ENTRY(GetPhysicalDeviceQueueFamilyProperties),
+        NULL_DRIVER_ENTRY(GetPhysicalDeviceQueueFamilyProperties2),
+        {"vkGetPhysicalDeviceQueueFamilyProperties2KHR",
+         reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceQueueFamilyProperties2)},
+        NULL_DRIVER_ENTRY(GetPhysicalDeviceMemoryProperties),
+        NULL_DRIVER_ENTRY(GetPhysicalDeviceMemoryProperties2),
+        {"vkGetPhysicalDeviceMemoryProperties2KHR", reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceMemoryProperties2)},
+        NULL_DRIVER_ENTRY(GetPhysicalDeviceFormatProperties),
+        NULL_DRIVER_ENTRY(GetPhysicalDeviceFormatProperties2),
+        {"vkGetPhysicalDeviceFormatProperties2KHR", reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceFormatProperties2)},
+        NULL_DRIVER_ENTRY(GetPhysicalDeviceImageFormatProperties),
+        NULL_DRIVER_ENTRY(GetPhysicalDeviceImageFormatProperties2),
+        {"vkGetPhysicalDeviceImageFormatProperties2KHR",
+         reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceImageFormatProperties2)},
+        NULL_DRIVER_ENTRY(GetPhysicalDeviceSparseImageFormatProperties),
+        NULL_DRIVER_ENTRY(GetPhysicalDeviceSparseImageFormatProperties2),
+        {"vkGetPhysicalDeviceSparseImageFormatProperties2KHR",
+         reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceSparseImageFormatProperties2)},
+        NULL_DRIVER_ENTRY(GetPhysicalDeviceExternalBufferProperties),
+        {"vkGetPhysicalDeviceExternalBufferPropertiesKHR",
+         reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceExternalBufferProperties)},
+        NULL_DRIVER_ENTRY(GetPhysicalDeviceExternalFenceProperties),
+        {"vkGetPhysicalDeviceExternalFencePropertiesKHR",
+         reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceExternalFenceProperties)},
+        NULL_DRIVER_ENTRY(GetPhysicalDeviceExternalSemaphoreProperties),
+        {"vkGetPhysicalDeviceExternalSemaphorePropertiesKHR",
+         reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceExternalSemaphoreProperties)},
+        NULL_DRIVER_ENTRY(GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR),
+        NULL_DRIVER_ENTRY(EnumeratePhysicalDeviceGroups),
+        {"vkEnumeratePhysicalDeviceGroupsKHR", reinterpret_cast<PFN_vkVoidFunction>(EnumeratePhysicalDeviceGroups)},
+        NULL_DRIVER_ENTRY(EnumerateDeviceExtensionProperties),
+        NULL_DRIVER_ENTRY(CreateDevice),
+        NULL_DRIVER_ENTRY(GetInstanceProcAddr),
+        NULL_DRIVER_ENTRY(GetDeviceProcAddr),
+    };
+    return entry_points;
+}
+
+static const std::unordered_map<std::string, PFN_vkVoidFunction> &DeviceEntryPoints() {
+    static const std::unordered_map<std::string, PFN_vkVoidFunction> entry_points = {
+        NULL_DRIVER_ENTRY(GetDeviceProcAddr),
+        NULL_DRIVER_ENTRY(DestroyDevice),
+        NULL_DRIVER_ENTRY(GetDeviceQueue),
+        NULL_DRIVER_ENTRY(GetDeviceQueue2),
+        NULL_DRIVER_ENTRY(CreateCommandPool),
+        NULL_DRIVER_ENTRY(DestroyCommandPool),
+        NULL_DRIVER_ENTRY(AllocateCommandBuffers),
+        NULL_DRIVER_ENTRY(FreeCommandBuffers),
+        NULL_DRIVER_ENTRY(AllocateMemory),
+        NULL_DRIVER_ENTRY(FreeMemory),
+        NULL_DRIVER_ENTRY(MapMemory),
+        NULL_DRIVER_ENTRY(GetBufferMemoryRequirements),
+        NULL_DRIVER_ENTRY(GetImageMemoryRequirements),
+        NULL_DRIVER_ENTRY(GetBufferMemoryRequirements2),
+        {"vkGetBufferMemoryRequirements2KHR", reinterpret_cast<PFN_vkVoidFunction>(GetBufferMemoryRequirements2)},
+        NULL_DRIVER_ENTRY(GetImageMemoryRequirements2),
+        {"vkGetImageMemoryRequirements2KHR", reinterpret_cast<PFN_vkVoidFunction>(GetImageMemoryRequirements2)},
+        NULL_DRIVER_ENTRY(GetImageSparseMemoryRequirements),
+        NULL_DRIVER_ENTRY(GetImageSparseMemoryRequirements2),
+        {"vkGetImageSparseMemoryRequirements2KHR", reinterpret_cast<PFN_vkVoidFunction>(GetImageSparseMemoryRequirements2)},
+        NULL_DRIVER_ENTRY(GetImageSubresourceLayout),
+        NULL_DRIVER_ENTRY(GetDeviceMemoryCommitment),
+        NULL_DRIVER_ENTRY(GetRenderAreaGranularity),
+        NULL_DRIVER_ENTRY(GetDeviceGroupPeerMemoryFeatures),
+        {"vkGetDeviceGroupPeerMemoryFeaturesKHR", reinterpret_cast<PFN_vkVoidFunction>(GetDeviceGroupPeerMemoryFeatures)},
+        NULL_DRIVER_ENTRY(GetDescriptorSetLayoutSupport),
+        {"vkGetDescriptorSetLayoutSupportKHR", reinterpret_cast<PFN_vkVoidFunction>(GetDescriptorSetLayoutSupport)},
+        NULL_DRIVER_ENTRY(GetQueryPoolResults),
+        NULL_DRIVER_ENTRY(GetPipelineCacheData),
+        NULL_DRIVER_ENTRY(GetSemaphoreCounterValue),
+        {"vkGetSemaphoreCounterValueKHR", reinterpret_cast<PFN_vkVoidFunction>(GetSemaphoreCounterValue)},
+        NULL_DRIVER_ENTRY(AllocateDescriptorSets),
+        NULL_DRIVER_ENTRY(CreateGraphicsPipelines),
+        NULL_DRIVER_ENTRY(CreateComputePipelines),
+        NULL_DRIVER_ENTRY(CreateBuffer),
+        NULL_DRIVER_ENTRY(CreateBufferView),
+        NULL_DRIVER_ENTRY(CreateImage),
+        NULL_DRIVER_ENTRY(CreateImageView),
+        NULL_DRIVER_ENTRY(CreateSampler),
+        NULL_DRIVER_ENTRY(CreateShaderModule),
+        NULL_DRIVER_ENTRY(CreatePipelineCache),
+        NULL_DRIVER_ENTRY(CreatePipelineLayout),
+        NULL_DRIVER_ENTRY(CreateDescriptorSetLayout),
+        NULL_DRIVER_ENTRY(CreateDescriptorPool),
+        NULL_DRIVER_ENTRY(CreateDescriptorUpdateTemplate),
+        {"vkCreateDescriptorUpdateTemplateKHR", reinterpret_cast<PFN_vkVoidFunction>(CreateDescriptorUpdateTemplate)},
+        NULL_DRIVER_ENTRY(CreateRenderPass),
+        NULL_DRIVER_ENTRY(CreateRenderPass2),
+        {"vkCreateRenderPass2KHR", reinterpret_cast<PFN_vkVoidFunction>(CreateRenderPass2)},
+        NULL_DRIVER_ENTRY(CreateSamplerYcbcrConversion),
+        {"vkCreateSamplerYcbcrConversionKHR", reinterpret_cast<PFN_vkVoidFunction>(CreateSamplerYcbcrConversion)},
+        NULL_DRIVER_ENTRY(CreateFramebuffer),
+        NULL_DRIVER_ENTRY(CreateFence),
+        NULL_DRIVER_ENTRY(CreateSemaphore),
+        NULL_DRIVER_ENTRY(CreateEvent),
+        NULL_DRIVER_ENTRY(CreateQueryPool),
+    };
+    return entry_points;
+}
+
+#undef NULL_DRIVER_ENTRY
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice device, const char *pName) {
+    const auto &entry_points = DeviceEntryPoints();
+    auto entry = entry_points.find(pName);
+    if (entry != entry_points.end()) return entry->second;
+    return HasNoOutputs(pName) ? reinterpret_cast<PFN_vkVoidFunction>(Noop) : nullptr;
+}
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetInstanceProcAddr(VkInstance instance, const char *pName) {
+    const auto &entry_points = InstanceEntryPoints();
+    auto entry = entry_points.find(pName);
+    if (entry != entry_points.end()) return entry->second;
+    return GetDeviceProcAddr(VK_NULL_HANDLE, pName);
+}
+
+}  // namespace null_driver
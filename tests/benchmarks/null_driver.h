@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+#include <vulkan/vk_layer.h>
+
+// A minimal in-process stand-in for an ICD, used as the bottom of the layer chain by vk_layer_benchmarks.
+//
+// Non-dispatchable handles are values from a global counter and almost every command is a no-op. Dispatchable handles are
+// real objects whose first word is the key layers use to look up their per-instance/per-device data, set the same way the
+// loader would (physical devices share their instance's key; queues and command buffers share their device's key). Entry
+// points that write outputs (queries, enumerations, handle creation) are implemented explicitly; those that aren't resolve to
+// NULL rather than to a no-op that would leave their outputs uninitialized.
+namespace null_driver {
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetInstanceProcAddr(VkInstance instance, const char *pName);
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice device, const char *pName);
+
+// Loader callback for objects that layers create internally (e.g. GPU-assisted validation command buffers)
+VKAPI_ATTR VkResult VKAPI_CALL SetDeviceLoaderData(VkDevice device, void *object);
+
+}  // namespace null_driver
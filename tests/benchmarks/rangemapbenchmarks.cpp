@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Scenarios for the sparse_container::range_map backends on their own. These don't call into the layer; they compare the
+// std::map ("tree") and sorted_vector_map ("flat") implementations at the sizes the large image layout maps reach.
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "benchmark_framework.h"
+#include "range_vector.h"
+
+using vkbench::BenchmarkState;
+
+namespace {
+
+using Range = sparse_container::range<uint64_t>;
+using TreeRangeMap = sparse_container::range_map<uint64_t, uint32_t>;
+using FlatRangeMap = sparse_container::flat_range_map<uint64_t, uint32_t>;
+
+// Operations measured per repetition against a map of the scenario's size
+const uint32_t kOperations = 1000;
+
+// Lookup results go here so they can't be optimized out
+volatile uint32_t found_sink = 0;
+
+// entries ranges of width 2, each followed by a gap of 2: [0, 2), [4, 6), ...
+template <typename Map>
+Map MakeRangeMap(uint64_t entries) {
+    Map map;
+    for (uint64_t i = 0; i < entries; ++i) {
+        map.insert(map.end(), std::make_pair(Range(4 * i, 4 * i + 2), static_cast<uint32_t>(i & 3)));
+    }
+    return map;
+}
+
+// kOperations inserts into random gaps of the map
+template <typename Map>
+void RangeMapInsert(BenchmarkState &state, uint64_t entries) {
+    std::mt19937 rng(1);
+    const uint64_t repetitions = state.Scaled(10);
+    for (uint64_t rep = 0; rep < repetitions; ++rep) {
+        Map map = MakeRangeMap<Map>(entries);
+        std::vector<Range> gaps(kOperations);
+        for (auto &gap : gaps) {
+            const uint64_t begin = 4 * (rng() % entries) + 2;
+            gap = Range(begin, begin + 1);
+        }
+        state.Measure(kOperations, [&]() {
+            for (const auto &gap : gaps) {
+                map.insert(std::make_pair(gap, 7u));
+            }
+        });
+    }
+}
+
+// kOperations splits of random entries, keeping both halves
+template <typename Map>
+void RangeMapSplit(BenchmarkState &state, uint64_t entries) {
+    std::mt19937 rng(2);
+    const uint64_t repetitions = state.Scaled(10);
+    for (uint64_t rep = 0; rep < repetitions; ++rep) {
+        Map map = MakeRangeMap<Map>(entries);
+        std::vector<uint64_t> entry_begins(kOperations);
+        for (auto &begin : entry_begins) {
+            begin = 4 * (rng() % entries);
+        }
+        state.Measure(kOperations, [&]() {
+            for (const auto begin : entry_begins) {
+                auto it = map.find(begin);
+                if (it != map.end()) map.split(it, begin + 1, sparse_container::split_op_keep_both());
+            }
+        });
+    }
+}
+
+// Overlays a map with a tenth as many entries, each overlapping one or two of the target's entries and the gaps between them,
+// the way secondary command buffer layouts are merged into the primary's
+template <typename Map>
+void RangeMapMerge(BenchmarkState &state, uint64_t entries) {
+    std::mt19937 rng(3);
+    Map overlay;
+    for (uint64_t i = 0; i < entries / 10; ++i) {
+        const uint64_t begin = 40 * i + rng() % 37;
+        overlay.insert(std::make_pair(Range(begin, begin + 3), 5u));
+    }
+    const uint64_t repetitions = state.Scaled(10);
+    for (uint64_t rep = 0; rep < repetitions; ++rep) {
+        Map map = MakeRangeMap<Map>(entries);
+        state.Measure(1, [&]() { sparse_container::splice(&map, overlay, sparse_container::value_precedence::prefer_source); });
+    }
+}
+
+// 100 * kOperations point lookups at random indices
+template <typename Map>
+void RangeMapFind(BenchmarkState &state, uint64_t entries) {
+    std::mt19937 rng(4);
+    const Map map = MakeRangeMap<Map>(entries);
+    std::vector<uint64_t> indices(100 * kOperations);
+    for (auto &index : indices) {
+        index = rng() % (4 * entries);
+    }
+    const uint64_t repetitions = state.Scaled(10);
+    for (uint64_t rep = 0; rep < repetitions; ++rep) {
+        state.Measure(indices.size(), [&]() {
+            uint32_t found = 0;
+            for (const auto index : indices) {
+                auto it = map.find(index);
+                if (it != map.end()) found += it->second;
+            }
+            found_sink = found;
+        });
+    }
+}
+
+}  // namespace
+
+// Registers the scenario for both backends, as <name>_tree_<size> and <name>_flat_<size>
+#define RANGE_MAP_BENCHMARK(Operation, name, size, entries)                                                    \
+    static void Operation##Tree##size(BenchmarkState &state) { Operation<TreeRangeMap>(state, entries); }     \
+    static void Operation##Flat##size(BenchmarkState &state) { Operation<FlatRangeMap>(state, entries); }     \
+    VKBENCH_REGISTER(name "_tree_" #size, Operation##Tree##size);                                             \
+    VKBENCH_REGISTER(name "_flat_" #size, Operation##Flat##size)
+
+RANGE_MAP_BENCHMARK(RangeMapInsert, "range_map_insert", 1k, 1000);
+RANGE_MAP_BENCHMARK(RangeMapInsert, "range_map_insert", 10k, 10000);
+RANGE_MAP_BENCHMARK(RangeMapInsert, "range_map_insert", 100k, 100000);
+RANGE_MAP_BENCHMARK(RangeMapSplit, "range_map_split", 1k, 1000);
+RANGE_MAP_BENCHMARK(RangeMapSplit, "range_map_split", 10k, 10000);
+RANGE_MAP_BENCHMARK(RangeMapSplit, "range_map_split", 100k, 100000);
+RANGE_MAP_BENCHMARK(RangeMapMerge, "range_map_merge", 1k, 1000);
+RANGE_MAP_BENCHMARK(RangeMapMerge, "range_map_merge", 10k, 10000);
+RANGE_MAP_BENCHMARK(RangeMapMerge, "range_map_merge", 100k, 100000);
+RANGE_MAP_BENCHMARK(RangeMapFind, "range_map_find", 1k, 1000);
+RANGE_MAP_BENCHMARK(RangeMapFind, "range_map_find", 10k, 10000);
+RANGE_MAP_BENCHMARK(RangeMapFind, "range_map_find", 100k, 100000);
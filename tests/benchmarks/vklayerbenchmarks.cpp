@@ -0,0 +1,950 @@
+/*
+ * Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark_framework.h"
+
+using vkbench::BenchmarkState;
+using vkbench::LayerDevice;
+
+static const char *kVertexShader = R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint Vertex %main "main"
+       %void = OpTypeVoid
+         %fn = OpTypeFunction %void
+       %main = OpFunction %void None %fn
+      %label = OpLabel
+               OpReturn
+               OpFunctionEnd
+)";
+
+// Reads a vec4 from the uniform buffer at set 0, binding 0 and writes it to color attachment 0
+static const char *kFragmentShader = R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint Fragment %main "main" %color
+               OpExecutionMode %main OriginUpperLeft
+               OpDecorate %color Location 0
+               OpDecorate %ubo_type Block
+               OpMemberDecorate %ubo_type 0 Offset 0
+               OpDecorate %ubo DescriptorSet 0
+               OpDecorate %ubo Binding 0
+       %void = OpTypeVoid
+         %fn = OpTypeFunction %void
+      %float = OpTypeFloat 32
+    %v4float = OpTypeVector %float 4
+   %ubo_type = OpTypeStruct %v4float
+%ptr_ubo_type = OpTypePointer Uniform %ubo_type
+        %ubo = OpVariable %ptr_ubo_type Uniform
+        %int = OpTypeInt 32 1
+      %int_0 = OpConstant %int 0
+%ptr_uniform_v4float = OpTypePointer Uniform %v4float
+%ptr_output_v4float = OpTypePointer Output %v4float
+      %color = OpVariable %ptr_output_v4float Output
+       %main = OpFunction %void None %fn
+      %label = OpLabel
+        %ptr = OpAccessChain %ptr_uniform_v4float %ubo %int_0
+      %value = OpLoad %v4float %ptr
+               OpStore %color %value
+               OpReturn
+               OpFunctionEnd
+)";
+
+// Render pass, framebuffer, graphics pipeline and a ring of uniform buffer descriptor sets shared by the scenarios below
+class GraphicsFixture {
+  public:
+    static const uint32_t kSetCount = 64;
+    static const uint32_t kExtent = 64;
+    static const VkDeviceSize kUniformStride = 256;
+
+    explicit GraphicsFixture(LayerDevice &dev) : dev_(dev) {
+        const auto &vk = dev_.vk;
+        const VkDevice device = dev_.device;
+
+        VkAttachmentDescription attachment = {};
+        attachment.format = VK_FORMAT_R8G8B8A8_UNORM;
+        attachment.samples = VK_SAMPLE_COUNT_1_BIT;
+        attachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+        attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        attachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        attachment.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        VkAttachmentReference color_ref = {0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+        VkSubpassDescription subpass = {};
+        subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+        subpass.colorAttachmentCount = 1;
+        subpass.pColorAttachments = &color_ref;
+        VkRenderPassCreateInfo render_pass_info = {VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO};
+        render_pass_info.attachmentCount = 1;
+        render_pass_info.pAttachments = &attachment;
+        render_pass_info.subpassCount = 1;
+        render_pass_info.pSubpasses = &subpass;
+        vk.CreateRenderPass(device, &render_pass_info, nullptr, &render_pass);
+
+        VkImageCreateInfo image_info = {VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO};
+        image_info.imageType = VK_IMAGE_TYPE_2D;
+        image_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+        image_info.extent = {kExtent, kExtent, 1};
+        image_info.mipLevels = 1;
+        image_info.arrayLayers = 1;
+        image_info.samples = VK_SAMPLE_COUNT_1_BIT;
+        image_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+        image_info.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+        image_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        image_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        vk.CreateImage(device, &image_info, nullptr, &image_);
+        VkMemoryRequirements image_requirements = {};
+        vk.GetImageMemoryRequirements(device, image_, &image_requirements);
+        image_memory_ = Allocate(image_requirements, 0);
+        vk.BindImageMemory(device, image_, image_memory_, 0);
+
+        VkImageViewCreateInfo view_info = {VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO};
+        view_info.image = image_;
+        view_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        view_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+        view_info.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+        vk.CreateImageView(device, &view_info, nullptr, &image_view_);
+
+        VkFramebufferCreateInfo framebuffer_info = {VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO};
+        framebuffer_info.renderPass = render_pass;
+        framebuffer_info.attachmentCount = 1;
+        framebuffer_info.pAttachments = &image_view_;
+        framebuffer_info.width = kExtent;
+        framebuffer_info.height = kExtent;
+        framebuffer_info.layers = 1;
+        vk.CreateFramebuffer(device, &framebuffer_info, nullptr, &framebuffer);
+
+        VkBufferCreateInfo buffer_info = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+        buffer_info.size = kSetCount * kUniformStride;
+        buffer_info.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+        buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        vk.CreateBuffer(device, &buffer_info, nullptr, &uniform_buffer);
+        VkMemoryRequirements buffer_requirements = {};
+        vk.GetBufferMemoryRequirements(device, uniform_buffer, &buffer_requirements);
+        uniform_memory_ = Allocate(buffer_requirements, 1);
+        vk.BindBufferMemory(device, uniform_buffer, uniform_memory_, 0);
+
+        VkDescriptorSetLayoutBinding binding = {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr};
+        VkDescriptorSetLayoutCreateInfo set_layout_info = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO};
+        set_layout_info.bindingCount = 1;
+        set_layout_info.pBindings = &binding;
+        vk.CreateDescriptorSetLayout(device, &set_layout_info, nullptr, &set_layout_);
+
+        VkPipelineLayoutCreateInfo pipeline_layout_info = {VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO};
+        pipeline_layout_info.setLayoutCount = 1;
+        pipeline_layout_info.pSetLayouts = &set_layout_;
+        vk.CreatePipelineLayout(device, &pipeline_layout_info, nullptr, &pipeline_layout);
+
+        VkDescriptorPoolSize pool_size = {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, kSetCount};
+        VkDescriptorPoolCreateInfo pool_info = {VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO};
+        pool_info.maxSets = kSetCount;
+        pool_info.poolSizeCount = 1;
+        pool_info.pPoolSizes = &pool_size;
+        vk.CreateDescriptorPool(device, &pool_info, nullptr, &descriptor_pool_);
+
+        std::vector<VkDescriptorSetLayout> set_layouts(kSetCount, set_layout_);
+        VkDescriptorSetAllocateInfo set_alloc_info = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO};
+        set_alloc_info.descriptorPool = descriptor_pool_;
+        set_alloc_info.descriptorSetCount = kSetCount;
+        set_alloc_info.pSetLayouts = set_layouts.data();
+        descriptor_sets.resize(kSetCount);
+        vk.AllocateDescriptorSets(device, &set_alloc_info, descriptor_sets.data());
+        for (uint32_t i = 0; i < kSetCount; ++i) {
+            UpdateSet(i, i);
+        }
+
+        vertex_shader_ = dev_.CreateShaderModule(kVertexShader);
+        fragment_shader_ = dev_.CreateShaderModule(kFragmentShader);
+        pipeline = CreatePipeline();
+    }
+
+    ~GraphicsFixture() {
+        const auto &vk = dev_.vk;
+        const VkDevice device = dev_.device;
+        vk.DeviceWaitIdle(device);
+        vk.DestroyPipeline(device, pipeline, nullptr);
+        vk.DestroyShaderModule(device, fragment_shader_, nullptr);
+        vk.DestroyShaderModule(device, vertex_shader_, nullptr);
+        vk.DestroyDescriptorPool(device, descriptor_pool_, nullptr);
+        vk.DestroyPipelineLayout(device, pipeline_layout, nullptr);
+        vk.DestroyDescriptorSetLayout(device, set_layout_, nullptr);
+        vk.DestroyBuffer(device, uniform_buffer, nullptr);
+        vk.FreeMemory(device, uniform_memory_, nullptr);
+        vk.DestroyFramebuffer(device, framebuffer, nullptr);
+        vk.DestroyImageView(device, image_view_, nullptr);
+        vk.DestroyImage(device, image_, nullptr);
+        vk.FreeMemory(device, image_memory_, nullptr);
+        vk.DestroyRenderPass(device, render_pass, nullptr);
+    }
+
+    // Pipelines with different variant numbers differ in vertex input and blend state; variants repeat every kVariantCount
+    static const uint32_t kVariantCount = 16;
+    VkPipeline CreatePipeline(uint32_t variant = 0) const {
+        VkPipelineShaderStageCreateInfo stages[2] = {};
+        stages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        stages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+        stages[0].module = vertex_shader_;
+        stages[0].pName = "main";
+        stages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+        stages[1].module = fragment_shader_;
+        stages[1].pName = "main";
+
+        variant %= kVariantCount;
+        const VkVertexInputBindingDescription vertex_binding = {0, 16 + 16 * (variant % 4), VK_VERTEX_INPUT_RATE_VERTEX};
+        VkPipelineVertexInputStateCreateInfo vertex_input = {VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO};
+        if (variant) {
+            vertex_input.vertexBindingDescriptionCount = 1;
+            vertex_input.pVertexBindingDescriptions = &vertex_binding;
+        }
+        VkPipelineInputAssemblyStateCreateInfo input_assembly = {VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO};
+        input_assembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+        VkViewport viewport = {0.0f, 0.0f, static_cast<float>(kExtent), static_cast<float>(kExtent), 0.0f, 1.0f};
+        VkRect2D scissor = {{0, 0}, {kExtent, kExtent}};
+        VkPipelineViewportStateCreateInfo viewport_state = {VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO};
+        viewport_state.viewportCount = 1;
+        viewport_state.pViewports = &viewport;
+        viewport_state.scissorCount = 1;
+        viewport_state.pScissors = &scissor;
+
+        VkPipelineRasterizationStateCreateInfo rasterization = {VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO};
+        rasterization.polygonMode = VK_POLYGON_MODE_FILL;
+        rasterization.cullMode = VK_CULL_MODE_NONE;
+        rasterization.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+        rasterization.lineWidth = 1.0f;
+
+        VkPipelineMultisampleStateCreateInfo multisample = {VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO};
+        multisample.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+        VkPipelineColorBlendAttachmentState blend_attachment = {};
+        blend_attachment.blendEnable = (variant / 4) % 2 ? VK_TRUE : VK_FALSE;
+        blend_attachment.srcColorBlendFactor = (variant / 8) ? VK_BLEND_FACTOR_SRC_ALPHA : VK_BLEND_FACTOR_ONE;
+        blend_attachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+        blend_attachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+        blend_attachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+        blend_attachment.colorWriteMask =
+            VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+        VkPipelineColorBlendStateCreateInfo color_blend = {VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO};
+        color_blend.attachmentCount = 1;
+        color_blend.pAttachments = &blend_attachment;
+
+        VkGraphicsPipelineCreateInfo pipeline_info = {VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO};
+        pipeline_info.stageCount = 2;
+        pipeline_info.pStages = stages;
+        pipeline_info.pVertexInputState = &vertex_input;
+        pipeline_info.pInputAssemblyState = &input_assembly;
+        pipeline_info.pViewportState = &viewport_state;
+        pipeline_info.pRasterizationState = &rasterization;
+        pipeline_info.pMultisampleState = &multisample;
+        pipeline_info.pColorBlendState = &color_blend;
+        pipeline_info.layout = pipeline_layout;
+        pipeline_info.renderPass = render_pass;
+        pipeline_info.subpass = 0;
+
+        VkPipeline new_pipeline = VK_NULL_HANDLE;
+        dev_.vk.CreateGraphicsPipelines(dev_.device, VK_NULL_HANDLE, 1, &pipeline_info, nullptr, &new_pipeline);
+        return new_pipeline;
+    }
+
+    // Points descriptor set `set_index` at uniform buffer slot `slot`
+    void UpdateSet(uint32_t set_index, uint32_t slot) const {
+        VkDescriptorBufferInfo buffer_info = {uniform_buffer, (slot % kSetCount) * kUniformStride, kUniformStride};
+        VkWriteDescriptorSet write = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+        write.dstSet = descriptor_sets[set_index];
+        write.dstBinding = 0;
+        write.descriptorCount = 1;
+        write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        write.pBufferInfo = &buffer_info;
+        dev_.vk.UpdateDescriptorSets(dev_.device, 1, &write, 0, nullptr);
+    }
+
+    void BeginRenderPass(VkCommandBuffer command_buffer) const {
+        VkClearValue clear = {};
+        VkRenderPassBeginInfo begin_info = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO};
+        begin_info.renderPass = render_pass;
+        begin_info.framebuffer = framebuffer;
+        begin_info.renderArea = {{0, 0}, {kExtent, kExtent}};
+        begin_info.clearValueCount = 1;
+        begin_info.pClearValues = &clear;
+        dev_.vk.CmdBeginRenderPass(command_buffer, &begin_info, VK_SUBPASS_CONTENTS_INLINE);
+        dev_.vk.CmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+    }
+
+    // Records `draw_count` draws, rebinding a different descriptor set before each one
+    void RecordDraws(VkCommandBuffer command_buffer, uint64_t draw_count) const {
+        const auto &vk = dev_.vk;
+        for (uint64_t i = 0; i < draw_count; ++i) {
+            vk.CmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout, 0, 1,
+                                     &descriptor_sets[i % kSetCount], 0, nullptr);
+            vk.CmdDraw(command_buffer, 3, 1, 0, 0);
+        }
+    }
+
+    VkRenderPass render_pass = VK_NULL_HANDLE;
+    VkFramebuffer framebuffer = VK_NULL_HANDLE;
+    VkBuffer uniform_buffer = VK_NULL_HANDLE;
+    VkPipelineLayout pipeline_layout = VK_NULL_HANDLE;
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    std::vector<VkDescriptorSet> descriptor_sets;
+
+  private:
+    VkDeviceMemory Allocate(const VkMemoryRequirements &requirements, uint32_t memory_type_index) const {
+        VkMemoryAllocateInfo alloc_info = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO};
+        alloc_info.allocationSize = requirements.size;
+        alloc_info.memoryTypeIndex = memory_type_index;
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        dev_.vk.AllocateMemory(dev_.device, &alloc_info, nullptr, &memory);
+        return memory;
+    }
+
+    LayerDevice &dev_;
+    VkImage image_ = VK_NULL_HANDLE;
+    VkDeviceMemory image_memory_ = VK_NULL_HANDLE;
+    VkImageView image_view_ = VK_NULL_HANDLE;
+    VkDeviceMemory uniform_memory_ = VK_NULL_HANDLE;
+    VkDescriptorSetLayout set_layout_ = VK_NULL_HANDLE;
+    VkDescriptorPool descriptor_pool_ = VK_NULL_HANDLE;
+    VkShaderModule vertex_shader_ = VK_NULL_HANDLE;
+    VkShaderModule fragment_shader_ = VK_NULL_HANDLE;
+};
+
+// A command pool and command buffers owned by one recording thread
+struct CommandContext {
+    CommandContext(LayerDevice &dev, uint32_t count) : dev(dev) {
+        VkCommandPoolCreateInfo pool_info = {VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO};
+        pool_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        pool_info.queueFamilyIndex = 0;
+        dev.vk.CreateCommandPool(dev.device, &pool_info, nullptr, &pool);
+
+        VkCommandBufferAllocateInfo alloc_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO};
+        alloc_info.commandPool = pool;
+        alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        alloc_info.commandBufferCount = count;
+        command_buffers.resize(count);
+        dev.vk.AllocateCommandBuffers(dev.device, &alloc_info, command_buffers.data());
+    }
+
+    ~CommandContext() { dev.vk.DestroyCommandPool(dev.device, pool, nullptr); }
+
+    void Begin(VkCommandBuffer command_buffer) const {
+        VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+        dev.vk.BeginCommandBuffer(command_buffer, &begin_info);
+    }
+
+    LayerDevice &dev;
+    VkCommandPool pool = VK_NULL_HANDLE;
+    std::vector<VkCommandBuffer> command_buffers;
+};
+
+static VkFence CreateFence(LayerDevice &dev) {
+    VkFenceCreateInfo fence_info = {VK_STRUCTURE_TYPE_FENCE_CREATE_INFO};
+    VkFence fence = VK_NULL_HANDLE;
+    dev.vk.CreateFence(dev.device, &fence_info, nullptr, &fence);
+    return fence;
+}
+
+static void SubmitAndWait(LayerDevice &dev, VkQueue queue, VkCommandBuffer command_buffer, VkFence fence) {
+    VkSubmitInfo submit_info = {VK_STRUCTURE_TYPE_SUBMIT_INFO};
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &command_buffer;
+    dev.vk.QueueSubmit(queue, 1, &submit_info, fence);
+    dev.vk.WaitForFences(dev.device, 1, &fence, VK_TRUE, UINT64_MAX);
+    dev.vk.ResetFences(dev.device, 1, &fence);
+}
+
+// 1M vkCmdDraw, each preceded by a vkCmdBindDescriptorSets with a different set, in 10k-draw command buffers that are
+// submitted and retired as they are filled
+static void DrawWithDescriptorChurn(BenchmarkState &state) {
+    LayerDevice &dev = state.device;
+    GraphicsFixture fixture(dev);
+    CommandContext commands(dev, 1);
+    VkCommandBuffer command_buffer = commands.command_buffers[0];
+    VkQueue queue = dev.GetQueue(0);
+    VkFence fence = CreateFence(dev);
+
+    const uint64_t total_draws = state.Scaled(1000000);
+    const uint64_t draws_per_submit = std::min<uint64_t>(10000, total_draws);
+    state.Measure(total_draws, [&]() {
+        for (uint64_t recorded = 0; recorded < total_draws; recorded += draws_per_submit) {
+            commands.Begin(command_buffer);
+            fixture.BeginRenderPass(command_buffer);
+            fixture.RecordDraws(command_buffer, std::min(draws_per_submit, total_draws - recorded));
+            dev.vk.CmdEndRenderPass(command_buffer);
+            dev.vk.EndCommandBuffer(command_buffer);
+            SubmitAndWait(dev, queue, command_buffer, fence);
+        }
+    });
+
+    dev.vk.DestroyFence(dev.device, fence, nullptr);
+}
+VKBENCH_REGISTER("draw_descriptor_churn", DrawWithDescriptorChurn);
+
+// 100k single-write vkUpdateDescriptorSets calls cycling over the fixture's sets
+static void UpdateDescriptorSets(BenchmarkState &state) {
+    GraphicsFixture fixture(state.device);
+    const uint64_t updates = state.Scaled(100000);
+    state.Measure(updates, [&]() {
+        for (uint64_t i = 0; i < updates; ++i) {
+            fixture.UpdateSet(static_cast<uint32_t>(i % GraphicsFixture::kSetCount), static_cast<uint32_t>(i + 1));
+        }
+    });
+}
+VKBENCH_REGISTER("update_descriptor_sets", UpdateDescriptorSets);
+
+// 10k vkCreateGraphicsPipelines calls with identical state; only creation is measured
+static void CreateGraphicsPipelines(BenchmarkState &state) {
+    GraphicsFixture fixture(state.device);
+    const uint64_t count = state.Scaled(10000);
+    std::vector<VkPipeline> pipelines(count);
+    state.Measure(count, [&]() {
+        for (uint64_t i = 0; i < count; ++i) {
+            pipelines[i] = fixture.CreatePipeline();
+        }
+    });
+    for (auto pipeline : pipelines) {
+        state.device.vk.DestroyPipeline(state.device.device, pipeline, nullptr);
+    }
+}
+VKBENCH_REGISTER("create_graphics_pipelines", CreateGraphicsPipelines);
+
+// Layer memory held by 50k live pipelines drawn from a small set of distinct vertex input and blend states. The interesting
+// figure is retained_bytes_per_call: the layer's steady state cost of each pipeline.
+static void PipelineMemory(BenchmarkState &state) {
+    GraphicsFixture fixture(state.device);
+    const uint64_t count = state.Scaled(50000);
+    std::vector<VkPipeline> pipelines(count);
+    state.Measure(count, [&]() {
+        for (uint64_t i = 0; i < count; ++i) {
+            pipelines[i] = fixture.CreatePipeline(static_cast<uint32_t>(i));
+        }
+    });
+    for (auto pipeline : pipelines) {
+        state.device.vk.DestroyPipeline(state.device.device, pipeline, nullptr);
+    }
+}
+VKBENCH_REGISTER("pipeline_memory_50k", PipelineMemory);
+
+// Generates a large shader module: function_count functions chained by calls, each doing ops_per_function read-modify-writes
+// of storage buffers cycling over buffer_count bindings in set 0. A compute module has one GLCompute entrypoint calling the
+// first function; a ray tracing module has raygen, miss and closest hit entrypoints that each enter the chain a third further
+// along, so their reachable ids differ.
+static std::vector<uint32_t> GenerateLargeShader(bool ray_tracing, uint32_t function_count, uint32_t ops_per_function,
+                                                 uint32_t buffer_count) {
+    std::ostringstream spirv;
+    spirv << "OpCapability Shader\n";
+    if (ray_tracing) {
+        spirv << "OpCapability RayTracingNV\n"
+                 "OpExtension \"SPV_NV_ray_tracing\"\n";
+    }
+    spirv << "OpMemoryModel Logical GLSL450\n";
+    if (ray_tracing) {
+        spirv << "OpEntryPoint RayGenerationNV %rgen \"main\"\n"
+                 "OpEntryPoint MissNV %miss \"main\"\n"
+                 "OpEntryPoint ClosestHitNV %chit \"main\"\n";
+    } else {
+        spirv << "OpEntryPoint GLCompute %main \"main\"\n"
+                 "OpExecutionMode %main LocalSize 64 1 1\n";
+    }
+    spirv << "OpDecorate %runtime_array ArrayStride 4\n"
+             "OpMemberDecorate %block 0 Offset 0\n"
+             "OpDecorate %block BufferBlock\n";
+    for (uint32_t b = 0; b < buffer_count; ++b) {
+        spirv << "OpDecorate %buffer_" << b << " DescriptorSet 0\n";
+        spirv << "OpDecorate %buffer_" << b << " Binding " << b << "\n";
+    }
+    spirv << "%void = OpTypeVoid\n"
+             "%fn = OpTypeFunction %void\n"
+             "%uint = OpTypeInt 32 0\n"
+             "%uint_0 = OpConstant %uint 0\n"
+             "%uint_1 = OpConstant %uint 1\n"
+             "%runtime_array = OpTypeRuntimeArray %uint\n"
+             "%block = OpTypeStruct %runtime_array\n"
+             "%ptr_block = OpTypePointer Uniform %block\n"
+             "%ptr_uint = OpTypePointer Uniform %uint\n";
+    for (uint32_t b = 0; b < buffer_count; ++b) {
+        spirv << "%buffer_" << b << " = OpVariable %ptr_block Uniform\n";
+    }
+
+    auto entry_point = [&spirv](const char *name, uint32_t first_function) {
+        spirv << "%" << name << " = OpFunction %void None %fn\n"
+              << "%" << name << "_label = OpLabel\n"
+              << "%" << name << "_call = OpFunctionCall %void %f_" << first_function << "\n"
+              << "OpReturn\n"
+                 "OpFunctionEnd\n";
+    };
+    if (ray_tracing) {
+        entry_point("rgen", 0);
+        entry_point("miss", function_count / 3);
+        entry_point("chit", 2 * function_count / 3);
+    } else {
+        entry_point("main", 0);
+    }
+
+    for (uint32_t f = 0; f < function_count; ++f) {
+        spirv << "%f_" << f << " = OpFunction %void None %fn\n"
+              << "%f_" << f << "_label = OpLabel\n";
+        for (uint32_t op = 0; op < ops_per_function; ++op) {
+            const std::string id = "%f_" + std::to_string(f) + "_" + std::to_string(op);
+            spirv << id << "_ptr = OpAccessChain %ptr_uint %buffer_" << (f + op) % buffer_count << " %uint_0 %uint_0\n"
+                  << id << "_value = OpLoad %uint " << id << "_ptr\n"
+                  << id << "_sum = OpIAdd %uint " << id << "_value %uint_1\n"
+                  << "OpStore " << id << "_ptr " << id << "_sum\n";
+        }
+        if (f + 1 < function_count) {
+            spirv << "%f_" << f << "_call = OpFunctionCall %void %f_" << f + 1 << "\n";
+        }
+        spirv << "OpReturn\n"
+                 "OpFunctionEnd\n";
+    }
+    return vkbench::AssembleSpirv(spirv.str().c_str());
+}
+
+// (function count, read-modify-writes per function) of the generated modules, from about 1k to 32k instructions
+static const uint32_t kLargeShaderShapes[][2] = {{64, 4}, {256, 8}, {1024, 8}};
+static const uint32_t kLargeShaderBufferCount = 16;
+
+static std::vector<std::vector<uint32_t>> LargeShaderCorpus(bool compute, bool ray_tracing) {
+    std::vector<std::vector<uint32_t>> corpus;
+    for (const auto &shape : kLargeShaderShapes) {
+        if (compute) corpus.push_back(GenerateLargeShader(false, shape[0], shape[1], kLargeShaderBufferCount));
+        if (ray_tracing) corpus.push_back(GenerateLargeShader(true, shape[0], shape[1], kLargeShaderBufferCount));
+    }
+    return corpus;
+}
+
+// vkCreateShaderModule over the compute and ray tracing corpus, 20 rounds. Module creation is where the layer indexes the
+// SPIR-V and walks each entrypoint's call tree.
+static void CreateLargeShaderModules(BenchmarkState &state) {
+    const auto corpus = LargeShaderCorpus(true, true);
+    const uint64_t rounds = state.Scaled(20);
+    std::vector<VkShaderModule> modules(corpus.size());
+    for (uint64_t round = 0; round < rounds; ++round) {
+        state.Measure(corpus.size(), [&]() {
+            for (size_t i = 0; i < corpus.size(); ++i) {
+                modules[i] = state.device.CreateShaderModule(corpus[i]);
+            }
+        });
+        for (auto module : modules) {
+            state.device.vk.DestroyShaderModule(state.device.device, module, nullptr);
+        }
+    }
+}
+VKBENCH_REGISTER("create_large_shader_modules", CreateLargeShaderModules);
+
+// 1k vkCreateComputePipelines calls cycling over the compute corpus, with a layout matching the modules' descriptor use.
+// Only pipeline creation is measured; with the module's analysis reused, cost should not grow with the size of the shader.
+static void CreateLargeComputePipelines(BenchmarkState &state) {
+    const auto &vk = state.device.vk;
+    const VkDevice device = state.device.device;
+
+    std::vector<VkDescriptorSetLayoutBinding> bindings(kLargeShaderBufferCount);
+    for (uint32_t b = 0; b < kLargeShaderBufferCount; ++b) {
+        bindings[b] = {b, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr};
+    }
+    VkDescriptorSetLayoutCreateInfo set_layout_info = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO};
+    set_layout_info.bindingCount = kLargeShaderBufferCount;
+    set_layout_info.pBindings = bindings.data();
+    VkDescriptorSetLayout set_layout = VK_NULL_HANDLE;
+    vk.CreateDescriptorSetLayout(device, &set_layout_info, nullptr, &set_layout);
+    VkPipelineLayoutCreateInfo layout_info = {VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO};
+    layout_info.setLayoutCount = 1;
+    layout_info.pSetLayouts = &set_layout;
+    VkPipelineLayout layout = VK_NULL_HANDLE;
+    vk.CreatePipelineLayout(device, &layout_info, nullptr, &layout);
+
+    std::vector<VkShaderModule> modules;
+    for (const auto &spirv : LargeShaderCorpus(true, false)) {
+        modules.push_back(state.device.CreateShaderModule(spirv));
+    }
+
+    const uint64_t count = state.Scaled(1000);
+    std::vector<VkPipeline> pipelines(count);
+    state.Measure(count, [&]() {
+        for (uint64_t i = 0; i < count; ++i) {
+            VkComputePipelineCreateInfo pipeline_info = {VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO};
+            pipeline_info.stage = {VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO};
+            pipeline_info.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+            pipeline_info.stage.module = modules[i % modules.size()];
+            pipeline_info.stage.pName = "main";
+            pipeline_info.layout = layout;
+            vk.CreateComputePipelines(device, VK_NULL_HANDLE, 1, &pipeline_info, nullptr, &pipelines[i]);
+        }
+    });
+
+    for (auto pipeline : pipelines) vk.DestroyPipeline(device, pipeline, nullptr);
+    for (auto module : modules) vk.DestroyShaderModule(device, module, nullptr);
+    vk.DestroyPipelineLayout(device, layout, nullptr);
+    vk.DestroyDescriptorSetLayout(device, set_layout, nullptr);
+}
+VKBENCH_REGISTER("create_large_compute_pipelines", CreateLargeComputePipelines);
+
+// thread_count threads each recording 100k draws into their own command pool. Reported time is wall clock for all threads.
+static void RecordDrawsOnThreads(BenchmarkState &state, uint32_t thread_count) {
+    LayerDevice &dev = state.device;
+    GraphicsFixture fixture(dev);
+    const uint64_t draws_per_thread = state.Scaled(100000);
+    const uint64_t draws_per_command_buffer = std::min<uint64_t>(1000, draws_per_thread);
+
+    std::vector<std::unique_ptr<CommandContext>> contexts;
+    for (uint32_t i = 0; i < thread_count; ++i) {
+        contexts.emplace_back(new CommandContext(dev, 1));
+    }
+
+    state.Measure(draws_per_thread * thread_count, [&]() {
+        std::vector<std::thread> threads;
+        for (uint32_t t = 0; t < thread_count; ++t) {
+            threads.emplace_back([&, t]() {
+                const CommandContext &commands = *contexts[t];
+                VkCommandBuffer command_buffer = commands.command_buffers[0];
+                for (uint64_t recorded = 0; recorded < draws_per_thread; recorded += draws_per_command_buffer) {
+                    commands.Begin(command_buffer);
+                    fixture.BeginRenderPass(command_buffer);
+                    fixture.RecordDraws(command_buffer, std::min(draws_per_command_buffer, draws_per_thread - recorded));
+                    dev.vk.CmdEndRenderPass(command_buffer);
+                    dev.vk.EndCommandBuffer(command_buffer);
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    });
+}
+
+// --threads threads recording concurrently
+static void MultithreadedRecording(BenchmarkState &state) { RecordDrawsOnThreads(state, state.options.threads); }
+VKBENCH_REGISTER("multithreaded_recording", MultithreadedRecording);
+
+// The same per-thread work on 1 to 16 threads. With recording on distinct command buffers running in parallel, ns/call
+// should fall in proportion to the thread count until the cores run out.
+static void RecordingScaling1(BenchmarkState &state) { RecordDrawsOnThreads(state, 1); }
+static void RecordingScaling2(BenchmarkState &state) { RecordDrawsOnThreads(state, 2); }
+static void RecordingScaling4(BenchmarkState &state) { RecordDrawsOnThreads(state, 4); }
+static void RecordingScaling8(BenchmarkState &state) { RecordDrawsOnThreads(state, 8); }
+static void RecordingScaling16(BenchmarkState &state) { RecordDrawsOnThreads(state, 16); }
+VKBENCH_REGISTER("recording_scaling_1_thread", RecordingScaling1);
+VKBENCH_REGISTER("recording_scaling_2_threads", RecordingScaling2);
+VKBENCH_REGISTER("recording_scaling_4_threads", RecordingScaling4);
+VKBENCH_REGISTER("recording_scaling_8_threads", RecordingScaling8);
+VKBENCH_REGISTER("recording_scaling_16_threads", RecordingScaling16);
+
+// 100k vkQueueSubmit calls of pre-recorded command buffers, with a fence wait after every 64 submits
+static void SubmitStorm(BenchmarkState &state) {
+    LayerDevice &dev = state.device;
+    GraphicsFixture fixture(dev);
+    const uint32_t kBatchSize = 64;
+    CommandContext commands(dev, kBatchSize);
+    for (auto command_buffer : commands.command_buffers) {
+        commands.Begin(command_buffer);
+        fixture.BeginRenderPass(command_buffer);
+        fixture.RecordDraws(command_buffer, 16);
+        dev.vk.CmdEndRenderPass(command_buffer);
+        dev.vk.EndCommandBuffer(command_buffer);
+    }
+    VkQueue queue = dev.GetQueue(0);
+    VkFence fence = CreateFence(dev);
+
+    const uint64_t submits = state.Scaled(100000);
+    state.Measure(submits, [&]() {
+        for (uint64_t i = 0; i < submits; ++i) {
+            VkSubmitInfo submit_info = {VK_STRUCTURE_TYPE_SUBMIT_INFO};
+            submit_info.commandBufferCount = 1;
+            submit_info.pCommandBuffers = &commands.command_buffers[i % kBatchSize];
+            const bool last_in_batch = (i % kBatchSize) == kBatchSize - 1 || i + 1 == submits;
+            dev.vk.QueueSubmit(queue, 1, &submit_info, last_in_batch ? fence : VK_NULL_HANDLE);
+            if (last_in_batch) {
+                dev.vk.WaitForFences(dev.device, 1, &fence, VK_TRUE, UINT64_MAX);
+                dev.vk.ResetFences(dev.device, 1, &fence);
+            }
+        }
+    });
+
+    dev.vk.DestroyFence(dev.device, fence, nullptr);
+}
+VKBENCH_REGISTER("submit_storm", SubmitStorm);
+
+// A 1600x800 image split into 8x8 tiles: copies from the 10k tiles of the left half to the mirrored tile in the right half
+// of the same image, which none of the source tiles overlap
+static void CopyImageRegions(BenchmarkState &state) {
+    LayerDevice &dev = state.device;
+    const uint32_t kTile = 8;
+    const uint32_t kTilesPerSide = 100;
+
+    VkImageCreateInfo image_info = {VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO};
+    image_info.imageType = VK_IMAGE_TYPE_2D;
+    image_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+    image_info.extent = {2 * kTile * kTilesPerSide, kTile * kTilesPerSide, 1};
+    image_info.mipLevels = 1;
+    image_info.arrayLayers = 1;
+    image_info.samples = VK_SAMPLE_COUNT_1_BIT;
+    image_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+    image_info.usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    image_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    image_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    VkImage image = VK_NULL_HANDLE;
+    dev.vk.CreateImage(dev.device, &image_info, nullptr, &image);
+    VkMemoryRequirements requirements = {};
+    dev.vk.GetImageMemoryRequirements(dev.device, image, &requirements);
+    VkMemoryAllocateInfo alloc_info = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO};
+    alloc_info.allocationSize = requirements.size;
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    dev.vk.AllocateMemory(dev.device, &alloc_info, nullptr, &memory);
+    dev.vk.BindImageMemory(dev.device, image, memory, 0);
+
+    std::vector<VkImageCopy> regions;
+    regions.reserve(kTilesPerSide * kTilesPerSide);
+    for (uint32_t y = 0; y < kTilesPerSide; ++y) {
+        for (uint32_t x = 0; x < kTilesPerSide; ++x) {
+            VkImageCopy region = {};
+            region.srcSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+            region.srcOffset = {static_cast<int32_t>(x * kTile), static_cast<int32_t>(y * kTile), 0};
+            region.dstSubresource = region.srcSubresource;
+            region.dstOffset = {static_cast<int32_t>((2 * kTilesPerSide - 1 - x) * kTile), static_cast<int32_t>(y * kTile), 0};
+            region.extent = {kTile, kTile, 1};
+            regions.push_back(region);
+        }
+    }
+
+    CommandContext commands(dev, 1);
+    VkCommandBuffer command_buffer = commands.command_buffers[0];
+    commands.Begin(command_buffer);
+    const uint64_t copies = state.Scaled(20);
+    state.Measure(copies, [&]() {
+        for (uint64_t i = 0; i < copies; ++i) {
+            dev.vk.CmdCopyImage(command_buffer, image, VK_IMAGE_LAYOUT_GENERAL, image, VK_IMAGE_LAYOUT_GENERAL,
+                                static_cast<uint32_t>(regions.size()), regions.data());
+        }
+    });
+    dev.vk.EndCommandBuffer(command_buffer);
+
+    dev.vk.DestroyImage(dev.device, image, nullptr);
+    dev.vk.FreeMemory(dev.device, memory, nullptr);
+}
+VKBENCH_REGISTER("copy_image_10k_regions", CopyImageRegions);
+
+// 10k 256-byte copies within one buffer, from the first half to the second in reverse order
+static void CopyBufferRegions(BenchmarkState &state) {
+    LayerDevice &dev = state.device;
+    const uint32_t kRegionCount = 10000;
+    const VkDeviceSize kRegionSize = 256;
+
+    VkBufferCreateInfo buffer_info = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    buffer_info.size = 2 * kRegionCount * kRegionSize;
+    buffer_info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    VkBuffer buffer = VK_NULL_HANDLE;
+    dev.vk.CreateBuffer(dev.device, &buffer_info, nullptr, &buffer);
+    VkMemoryRequirements requirements = {};
+    dev.vk.GetBufferMemoryRequirements(dev.device, buffer, &requirements);
+    VkMemoryAllocateInfo alloc_info = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO};
+    alloc_info.allocationSize = requirements.size;
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    dev.vk.AllocateMemory(dev.device, &alloc_info, nullptr, &memory);
+    dev.vk.BindBufferMemory(dev.device, buffer, memory, 0);
+
+    std::vector<VkBufferCopy> regions(kRegionCount);
+    for (uint32_t i = 0; i < kRegionCount; ++i) {
+        regions[i] = {i * kRegionSize, (2 * kRegionCount - 1 - i) * kRegionSize, kRegionSize};
+    }
+
+    CommandContext commands(dev, 1);
+    VkCommandBuffer command_buffer = commands.command_buffers[0];
+    commands.Begin(command_buffer);
+    const uint64_t copies = state.Scaled(20);
+    state.Measure(copies, [&]() {
+        for (uint64_t i = 0; i < copies; ++i) {
+            dev.vk.CmdCopyBuffer(command_buffer, buffer, buffer, kRegionCount, regions.data());
+        }
+    });
+    dev.vk.EndCommandBuffer(command_buffer);
+
+    dev.vk.DestroyBuffer(dev.device, buffer, nullptr);
+    dev.vk.FreeMemory(dev.device, memory, nullptr);
+}
+VKBENCH_REGISTER("copy_buffer_10k_regions", CopyBufferRegions);
+
+// Uploads every mip level of every layer of a 256 layer, 9 level array image, one region per level and layer (2304 regions),
+// from the start of a buffer large enough for the top level
+static void CopyBufferToImageMipChain(BenchmarkState &state) {
+    LayerDevice &dev = state.device;
+    const uint32_t kSize = 256;
+    const uint32_t kMipLevels = 9;
+    const uint32_t kLayers = 256;
+
+    VkImageCreateInfo image_info = {VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO};
+    image_info.imageType = VK_IMAGE_TYPE_2D;
+    image_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+    image_info.extent = {kSize, kSize, 1};
+    image_info.mipLevels = kMipLevels;
+    image_info.arrayLayers = kLayers;
+    image_info.samples = VK_SAMPLE_COUNT_1_BIT;
+    image_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+    image_info.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    image_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    image_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    VkImage image = VK_NULL_HANDLE;
+    dev.vk.CreateImage(dev.device, &image_info, nullptr, &image);
+    VkMemoryRequirements requirements = {};
+    dev.vk.GetImageMemoryRequirements(dev.device, image, &requirements);
+    VkMemoryAllocateInfo alloc_info = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO};
+    alloc_info.allocationSize = requirements.size;
+    VkDeviceMemory image_memory = VK_NULL_HANDLE;
+    dev.vk.AllocateMemory(dev.device, &alloc_info, nullptr, &image_memory);
+    dev.vk.BindImageMemory(dev.device, image, image_memory, 0);
+
+    VkBufferCreateInfo buffer_info = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    buffer_info.size = kSize * kSize * 4;
+    buffer_info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    VkBuffer buffer = VK_NULL_HANDLE;
+    dev.vk.CreateBuffer(dev.device, &buffer_info, nullptr, &buffer);
+    dev.vk.GetBufferMemoryRequirements(dev.device, buffer, &requirements);
+    alloc_info.allocationSize = requirements.size;
+    VkDeviceMemory buffer_memory = VK_NULL_HANDLE;
+    dev.vk.AllocateMemory(dev.device, &alloc_info, nullptr, &buffer_memory);
+    dev.vk.BindBufferMemory(dev.device, buffer, buffer_memory, 0);
+
+    std::vector<VkBufferImageCopy> regions;
+    regions.reserve(kMipLevels * kLayers);
+    for (uint32_t layer = 0; layer < kLayers; ++layer) {
+        for (uint32_t level = 0; level < kMipLevels; ++level) {
+            VkBufferImageCopy region = {};
+            region.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, level, layer, 1};
+            region.imageExtent = {kSize >> level, kSize >> level, 1};
+            regions.push_back(region);
+        }
+    }
+
+    CommandContext commands(dev, 1);
+    VkCommandBuffer command_buffer = commands.command_buffers[0];
+    const uint64_t uploads = state.Scaled(50);
+    state.Measure(uploads, [&]() {
+        for (uint64_t i = 0; i < uploads; ++i) {
+            // Start over each time, so every upload records the initial layouts of a fresh command buffer
+            commands.Begin(command_buffer);
+            dev.vk.CmdCopyBufferToImage(command_buffer, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                        static_cast<uint32_t>(regions.size()), regions.data());
+            dev.vk.EndCommandBuffer(command_buffer);
+        }
+    });
+
+    dev.vk.DestroyBuffer(dev.device, buffer, nullptr);
+    dev.vk.FreeMemory(dev.device, buffer_memory, nullptr);
+    dev.vk.DestroyImage(dev.device, image, nullptr);
+    dev.vk.FreeMemory(dev.device, image_memory, nullptr);
+}
+VKBENCH_REGISTER("copy_buffer_to_image_mip_chain", CopyBufferToImageMipChain);
+
+// 10k vkFlushMappedMemoryRanges calls, each flushing a 64KB range of a 256MB non-coherent allocation mapped whole, the way
+// streaming uploads write into a persistently mapped heap
+static void FlushMappedMemoryRanges(BenchmarkState &state) {
+    LayerDevice &dev = state.device;
+    const VkDeviceSize kAllocationSize = VkDeviceSize(256) << 20;
+    const VkDeviceSize kRangeSize = 64 << 10;
+    const uint32_t kNonCoherentMemoryType = 2;
+
+    VkMemoryAllocateInfo alloc_info = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO};
+    alloc_info.allocationSize = kAllocationSize;
+    alloc_info.memoryTypeIndex = kNonCoherentMemoryType;
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    dev.vk.AllocateMemory(dev.device, &alloc_info, nullptr, &memory);
+    void *data = nullptr;
+    dev.vk.MapMemory(dev.device, memory, 0, VK_WHOLE_SIZE, 0, &data);
+
+    VkMappedMemoryRange range = {VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE};
+    range.memory = memory;
+    range.size = kRangeSize;
+    const uint64_t flushes = state.Scaled(10000);
+    state.Measure(flushes, [&]() {
+        for (uint64_t i = 0; i < flushes; ++i) {
+            range.offset = (i * kRangeSize) % kAllocationSize;
+            dev.vk.FlushMappedMemoryRanges(dev.device, 1, &range);
+        }
+    });
+
+    dev.vk.UnmapMemory(dev.device, memory);
+    dev.vk.FreeMemory(dev.device, memory, nullptr);
+}
+VKBENCH_REGISTER("flush_mapped_memory_ranges", FlushMappedMemoryRanges);
+
+// Suballocation: 10k buffers and 2k VK_IMAGE_CREATE_ALIAS_BIT images bound side by side into one allocation, the images in
+// pairs sharing an offset, then all destroyed. Each bind and destroy is one call.
+static void BindMemorySuballocated(BenchmarkState &state) {
+    LayerDevice &dev = state.device;
+    const uint32_t kBufferCount = 10000;
+    const uint32_t kImageCount = 2000;
+
+    VkBufferCreateInfo buffer_info = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    buffer_info.size = 256;
+    buffer_info.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+    buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    VkImageCreateInfo image_info = {VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO};
+    image_info.flags = VK_IMAGE_CREATE_ALIAS_BIT;
+    image_info.imageType = VK_IMAGE_TYPE_2D;
+    image_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+    image_info.extent = {64, 64, 1};
+    image_info.mipLevels = 1;
+    image_info.arrayLayers = 1;
+    image_info.samples = VK_SAMPLE_COUNT_1_BIT;
+    image_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+    image_info.usage = VK_IMAGE_USAGE_SAMPLED_BIT;
+    image_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    image_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+    const uint64_t repetitions = state.Scaled(5);
+    for (uint64_t rep = 0; rep < repetitions; ++rep) {
+        std::vector<VkBuffer> buffers(kBufferCount);
+        std::vector<VkImage> images(kImageCount);
+        for (auto &buffer : buffers) dev.vk.CreateBuffer(dev.device, &buffer_info, nullptr, &buffer);
+        for (auto &image : images) dev.vk.CreateImage(dev.device, &image_info, nullptr, &image);
+        VkMemoryRequirements buffer_requirements = {};
+        dev.vk.GetBufferMemoryRequirements(dev.device, buffers[0], &buffer_requirements);
+        VkMemoryRequirements image_requirements = {};
+        dev.vk.GetImageMemoryRequirements(dev.device, images[0], &image_requirements);
+        const VkDeviceSize images_offset = kBufferCount * buffer_requirements.size;
+
+        VkMemoryAllocateInfo alloc_info = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO};
+        alloc_info.allocationSize = images_offset + (kImageCount / 2) * image_requirements.size;
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        dev.vk.AllocateMemory(dev.device, &alloc_info, nullptr, &memory);
+
+        state.Measure(kBufferCount + kImageCount, [&]() {
+            for (uint32_t i = 0; i < kBufferCount; ++i) {
+                dev.vk.BindBufferMemory(dev.device, buffers[i], memory, i * buffer_requirements.size);
+            }
+            for (uint32_t i = 0; i < kImageCount; ++i) {
+                dev.vk.BindImageMemory(dev.device, images[i], memory, images_offset + (i / 2) * image_requirements.size);
+            }
+        });
+        state.Measure(kBufferCount + kImageCount, [&]() {
+            for (auto buffer : buffers) dev.vk.DestroyBuffer(dev.device, buffer, nullptr);
+            for (auto image : images) dev.vk.DestroyImage(dev.device, image, nullptr);
+        });
+        dev.vk.FreeMemory(dev.device, memory, nullptr);
+    }
+}
+VKBENCH_REGISTER("bind_memory_suballocated", BindMemorySuballocated);
@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Unit tests for HostWriteTracker, the page-protection based write tracking behind the layer's host write hazard checks. The
+// tracked regions are ordinary page-aligned allocations written directly by the test, so no Vulkan device is needed.
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+#include "gtest/gtest.h"
+#include "host_write_tracker.h"
+
+namespace {
+
+// Page-aligned, zero-filled memory the trackers can protect
+class Pages {
+  public:
+    explicit Pages(size_t page_count) : size_(page_count * HostWriteTracker::PageSize()) {
+#ifdef _WIN32
+        base_ = static_cast<char *>(VirtualAlloc(nullptr, size_, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE));
+#else
+        void *base = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        base_ = (base == MAP_FAILED) ? nullptr : static_cast<char *>(base);
+#endif
+    }
+    ~Pages() {
+        if (!base_) return;
+#ifdef _WIN32
+        VirtualFree(base_, 0, MEM_RELEASE);
+#else
+        munmap(base_, size_);
+#endif
+    }
+
+    Pages(const Pages &) = delete;
+    Pages &operator=(const Pages &) = delete;
+
+    char *data() const { return base_; }
+    size_t size() const { return size_; }
+    char *page(size_t index) const { return base_ + index * HostWriteTracker::PageSize(); }
+
+  private:
+    size_t size_;
+    char *base_;
+};
+
+// Returns the written ranges ForEachWrittenRange reports, as (offset, size) pairs
+std::vector<std::pair<size_t, size_t>> WrittenRanges(const HostWriteTracker &tracker, const char *begin, size_t size) {
+    std::vector<std::pair<size_t, size_t>> ranges;
+    tracker.ForEachWrittenRange(begin, size, [&ranges](size_t offset, size_t range_size) {
+        ranges.emplace_back(offset, range_size);
+    });
+    return ranges;
+}
+
+// Trackers are not available everywhere; the tests that need one return early, the same way layer tests skip
+#define CREATE_TRACKER_OR_SKIP(tracker, pages)                                           \
+    auto tracker = HostWriteTracker::Create((pages).data(), (pages).size());             \
+    if (!tracker) {                                                                      \
+        printf("             HostWriteTracker is not supported here; skipping test.\n"); \
+        return;                                                                          \
+    }
+
+}  // namespace
+
+TEST(HostWriteTracker, CreateRejectsUnalignedRegions) {
+    Pages pages(2);
+    ASSERT_NE(pages.data(), nullptr);
+    EXPECT_EQ(HostWriteTracker::Create(pages.data() + 1, pages.size() - HostWriteTracker::PageSize()), nullptr);
+    EXPECT_EQ(HostWriteTracker::Create(pages.data(), 0), nullptr);
+}
+
+TEST(HostWriteTracker, WritesAreRecordedUntilProtect) {
+    const size_t page_size = HostWriteTracker::PageSize();
+    Pages pages(4);
+    ASSERT_NE(pages.data(), nullptr);
+    CREATE_TRACKER_OR_SKIP(tracker, pages);
+
+    EXPECT_FALSE(tracker->HasWrites());
+    pages.page(1)[7] = 1;
+    pages.page(2)[0] = 2;
+    EXPECT_TRUE(tracker->HasWrites());
+    // Consecutive written pages form one run
+    const std::vector<std::pair<size_t, size_t>> expected = {{page_size, 2 * page_size}};
+    EXPECT_EQ(WrittenRanges(*tracker, pages.data(), pages.size()), expected);
+
+    tracker->Protect();
+    EXPECT_FALSE(tracker->HasWrites());
+    EXPECT_TRUE(WrittenRanges(*tracker, pages.data(), pages.size()).empty());
+
+    // Protected again, so the next write to the same page is seen again
+    pages.page(1)[8] = 3;
+    EXPECT_TRUE(tracker->HasWrites());
+    const std::vector<std::pair<size_t, size_t>> expected_again = {{page_size, page_size}};
+    EXPECT_EQ(WrittenRanges(*tracker, pages.data(), pages.size()), expected_again);
+    EXPECT_EQ(pages.page(1)[7], 1);
+    EXPECT_EQ(pages.page(1)[8], 3);
+}
+
+TEST(HostWriteTracker, WrittenRangesAreClippedToTheQuery) {
+    const size_t page_size = HostWriteTracker::PageSize();
+    Pages pages(4);
+    ASSERT_NE(pages.data(), nullptr);
+    CREATE_TRACKER_OR_SKIP(tracker, pages);
+
+    pages.page(0)[0] = 1;
+    pages.page(1)[0] = 1;
+    pages.page(3)[0] = 1;
+    // Starting half way into page 0 and ending half way into page 3
+    const char *begin = pages.page(0) + page_size / 2;
+    const size_t size = 3 * page_size;
+    const std::vector<std::pair<size_t, size_t>> expected = {{0, page_size + page_size / 2},
+                                                             {2 * page_size + page_size / 2, page_size / 2}};
+    EXPECT_EQ(WrittenRanges(*tracker, begin, size), expected);
+}
+
+TEST(HostWriteTracker, SyncCopiesOnlyDirtyPages) {
+    const size_t page_size = HostWriteTracker::PageSize();
+    Pages pages(4);
+    ASSERT_NE(pages.data(), nullptr);
+    CREATE_TRACKER_OR_SKIP(tracker, pages);
+
+    memset(pages.page(0), 0x11, 16);
+    memset(pages.page(2), 0x22, 16);
+    std::vector<char> destination(pages.size(), 0x7f);
+    tracker->Sync(pages.data(), pages.size(), destination.data());
+    EXPECT_EQ(destination[0], 0x11);
+    EXPECT_EQ(destination[page_size - 1], 0);
+    EXPECT_EQ(destination[page_size], 0x7f);  // Page 1 was never written
+    EXPECT_EQ(destination[2 * page_size], 0x22);
+    EXPECT_EQ(destination[3 * page_size], 0x7f);
+
+    // Everything copied is clean now, but still counts as written until the next Protect()
+    std::fill(destination.begin(), destination.end(), 0x7f);
+    tracker->Sync(pages.data(), pages.size(), destination.data());
+    EXPECT_EQ(destination, std::vector<char>(pages.size(), 0x7f));
+    EXPECT_TRUE(tracker->HasWrites());
+
+    // A clean page is write protected again, so writing it makes it dirty
+    pages.page(2)[1] = 0x33;
+    tracker->Sync(pages.data(), pages.size(), destination.data());
+    EXPECT_EQ(destination[0], 0x7f);
+    EXPECT_EQ(destination[2 * page_size], 0x22);
+    EXPECT_EQ(destination[2 * page_size + 1], 0x33);
+}
+
+TEST(HostWriteTracker, SyncLeavesStraddledPagesDirty) {
+    const size_t page_size = HostWriteTracker::PageSize();
+    Pages pages(4);
+    ASSERT_NE(pages.data(), nullptr);
+    CREATE_TRACKER_OR_SKIP(tracker, pages);
+
+    for (size_t page = 0; page < 3; ++page) memset(pages.page(page), static_cast<int>(page + 1), page_size);
+
+    // Half of page 0, all of page 1 and half of page 2; the destination stands for the start of the range
+    const char *begin = pages.page(0) + page_size / 2;
+    const size_t size = 2 * page_size;
+    std::vector<char> destination(size, 0x7f);
+    tracker->Sync(begin, size, destination.data());
+    EXPECT_EQ(destination[0], 1);
+    EXPECT_EQ(destination[page_size / 2 - 1], 1);
+    EXPECT_EQ(destination[page_size / 2], 2);
+    EXPECT_EQ(destination[size - 1], 3);
+
+    // Pages 0 and 2 hold dirty data outside the range, so a full Sync copies them again; page 1 is clean
+    std::vector<char> full(pages.size(), 0x7f);
+    tracker->Sync(pages.data(), pages.size(), full.data());
+    EXPECT_EQ(full[0], 1);
+    EXPECT_EQ(full[page_size - 1], 1);
+    EXPECT_EQ(full[page_size], 0x7f);
+    EXPECT_EQ(full[2 * page_size - 1], 0x7f);
+    EXPECT_EQ(full[2 * page_size], 3);
+    EXPECT_EQ(full[3 * page_size - 1], 3);
+    EXPECT_EQ(full[3 * page_size], 0x7f);
+}
+
+TEST(HostWriteTracker, CopyInIsNotAWrite) {
+    const size_t page_size = HostWriteTracker::PageSize();
+    Pages pages(4);
+    ASSERT_NE(pages.data(), nullptr);
+    CREATE_TRACKER_OR_SKIP(tracker, pages);
+
+    // Straddles pages 0-2 without covering their outer ends
+    std::vector<char> source(2 * page_size, 0x44);
+    char *begin = pages.page(0) + page_size / 2;
+    tracker->CopyIn(begin, source.data(), source.size());
+    EXPECT_EQ(pages.page(0)[0], 0);
+    EXPECT_EQ(begin[0], 0x44);
+    EXPECT_EQ(begin[source.size() - 1], 0x44);
+    EXPECT_EQ(pages.page(2)[page_size - 1], 0);
+    EXPECT_FALSE(tracker->HasWrites());
+
+    std::vector<char> destination(pages.size(), 0x7f);
+    tracker->Sync(pages.data(), pages.size(), destination.data());
+    EXPECT_EQ(destination, std::vector<char>(pages.size(), 0x7f));
+
+    // The pages CopyIn wrote are protected again
+    pages.page(1)[0] = 0x55;
+    const std::vector<std::pair<size_t, size_t>> expected = {{page_size, page_size}};
+    EXPECT_EQ(WrittenRanges(*tracker, pages.data(), pages.size()), expected);
+}
+
+TEST(HostWriteTracker, CopyInKeepsEarlierWrites) {
+    const size_t page_size = HostWriteTracker::PageSize();
+    Pages pages(2);
+    ASSERT_NE(pages.data(), nullptr);
+    CREATE_TRACKER_OR_SKIP(tracker, pages);
+
+    pages.page(0)[0] = 1;
+    std::vector<char> source(page_size, 0x44);
+    tracker->CopyIn(pages.page(0), source.data(), source.size());
+    const std::vector<std::pair<size_t, size_t>> expected = {{0, page_size}};
+    EXPECT_EQ(WrittenRanges(*tracker, pages.data(), pages.size()), expected);
+}
+
+TEST(HostWriteTracker, ReportedUntilProtect) {
+    Pages pages(1);
+    ASSERT_NE(pages.data(), nullptr);
+    CREATE_TRACKER_OR_SKIP(tracker, pages);
+
+    EXPECT_FALSE(tracker->Reported());
+    tracker->SetReported();
+    EXPECT_TRUE(tracker->Reported());
+    tracker->Protect();
+    EXPECT_FALSE(tracker->Reported());
+}
+
+TEST(HostWriteTracker, DestroyMakesRegionWritable) {
+    Pages pages(2);
+    ASSERT_NE(pages.data(), nullptr);
+    {
+        CREATE_TRACKER_OR_SKIP(tracker, pages);
+        pages.page(0)[0] = 1;
+    }
+    // No tracker is left to handle a fault, so these would crash if the pages were still protected
+    pages.page(0)[1] = 2;
+    pages.page(1)[0] = 3;
+    EXPECT_EQ(pages.page(0)[0], 1);
+}
+
+// Trackers for other regions come and go while one thread keeps faulting on its own tracked region. Every write must be
+// recorded, and none may reach a tracker that is being destroyed.
+TEST(HostWriteTracker, CreateAndDestroyRaceWithFaults) {
+    const size_t page_size = HostWriteTracker::PageSize();
+    const size_t page_count = 16;
+    Pages pages(page_count);
+    ASSERT_NE(pages.data(), nullptr);
+    CREATE_TRACKER_OR_SKIP(tracker, pages);
+
+    std::atomic<bool> stop(false);
+    std::atomic<bool> failed(false);
+    std::thread churn([&stop, &failed]() {
+        Pages other(4);
+        while (!stop.load()) {
+            auto other_tracker = HostWriteTracker::Create(other.data(), other.size());
+            if (!other_tracker) {
+                failed.store(true);
+                return;
+            }
+            other.page(1)[0]++;
+            if (!other_tracker->HasWrites()) failed.store(true);
+        }
+    });
+
+    for (int round = 0; round < 200; ++round) {
+        tracker->Protect();
+        for (size_t page = 0; page < page_count; ++page) pages.page(page)[round % page_size] = static_cast<char>(round);
+        const std::vector<std::pair<size_t, size_t>> expected = {{0, pages.size()}};
+        ASSERT_EQ(WrittenRanges(*tracker, pages.data(), pages.size()), expected) << "round " << round;
+    }
+    stop.store(true);
+    churn.join();
+    EXPECT_FALSE(failed.load());
+}
@@ -26,6 +26,12 @@
 #include "cast_utils.h"
 #include "layer_validation_tests.h"
 
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
 VkFormat FindSupportedDepthOnlyFormat(VkPhysicalDevice phy) {
     const VkFormat ds_formats[] = {VK_FORMAT_D16_UNORM, VK_FORMAT_X8_D24_UNORM_PACK32, VK_FORMAT_D32_SFLOAT};
     for (uint32_t i = 0; i < size(ds_formats); ++i) {
@@ -177,6 +183,43 @@ VKAPI_ATTR VkBool32 VKAPI_CALL DebugUtilsCallback(VkDebugUtilsMessageSeverityFla
     return VK_FALSE;
 }
 
+ScopedLayerOption::ScopedLayerOption(const char *option, const char *value) : option_(option) {
+    typedef const char *(*GetLayerOptionFn)(const char *option);
+    typedef void (*SetLayerOptionFn)(const char *option, const char *value);
+    GetLayerOptionFn get_option = nullptr;
+    SetLayerOptionFn set_option = nullptr;
+#if defined(_WIN32)
+    // Only look at the copy the loader already has loaded; a second copy would not share its settings
+    HMODULE layer_library = GetModuleHandleA("VkLayer_khronos_validation.dll");
+    if (layer_library) {
+        get_option = reinterpret_cast<GetLayerOptionFn>(GetProcAddress(layer_library, "getLayerOption"));
+        set_option = reinterpret_cast<SetLayerOptionFn>(GetProcAddress(layer_library, "setLayerOption"));
+    }
+#else
+#if defined(__APPLE__)
+    const char *layer_library_name = "libVkLayer_khronos_validation.dylib";
+#else
+    const char *layer_library_name = "libVkLayer_khronos_validation.so";
+#endif
+    // Only look at the copy the loader already has loaded; a second copy would not share its settings
+    void *layer_library = dlopen(layer_library_name, RTLD_LAZY | RTLD_NOLOAD);
+    if (layer_library) {
+        get_option = reinterpret_cast<GetLayerOptionFn>(dlsym(layer_library, "getLayerOption"));
+        set_option = reinterpret_cast<SetLayerOptionFn>(dlsym(layer_library, "setLayerOption"));
+        // The loader holds its own reference for as long as the instance exists
+        dlclose(layer_library);
+    }
+#endif
+    if (!get_option || !set_option) return;
+    previous_value_ = get_option(option);
+    set_option(option, value);
+    set_option_ = set_option;
+}
+
+ScopedLayerOption::~ScopedLayerOption() {
+    if (set_option_) set_option_(option_.c_str(), previous_value_.c_str());
+}
+
 #if GTEST_IS_THREADSAFE
 extern "C" void *AddToCommandBuffer(void *arg) {
     struct thread_data_struct *data = (struct thread_data_struct *)arg;
@@ -664,6 +664,25 @@ VKAPI_ATTR VkBool32 VKAPI_CALL DebugUtilsCallback(VkDebugUtilsMessageSeverityFla
                                                   VkDebugUtilsMessageTypeFlagsEXT messageTypes,
                                                   const VkDebugUtilsMessengerCallbackDataEXT *pCallbackData, void *pUserData);
 
+// Overrides a khronos_validation setting, as vk_layer_settings.txt would set it, in the layer library the loader loaded, and
+// restores the previous value when it goes out of scope. The layer reads its settings when a device is created, so construct
+// one after InitFramework() and before InitState(). Supported() is false if the layer library or its exports can't be found.
+class ScopedLayerOption {
+  public:
+    ScopedLayerOption(const char *option, const char *value);
+    ~ScopedLayerOption();
+
+    ScopedLayerOption(const ScopedLayerOption &) = delete;
+    ScopedLayerOption &operator=(const ScopedLayerOption &) = delete;
+
+    bool Supported() const { return set_option_ != nullptr; }
+
+  private:
+    std::string option_;
+    std::string previous_value_;
+    void (*set_option_)(const char *option, const char *value) = nullptr;
+};
+
 #if GTEST_IS_THREADSAFE
 struct thread_data_struct {
     VkCommandBuffer commandBuffer;
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Unit tests for the sparse_container::range_map backends benchmarked in benchmarks/rangemapbenchmarks.cpp. Random operations are
+// applied to the std::map ("tree") and sorted_vector_map ("flat") backends and to a plain per-index array, and all three must
+// agree.
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "range_vector.h"
+
+namespace {
+
+using Range = sparse_container::range<uint64_t>;
+using TreeRangeMap = sparse_container::range_map<uint64_t, uint32_t>;
+using FlatRangeMap = sparse_container::flat_range_map<uint64_t, uint32_t>;
+using sparse_container::value_precedence;
+
+// Indices the random operations cover
+const uint64_t kDomain = 128;
+// Marks an index no entry covers in the reference array
+const uint32_t kUnset = ~0u;
+
+using Entries = std::vector<std::pair<Range, uint32_t>>;
+
+template <typename Map>
+Entries GetEntries(const Map &map) {
+    Entries entries;
+    for (const auto &entry : map) {
+        entries.emplace_back(entry.first, entry.second);
+    }
+    return entries;
+}
+
+// Checks that the entries are non-empty, sorted and disjoint, and cover exactly what the reference array does
+void ExpectMatchesReference(const Entries &entries, const std::vector<uint32_t> &reference) {
+    std::vector<uint32_t> covered(kDomain, kUnset);
+    uint64_t previous_end = 0;
+    for (const auto &entry : entries) {
+        ASSERT_TRUE(entry.first.non_empty());
+        ASSERT_LE(previous_end, entry.first.begin);
+        ASSERT_LE(entry.first.end, kDomain);
+        previous_end = entry.first.end;
+        for (uint64_t i = entry.first.begin; i < entry.first.end; ++i) {
+            covered[i] = entry.second;
+        }
+    }
+    EXPECT_EQ(reference, covered);
+}
+
+Range RandomRange(std::mt19937 &rng) {
+    const uint64_t begin = rng() % kDomain;
+    const uint64_t end = begin + 1 + rng() % (kDomain - begin);
+    return Range(begin, end);
+}
+
+// Few distinct values, so that operations often meet entries already holding the value they write
+uint32_t RandomValue(std::mt19937 &rng) { return rng() % 4; }
+
+// Applies one random operation to map. overlay holds the entries that operation 4 splices in.
+template <typename Map>
+void ApplyOperation(Map &map, uint32_t operation, const Range &range, uint32_t value, value_precedence precedence,
+                    const std::vector<std::pair<Range, uint32_t>> &overlay) {
+    switch (operation) {
+        case 0:
+            map.insert(std::make_pair(range, value));
+            break;
+        case 1:
+            map.overwrite_range(std::make_pair(range, value));
+            break;
+        case 2:
+            map.erase_range(range);
+            break;
+        case 3:
+            sparse_container::update_range_value(map, range, value, precedence);
+            break;
+        case 4: {
+            Map from;
+            for (const auto &entry : overlay) {
+                from.insert(entry);
+            }
+            sparse_container::splice(&map, from, precedence);
+            break;
+        }
+        case 5: {
+            auto it = map.find(range.begin);
+            if (it != map.end()) map.split(it, range.begin + 1, sparse_container::split_op_keep_both());
+            break;
+        }
+        default:
+            assert(false);
+    }
+}
+
+void ApplyToReference(std::vector<uint32_t> &reference, uint32_t operation, const Range &range, uint32_t value,
+                      value_precedence precedence, const std::vector<std::pair<Range, uint32_t>> &overlay) {
+    auto write = [&reference](const Range &bounds, uint32_t written, value_precedence arbiter) {
+        for (uint64_t i = bounds.begin; i < bounds.end; ++i) {
+            if (arbiter == value_precedence::prefer_source || reference[i] == kUnset) reference[i] = written;
+        }
+    };
+    switch (operation) {
+        case 0: {
+            bool empty = true;
+            for (uint64_t i = range.begin; i < range.end; ++i) {
+                empty &= (reference[i] == kUnset);
+            }
+            if (empty) write(range, value, value_precedence::prefer_source);
+            break;
+        }
+        case 1:
+            write(range, value, value_precedence::prefer_source);
+            break;
+        case 2:
+            write(range, kUnset, value_precedence::prefer_source);
+            break;
+        case 3:
+            write(range, value, precedence);
+            break;
+        case 4:
+            for (const auto &entry : overlay) {
+                write(entry.first, entry.second, precedence);
+            }
+            break;
+        case 5:
+            // Splitting changes the entries but not what they cover
+            break;
+        default:
+            assert(false);
+    }
+}
+
+template <typename Map>
+void UpdateRangeValuePreferSourceAfterMatchingEntry() {
+    // A differing entry follows the matching one
+    Map map;
+    map.insert(std::make_pair(Range(0, 4), 2u));
+    map.insert(std::make_pair(Range(4, 8), 1u));
+    EXPECT_TRUE(sparse_container::update_range_value(map, Range(0, 8), 2u, value_precedence::prefer_source));
+    EXPECT_EQ(Entries({{Range(0, 8), 2u}}), GetEntries(map));
+
+    // A gap follows the matching one
+    map.clear();
+    map.insert(std::make_pair(Range(0, 4), 2u));
+    map.insert(std::make_pair(Range(8, 12), 1u));
+    EXPECT_TRUE(sparse_container::update_range_value(map, Range(0, 8), 2u, value_precedence::prefer_source));
+    EXPECT_EQ(Entries({{Range(0, 8), 2u}, {Range(8, 12), 1u}}), GetEntries(map));
+}
+
+}  // namespace
+
+// update_range_value with prefer_source must overwrite from the start of the range even after skipping entries that already
+// hold the value
+TEST(RangeMap, UpdateRangeValuePreferSourceAfterMatchingEntry) {
+    UpdateRangeValuePreferSourceAfterMatchingEntry<TreeRangeMap>();
+    UpdateRangeValuePreferSourceAfterMatchingEntry<FlatRangeMap>();
+}
+
+// The two backends must leave identical entries after any sequence of operations, covering what a per-index array does
+TEST(RangeMap, BackendsMatchReference) {
+    std::mt19937 rng(1);
+    for (uint32_t sequence = 0; sequence < 200; ++sequence) {
+        TreeRangeMap tree;
+        FlatRangeMap flat;
+        std::vector<uint32_t> reference(kDomain, kUnset);
+        for (uint32_t step = 0; step < 100; ++step) {
+            const uint32_t operation = rng() % 6;
+            const Range range = RandomRange(rng);
+            const uint32_t value = RandomValue(rng);
+            const auto precedence = (rng() % 2) ? value_precedence::prefer_source : value_precedence::prefer_dest;
+            std::vector<std::pair<Range, uint32_t>> overlay;
+            if (operation == 4) {
+                // Disjoint entries with random gaps between them
+                for (uint64_t begin = rng() % 8; begin < kDomain; begin += 1 + rng() % 16) {
+                    const uint64_t end = std::min(kDomain, begin + 1 + rng() % 16);
+                    overlay.emplace_back(Range(begin, end), RandomValue(rng));
+                    begin = end;
+                }
+            }
+
+            ApplyOperation(tree, operation, range, value, precedence, overlay);
+            ApplyOperation(flat, operation, range, value, precedence, overlay);
+            ApplyToReference(reference, operation, range, value, precedence, overlay);
+
+            const Entries tree_entries = GetEntries(tree);
+            ASSERT_EQ(tree_entries, GetEntries(flat)) << "sequence " << sequence << ", step " << step;
+            ASSERT_NO_FATAL_FAILURE(ExpectMatchesReference(tree_entries, reference));
+            ASSERT_FALSE(::testing::Test::HasFailure()) << "sequence " << sequence << ", step " << step;
+        }
+    }
+}
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Unit tests for GpuAssistedShaderCache, the on-disk cache of GPU-AV instrumented shaders. The shaders are minimal SPIR-V
+// word streams built by the test; the cache only hashes and copies them, so they don't need to be valid modules.
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gpu_validation_shader_cache.h"
+
+namespace {
+
+const uint32_t kSpirvMagic = 0x07230203;
+const uint32_t kOpConstant = 43;
+
+// Header words the cache writes at the start of the file: "GAVC" and the format version
+const uint32_t kCacheMagic = 0x43564147;
+const uint32_t kCacheFormatVersion = 1;
+
+// A SPIR-V header followed by one 32-bit OpConstant per value
+std::vector<uint32_t> MakeShader(const std::vector<uint32_t> &constants) {
+    std::vector<uint32_t> words = {kSpirvMagic, 0x00010000, 0, 100, 0};
+    uint32_t id = 1;
+    for (const auto value : constants) {
+        words.insert(words.end(), {(4u << 16) | kOpConstant, 99, id++, value});
+    }
+    return words;
+}
+
+// A cache file in the working directory, named after the running test and removed when done
+class CacheFile {
+  public:
+    CacheFile() : path_(std::string("shader_cache_test_") + ::testing::UnitTest::GetInstance()->current_test_info()->name()) {
+        std::remove(path_.c_str());
+    }
+    ~CacheFile() { std::remove(path_.c_str()); }
+
+    const std::string &path() const { return path_; }
+
+    void Write(const std::vector<uint32_t> &words) const {
+        FILE *out = fopen(path_.c_str(), "wb");
+        ASSERT_NE(nullptr, out);
+        if (!words.empty()) fwrite(words.data(), sizeof(uint32_t), words.size(), out);
+        fclose(out);
+    }
+
+    std::vector<uint32_t> Read() const {
+        std::vector<uint32_t> words;
+        FILE *in = fopen(path_.c_str(), "rb");
+        if (!in) return words;
+        uint32_t word;
+        while (fread(&word, sizeof(word), 1, in) == 1) words.push_back(word);
+        fclose(in);
+        return words;
+    }
+
+    long Size() const {
+        FILE *in = fopen(path_.c_str(), "rb");
+        if (!in) return -1;
+        fseek(in, 0, SEEK_END);
+        const long size = ftell(in);
+        fclose(in);
+        return size;
+    }
+
+  private:
+    std::string path_;
+};
+
+// Stands in for an instrumentation pass: the original shader with the placeholder shader ID appended as a constant
+std::vector<uint32_t> Instrument(const std::vector<uint32_t> &original) {
+    std::vector<uint32_t> instrumented = original;
+    instrumented.insert(instrumented.end(), {(4u << 16) | kOpConstant, 99, 1000, GpuAssistedShaderCache::kPlaceholderShaderId});
+    return instrumented;
+}
+
+void AddInstrumented(GpuAssistedShaderCache *cache, const std::vector<uint32_t> &original) {
+    const auto instrumented = Instrument(original);
+    cache->Add(original.data(), original.size(), instrumented,
+               GpuAssistedShaderCache::FindPlaceholderConstants(instrumented.data(), instrumented.size()));
+}
+
+// What Find should return for original given shader_id
+std::vector<uint32_t> Expected(const std::vector<uint32_t> &original, uint32_t shader_id) {
+    auto expected = Instrument(original);
+    expected.back() = shader_id;
+    return expected;
+}
+
+}  // namespace
+
+TEST(GpuAssistedShaderCache, FindPlaceholderConstants) {
+    const uint32_t placeholder = GpuAssistedShaderCache::kPlaceholderShaderId;
+    const auto shader = MakeShader({1, placeholder, 2, placeholder});
+    const std::vector<uint32_t> expected = {12, 20};
+    EXPECT_EQ(expected, GpuAssistedShaderCache::FindPlaceholderConstants(shader.data(), shader.size()));
+
+    // An instruction running past the end stops the scan
+    auto truncated = shader;
+    truncated.resize(truncated.size() - 1);
+    EXPECT_EQ(std::vector<uint32_t>{12}, GpuAssistedShaderCache::FindPlaceholderConstants(truncated.data(), truncated.size()));
+}
+
+TEST(GpuAssistedShaderCache, CreatesFileWithHeader) {
+    CacheFile file;
+    GpuAssistedShaderCache cache;
+    ASSERT_TRUE(cache.Open(file.path(), "configuration"));
+    EXPECT_TRUE(cache.IsOpen());
+    EXPECT_EQ((std::vector<uint32_t>{kCacheMagic, kCacheFormatVersion}), file.Read());
+}
+
+TEST(GpuAssistedShaderCache, FindsShadersAddedThisRun) {
+    CacheFile file;
+    GpuAssistedShaderCache cache;
+    ASSERT_TRUE(cache.Open(file.path(), "configuration"));
+    const auto shader = MakeShader({1, 2, 3});
+    std::vector<uint32_t> found;
+    EXPECT_FALSE(cache.Find(shader.data(), shader.size(), 7, &found));
+
+    AddInstrumented(&cache, shader);
+    ASSERT_TRUE(cache.Find(shader.data(), shader.size(), 7, &found));
+    EXPECT_EQ(Expected(shader, 7), found);
+    // Each lookup patches in the ID it is given
+    ASSERT_TRUE(cache.Find(shader.data(), shader.size(), 8, &found));
+    EXPECT_EQ(Expected(shader, 8), found);
+}
+
+TEST(GpuAssistedShaderCache, RoundTripThroughFile) {
+    CacheFile file;
+    const auto first = MakeShader({1, 2, 3});
+    const auto second = MakeShader({4, 5});
+    {
+        GpuAssistedShaderCache cache;
+        ASSERT_TRUE(cache.Open(file.path(), "configuration"));
+        AddInstrumented(&cache, first);
+        AddInstrumented(&cache, second);
+    }
+
+    GpuAssistedShaderCache cache;
+    ASSERT_TRUE(cache.Open(file.path(), "configuration"));
+    std::vector<uint32_t> found;
+    ASSERT_TRUE(cache.Find(first.data(), first.size(), 11, &found));
+    EXPECT_EQ(Expected(first, 11), found);
+    ASSERT_TRUE(cache.Find(second.data(), second.size(), 12, &found));
+    EXPECT_EQ(Expected(second, 12), found);
+    const auto unknown = MakeShader({1, 2, 4});
+    EXPECT_FALSE(cache.Find(unknown.data(), unknown.size(), 13, &found));
+
+    // Adding to a reopened cache appends, keeping the earlier records
+    const auto third = MakeShader({6});
+    AddInstrumented(&cache, third);
+    GpuAssistedShaderCache reopened;
+    ASSERT_TRUE(reopened.Open(file.path(), "configuration"));
+    EXPECT_TRUE(reopened.Find(first.data(), first.size(), 14, &found));
+    EXPECT_TRUE(reopened.Find(third.data(), third.size(), 14, &found));
+}
+
+TEST(GpuAssistedShaderCache, ConfigurationIsPartOfTheKey) {
+    CacheFile file;
+    const auto shader = MakeShader({1, 2, 3});
+    {
+        GpuAssistedShaderCache cache;
+        ASSERT_TRUE(cache.Open(file.path(), "configuration"));
+        AddInstrumented(&cache, shader);
+    }
+    GpuAssistedShaderCache cache;
+    ASSERT_TRUE(cache.Open(file.path(), "other configuration"));
+    std::vector<uint32_t> found;
+    EXPECT_FALSE(cache.Find(shader.data(), shader.size(), 1, &found));
+}
+
+TEST(GpuAssistedShaderCache, IgnoresTruncatedTrailingRecord) {
+    CacheFile file;
+    const auto first = MakeShader({1, 2, 3});
+    const auto second = MakeShader({4, 5});
+    {
+        GpuAssistedShaderCache cache;
+        ASSERT_TRUE(cache.Open(file.path(), "configuration"));
+        AddInstrumented(&cache, first);
+        AddInstrumented(&cache, second);
+    }
+    // As left by a process that died while appending the second record
+    auto words = file.Read();
+    words.resize(words.size() - 3);
+    file.Write(words);
+
+    GpuAssistedShaderCache cache;
+    ASSERT_TRUE(cache.Open(file.path(), "configuration"));
+    std::vector<uint32_t> found;
+    ASSERT_TRUE(cache.Find(first.data(), first.size(), 1, &found));
+    EXPECT_EQ(Expected(first, 1), found);
+    EXPECT_FALSE(cache.Find(second.data(), second.size(), 1, &found));
+}
+
+TEST(GpuAssistedShaderCache, RejectsCorruptHeader) {
+    CacheFile file;
+    const std::vector<uint32_t> contents = {0x12345678, kCacheFormatVersion, 1, 2, 3, 4, 5, 6, 7};
+    file.Write(contents);
+    GpuAssistedShaderCache cache;
+    EXPECT_FALSE(cache.Open(file.path(), "configuration"));
+    EXPECT_FALSE(cache.IsOpen());
+    // The file is left as it was, in case another process is using it
+    EXPECT_EQ(contents, file.Read());
+}
+
+TEST(GpuAssistedShaderCache, RejectsOtherFormatVersions) {
+    CacheFile file;
+    for (const uint32_t version : {kCacheFormatVersion - 1, kCacheFormatVersion + 1}) {
+        const std::vector<uint32_t> contents = {kCacheMagic, version};
+        file.Write(contents);
+        GpuAssistedShaderCache cache;
+        EXPECT_FALSE(cache.Open(file.path(), "configuration")) << "format version " << version;
+        EXPECT_EQ(contents, file.Read());
+    }
+}
+
+TEST(GpuAssistedShaderCache, RejectsFileShorterThanHeader) {
+    CacheFile file;
+    FILE *out = fopen(file.path().c_str(), "wb");
+    ASSERT_NE(nullptr, out);
+    fputc('G', out);
+    fclose(out);
+    GpuAssistedShaderCache cache;
+    EXPECT_FALSE(cache.Open(file.path(), "configuration"));
+    EXPECT_EQ(1, file.Size());
+}
+
+TEST(GpuAssistedShaderCache, AddWithoutOpenIsIgnored) {
+    GpuAssistedShaderCache cache;
+    const auto shader = MakeShader({1});
+    AddInstrumented(&cache, shader);
+    std::vector<uint32_t> found;
+    EXPECT_FALSE(cache.Find(shader.data(), shader.size(), 1, &found));
+}
@@ -71,6 +71,32 @@ TEST_F(VkLayerTest, BufferExtents) {
     m_commandBuffer->end();
 }
 
+TEST_F(VkLayerTest, BufferCopyRegionsOverlap) {
+    TEST_DESCRIPTION("Copy between regions of the same buffer, where only intersecting source and destination ranges overlap.");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkBufferObj buffer;
+    VkMemoryPropertyFlags reqs = 0;
+    buffer.init_as_src_and_dst(*m_device, 256, reqs);
+
+    m_commandBuffer->begin();
+
+    // The source ranges [0, 32) and [96, 128) and the destination ranges [64, 96) and [32, 64) interleave without intersecting
+    VkBufferCopy regions[2] = {{0, 64, 32}, {96, 32, 32}};
+    m_errorMonitor->ExpectSuccess();
+    vk::CmdCopyBuffer(m_commandBuffer->handle(), buffer.handle(), buffer.handle(), 2, regions);
+    m_errorMonitor->VerifyNotFound();
+
+    // The destination range [16, 48) intersects the source range [0, 32)
+    regions[1].dstOffset = 16;
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "VUID-vkCmdCopyBuffer-pRegions-00117");
+    vk::CmdCopyBuffer(m_commandBuffer->handle(), buffer.handle(), buffer.handle(), 2, regions);
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->end();
+}
+
 TEST_F(VkLayerTest, MirrorClampToEdgeNotEnabled) {
     TEST_DESCRIPTION("Validation should catch using CLAMP_TO_EDGE addressing mode if the extension is not enabled.");
 
@@ -613,13 +639,64 @@ TEST_F(VkLayerTest, InvalidMemoryMapping) {
         vk::DestroyBuffer(m_device->device(), buffer, NULL);
         return;
     }
-    // TODO : If we can get HOST_VISIBLE w/o HOST_COHERENT we can test cases of
-    //  kVUID_Core_MemTrack_InvalidMap in validateAndCopyNoncoherentMemoryToDriver()
 
     vk::DestroyBuffer(m_device->device(), buffer, NULL);
     vk::FreeMemory(m_device->device(), mem, NULL);
 }
 
+TEST_F(VkLayerTest, NonCoherentMemoryGuardBands) {
+    TEST_DESCRIPTION("Write just outside a mapping of non-coherent memory and check that each overrun is reported once per flush.");
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    const VkDeviceSize atom_size = m_device->props.limits.nonCoherentAtomSize;
+    VkMemoryAllocateInfo alloc_info = vk_testing::DeviceMemory::alloc_info(16 * atom_size, 0);
+    if (!m_device->phy().set_memory_type(0xFFFFFFFF, &alloc_info, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                                         VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)) {
+        printf("%s Couldn't find a memory type without a COHERENT bit.\n", kSkipPrefix);
+        return;
+    }
+    vk_testing::DeviceMemory mem;
+    mem.init(*m_device, alloc_info);
+
+    // Two ranges of the same mapping in one flush, so that a band checked per range would be reported twice
+    VkMappedMemoryRange ranges[2] = {};
+    for (auto &range : ranges) {
+        range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        range.memory = mem.handle();
+        range.size = 2 * atom_size;
+    }
+    ranges[0].offset = 4 * atom_size;
+    ranges[1].offset = 6 * atom_size;
+
+    // The mapping starts and ends away from the ends of the allocation, so the bytes written lie inside it either way
+    uint8_t *data = nullptr;
+    ASSERT_VK_SUCCESS(
+        vk::MapMemory(m_device->device(), mem.handle(), 4 * atom_size, 4 * atom_size, 0, reinterpret_cast<void **>(&data)));
+    data[-1] ^= 0xff;
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "Memory underflow was detected");
+    vk::FlushMappedMemoryRanges(m_device->device(), 2, ranges);
+    m_errorMonitor->VerifyFound();
+    vk::UnmapMemory(m_device->device(), mem.handle());
+
+    ASSERT_VK_SUCCESS(
+        vk::MapMemory(m_device->device(), mem.handle(), 4 * atom_size, 4 * atom_size, 0, reinterpret_cast<void **>(&data)));
+    data[4 * atom_size] ^= 0xff;
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "Memory overflow was detected");
+    vk::FlushMappedMemoryRanges(m_device->device(), 2, ranges);
+    m_errorMonitor->VerifyFound();
+    vk::UnmapMemory(m_device->device(), mem.handle());
+
+    ASSERT_VK_SUCCESS(
+        vk::MapMemory(m_device->device(), mem.handle(), 4 * atom_size, 4 * atom_size, 0, reinterpret_cast<void **>(&data)));
+    data[-1] ^= 0xff;
+    data[4 * atom_size] ^= 0xff;
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "Memory underflow was detected");
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "Memory overflow was detected");
+    vk::FlushMappedMemoryRanges(m_device->device(), 2, ranges);
+    m_errorMonitor->VerifyFound();
+    vk::UnmapMemory(m_device->device(), mem.handle());
+}
+
 TEST_F(VkLayerTest, MapMemWithoutHostVisibleBit) {
     TEST_DESCRIPTION("Allocate memory that is not mappable and then attempt to map it.");
     VkResult err;
@@ -2126,6 +2203,97 @@ TEST_F(VkLayerTest, BlitImageLayout) {
     ASSERT_VK_SUCCESS(err);
 }
 
+TEST_F(VkLayerTest, CopyImageMultiRegionInitialLayouts) {
+    TEST_DESCRIPTION(
+        "Record the initial layouts of a copy with unsorted, overlapping regions in one call and one region per call, and check "
+        "that both report the same mismatches at submit.");
+
+    ASSERT_NO_FATAL_FAILURE(Init(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
+
+    VkImageCreateInfo image_ci = {};
+    image_ci.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    image_ci.imageType = VK_IMAGE_TYPE_2D;
+    image_ci.format = VK_FORMAT_R8G8B8A8_UNORM;
+    image_ci.extent = {64, 64, 1};
+    image_ci.mipLevels = 4;
+    image_ci.arrayLayers = 4;
+    image_ci.samples = VK_SAMPLE_COUNT_1_BIT;
+    image_ci.tiling = VK_IMAGE_TILING_OPTIMAL;
+    image_ci.usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    VkImageObj dst_image(m_device);
+    dst_image.init(&image_ci);
+    image_ci.mipLevels = 1;
+    VkImageObj src_image(m_device);
+    src_image.init(&image_ci);
+    ASSERT_TRUE(dst_image.initialized());
+    ASSERT_TRUE(src_image.initialized());
+
+    // Every subresource of the destination starts in TRANSFER_DST_OPTIMAL, except array layer 2 which is in GENERAL
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->begin();
+    const VkImageMemoryBarrier setup_barriers[] = {
+        src_image.image_memory_barrier(0, VK_ACCESS_TRANSFER_READ_BIT, VK_IMAGE_LAYOUT_UNDEFINED,
+                                       VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                                       src_image.subresource_range(VK_IMAGE_ASPECT_COLOR_BIT)),
+        dst_image.image_memory_barrier(0, VK_ACCESS_TRANSFER_WRITE_BIT, VK_IMAGE_LAYOUT_UNDEFINED,
+                                       VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                       dst_image.subresource_range(VK_IMAGE_ASPECT_COLOR_BIT)),
+    };
+    m_commandBuffer->PipelineBarrier(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr,
+                                     2, setup_barriers);
+    const VkImageMemoryBarrier layer_2_barrier = dst_image.image_memory_barrier(
+        VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_TRANSFER_WRITE_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL,
+        VkImageObj::subresource_range(VK_IMAGE_ASPECT_COLOR_BIT, 0, VK_REMAINING_MIP_LEVELS, 2, 1));
+    m_commandBuffer->PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1,
+                                     &layer_2_barrier);
+    m_commandBuffer->end();
+    m_commandBuffer->QueueCommandBuffer();
+    m_errorMonitor->VerifyNotFound();
+
+    // Out of mip order, with the mip 2 regions overlapping each other and the mip 1 region overlapping the barrier below
+    auto region = [](uint32_t mip_level, uint32_t base_layer, uint32_t layer_count) {
+        VkImageCopy copy = {};
+        copy.srcSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, base_layer, layer_count};
+        copy.dstSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, mip_level, base_layer, layer_count};
+        copy.extent = {8, 8, 1};
+        return copy;
+    };
+    const VkImageCopy regions[] = {region(2, 0, 4), region(0, 1, 2), region(2, 1, 1), region(1, 0, 2)};
+    const uint32_t region_count = static_cast<uint32_t>(sizeof(regions) / sizeof(regions[0]));
+
+    for (bool one_call : {true, false}) {
+        m_commandBuffer->reset(0);
+        m_commandBuffer->begin();
+        // Array layer 1 of mip 1 is first used in GENERAL, and the copy must not replace that initial layout
+        const VkImageMemoryBarrier barrier = dst_image.image_memory_barrier(
+            VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_TRANSFER_WRITE_BIT, VK_IMAGE_LAYOUT_GENERAL,
+            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VkImageObj::subresource_range(VK_IMAGE_ASPECT_COLOR_BIT, 1, 1, 1, 1));
+        m_commandBuffer->PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr,
+                                         1, &barrier);
+        if (one_call) {
+            vk::CmdCopyImage(m_commandBuffer->handle(), src_image.image(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, dst_image.image(),
+                             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, region_count, regions);
+        } else {
+            for (const auto &copy : regions) {
+                vk::CmdCopyImage(m_commandBuffer->handle(), src_image.image(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                                 dst_image.image(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copy);
+            }
+        }
+        m_commandBuffer->end();
+
+        // Exactly the subresources whose first use doesn't match the layouts set up above
+        m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "array layer 2, mip level 0");
+        m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "array layer 1, mip level 1");
+        m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "array layer 2, mip level 2");
+        VkSubmitInfo submit_info = {};
+        submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers = &m_commandBuffer->handle();
+        vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+        m_errorMonitor->VerifyFound();
+    }
+}
+
 TEST_F(VkLayerTest, BlitImageOffsets) {
     ASSERT_NO_FATAL_FAILURE(Init());
 
@@ -8467,3 +8635,95 @@ TEST_F(VkLayerTest, InvalidMemoryRequirements) {
         }
     }
 }
+
+TEST_F(VkLayerTest, HostWriteInUseReportedOncePerSubmission) {
+    TEST_DESCRIPTION(
+        "With khronos_validation.host_write_tracking, write through a non-coherent mapping to a buffer that submitted work is "
+        "using, and check the hazard is reported once per submission however often the memory is flushed.");
+    ASSERT_NO_FATAL_FAILURE(InitFramework(myDbgFunc, m_errorMonitor));
+    ScopedLayerOption host_write_tracking("khronos_validation.host_write_tracking", "true");
+    if (!host_write_tracking.Supported()) {
+        printf("%s Couldn't set layer options in the loaded layer, skipping test.\n", kSkipPrefix);
+        return;
+    }
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    VkBufferCreateInfo buffer_ci = {};
+    buffer_ci.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buffer_ci.size = 256;
+    buffer_ci.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    buffer_ci.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    VkBuffer buffer;
+    ASSERT_VK_SUCCESS(vk::CreateBuffer(m_device->device(), &buffer_ci, nullptr, &buffer));
+
+    VkMemoryRequirements mem_reqs;
+    vk::GetBufferMemoryRequirements(m_device->device(), buffer, &mem_reqs);
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.allocationSize = mem_reqs.size;
+    if (!m_device->phy().set_memory_type(mem_reqs.memoryTypeBits, &alloc_info, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                                         VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)) {
+        printf("%s Couldn't find a memory type without a COHERENT bit, skipping test.\n", kSkipPrefix);
+        vk::DestroyBuffer(m_device->device(), buffer, nullptr);
+        return;
+    }
+    VkDeviceMemory mem;
+    ASSERT_VK_SUCCESS(vk::AllocateMemory(m_device->device(), &alloc_info, nullptr, &mem));
+    ASSERT_VK_SUCCESS(vk::BindBufferMemory(m_device->device(), buffer, mem, 0));
+    uint8_t *data;
+    ASSERT_VK_SUCCESS(vk::MapMemory(m_device->device(), mem, 0, VK_WHOLE_SIZE, 0, reinterpret_cast<void **>(&data)));
+
+    VkCommandBufferObj first_command_buffer(m_device, m_commandPool);
+    VkCommandBufferObj second_command_buffer(m_device, m_commandPool);
+    for (auto command_buffer : {&first_command_buffer, &second_command_buffer}) {
+        command_buffer->begin();
+        vk::CmdFillBuffer(command_buffer->handle(), buffer, 0, VK_WHOLE_SIZE, 0);
+        command_buffer->end();
+    }
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount = 1;
+
+    VkMappedMemoryRange range = {};
+    range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+    range.memory = mem;
+    range.offset = 0;
+    range.size = VK_WHOLE_SIZE;
+
+    // Nothing waits on the submissions until the end, so the layer sees the buffer in use throughout
+    m_errorMonitor->ExpectSuccess(VK_DEBUG_REPORT_WARNING_BIT_EXT | VK_DEBUG_REPORT_ERROR_BIT_EXT);
+    submit_info.pCommandBuffers = &first_command_buffer.handle();
+    ASSERT_VK_SUCCESS(vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE));
+    m_errorMonitor->VerifyNotFound();
+
+    data[0] = 1;
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_WARNING_BIT_EXT, "UNASSIGNED-CoreValidation-MemTrack-HostWriteInUse");
+    vk::FlushMappedMemoryRanges(m_device->device(), 1, &range);
+    m_errorMonitor->VerifyFound();
+
+    // Already reported for this submission: neither another flush nor the next submission reports it again
+    data[1] = 2;
+    m_errorMonitor->ExpectSuccess(VK_DEBUG_REPORT_WARNING_BIT_EXT | VK_DEBUG_REPORT_ERROR_BIT_EXT);
+    vk::FlushMappedMemoryRanges(m_device->device(), 1, &range);
+    submit_info.pCommandBuffers = &second_command_buffer.handle();
+    ASSERT_VK_SUCCESS(vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE));
+    m_errorMonitor->VerifyNotFound();
+
+    // A write after the new submission is a new hazard
+    data[2] = 3;
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_WARNING_BIT_EXT, "UNASSIGNED-CoreValidation-MemTrack-HostWriteInUse");
+    vk::FlushMappedMemoryRanges(m_device->device(), 1, &range);
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->ExpectSuccess(VK_DEBUG_REPORT_WARNING_BIT_EXT | VK_DEBUG_REPORT_ERROR_BIT_EXT);
+    vk::FlushMappedMemoryRanges(m_device->device(), 1, &range);
+    vk::QueueWaitIdle(m_device->m_queue);
+    // Once the work has completed, writes are no hazard
+    data[3] = 4;
+    vk::FlushMappedMemoryRanges(m_device->device(), 1, &range);
+    m_errorMonitor->VerifyNotFound();
+
+    vk::UnmapMemory(m_device->device(), mem);
+    vk::DestroyBuffer(m_device->device(), buffer, nullptr);
+    vk::FreeMemory(m_device->device(), mem, nullptr);
+}
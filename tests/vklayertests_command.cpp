@@ -2874,6 +2874,62 @@ TEST_F(VkLayerTest, CopyImageMultiplaneAspectBits) {
     m_commandBuffer->end();
 }
 
+TEST_F(VkLayerTest, CopyImageRegionsOverlap) {
+    TEST_DESCRIPTION("Copy many rows within the same image, where only intersecting source and destination rows overlap.");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkImageCreateInfo ci;
+    ci.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    ci.pNext = NULL;
+    ci.flags = 0;
+    ci.imageType = VK_IMAGE_TYPE_2D;
+    ci.format = VK_FORMAT_R8G8B8A8_UNORM;
+    ci.extent = {64, 64, 1};
+    ci.mipLevels = 1;
+    ci.arrayLayers = 1;
+    ci.samples = VK_SAMPLE_COUNT_1_BIT;
+    ci.tiling = VK_IMAGE_TILING_OPTIMAL;
+    ci.usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    ci.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    ci.queueFamilyIndexCount = 0;
+    ci.pQueueFamilyIndices = NULL;
+    ci.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+    VkImageObj image(m_device);
+    image.init(&ci);
+    ASSERT_TRUE(image.initialized());
+
+    // Copy each full-width row of the top half of the image to the matching row of the bottom half
+    std::vector<VkImageCopy> copy_regions(32);
+    for (uint32_t i = 0; i < copy_regions.size(); ++i) {
+        VkImageCopy &copy_region = copy_regions[i];
+        copy_region.srcSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+        copy_region.dstSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+        copy_region.srcOffset = {0, static_cast<int32_t>(i), 0};
+        copy_region.dstOffset = {0, static_cast<int32_t>(i + 32), 0};
+        copy_region.extent = {64, 1, 1};
+    }
+
+    m_commandBuffer->begin();
+
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->CopyImage(image.image(), VK_IMAGE_LAYOUT_GENERAL, image.image(), VK_IMAGE_LAYOUT_GENERAL,
+                               static_cast<uint32_t>(copy_regions.size()), copy_regions.data());
+    m_errorMonitor->VerifyNotFound();
+
+    // Copying row 0 to row 1 writes over the source of the copy out of row 1
+    VkImageCopy overlapping_region = copy_regions[0];
+    overlapping_region.dstOffset.y = 1;
+    copy_regions.push_back(overlapping_region);
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "VUID-vkCmdCopyImage-pRegions-00124");
+    m_commandBuffer->CopyImage(image.image(), VK_IMAGE_LAYOUT_GENERAL, image.image(), VK_IMAGE_LAYOUT_GENERAL,
+                               static_cast<uint32_t>(copy_regions.size()), copy_regions.data());
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->end();
+}
+
 TEST_F(VkLayerTest, CopyImageSrcSizeExceeded) {
     // Image copy with source region specified greater than src image size
     ASSERT_NO_FATAL_FAILURE(Init());
@@ -5435,3 +5491,364 @@ TEST_F(VkLayerTest, CreateSamplerYcbcrConversionEnable) {
     vkCreateSamplerYcbcrConversionFunction(m_device->handle(), &ycbcr_create_info, nullptr, &conversions);
     m_errorMonitor->VerifyFound();
 }
+
+TEST_F(VkLayerTest, CmdResetQueryPoolRange) {
+    TEST_DESCRIPTION("Use queries inside and on either side of the range reset by vkCmdResetQueryPool.");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkQueryPoolCreateInfo query_pool_ci = {};
+    query_pool_ci.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    query_pool_ci.queryType = VK_QUERY_TYPE_OCCLUSION;
+    query_pool_ci.queryCount = 4;
+    VkQueryPool query_pool;
+    ASSERT_VK_SUCCESS(vk::CreateQueryPool(m_device->device(), &query_pool_ci, nullptr, &query_pool));
+
+    // Queries 1 and 2 are reset in the command buffer that uses them
+    VkCommandBufferObj inside_range(m_device, m_commandPool);
+    inside_range.begin();
+    vk::CmdResetQueryPool(inside_range.handle(), query_pool, 1, 2);
+    for (uint32_t query = 1; query < 3; ++query) {
+        vk::CmdBeginQuery(inside_range.handle(), query_pool, query, 0);
+        vk::CmdEndQuery(inside_range.handle(), query_pool, query);
+    }
+    inside_range.end();
+
+    m_errorMonitor->ExpectSuccess();
+    inside_range.QueueCommandBuffer();
+    m_errorMonitor->VerifyNotFound();
+
+    // Queries 0 and 3, just outside the range, were never reset
+    VkCommandBufferObj outside_range(m_device, m_commandPool);
+    outside_range.begin();
+    vk::CmdResetQueryPool(outside_range.handle(), query_pool, 1, 2);
+    for (uint32_t query : {0u, 3u}) {
+        vk::CmdBeginQuery(outside_range.handle(), query_pool, query, 0);
+        vk::CmdEndQuery(outside_range.handle(), query_pool, query);
+    }
+    outside_range.end();
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "UNASSIGNED-CoreValidation-DrawState-QueryNotReset");
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "UNASSIGNED-CoreValidation-DrawState-QueryNotReset");
+    outside_range.QueueCommandBuffer(false);
+    m_errorMonitor->VerifyFound();
+
+    vk::DestroyQueryPool(m_device->device(), query_pool, nullptr);
+}
+
+TEST_F(VkLayerTest, HostQueryResetRange) {
+    TEST_DESCRIPTION("Use queries inside and on either side of the range reset by vkResetQueryPoolEXT.");
+
+    if (!InstanceExtensionSupported(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME)) {
+        printf("%s Did not find required instance extension %s; skipped.\n", kSkipPrefix,
+               VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+        return;
+    }
+    m_instance_extension_names.push_back(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+    ASSERT_NO_FATAL_FAILURE(InitFramework(myDbgFunc, m_errorMonitor));
+
+    if (!DeviceExtensionSupported(gpu(), nullptr, VK_EXT_HOST_QUERY_RESET_EXTENSION_NAME)) {
+        printf("%s Extension %s not supported by device; skipped.\n", kSkipPrefix, VK_EXT_HOST_QUERY_RESET_EXTENSION_NAME);
+        return;
+    }
+    m_device_extension_names.push_back(VK_EXT_HOST_QUERY_RESET_EXTENSION_NAME);
+
+    VkPhysicalDeviceHostQueryResetFeaturesEXT host_query_reset_features{};
+    host_query_reset_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES_EXT;
+    host_query_reset_features.hostQueryReset = VK_TRUE;
+
+    VkPhysicalDeviceFeatures2 pd_features2{};
+    pd_features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    pd_features2.pNext = &host_query_reset_features;
+
+    ASSERT_NO_FATAL_FAILURE(InitState(nullptr, &pd_features2));
+
+    auto fpvkResetQueryPoolEXT = (PFN_vkResetQueryPoolEXT)vk::GetDeviceProcAddr(m_device->device(), "vkResetQueryPoolEXT");
+
+    VkQueryPoolCreateInfo query_pool_ci = {};
+    query_pool_ci.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    query_pool_ci.queryType = VK_QUERY_TYPE_OCCLUSION;
+    query_pool_ci.queryCount = 4;
+    VkQueryPool query_pool;
+    ASSERT_VK_SUCCESS(vk::CreateQueryPool(m_device->device(), &query_pool_ci, nullptr, &query_pool));
+
+    m_errorMonitor->ExpectSuccess();
+    fpvkResetQueryPoolEXT(m_device->device(), query_pool, 1, 2);
+    m_errorMonitor->VerifyNotFound();
+
+    // Queries 1 and 2 were reset from the host
+    VkCommandBufferObj inside_range(m_device, m_commandPool);
+    inside_range.begin();
+    for (uint32_t query = 1; query < 3; ++query) {
+        vk::CmdBeginQuery(inside_range.handle(), query_pool, query, 0);
+        vk::CmdEndQuery(inside_range.handle(), query_pool, query);
+    }
+    inside_range.end();
+
+    m_errorMonitor->ExpectSuccess();
+    inside_range.QueueCommandBuffer();
+    m_errorMonitor->VerifyNotFound();
+
+    // Queries 0 and 3, just outside the range, were never reset, and 1 and 2 have been used since
+    for (uint32_t query = 0; query < 4; ++query) {
+        VkCommandBufferObj command_buffer(m_device, m_commandPool);
+        command_buffer.begin();
+        vk::CmdBeginQuery(command_buffer.handle(), query_pool, query, 0);
+        vk::CmdEndQuery(command_buffer.handle(), query_pool, query);
+        command_buffer.end();
+
+        m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "UNASSIGNED-CoreValidation-DrawState-QueryNotReset");
+        command_buffer.QueueCommandBuffer(false);
+        m_errorMonitor->VerifyFound();
+    }
+
+    // Resetting from the host again makes them usable
+    fpvkResetQueryPoolEXT(m_device->device(), query_pool, 0, 4);
+    VkCommandBufferObj after_reset(m_device, m_commandPool);
+    after_reset.begin();
+    for (uint32_t query = 0; query < 4; ++query) {
+        vk::CmdBeginQuery(after_reset.handle(), query_pool, query, 0);
+        vk::CmdEndQuery(after_reset.handle(), query_pool, query);
+    }
+    after_reset.end();
+
+    m_errorMonitor->ExpectSuccess();
+    after_reset.QueueCommandBuffer();
+    m_errorMonitor->VerifyNotFound();
+
+    vk::DestroyQueryPool(m_device->device(), query_pool, nullptr);
+}
+
+TEST_F(VkLayerTest, QueryStateNotKeptAfterPoolDestroyed) {
+    TEST_DESCRIPTION("Queries of a pool created after another was reset and destroyed must still be reset before use.");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkQueryPoolCreateInfo query_pool_ci = {};
+    query_pool_ci.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    query_pool_ci.queryType = VK_QUERY_TYPE_OCCLUSION;
+    query_pool_ci.queryCount = 2;
+
+    VkQueryPool query_pool;
+    ASSERT_VK_SUCCESS(vk::CreateQueryPool(m_device->device(), &query_pool_ci, nullptr, &query_pool));
+    VkCommandBufferObj reset(m_device, m_commandPool);
+    reset.begin();
+    vk::CmdResetQueryPool(reset.handle(), query_pool, 0, 2);
+    reset.end();
+    m_errorMonitor->ExpectSuccess();
+    reset.QueueCommandBuffer();
+    vk::DestroyQueryPool(m_device->device(), query_pool, nullptr);
+    m_errorMonitor->VerifyNotFound();
+
+    // The new pool may well reuse the handle of the destroyed one
+    ASSERT_VK_SUCCESS(vk::CreateQueryPool(m_device->device(), &query_pool_ci, nullptr, &query_pool));
+    VkCommandBufferObj use(m_device, m_commandPool);
+    use.begin();
+    vk::CmdBeginQuery(use.handle(), query_pool, 0, 0);
+    vk::CmdEndQuery(use.handle(), query_pool, 0);
+    use.end();
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "UNASSIGNED-CoreValidation-DrawState-QueryNotReset");
+    use.QueueCommandBuffer(false);
+    m_errorMonitor->VerifyFound();
+
+    vk::DestroyQueryPool(m_device->device(), query_pool, nullptr);
+}
+
+TEST_F(VkLayerTest, QueryPerformancePassesPerQuery) {
+    TEST_DESCRIPTION("Check that the passes a performance query was submitted for are counted per query, and cleared by a reset.");
+
+    if (InstanceExtensionSupported(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME)) {
+        m_instance_extension_names.push_back(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+    } else {
+        printf("%s Extension %s is not supported.\n", kSkipPrefix, VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+        return;
+    }
+    ASSERT_NO_FATAL_FAILURE(InitFramework(myDbgFunc, m_errorMonitor));
+
+    if (DeviceExtensionSupported(gpu(), nullptr, VK_KHR_PERFORMANCE_QUERY_EXTENSION_NAME)) {
+        m_device_extension_names.push_back(VK_KHR_PERFORMANCE_QUERY_EXTENSION_NAME);
+    } else {
+        printf("%s Extension %s is not supported.\n", kSkipPrefix, VK_KHR_PERFORMANCE_QUERY_EXTENSION_NAME);
+        return;
+    }
+    if (DeviceExtensionSupported(gpu(), nullptr, VK_EXT_HOST_QUERY_RESET_EXTENSION_NAME)) {
+        m_device_extension_names.push_back(VK_EXT_HOST_QUERY_RESET_EXTENSION_NAME);
+    } else {
+        printf("%s Extension %s is not supported.\n", kSkipPrefix, VK_EXT_HOST_QUERY_RESET_EXTENSION_NAME);
+        return;
+    }
+
+    PFN_vkGetPhysicalDeviceFeatures2KHR vkGetPhysicalDeviceFeatures2KHR =
+        (PFN_vkGetPhysicalDeviceFeatures2KHR)vk::GetInstanceProcAddr(instance(), "vkGetPhysicalDeviceFeatures2KHR");
+    ASSERT_TRUE(vkGetPhysicalDeviceFeatures2KHR != nullptr);
+    auto hostQueryResetFeatures = lvl_init_struct<VkPhysicalDeviceHostQueryResetFeaturesEXT>();
+    auto performanceFeatures = lvl_init_struct<VkPhysicalDevicePerformanceQueryFeaturesKHR>(&hostQueryResetFeatures);
+    auto features2 = lvl_init_struct<VkPhysicalDeviceFeatures2KHR>(&performanceFeatures);
+    vkGetPhysicalDeviceFeatures2KHR(gpu(), &features2);
+    if (!performanceFeatures.performanceCounterQueryPools) {
+        printf("%s Performance query pools are not supported.\n", kSkipPrefix);
+        return;
+    }
+    if (!hostQueryResetFeatures.hostQueryReset) {
+        printf("%s Missing host query reset.\n", kSkipPrefix);
+        return;
+    }
+
+    ASSERT_NO_FATAL_FAILURE(InitState(nullptr, &performanceFeatures));
+    PFN_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR
+        vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR =
+            (PFN_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR)vk::GetInstanceProcAddr(
+                instance(), "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR");
+    ASSERT_TRUE(vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR != nullptr);
+    PFN_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR =
+        (PFN_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR)vk::GetInstanceProcAddr(
+            instance(), "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR");
+    ASSERT_TRUE(vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR != nullptr);
+
+    // Use the first counter of the first queue family that has any
+    auto queueFamilyProperties = m_device->phy().queue_properties();
+    uint32_t queueFamilyIndex = queueFamilyProperties.size();
+    for (uint32_t idx = 0; idx < queueFamilyProperties.size(); idx++) {
+        uint32_t nCounters = 0;
+        vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(gpu(), idx, &nCounters, nullptr, nullptr);
+        if (nCounters > 0) {
+            queueFamilyIndex = idx;
+            break;
+        }
+    }
+    if (queueFamilyIndex == queueFamilyProperties.size()) {
+        printf("%s No queue reported any performance counters.\n", kSkipPrefix);
+        return;
+    }
+
+    const uint32_t counterIndex = 0;
+    VkQueryPoolPerformanceCreateInfoKHR perf_query_pool_ci{};
+    perf_query_pool_ci.sType = VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_CREATE_INFO_KHR;
+    perf_query_pool_ci.queueFamilyIndex = queueFamilyIndex;
+    perf_query_pool_ci.counterIndexCount = 1;
+    perf_query_pool_ci.pCounterIndices = &counterIndex;
+    uint32_t nPasses = 0;
+    vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(gpu(), &perf_query_pool_ci, &nPasses);
+
+    VkQueryPoolCreateInfo query_pool_ci{};
+    query_pool_ci.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    query_pool_ci.pNext = &perf_query_pool_ci;
+    query_pool_ci.queryType = VK_QUERY_TYPE_PERFORMANCE_QUERY_KHR;
+    query_pool_ci.queryCount = 2;
+    VkQueryPool query_pool;
+    ASSERT_VK_SUCCESS(vk::CreateQueryPool(device(), &query_pool_ci, nullptr, &query_pool));
+
+    VkQueue queue = VK_NULL_HANDLE;
+    vk::GetDeviceQueue(device(), queueFamilyIndex, 0, &queue);
+    VkCommandPoolObj command_pool(m_device, queueFamilyIndex);
+    VkCommandBufferObj command_buffer(m_device, &command_pool);
+
+    PFN_vkAcquireProfilingLockKHR vkAcquireProfilingLockKHR =
+        (PFN_vkAcquireProfilingLockKHR)vk::GetInstanceProcAddr(instance(), "vkAcquireProfilingLockKHR");
+    ASSERT_TRUE(vkAcquireProfilingLockKHR != nullptr);
+    PFN_vkReleaseProfilingLockKHR vkReleaseProfilingLockKHR =
+        (PFN_vkReleaseProfilingLockKHR)vk::GetInstanceProcAddr(instance(), "vkReleaseProfilingLockKHR");
+    ASSERT_TRUE(vkReleaseProfilingLockKHR != nullptr);
+    PFN_vkResetQueryPoolEXT fpvkResetQueryPoolEXT =
+        (PFN_vkResetQueryPoolEXT)vk::GetDeviceProcAddr(device(), "vkResetQueryPoolEXT");
+
+    VkAcquireProfilingLockInfoKHR lock_info{};
+    lock_info.sType = VK_STRUCTURE_TYPE_ACQUIRE_PROFILING_LOCK_INFO_KHR;
+    ASSERT_VK_SUCCESS(vkAcquireProfilingLockKHR(device(), &lock_info));
+
+    VkBufferObj buffer;
+    VkMemoryPropertyFlags reqs = 0;
+    buffer.init_as_dst(*m_device, 4096, reqs);
+
+    // Only query 0 is used, and it is submitted for every pass
+    fpvkResetQueryPoolEXT(device(), query_pool, 0, 2);
+    VkCommandBufferBeginInfo command_buffer_begin_info{};
+    command_buffer_begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    command_buffer_begin_info.flags = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
+    command_buffer.begin(&command_buffer_begin_info);
+    vk::CmdBeginQuery(command_buffer.handle(), query_pool, 0, 0);
+    vk::CmdFillBuffer(command_buffer.handle(), buffer.handle(), 0, 4096, 0);
+    vk::CmdEndQuery(command_buffer.handle(), query_pool, 0);
+    command_buffer.end();
+
+    m_errorMonitor->ExpectSuccess();
+    for (uint32_t passIdx = 0; passIdx < nPasses; passIdx++) {
+        VkPerformanceQuerySubmitInfoKHR perf_submit_info{};
+        perf_submit_info.sType = VK_STRUCTURE_TYPE_PERFORMANCE_QUERY_SUBMIT_INFO_KHR;
+        perf_submit_info.counterPassIndex = passIdx;
+        VkSubmitInfo submit_info{};
+        submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submit_info.pNext = &perf_submit_info;
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers = &command_buffer.handle();
+        vk::QueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE);
+    }
+    vk::QueueWaitIdle(queue);
+    m_errorMonitor->VerifyNotFound();
+
+    VkPerformanceCounterResultKHR result;
+    m_errorMonitor->ExpectSuccess();
+    vk::GetQueryPoolResults(device(), query_pool, 0, 1, sizeof(result), &result, sizeof(result), VK_QUERY_RESULT_WAIT_BIT);
+    m_errorMonitor->VerifyNotFound();
+
+    // Query 1 was never submitted, even though query 0 was for every pass
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "VUID-vkGetQueryPoolResults-queryType-03231");
+    vk::GetQueryPoolResults(device(), query_pool, 1, 1, sizeof(result), &result, sizeof(result), 0);
+    m_errorMonitor->VerifyFound();
+
+    // Resetting query 0 clears the passes it was submitted for
+    fpvkResetQueryPoolEXT(device(), query_pool, 0, 1);
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "VUID-vkGetQueryPoolResults-queryType-03231");
+    vk::GetQueryPoolResults(device(), query_pool, 0, 1, sizeof(result), &result, sizeof(result), 0);
+    m_errorMonitor->VerifyFound();
+
+    vkReleaseProfilingLockKHR(device());
+    vk::DestroyQueryPool(device(), query_pool, nullptr);
+}
+
+TEST_F(VkLayerTest, QueryIndicesOutOfRange) {
+    TEST_DESCRIPTION("Reset and begin queries past the end of a query pool, including ranges whose end overflows 32 bits.");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkQueryPoolCreateInfo query_pool_ci = {};
+    query_pool_ci.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    query_pool_ci.queryType = VK_QUERY_TYPE_OCCLUSION;
+    query_pool_ci.queryCount = 4;
+    VkQueryPool query_pool;
+    ASSERT_VK_SUCCESS(vk::CreateQueryPool(m_device->device(), &query_pool_ci, nullptr, &query_pool));
+
+    VkCommandBufferObj reset_cb(m_device, m_commandPool);
+    reset_cb.begin();
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "VUID-vkCmdResetQueryPool-firstQuery-00796");
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "VUID-vkCmdResetQueryPool-firstQuery-00797");
+    vk::CmdResetQueryPool(reset_cb.handle(), query_pool, 0xFFFFFFF0, 0x20);
+    m_errorMonitor->VerifyFound();
+    // Only the part of this range inside the pool, queries 2 and 3, is reset
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "VUID-vkCmdResetQueryPool-firstQuery-00797");
+    vk::CmdResetQueryPool(reset_cb.handle(), query_pool, 2, 0xFFFFFFFF);
+    m_errorMonitor->VerifyFound();
+    vk::CmdBeginQuery(reset_cb.handle(), query_pool, 3, 0);
+    vk::CmdEndQuery(reset_cb.handle(), query_pool, 3);
+    reset_cb.end();
+
+    m_errorMonitor->ExpectSuccess();
+    reset_cb.QueueCommandBuffer();
+    m_errorMonitor->VerifyNotFound();
+
+    VkCommandBufferObj begin_cb(m_device, m_commandPool);
+    begin_cb.begin();
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "VUID-vkCmdBeginQuery-query-00802");
+    vk::CmdBeginQuery(begin_cb.handle(), query_pool, 0xFFFFFFFF, 0);
+    m_errorMonitor->VerifyFound();
+    vk::CmdEndQuery(begin_cb.handle(), query_pool, 0xFFFFFFFF);
+    begin_cb.end();
+
+    // The query has no state to track, so it is reported as not reset at submit time
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "UNASSIGNED-CoreValidation-DrawState-QueryNotReset");
+    begin_cb.QueueCommandBuffer(false);
+    m_errorMonitor->VerifyFound();
+
+    vk::DestroyQueryPool(m_device->device(), query_pool, nullptr);
+}
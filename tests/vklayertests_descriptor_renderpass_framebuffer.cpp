@@ -506,6 +506,138 @@ TEST_F(VkLayerTest, GpuValidationArrayOOBGraphicsShaders) {
     return;
 }
 
+TEST_F(VkLayerTest, GpuValidationArrayOOBBackgroundInstrumentation) {
+    TEST_DESCRIPTION(
+        "GPU validation: Detect out-of-bounds descriptor array indexing with shaders instrumented on background threads and "
+        "reused from the instrumented shader cache.");
+
+    VkValidationFeatureEnableEXT enables[] = {VK_VALIDATION_FEATURE_ENABLE_GPU_ASSISTED_EXT};
+    VkValidationFeaturesEXT features = {};
+    features.sType = VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT;
+    features.enabledValidationFeatureCount = 1;
+    features.pEnabledValidationFeatures = enables;
+    ASSERT_NO_FATAL_FAILURE(InitFramework(myDbgFunc, m_errorMonitor, &features));
+    if (DeviceIsMockICD() || DeviceSimulation()) {
+        printf("%s GPU-Assisted validation test requires a driver that can draw.\n", kSkipPrefix);
+        return;
+    }
+
+    // Start without a cache file, in case an earlier run stopped before removing it
+    const char *cache_path = "gpu_validation_background_instrumentation.cache";
+    std::remove(cache_path);
+
+    // The options go out of scope, restoring the layer's settings, before ShutdownFramework() unloads the layer
+    {
+        ScopedLayerOption instrumentation_threads("khronos_validation.gpu_validation_instrumentation_threads", "2");
+        ScopedLayerOption shader_cache("khronos_validation.gpu_validation_shader_cache", cache_path);
+        if (!instrumentation_threads.Supported()) {
+            printf("%s Couldn't set layer options in the loaded layer, skipping test.\n", kSkipPrefix);
+            return;
+        }
+
+        ASSERT_NO_FATAL_FAILURE(InitState(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
+        if (m_device->props.apiVersion < VK_API_VERSION_1_1) {
+            printf("%s GPU-Assisted validation test requires Vulkan 1.1+.\n", kSkipPrefix);
+            return;
+        }
+        ASSERT_NO_FATAL_FAILURE(InitViewport());
+        ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+        // A uniform buffer holding the invalid array index
+        VkBufferObj index_buffer;
+        VkMemoryPropertyFlags mem_props = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+        index_buffer.init(*m_device, 1024, mem_props, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+        uint32_t *data = static_cast<uint32_t *>(index_buffer.memory().map());
+        data[0] = 25;
+        index_buffer.memory().unmap();
+
+        OneOffDescriptorSet descriptor_set(m_device,
+                                           {
+                                               {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
+                                               {1, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 6, VK_SHADER_STAGE_ALL, nullptr},
+                                           });
+        const VkPipelineLayoutObj pipeline_layout(m_device, {&descriptor_set.layout_});
+        VkTextureObj texture(m_device, nullptr);
+        VkSamplerObj sampler(m_device);
+
+        VkDescriptorBufferInfo buffer_info = {index_buffer.handle(), 0, sizeof(uint32_t)};
+        VkDescriptorImageInfo image_info[6] = {};
+        for (auto &info : image_info) {
+            info = texture.DescriptorImageInfo();
+            info.sampler = sampler.handle();
+            info.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        }
+        VkWriteDescriptorSet descriptor_writes[2] = {};
+        descriptor_writes[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        descriptor_writes[0].dstSet = descriptor_set.set_;
+        descriptor_writes[0].dstBinding = 0;
+        descriptor_writes[0].descriptorCount = 1;
+        descriptor_writes[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        descriptor_writes[0].pBufferInfo = &buffer_info;
+        descriptor_writes[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        descriptor_writes[1].dstSet = descriptor_set.set_;
+        descriptor_writes[1].dstBinding = 1;
+        descriptor_writes[1].descriptorCount = 6;
+        descriptor_writes[1].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        descriptor_writes[1].pImageInfo = image_info;
+        vk::UpdateDescriptorSets(m_device->device(), 2, descriptor_writes, 0, NULL);
+
+        char const *vsSource =
+            "#version 450\n"
+            "\n"
+            "layout(std140, set = 0, binding = 0) uniform foo { uint tex_index[1]; } uniform_index_buffer;\n"
+            "layout(set = 0, binding = 1) uniform sampler2D tex[6];\n"
+            "vec2 vertices[3];\n"
+            "void main(){\n"
+            "      vertices[0] = vec2(-1.0, -1.0);\n"
+            "      vertices[1] = vec2( 1.0, -1.0);\n"
+            "      vertices[2] = vec2( 0.0,  1.0);\n"
+            "   gl_Position = vec4(vertices[gl_VertexIndex % 3], 0.0, 1.0);\n"
+            "   gl_Position += 1e-30 * texture(tex[uniform_index_buffer.tex_index[0]], vec2(0, 0));\n"
+            "}\n";
+
+        VkViewport viewport = m_viewports[0];
+        VkRect2D scissors = m_scissors[0];
+
+        VkSubmitInfo submit_info = {};
+        submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers = &m_commandBuffer->handle();
+
+        // The second pass creates the same shaders again, so they come from the shader cache with a new shader ID patched in
+        for (int pass = 0; pass < 2; ++pass) {
+            m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                                 "Index of 25 used to index descriptor array of length 6.");
+            VkShaderObj vs(m_device, vsSource, VK_SHADER_STAGE_VERTEX_BIT, this);
+            VkShaderObj fs(m_device, bindStateFragShaderText, VK_SHADER_STAGE_FRAGMENT_BIT, this);
+            VkPipelineObj pipe(m_device);
+            pipe.AddShader(&vs);
+            pipe.AddShader(&fs);
+            pipe.AddDefaultColorAttachment();
+            ASSERT_VK_SUCCESS(pipe.CreateVKPipeline(pipeline_layout.handle(), renderPass()));
+
+            m_commandBuffer->begin();
+            m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+            vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.handle());
+            vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout.handle(), 0, 1,
+                                      &descriptor_set.set_, 0, nullptr);
+            vk::CmdSetViewport(m_commandBuffer->handle(), 0, 1, &viewport);
+            vk::CmdSetScissor(m_commandBuffer->handle(), 0, 1, &scissors);
+            vk::CmdDraw(m_commandBuffer->handle(), 3, 1, 0, 0);
+            vk::CmdEndRenderPass(m_commandBuffer->handle());
+            m_commandBuffer->end();
+
+            vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+            vk::QueueWaitIdle(m_device->m_queue);
+            m_errorMonitor->VerifyFound();
+        }
+    }
+
+    // The cache file can only go once the device has unmapped it
+    ShutdownFramework();
+    std::remove(cache_path);
+}
+
 TEST_F(VkLayerTest, GpuBufferDeviceAddressOOB) {
     bool supported = InstanceExtensionSupported(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
     m_instance_extension_names.push_back(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
@@ -1115,6 +1115,39 @@ TEST_F(VkLayerTest, InvalidCmdBufferEventDestroyed) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(VkLayerTest, InvalidCmdBufferEventDestroyedWhileRecording) {
+    TEST_DESCRIPTION("Destroy an event used by a command buffer that is still being recorded, then end the command buffer.");
+    ASSERT_NO_FATAL_FAILURE(Init(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
+
+    VkEvent event;
+    VkEvent other_event;
+    VkEventCreateInfo evci = {};
+    evci.sType = VK_STRUCTURE_TYPE_EVENT_CREATE_INFO;
+    VkResult result = vk::CreateEvent(m_device->device(), &evci, NULL, &event);
+    ASSERT_VK_SUCCESS(result);
+    result = vk::CreateEvent(m_device->device(), &evci, NULL, &other_event);
+    ASSERT_VK_SUCCESS(result);
+
+    m_commandBuffer->begin();
+    vk::CmdSetEvent(m_commandBuffer->handle(), event, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT);
+    vk::DestroyEvent(m_device->device(), event, NULL);
+
+    // Bindings are not rechecked on every command, so recording carries on quietly...
+    m_errorMonitor->ExpectSuccess();
+    vk::CmdSetEvent(m_commandBuffer->handle(), other_event, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT);
+    m_errorMonitor->VerifyNotFound();
+
+    // ...and the destroyed event is reported when recording ends
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                         "UNASSIGNED-CoreValidation-DrawState-InvalidCommandBuffer-VkEvent");
+    vk::EndCommandBuffer(m_commandBuffer->handle());
+    m_errorMonitor->VerifyFound();
+
+    // The failed vkEndCommandBuffer did not reach the driver, so the command buffer is still recording
+    m_commandBuffer->reset();
+    vk::DestroyEvent(m_device->device(), other_event, NULL);
+}
+
 TEST_F(VkLayerTest, InvalidCmdBufferQueryPoolDestroyed) {
     TEST_DESCRIPTION("Attempt to draw with a command buffer that is invalid due to a query pool dependency being destroyed.");
     ASSERT_NO_FATAL_FAILURE(Init());
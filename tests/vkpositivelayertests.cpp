@@ -26,6 +26,9 @@
 
 #include "cast_utils.h"
 #include "layer_validation_tests.h"
+
+#include <chrono>
+#include <thread>
 //
 // POSITIVE VALIDATION TESTS
 //
@@ -1673,6 +1676,33 @@ TEST_F(VkPositiveLayerTest, StatelessValidationDisable) {
     m_errorMonitor->VerifyNotFound();
 }
 
+TEST_F(VkPositiveLayerTest, DestroyUnusedObjectWhileRecording) {
+    TEST_DESCRIPTION("Destroy an event the command buffer being recorded does not use, then end and submit the command buffer.");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+    m_errorMonitor->ExpectSuccess();
+
+    VkEvent event;
+    VkEvent unused_event;
+    VkEventCreateInfo event_info = {};
+    event_info.sType = VK_STRUCTURE_TYPE_EVENT_CREATE_INFO;
+    vk::CreateEvent(m_device->device(), &event_info, nullptr, &event);
+    vk::CreateEvent(m_device->device(), &event_info, nullptr, &unused_event);
+
+    m_commandBuffer->begin();
+    vk::CmdSetEvent(m_commandBuffer->handle(), event, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT);
+    // Any destruction makes the command buffer look its bound objects up again; the event it uses must still be found
+    vk::DestroyEvent(m_device->device(), unused_event, nullptr);
+    vk::CmdResetEvent(m_commandBuffer->handle(), event, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT);
+    m_commandBuffer->end();
+
+    m_commandBuffer->QueueCommandBuffer();
+    vk::QueueWaitIdle(m_device->m_queue);
+
+    vk::DestroyEvent(m_device->device(), event, nullptr);
+    m_errorMonitor->VerifyNotFound();
+}
+
 TEST_F(VkPositiveLayerTest, PointSizeWriteInFunction) {
     TEST_DESCRIPTION("Create a pipeline using TOPOLOGY_POINT_LIST and write PointSize in vertex shader function.");
 
@@ -3207,6 +3237,93 @@ TEST_F(VkPositiveLayerTest, NonCoherentMemoryMapping) {
     vk::FreeMemory(m_device->device(), mem, NULL);
 }
 
+TEST_F(VkPositiveLayerTest, NonCoherentMemoryFlushReachesDriver) {
+    TEST_DESCRIPTION(
+        "Flush subranges of non-coherent memory mapped at an offset, and check through a device copy that the flushed data "
+        "reached the driver's mapping at the right place.");
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    const VkDeviceSize atom_size = m_device->props.limits.nonCoherentAtomSize;
+    const VkDeviceSize buffer_size = 16 * atom_size;
+    vk_testing::DeviceMemory mem;  // Outlives the buffer bound to it
+    VkBufferObj src_buffer;
+    src_buffer.init_no_mem(*m_device, VkBufferObj::create_info(buffer_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT));
+    const VkMemoryRequirements mem_reqs = src_buffer.memory_requirements();
+    VkMemoryAllocateInfo alloc_info = vk_testing::DeviceMemory::alloc_info(mem_reqs.size, 0);
+    if (!m_device->phy().set_memory_type(mem_reqs.memoryTypeBits, &alloc_info, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                                         VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)) {
+        printf("%s Couldn't find a memory type without a COHERENT bit.\n", kSkipPrefix);
+        return;
+    }
+    mem.init(*m_device, alloc_info);
+    src_buffer.bind_memory(mem, 0);
+
+    VkMemoryPropertyFlags dst_props = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    VkBufferObj dst_buffer;
+    dst_buffer.init_as_dst(*m_device, buffer_size, dst_props);
+
+    // Distinct neighbouring bytes, so that data landing at the wrong offset doesn't compare equal
+    auto pattern = [](VkDeviceSize offset) { return static_cast<uint8_t>(offset * 7 + 1); };
+
+    // Copies src_buffer[src_offset, src_offset + size) to the start of dst_buffer and checks it against the pattern written at
+    // mapped_offset
+    auto check_copy = [&](VkDeviceSize src_offset, VkDeviceSize size, VkDeviceSize mapped_offset) {
+        m_commandBuffer->begin();
+        VkBufferCopy region = {src_offset, 0, size};
+        vk::CmdCopyBuffer(m_commandBuffer->handle(), src_buffer.handle(), dst_buffer.handle(), 1, &region);
+        VkMemoryBarrier barrier = {};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+        vk::CmdPipelineBarrier(m_commandBuffer->handle(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 1,
+                               &barrier, 0, nullptr, 0, nullptr);
+        m_commandBuffer->end();
+        m_commandBuffer->QueueCommandBuffer();
+
+        const uint8_t *copied = static_cast<const uint8_t *>(dst_buffer.memory().map());
+        for (VkDeviceSize i = 0; i < size; ++i) {
+            ASSERT_EQ(pattern(mapped_offset + i), copied[i]) << "at byte " << i << " of the flushed range";
+        }
+        dst_buffer.memory().unmap();
+    };
+
+    m_errorMonitor->ExpectSuccess();
+
+    // Map with an offset and size, and flush a subrange that starts past the start of the mapping
+    {
+        uint8_t *data = nullptr;
+        ASSERT_VK_SUCCESS(vk::MapMemory(m_device->device(), mem.handle(), 2 * atom_size, 8 * atom_size, 0,
+                                        reinterpret_cast<void **>(&data)));
+        for (VkDeviceSize i = 0; i < 8 * atom_size; ++i) data[i] = pattern(i);
+        VkMappedMemoryRange range = {};
+        range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        range.memory = mem.handle();
+        range.offset = 4 * atom_size;
+        range.size = 2 * atom_size;
+        ASSERT_VK_SUCCESS(vk::FlushMappedMemoryRanges(m_device->device(), 1, &range));
+        vk::UnmapMemory(m_device->device(), mem.handle());
+        check_copy(4 * atom_size, 2 * atom_size, 2 * atom_size);
+    }
+
+    // Map VK_WHOLE_SIZE with an offset, and flush VK_WHOLE_SIZE from a later offset
+    {
+        uint8_t *data = nullptr;
+        ASSERT_VK_SUCCESS(
+            vk::MapMemory(m_device->device(), mem.handle(), 5 * atom_size, VK_WHOLE_SIZE, 0, reinterpret_cast<void **>(&data)));
+        for (VkDeviceSize i = 0; i < alloc_info.allocationSize - 5 * atom_size; ++i) data[i] = pattern(i);
+        VkMappedMemoryRange range = {};
+        range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        range.memory = mem.handle();
+        range.offset = 6 * atom_size;
+        range.size = VK_WHOLE_SIZE;
+        ASSERT_VK_SUCCESS(vk::FlushMappedMemoryRanges(m_device->device(), 1, &range));
+        vk::UnmapMemory(m_device->device(), mem.handle());
+        check_copy(6 * atom_size, buffer_size - 6 * atom_size, atom_size);
+    }
+
+    m_errorMonitor->VerifyNotFound();
+}
+
 // This is a positive test. We used to expect error in this case but spec now allows it
 TEST_F(VkPositiveLayerTest, ResetUnsignaledFence) {
     m_errorMonitor->ExpectSuccess();
@@ -9185,3 +9302,83 @@ TEST_F(VkPositiveLayerTest, CreatePipelineSpecializeInt64) {
 
     m_errorMonitor->VerifyNotFound();
 }
+
+TEST_F(VkPositiveLayerTest, QueueRetirementThreadRetiresWithoutWait) {
+    TEST_DESCRIPTION(
+        "With khronos_validation.queue_retirement_thread, submit a command buffer and check that it stops being in use once it "
+        "completes, without the application waiting on a fence or the queue.");
+    ASSERT_NO_FATAL_FAILURE(InitFramework(myDbgFunc, m_errorMonitor));
+    ScopedLayerOption retirement_thread("khronos_validation.queue_retirement_thread", "true");
+    if (!retirement_thread.Supported()) {
+        printf("%s Couldn't set layer options in the loaded layer, skipping test.\n", kSkipPrefix);
+        return;
+    }
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->begin();
+    m_commandBuffer->end();
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &m_commandBuffer->handle();
+    ASSERT_VK_SUCCESS(vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE));
+    m_errorMonitor->VerifyNotFound();
+
+    // Beginning the command buffer again is an error until the submission is retired; the layer skips the call when it reports
+    // it, so probing leaves the command buffer untouched until it succeeds.
+    VkCommandBufferBeginInfo begin_info = {};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    bool retired = false;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!retired && std::chrono::steady_clock::now() < deadline) {
+        m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "VUID-vkBeginCommandBuffer-commandBuffer-00049");
+        vk::BeginCommandBuffer(m_commandBuffer->handle(), &begin_info);
+        retired = !m_errorMonitor->AnyDesiredMsgFound();
+        m_errorMonitor->Reset();
+        if (!retired) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_TRUE(retired) << "the submission was not retired within 10 seconds";
+
+    m_errorMonitor->ExpectSuccess();
+    vk::EndCommandBuffer(m_commandBuffer->handle());
+    ASSERT_VK_SUCCESS(vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE));
+    vk::QueueWaitIdle(m_device->m_queue);
+    m_errorMonitor->VerifyNotFound();
+}
+
+TEST_F(VkPositiveLayerTest, QueueRetirementThreadDeviceDestroyWhilePending) {
+    TEST_DESCRIPTION(
+        "With khronos_validation.queue_retirement_thread, destroy the device straight after the application's own wait, while "
+        "the retirement thread still holds fences it has not seen signal.");
+    ASSERT_NO_FATAL_FAILURE(InitFramework(myDbgFunc, m_errorMonitor));
+    ScopedLayerOption retirement_thread("khronos_validation.queue_retirement_thread", "true");
+    if (!retirement_thread.Supported()) {
+        printf("%s Couldn't set layer options in the loaded layer, skipping test.\n", kSkipPrefix);
+        return;
+    }
+
+    // A device of the test's own, so that it is destroyed here rather than in teardown
+    VkDeviceObj *device = new VkDeviceObj(0, gpu(), m_device_extension_names);
+    VkQueue queue = device->GetDefaultQueue()->handle();
+
+    m_errorMonitor->ExpectSuccess();
+    {
+        VkCommandPoolObj command_pool(device, device->graphics_queue_node_index_);
+        const uint32_t kSubmissionCount = 64;
+        std::vector<std::unique_ptr<VkCommandBufferObj>> command_buffers;
+        for (uint32_t i = 0; i < kSubmissionCount; ++i) {
+            command_buffers.emplace_back(new VkCommandBufferObj(device, &command_pool));
+            command_buffers.back()->begin();
+            command_buffers.back()->end();
+            VkSubmitInfo submit_info = {};
+            submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submit_info.commandBufferCount = 1;
+            submit_info.pCommandBuffers = &command_buffers.back()->handle();
+            ASSERT_VK_SUCCESS(vk::QueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE));
+        }
+        vk::QueueWaitIdle(queue);
+    }
+    delete device;
+    m_errorMonitor->VerifyNotFound();
+}